@@ -0,0 +1,84 @@
+# Build the native API benchmark (src\Native\Benchmark) using Visual Studio compiler directly
+param(
+    [string]$Configuration = "Release"
+)
+
+Write-Host "=== Building UnrealLiveLink Native Benchmark ===" -ForegroundColor Green
+Write-Host "Configuration: $Configuration"
+
+# Setup paths
+$RepoRoot = Split-Path $PSScriptRoot -Parent
+$BenchmarkSrcDir = Join-Path $RepoRoot "src\Native\Benchmark"
+$BuildDir = Join-Path $RepoRoot "build\temp\benchmark"
+
+# Ensure directories exist
+New-Item -ItemType Directory -Path $BuildDir -Force | Out-Null
+
+# Find Visual Studio 2022 Build Tools
+$VSPath = "C:\Program Files (x86)\Microsoft Visual Studio\2022\BuildTools"
+if (-not (Test-Path $VSPath)) {
+    $VSPath = "C:\Program Files\Microsoft Visual Studio\2022\BuildTools"
+}
+if (-not (Test-Path $VSPath)) {
+    Write-Error "Visual Studio 2022 Build Tools not found"
+    exit 1
+}
+
+# Setup Visual Studio environment
+$VCVarsPath = Join-Path $VSPath "VC\Auxiliary\Build\vcvars64.bat"
+if (-not (Test-Path $VCVarsPath)) {
+    Write-Error "vcvars64.bat not found at: $VCVarsPath"
+    exit 1
+}
+
+Write-Host "Using Visual Studio at: $VSPath"
+Write-Host "Setting up build environment..."
+
+# Create a temporary batch file to setup environment and compile
+$TempBat = Join-Path $BuildDir "build.bat"
+$BenchmarkCpp = Join-Path $BenchmarkSrcDir "UnrealLiveLinkBenchmark.cpp"
+$OutputExe = Join-Path $BuildDir "UnrealLiveLinkBenchmark.exe"
+
+if ($Configuration -eq "Debug") {
+    $CompilerFlags = "/Od /Zi /MDd /EHsc /std:c++17"
+} else {
+    $CompilerFlags = "/O2 /MD /DNDEBUG /EHsc /std:c++17"
+}
+
+$BatchContent = @"
+@echo off
+call "$VCVarsPath"
+echo Compiling UnrealLiveLinkBenchmark.cpp...
+cl.exe $CompilerFlags "$BenchmarkCpp" /Fe:"$OutputExe" psapi.lib
+if %ERRORLEVEL% NEQ 0 (
+    echo Build failed!
+    exit /b 1
+)
+echo Build completed successfully!
+exit /b 0
+"@
+
+Write-Output $BatchContent | Out-File -FilePath $TempBat -Encoding ASCII
+
+# Execute the build
+Write-Host "Compiling..."
+$Process = Start-Process -FilePath "cmd.exe" -ArgumentList "/c", "`"$TempBat`"" -WorkingDirectory $BuildDir -Wait -PassThru -NoNewWindow
+
+if ($Process.ExitCode -eq 0) {
+    Write-Host "Build SUCCESS!" -ForegroundColor Green
+
+    if (Test-Path $OutputExe) {
+        $FileInfo = Get-Item $OutputExe
+        Write-Host "Benchmark created: $OutputExe" -ForegroundColor Green
+        Write-Host "Size: $($FileInfo.Length) bytes"
+    }
+} else {
+    Write-Host "Build FAILED with exit code: $($Process.ExitCode)" -ForegroundColor Red
+    exit 1
+}
+
+# Cleanup
+Remove-Item $TempBat -ErrorAction SilentlyContinue
+
+Write-Host "Usage: $OutputExe --dll lib\native\win-x64\UnrealLiveLink.Native.dll [--subjects N] [--properties N] [--rate Hz] [--threads N]"
+exit 0
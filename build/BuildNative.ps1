@@ -1,13 +1,19 @@
 ﻿# Build Native UnrealLiveLink.Native DLL using Unreal Build Tool
+# -Flavor Production builds the UnrealLiveLinkNativeProduction target: per-frame logging compiled
+# out, full optimization. Output goes to lib\native\win-x64\Production (same DLL name, so
+# P/Invoke is unchanged) with a BuildInfo.txt identifying the flavor.
 param(
     [string]$Configuration = "Development",
     [string]$Platform = "Win64",
-    [string]$UEPath = ""
+    [string]$UEPath = "",
+    [ValidateSet("Development", "Production")]
+    [string]$Flavor = "Development"
 )
 
 Write-Host "=== Building Native UnrealLiveLink DLL with UBT ===" -ForegroundColor Green
 Write-Host "Configuration: $Configuration"
 Write-Host "Platform: $Platform"
+Write-Host "Flavor: $Flavor"
 
 # Auto-detect UE installation if not provided
 if ([string]::IsNullOrEmpty($UEPath)) {
@@ -45,9 +51,13 @@ $NativeSourceDir = Join-Path $RepoRoot "src\Native\UnrealLiveLink.Native"
 $UEProgramsDir = Join-Path $UEPath "Engine\Source\Programs"
 $UETargetDir = Join-Path $UEProgramsDir "UnrealLiveLinkNative"
 $UEBinariesDir = Join-Path $UEPath "Engine\Binaries\$Platform"
-$OutputDll = Join-Path $UEBinariesDir "UnrealLiveLinkNative.dll"
-$OutputExe = Join-Path $UEBinariesDir "UnrealLiveLinkNative.exe"
+$TargetName = if ($Flavor -eq "Production") { "UnrealLiveLinkNativeProduction" } else { "UnrealLiveLinkNative" }
+$OutputDll = Join-Path $UEBinariesDir "$TargetName.dll"
+$OutputExe = Join-Path $UEBinariesDir "$TargetName.exe"
 $RepoOutputDir = Join-Path $RepoRoot "lib\native\win-x64"
+if ($Flavor -eq "Production") {
+    $RepoOutputDir = Join-Path $RepoOutputDir "Production"
+}
 
 # Verify prerequisites
 if (-not (Test-Path $UEPath)) {
@@ -113,7 +123,7 @@ if ($IsSourceBuild) {
 Write-Host "Building with UnrealBuildTool..." -ForegroundColor Yellow
 
 $UBTArgs = @(
-    "UnrealLiveLinkNative"
+    $TargetName
     $Platform
     $Configuration
 )
@@ -210,11 +220,26 @@ if ($OutputType -eq "DLL") {
     }
 }
 
+# Stamp the output so deployed DLLs can be told apart
+$GitCommit = (& git -C $RepoRoot rev-parse --short HEAD 2>$null)
+if ([string]::IsNullOrEmpty($GitCommit)) { $GitCommit = "unknown" }
+$BuildInfo = @(
+    "Flavor=$Flavor"
+    "Target=$TargetName"
+    "Configuration=$Configuration"
+    "Platform=$Platform"
+    "Commit=$GitCommit"
+    "Built=$(Get-Date -Format 'yyyy-MM-ddTHH:mm:ss')"
+)
+Set-Content -Path (Join-Path $RepoOutputDir "BuildInfo.txt") -Value $BuildInfo
+Write-Host "  Wrote BuildInfo.txt ($Flavor, $GitCommit)" -ForegroundColor Gray
+
 # Display build results
 $OutputInfo = Get-Item $TargetRepoPath
 Write-Host ""
 Write-Host "≡ƒÄë BUILD SUCCESS!" -ForegroundColor Green
 Write-Host "Output Type: $OutputType" -ForegroundColor Green
+Write-Host "Flavor: $Flavor" -ForegroundColor Green
 Write-Host "Output File: $($OutputInfo.FullName)" -ForegroundColor Green
 Write-Host "Size: $($OutputInfo.Length) bytes ($([math]::Round($OutputInfo.Length / 1MB, 2)) MB)"
 Write-Host "Modified: $($OutputInfo.LastWriteTime)"
@@ -144,17 +144,23 @@ Write-Host "──────────────────────
 # Temporary build directories
 Remove-DirectorySafe -Path (Join-Path $ProjectRoot "build\temp") -Description "Build temp folder"
 
-# Simio test logs (can be regenerated)
-$SimioLogPath = Join-Path $ProjectRoot "tests\Simio.Tests\SimioUnrealLiveLink_Mock.log"
-if (Test-Path $SimioLogPath) {
-    Write-Host "Removing Simio test log..." -ForegroundColor Yellow
-    try {
-        Remove-Item $SimioLogPath -Force -ErrorAction Stop
-        Write-Host "  ✅ Removed: SimioUnrealLiveLink_Mock.log" -ForegroundColor Green
-        $DeletedCount++
-    } catch {
-        Write-Host "  ❌ Failed: $($_.Exception.Message)" -ForegroundColor Red
-        $ErrorCount++
+# Simio test logs (can be regenerated) - mock default location and the one used by older mock builds
+$SimioLogPaths = @(
+    (Join-Path $env:TEMP "SimioUnrealLiveLink_Mock.log"),
+    (Join-Path $env:TEMP "SimioUnrealLiveLink_Mock.log.bin"),
+    (Join-Path $ProjectRoot "tests\Simio.Tests\SimioUnrealLiveLink_Mock.log")
+)
+foreach ($SimioLogPath in $SimioLogPaths) {
+    if (Test-Path $SimioLogPath) {
+        Write-Host "Removing Simio test log..." -ForegroundColor Yellow
+        try {
+            Remove-Item $SimioLogPath -Force -ErrorAction Stop
+            Write-Host "  ✅ Removed: $(Split-Path $SimioLogPath -Leaf)" -ForegroundColor Green
+            $DeletedCount++
+        } catch {
+            Write-Host "  ❌ Failed: $($_.Exception.Message)" -ForegroundColor Red
+            $ErrorCount++
+        }
     }
 }
 
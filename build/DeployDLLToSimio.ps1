@@ -2,9 +2,12 @@
 # Deploy both managed and native DLLs to Simio for Unreal Engine LiveLink testing
 # This deploys the REAL Unreal Engine native DLL (~29 MB) for full LiveLink connectivity
 # For development/testing without UE, use: DeployMockDLLToSimio.ps1
+# -Flavor Production deploys the build from BuildNative.ps1 -Flavor Production
 
 param(
     [string]$Configuration = "Release",
+    [ValidateSet("Development", "Production")]
+    [string]$Flavor = "Development",
     [string]$UEPath = "",
     [switch]$Force = $false,
     [switch]$Verbose = $false
@@ -14,10 +17,15 @@ param(
 $ScriptDir = Split-Path -Parent $MyInvocation.MyCommand.Definition
 $ProjectRoot = Split-Path -Parent $ScriptDir
 $ManagedDLLSource = Join-Path $ProjectRoot "src\Managed\bin\$Configuration\net48\SimioUnrealEngineLiveLinkConnector.dll"
-$NativeDLLSource = Join-Path $ProjectRoot "lib\native\win-x64\UnrealLiveLink.Native.dll"
+$NativeDLLDir = Join-Path $ProjectRoot "lib\native\win-x64"
+if ($Flavor -eq "Production") {
+    $NativeDLLDir = Join-Path $NativeDLLDir "Production"
+}
+$NativeDLLSource = Join-Path $NativeDLLDir "UnrealLiveLink.Native.dll"
 
 Write-Host "=== Deploy Managed + Native DLLs to Simio ===" -ForegroundColor Cyan
 Write-Host "Configuration: $Configuration" -ForegroundColor Yellow
+Write-Host "Native Flavor: $Flavor" -ForegroundColor Yellow
 Write-Host ""
 
 # Auto-detect UE installation if not provided
@@ -96,7 +104,7 @@ Write-Host ""
 # Verify native DLL exists and is the real one (not mock)
 if (!(Test-Path $NativeDLLSource)) {
     Write-Error "Native DLL not found: $NativeDLLSource"
-    Write-Host "Please run build\BuildNative.ps1 first to build the native DLL." -ForegroundColor Red
+    Write-Host "Please run build\BuildNative.ps1 -Flavor $Flavor first to build the native DLL." -ForegroundColor Red
     exit 1
 }
 
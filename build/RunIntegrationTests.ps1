@@ -5,7 +5,8 @@
 param(
     [string]$Configuration = "Debug",
     [switch]$NoBuild,
-    [switch]$Verbose
+    [switch]$Verbose,
+    [string]$LatencyCsv = ""
 )
 
 $ErrorActionPreference = "Stop"
@@ -128,6 +129,15 @@ if (Test-Path $UEBinPath) {
     Write-Host "   Tests may fail if UE dependencies are not available" -ForegroundColor Yellow
 }
 
+# Latency probe CSV kept for comparison across releases (see LatencyProbe_ShouldStampStagesAndWriteCsv)
+if ($LatencyCsv) {
+    $LatencyCsv = [System.IO.Path]::GetFullPath($LatencyCsv)
+    $env:ULL_LATENCY_CSV = $LatencyCsv
+    Write-Host "✅ Latency probe CSV: $LatencyCsv (echo port 6670; start Unreal with Simio.LatencyProbe.EchoPort 6670 for receipt times)" -ForegroundColor Green
+} else {
+    Remove-Item Env:ULL_LATENCY_CSV -ErrorAction SilentlyContinue
+}
+
 # Run tests with InIsolation flag to prevent DLL locking
 Write-Host "`nRunning integration tests..." -ForegroundColor Yellow
 Write-Host "================================================================" -ForegroundColor Cyan
@@ -175,5 +185,8 @@ Write-Host "`nTest Summary:" -ForegroundColor Yellow
 Write-Host "  Project: Integration.Tests" -ForegroundColor White
 Write-Host "  Configuration: $Configuration" -ForegroundColor White
 Write-Host "  Native DLL: $($DllInfo.Name) ($($DllInfo.Length) bytes)" -ForegroundColor White
+if ($LatencyCsv) {
+    Write-Host "  Latency CSV: $LatencyCsv" -ForegroundColor White
+}
 
 exit $TestExitCode
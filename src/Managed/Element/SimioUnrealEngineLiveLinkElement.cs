@@ -1,4 +1,5 @@
 using System;
+using System.Linq;
 using SimioAPI;
 using SimioAPI.Extensions;
 using SimioUnrealEngineLiveLinkConnector.UnrealIntegration;
@@ -15,6 +16,12 @@ namespace SimioUnrealEngineLiveLinkConnector.Element
     {
         private readonly IElementData _elementData;
         private readonly LiveLinkConfiguration _configuration;
+        private readonly string[] _prewarmObjectNames;
+        private readonly string _captureFilePath;
+        private readonly string _latencyProbeCsvPath;
+
+        // Probes per second of the element's latency probe (a light load next to a model's subjects)
+        private const int LatencyProbeRateHz = 10;
 
         public SimioUnrealEngineLiveLinkElement(IElementData elementData)
         {
@@ -22,6 +29,13 @@ namespace SimioUnrealEngineLiveLinkConnector.Element
             
             // Read ALL 7 essential properties with validation
             _configuration = ReadAndValidateProperties(elementData);
+            _prewarmObjectNames = ReadStringProperty("PrewarmObjectNames", elementData, string.Empty)
+                .Split(new[] { ',', ';' }, StringSplitOptions.RemoveEmptyEntries)
+                .Select(name => name.Trim())
+                .Where(name => name.Length > 0)
+                .ToArray();
+            _captureFilePath = ReadStringProperty("CaptureFilePath", elementData, string.Empty).Trim();
+            _latencyProbeCsvPath = ReadStringProperty("LatencyProbeCsvPath", elementData, string.Empty).Trim();
         }
 
         /// <summary>
@@ -34,12 +48,52 @@ namespace SimioUnrealEngineLiveLinkConnector.Element
             // Read properties with defaults
             string sourceName = ReadStringProperty("SourceName", elementData, "SimioSimulation");
             bool enableLogging = ReadBooleanProperty("EnableLogging", elementData, false);
+            int pumpRateHz = ReadIntegerProperty("MessageBusPumpRateHz", elementData, LiveLinkConfiguration.DefaultMessageBusPumpRateHz);
+            bool useSharedMemory = ReadBooleanProperty("UseSharedMemoryTransport", elementData, false);
+            int sharedMemoryCapacity = ReadIntegerProperty("SharedMemoryCapacity", elementData, LiveLinkConfiguration.DefaultSharedMemoryCapacity);
+            bool asyncSendMode = ReadBooleanProperty("AsyncSendMode", elementData, false);
+            int queueDepth = ReadIntegerProperty("QueueDepth", elementData, LiveLinkConfiguration.DefaultQueueDepth);
+            bool dropWhenQueueFull = ReadBooleanProperty("DropFramesWhenQueueFull", elementData, true);
+            int publishRateHz = ReadIntegerProperty("PublishRateHz", elementData, 0);
+            bool enableDeadband = ReadBooleanProperty("EnableDeadband", elementData, false);
+            double positionDeadband = ReadRealProperty("PositionDeadband", elementData, 0.1);
+            double rotationDeadband = ReadRealProperty("RotationDeadband", elementData, 0.1);
+            double propertyDeadband = ReadRealProperty("PropertyDeadband", elementData, 0.0);
+            int keepAliveIntervalMs = ReadIntegerProperty("KeepAliveIntervalMs", elementData, LiveLinkConfiguration.DefaultKeepAliveIntervalMs);
+            bool useSimulationTime = ReadBooleanProperty("UseSimulationTime", elementData, false);
+            double simulationTimeScale = ReadRealProperty("SimulationTimeScale", elementData, 1.0);
+            int subjectPoolSize = ReadIntegerProperty("SubjectPoolSize", elementData, 0);
+            int publishFrameBudget = ReadIntegerProperty("PublishFrameBudget", elementData, 0);
+            int publishByteBudget = ReadIntegerProperty("PublishByteBudget", elementData, 0);
+            bool asyncInitialization = ReadBooleanProperty("AsyncInitialization", elementData, false);
+            bool deferredUpdates = ReadBooleanProperty("DeferredUpdates", elementData, false);
+            int deferredFlushRateHz = ReadIntegerProperty("DeferredFlushRateHz", elementData, 0);
 
             // Validate and create configuration
             var config = new LiveLinkConfiguration
             {
                 SourceName = sourceName,
-                EnableLogging = enableLogging
+                EnableLogging = enableLogging,
+                SendMode = asyncSendMode ? LiveLinkSendMode.Asynchronous : LiveLinkSendMode.Synchronous,
+                QueueDepth = queueDepth,
+                QueuePolicy = dropWhenQueueFull ? LiveLinkQueuePolicy.DropOldest : LiveLinkQueuePolicy.Block,
+                PublishRateHz = publishRateHz,
+                EnableDeadband = enableDeadband,
+                PositionDeadband = positionDeadband,
+                RotationDeadbandDegrees = rotationDeadband,
+                PropertyDeadband = propertyDeadband,
+                KeepAliveIntervalMs = keepAliveIntervalMs,
+                MessageBusPumpRateHz = pumpRateHz,
+                Transport = useSharedMemory ? LiveLinkTransport.SharedMemory : LiveLinkTransport.MessageBus,
+                SharedMemoryCapacity = sharedMemoryCapacity,
+                UseSimulationTime = useSimulationTime,
+                SimulationTimeScale = simulationTimeScale,
+                SubjectPoolSize = subjectPoolSize,
+                PublishFrameBudget = publishFrameBudget,
+                PublishByteBudget = publishByteBudget,
+                AsyncInitialization = asyncInitialization,
+                DeferredUpdates = deferredUpdates,
+                DeferredFlushRateHz = deferredFlushRateHz
             };
 
             return config;
@@ -163,11 +217,45 @@ namespace SimioUnrealEngineLiveLinkConnector.Element
             try
             {
                 // Initialize the LiveLink connection via the singleton manager
-                LiveLinkManager.Instance.Initialize(_configuration);
+                LiveLinkManager.Instance.Initialize(_configuration, _prewarmObjectNames);
                 
                 // Report successful initialization with Message Bus discovery info
                 _elementData.ExecutionContext.ExecutionInformation.TraceInformation(
                     $"LiveLink Message Bus provider '{_configuration.SourceName}' initialized (UDP multicast auto-discovery).");
+
+                if (_prewarmObjectNames.Length > 0)
+                {
+                    _elementData.ExecutionContext.ExecutionInformation.TraceInformation(
+                        $"LiveLink pre-registered {LiveLinkManager.Instance.ObjectCount} of {_prewarmObjectNames.Length} known objects.");
+                }
+
+                if (_captureFilePath.Length > 0)
+                {
+                    if (LiveLinkManager.Instance.StartCapture(_captureFilePath))
+                    {
+                        _elementData.ExecutionContext.ExecutionInformation.TraceInformation(
+                            $"LiveLink capturing frames to '{_captureFilePath}'.");
+                    }
+                    else
+                    {
+                        _elementData.ExecutionContext.ExecutionInformation.ReportError(
+                            $"LiveLink capture to '{_captureFilePath}' could not be started (check the path; capture is not available with the shared memory transport).");
+                    }
+                }
+
+                if (_latencyProbeCsvPath.Length > 0)
+                {
+                    if (LiveLinkManager.Instance.StartLatencyProbe(LatencyProbeRateHz, UnrealLiveLinkNative.ULL_LATENCY_ECHO_DEFAULT_PORT, _latencyProbeCsvPath))
+                    {
+                        _elementData.ExecutionContext.ExecutionInformation.TraceInformation(
+                            $"LiveLink latency probe writing to '{_latencyProbeCsvPath}' (echo port {UnrealLiveLinkNative.ULL_LATENCY_ECHO_DEFAULT_PORT}).");
+                    }
+                    else
+                    {
+                        _elementData.ExecutionContext.ExecutionInformation.ReportError(
+                            $"LiveLink latency probe to '{_latencyProbeCsvPath}' could not be started (check the path and that the echo port is free; the probe is not available with the shared memory transport or subject pools).");
+                    }
+                }
             }
             catch (Exception ex)
             {
@@ -30,11 +30,127 @@ namespace SimioUnrealEngineLiveLinkConnector.Element
             sourceNameProperty.Description = "Name displayed in Unreal Engine's LiveLink Sources window.";
             sourceNameProperty.CategoryName = "LiveLink Connection";
 
+            var pumpRateProperty = schema.PropertyDefinitions.AddExpressionProperty("MessageBusPumpRateHz", "60");
+            pumpRateProperty.DisplayName = "Message Bus Pump Rate (Hz)";
+            pumpRateProperty.Description = "How often the connector services Message Bus discovery and heartbeats on its own thread. 0 disables the pump thread.";
+            pumpRateProperty.CategoryName = "LiveLink Connection";
+
+            var sharedMemoryProperty = schema.PropertyDefinitions.AddExpressionProperty("UseSharedMemoryTransport", "False");
+            sharedMemoryProperty.DisplayName = "Use Shared Memory Transport";
+            sharedMemoryProperty.Description = "Send object positions through shared memory instead of the Message Bus when Unreal runs on the same machine. Requires the SimioLiveLinkSharedMemory plugin in the Unreal project (add the source from its LiveLink window). Data tables still use the Message Bus.";
+            sharedMemoryProperty.CategoryName = "LiveLink Connection";
+
+            var sharedMemoryCapacityProperty = schema.PropertyDefinitions.AddExpressionProperty("SharedMemoryCapacity", "16384");
+            sharedMemoryCapacityProperty.DisplayName = "Shared Memory Capacity";
+            sharedMemoryCapacityProperty.Description = "Maximum number of objects in the shared memory table (1 to 1048576). Objects beyond it are not streamed.";
+            sharedMemoryCapacityProperty.CategoryName = "LiveLink Connection";
+
             // === Logging Category ===
             var enableLoggingProperty = schema.PropertyDefinitions.AddExpressionProperty("EnableLogging", "True");
             enableLoggingProperty.DisplayName = "Enable Logging";
             enableLoggingProperty.Description = "Enable or disable detailed native logging for troubleshooting. View logs using DebugView++ (https://github.com/CobaltFusion/DebugViewPP).";
             enableLoggingProperty.CategoryName = "Logging";
+
+            var captureFilePathProperty = schema.PropertyDefinitions.AddStringProperty("CaptureFilePath", "");
+            captureFilePathProperty.DisplayName = "Capture File Path";
+            captureFilePathProperty.Description = "Record every frame sent to Unreal during the run to this file (overwritten each run, empty = off). The capture can be replayed into Unreal later without Simio, at real time or faster, with pause and seek. Not available with the shared memory transport.";
+            captureFilePathProperty.CategoryName = "Logging";
+
+            var latencyProbeCsvPathProperty = schema.PropertyDefinitions.AddStringProperty("LatencyProbeCsvPath", "");
+            latencyProbeCsvPathProperty.DisplayName = "Latency Probe CSV Path";
+            latencyProbeCsvPathProperty.Description = "Send a reserved probe subject (SimioLatencyProbe) 10 times per second and write its per-stage latency percentiles to this CSV file once per second (overwritten each run, empty = off). Receipt and total latency need the echo of the SimioLiveLinkSharedMemory plugin (console variable Simio.LatencyProbe.EchoPort 6670). Not available with the shared memory transport or subject pools.";
+            latencyProbeCsvPathProperty.CategoryName = "Logging";
+
+            // === Performance Category ===
+            var asyncSendModeProperty = schema.PropertyDefinitions.AddExpressionProperty("AsyncSendMode", "False");
+            asyncSendModeProperty.DisplayName = "Async Send Mode";
+            asyncSendModeProperty.Description = "Queue frames and send them to Unreal on a dedicated native thread so simulation steps never wait on the network. Takes effect at initialization.";
+            asyncSendModeProperty.CategoryName = "Performance";
+
+            var queueDepthProperty = schema.PropertyDefinitions.AddExpressionProperty("QueueDepth", "4096");
+            queueDepthProperty.DisplayName = "Queue Depth";
+            queueDepthProperty.Description = "Maximum number of frames waiting to be sent in async send mode (16 to 1048576).";
+            queueDepthProperty.CategoryName = "Performance";
+
+            var dropWhenQueueFullProperty = schema.PropertyDefinitions.AddExpressionProperty("DropFramesWhenQueueFull", "True");
+            dropWhenQueueFullProperty.DisplayName = "Drop Frames When Queue Full";
+            dropWhenQueueFullProperty.Description = "When the async send queue is full, discard the oldest frame (True) or make the simulation wait for space (False).";
+            dropWhenQueueFullProperty.CategoryName = "Performance";
+
+            var publishRateProperty = schema.PropertyDefinitions.AddExpressionProperty("PublishRateHz", "0");
+            publishRateProperty.DisplayName = "Publish Rate (Hz)";
+            publishRateProperty.Description = "When greater than 0, only the latest position of each object is sent, at this rate (e.g. 30 or 60). Use when running faster than real time. 0 sends every update immediately.";
+            publishRateProperty.CategoryName = "Performance";
+
+            var enableDeadbandProperty = schema.PropertyDefinitions.AddExpressionProperty("EnableDeadband", "False");
+            enableDeadbandProperty.DisplayName = "Skip Unchanged Updates";
+            enableDeadbandProperty.Description = "Do not resend an object whose position, rotation and property values changed less than the deadband thresholds since it was last sent.";
+            enableDeadbandProperty.CategoryName = "Performance";
+
+            var positionDeadbandProperty = schema.PropertyDefinitions.AddExpressionProperty("PositionDeadband", "0.1");
+            positionDeadbandProperty.DisplayName = "Position Deadband (cm)";
+            positionDeadbandProperty.Description = "Position change in Unreal centimeters below which an update is skipped.";
+            positionDeadbandProperty.CategoryName = "Performance";
+
+            var rotationDeadbandProperty = schema.PropertyDefinitions.AddExpressionProperty("RotationDeadband", "0.1");
+            rotationDeadbandProperty.DisplayName = "Rotation Deadband (deg)";
+            rotationDeadbandProperty.Description = "Rotation change in degrees below which an update is skipped.";
+            rotationDeadbandProperty.CategoryName = "Performance";
+
+            var propertyDeadbandProperty = schema.PropertyDefinitions.AddExpressionProperty("PropertyDeadband", "0");
+            propertyDeadbandProperty.DisplayName = "Property Deadband";
+            propertyDeadbandProperty.Description = "Change in any property value below which an update is skipped (0 = any change is sent).";
+            propertyDeadbandProperty.CategoryName = "Performance";
+
+            var keepAliveProperty = schema.PropertyDefinitions.AddExpressionProperty("KeepAliveIntervalMs", "1000");
+            keepAliveProperty.DisplayName = "Keep Alive Interval (ms)";
+            keepAliveProperty.Description = "Unchanged objects are still resent after this many milliseconds so Unreal does not mark them stale.";
+            keepAliveProperty.CategoryName = "Performance";
+
+            var useSimulationTimeProperty = schema.PropertyDefinitions.AddExpressionProperty("UseSimulationTime", "False");
+            useSimulationTimeProperty.DisplayName = "Timestamp With Simulation Time";
+            useSimulationTimeProperty.Description = "Stamp each position update with the simulation time instead of the send time, so Unreal can interpolate between sparse updates. Enable frame interpolation (buffered evaluation) on the LiveLink source in Unreal.";
+            useSimulationTimeProperty.CategoryName = "Performance";
+
+            var simulationTimeScaleProperty = schema.PropertyDefinitions.AddExpressionProperty("SimulationTimeScale", "1");
+            simulationTimeScaleProperty.DisplayName = "Simulation Time Scale";
+            simulationTimeScaleProperty.Description = "Playback seconds in Unreal per simulated second when timestamping with simulation time (1 = real time, 0.01 = 100 times faster).";
+            simulationTimeScaleProperty.CategoryName = "Performance";
+
+            var subjectPoolSizeProperty = schema.PropertyDefinitions.AddExpressionProperty("SubjectPoolSize", "0");
+            subjectPoolSizeProperty.DisplayName = "Subject Pool Size";
+            subjectPoolSizeProperty.Description = "Pre-register this many LiveLink subjects per property set and reuse them for created objects (0 = off). Destroyed objects are hidden (zero scale, Visible property 0) instead of removed, which avoids subject churn in Unreal; subjects are named Pool<n>_<index>.";
+            subjectPoolSizeProperty.CategoryName = "Performance";
+
+            var publishFrameBudgetProperty = schema.PropertyDefinitions.AddExpressionProperty("PublishFrameBudget", "0");
+            publishFrameBudgetProperty.DisplayName = "Publish Frame Budget (frames/s)";
+            publishFrameBudgetProperty.Description = "Maximum frames per second sent across all objects when Publish Rate is greater than 0 (0 = unlimited). Objects with Low update priority are held back first, and their latest position is sent as soon as the budget allows.";
+            publishFrameBudgetProperty.CategoryName = "Performance";
+
+            var publishByteBudgetProperty = schema.PropertyDefinitions.AddExpressionProperty("PublishByteBudget", "0");
+            publishByteBudgetProperty.DisplayName = "Publish Byte Budget (bytes/s)";
+            publishByteBudgetProperty.Description = "Maximum estimated bytes per second sent across all objects when Publish Rate is greater than 0 (0 = unlimited). Use to stay within a network budget when several Unreal instances subscribe.";
+            publishByteBudgetProperty.CategoryName = "Performance";
+
+            var asyncInitializationProperty = schema.PropertyDefinitions.AddExpressionProperty("AsyncInitialization", "False");
+            asyncInitializationProperty.DisplayName = "Async Initialization";
+            asyncInitializationProperty.Description = "Start the Unreal runtime in the background so the first run does not wait for it (it is reused by later runs). Updates sent before it is up are kept as each object's latest position and sent once it is. Not available with Subject Pool Size or the shared-memory transport. Takes effect at initialization.";
+            asyncInitializationProperty.CategoryName = "Performance";
+
+            var deferredUpdatesProperty = schema.PropertyDefinitions.AddExpressionProperty("DeferredUpdates", "False");
+            deferredUpdatesProperty.DisplayName = "Deferred Updates";
+            deferredUpdatesProperty.Description = "Collect object position and property updates in memory and send them to Unreal as one frame when a Flush LiveLink Frame step runs (or at the Deferred Flush Rate). Each position step then costs a memory write instead of a native call, and frame boundaries follow the model. Takes effect at initialization.";
+            deferredUpdatesProperty.CategoryName = "Performance";
+
+            var deferredFlushRateProperty = schema.PropertyDefinitions.AddExpressionProperty("DeferredFlushRateHz", "0");
+            deferredFlushRateProperty.DisplayName = "Deferred Flush Rate (Hz)";
+            deferredFlushRateProperty.Description = "With Deferred Updates, also send the collected frame automatically this many times per wall-clock second (0 = only Flush LiveLink Frame steps). For a simulation-time rate, run Flush LiveLink Frame from a Timer element's process instead.";
+            deferredFlushRateProperty.CategoryName = "Performance";
+
+            var prewarmObjectNamesProperty = schema.PropertyDefinitions.AddStringProperty("PrewarmObjectNames", "");
+            prewarmObjectNamesProperty.DisplayName = "Prewarm Object Names";
+            prewarmObjectNamesProperty.Description = "Comma-separated object names known at model start. They are registered with LiveLink in one call during initialization, so the first Create Object steps do not register objects one by one (empty = off).";
+            prewarmObjectNamesProperty.CategoryName = "Performance";
         }
 
         public IElement CreateElement(IElementData elementData)
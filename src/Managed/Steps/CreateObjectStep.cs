@@ -68,7 +68,28 @@ namespace SimioUnrealEngineLiveLinkConnector.Steps
 
                 // Get or create the object updater and set initial transform
                 var objectUpdater = LiveLinkManager.Instance.GetOrCreateObject(objectName);
-                objectUpdater.UpdateTransform(x, y, z, heading, pitch, roll);
+
+                // Update-rate tier (only used by the coalescing publish pass)
+                if (connectorElement.Configuration.PublishRateHz > 0 &&
+                    TryGetDoubleProperty("UpdatePriority", context, out double priority) &&
+                    TryGetDoubleProperty("MaxUpdateRateHz", context, out double maxUpdateRateHz))
+                {
+                    var tier = (LiveLinkPriority)Math.Max((int)LiveLinkPriority.High, Math.Min((int)LiveLinkPriority.Low, (int)priority));
+                    int maxRateHz = Math.Max(0, (int)maxUpdateRateHz);
+                    if (tier != LiveLinkPriority.Normal || maxRateHz > 0)
+                    {
+                        objectUpdater.SetSchedule(tier, maxRateHz);
+                    }
+                }
+                if (connectorElement.Configuration.UseSimulationTime)
+                {
+                    // Simio TimeNow is in hours
+                    objectUpdater.UpdateTransformAtTime(context.Calendar.TimeNow * 3600.0, x, y, z, heading, pitch, roll);
+                }
+                else
+                {
+                    objectUpdater.UpdateTransform(x, y, z, heading, pitch, roll);
+                }
 
                 // 🆕 ADD TRACE INFORMATION - Currently missing!
                 context.ExecutionInformation.TraceInformation($"LiveLink object '{objectName}' created at position ({x:F2}, {y:F2}, {z:F2}).");
@@ -70,6 +70,17 @@ namespace SimioUnrealEngineLiveLinkConnector.Steps
             rollProperty.DisplayName = "Roll";
             rollProperty.Description = "Banking/tilting rotation (standard aviation roll convention).";
             rollProperty.CategoryName = "Rotation";
+
+            // Update-rate tier (applies when the connector's Publish Rate is greater than 0)
+            var updatePriorityProperty = schema.AddExpressionProperty("UpdatePriority", "1");
+            updatePriorityProperty.DisplayName = "Update Priority";
+            updatePriorityProperty.Description = "Publish priority when the connector's frame or byte budget is exceeded: 0 = High, 1 = Normal, 2 = Low (held back first).";
+            updatePriorityProperty.CategoryName = "Update Rate";
+
+            var maxUpdateRateProperty = schema.AddExpressionProperty("MaxUpdateRateHz", "0");
+            maxUpdateRateProperty.DisplayName = "Max Update Rate (Hz)";
+            maxUpdateRateProperty.Description = "Maximum updates per second sent for this object, e.g. 2-5 for far-away objects (0 = every publish pass). Only the latest position is sent.";
+            maxUpdateRateProperty.CategoryName = "Update Rate";
         }
 
         public IStep CreateStep(IPropertyReaders propertyReaders)
@@ -0,0 +1,62 @@
+using System;
+using SimioAPI;
+using SimioAPI.Extensions;
+using SimioUnrealEngineLiveLinkConnector.Element;
+using SimioUnrealEngineLiveLinkConnector.UnrealIntegration;
+
+namespace SimioUnrealEngineLiveLinkConnector.Steps
+{
+    /// <summary>
+    /// Step that submits the connector's deferred frame: the latest state of every object updated
+    /// since the previous flush, in one native batch call per property count.
+    /// A no-op when the connector is not in Deferred Updates mode.
+    /// </summary>
+    internal class FlushLiveLinkFrameStep : IStep
+    {
+        private readonly IPropertyReaders _readers;
+        private int? _lastTraceTick = null; // Loop protection: flushes typically run every time step
+
+        public FlushLiveLinkFrameStep(IPropertyReaders readers)
+        {
+            _readers = readers ?? throw new ArgumentNullException(nameof(readers));
+        }
+
+        public ExitType Execute(IStepExecutionContext context)
+        {
+            try
+            {
+                // Get the connector element
+                var connectorElement = ((IElementProperty)_readers.GetProperty("Element"))
+                    .GetElement(context) as SimioUnrealEngineLiveLinkElement;
+
+                if (connectorElement == null)
+                {
+                    context.ExecutionInformation.ReportError("Invalid or missing LiveLink element reference");
+                    return ExitType.FirstExit;
+                }
+
+                if (!connectorElement.Configuration.DeferredUpdates)
+                {
+                    // Updates are sent immediately; nothing is waiting
+                    return ExitType.FirstExit;
+                }
+
+                int sent = LiveLinkManager.Instance.FlushFrame();
+
+                int now = Environment.TickCount;
+                if (!_lastTraceTick.HasValue || unchecked(now - _lastTraceTick.Value) >= 1000)
+                {
+                    context.ExecutionInformation.TraceInformation($"LiveLink frame flushed with {sent} object updates.");
+                    _lastTraceTick = now;
+                }
+
+                return ExitType.FirstExit;
+            }
+            catch (Exception ex)
+            {
+                context.ExecutionInformation.ReportError($"Unexpected error flushing LiveLink frame: {ex.Message}");
+                return ExitType.FirstExit;
+            }
+        }
+    }
+}
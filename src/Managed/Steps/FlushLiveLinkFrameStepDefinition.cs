@@ -0,0 +1,35 @@
+using System;
+using System.Drawing;
+using SimioAPI;
+using SimioAPI.Extensions;
+using SimioUnrealEngineLiveLinkConnector.Element;
+
+namespace SimioUnrealEngineLiveLinkConnector.Steps
+{
+    internal class FlushLiveLinkFrameStepDefinition : IStepDefinition
+    {
+        // Unique identifier for this step type
+        private static readonly Guid MY_ID = new Guid("D4E5F6A7-B8C9-0123-DEF0-456789012345");
+
+        public string Name => "FlushLiveLinkFrame";
+        public string Description => "Sends every object update collected since the last flush to Unreal Engine as one frame (connector in Deferred Updates mode).";
+        public Image Icon => null!;
+        public Guid UniqueID => MY_ID;
+        public int NumberOfExits => 1;
+
+        public void DefineSchema(IPropertyDefinitions schema)
+        {
+            // Element reference property to constrain to LiveLink elements
+            var elementProperty = schema.AddElementProperty("Element", SimioUnrealEngineLiveLinkElementDefinition.MY_ID);
+            elementProperty.DisplayName = "LiveLink Element";
+            elementProperty.Description = "The LiveLink element whose deferred frame is sent. Run this step from a Timer element's process to flush at a simulation-time rate.";
+            elementProperty.CategoryName = "Element";
+            elementProperty.Required = true;
+        }
+
+        public IStep CreateStep(IPropertyReaders propertyReaders)
+        {
+            return new FlushLiveLinkFrameStep(propertyReaders);
+        }
+    }
+}
@@ -13,7 +13,8 @@ namespace SimioUnrealEngineLiveLinkConnector.Steps
     internal class SetObjectPositionOrientationStep : IStep
     {
         private readonly IPropertyReaders _readers;
-        private DateTime? _lastTraceTime = null; // 🆕 Add loop protection for high-frequency tracing
+        private int? _lastTraceTick = null; // 🆕 Add loop protection for high-frequency tracing (Environment.TickCount, no DateTime.Now per step)
+        private CachedUpdater? _lastUpdater; // Skips the manager lookup while the same object is updated repeatedly
 
         public SetObjectPositionOrientationStep(IPropertyReaders readers)
         {
@@ -70,14 +71,23 @@ namespace SimioUnrealEngineLiveLinkConnector.Steps
 
                 // Get or create the object updater and update transform
                 // Note: GetOrCreateObject handles both new objects and existing ones
-                var objectUpdater = LiveLinkManager.Instance.GetOrCreateObject(objectName);
-                objectUpdater.UpdateTransform(x, y, z, heading, pitch, roll);
+                var objectUpdater = GetObjectUpdater(objectName);
+                if (connectorElement.Configuration.UseSimulationTime)
+                {
+                    // Simio TimeNow is in hours
+                    objectUpdater.UpdateTransformAtTime(context.Calendar.TimeNow * 3600.0, x, y, z, heading, pitch, roll);
+                }
+                else
+                {
+                    objectUpdater.UpdateTransform(x, y, z, heading, pitch, roll);
+                }
 
                 // 🆕 Loop protection: trace max once per second for high-frequency steps
-                if (!_lastTraceTime.HasValue || (DateTime.Now - _lastTraceTime.Value).TotalSeconds >= 1.0)
+                int now = Environment.TickCount;
+                if (!_lastTraceTick.HasValue || unchecked(now - _lastTraceTick.Value) >= 1000)
                 {
                     context.ExecutionInformation.TraceInformation($"LiveLink position updated for '{objectName}' ({x:F2}, {y:F2}, {z:F2}).");
-                    _lastTraceTime = DateTime.Now;
+                    _lastTraceTick = now;
                 }
 
                 return ExitType.FirstExit;
@@ -89,6 +99,39 @@ namespace SimioUnrealEngineLiveLinkConnector.Steps
             }
         }
 
+        /// <summary>
+        /// Returns the updater of the previous execution when the name matches and it is still live,
+        /// otherwise looks it up (or creates it) in the manager and caches it.
+        /// </summary>
+        private LiveLinkObjectUpdater GetObjectUpdater(string objectName)
+        {
+            var cached = _lastUpdater; // Single read: the pair is replaced, never mutated
+            if (cached != null && !cached.Updater.IsDisposed &&
+                string.Equals(cached.ObjectName, objectName, StringComparison.Ordinal))
+            {
+                return cached.Updater;
+            }
+
+            var updater = LiveLinkManager.Instance.GetOrCreateObject(objectName);
+            _lastUpdater = new CachedUpdater(objectName, updater);
+            return updater;
+        }
+
+        /// <summary>
+        /// Object name and updater cached together so concurrent executions never see a mismatched pair.
+        /// </summary>
+        private sealed class CachedUpdater
+        {
+            public readonly string ObjectName;
+            public readonly LiveLinkObjectUpdater Updater;
+
+            public CachedUpdater(string objectName, LiveLinkObjectUpdater updater)
+            {
+                ObjectName = objectName;
+                Updater = updater;
+            }
+        }
+
         /// <summary>
         /// Helper method to safely read string properties from expressions.
         /// </summary>
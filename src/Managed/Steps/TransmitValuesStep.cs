@@ -73,6 +73,32 @@ namespace SimioUnrealEngineLiveLinkConnector.Steps
                     }
                 }
 
+                // Data subject target: one properties-only frame, no transform payload
+                string dataSubjectName = _readers.GetProperty("DataSubjectName")?.GetStringValue(context) ?? string.Empty;
+                if (dataValues.Count > 0 && !string.IsNullOrWhiteSpace(dataSubjectName))
+                {
+                    try
+                    {
+                        LiveLinkManager.Instance.UpdateDataSubject(
+                            dataSubjectName,
+                            dataValues.Keys.ToArray(),
+                            dataValues.Values.Select(v => (float)v).ToArray());
+                    }
+                    catch (Exception ex)
+                    {
+                        context.ExecutionInformation.ReportError($"Error transmitting to data subject '{dataSubjectName}': {ex.Message}");
+                        return ExitType.FirstExit;
+                    }
+
+                    if (!_lastTraceTime.HasValue || (DateTime.Now - _lastTraceTime.Value).TotalSeconds >= 1.0)
+                    {
+                        context.ExecutionInformation.TraceInformation($"LiveLink data subject '{dataSubjectName}' updated with {dataValues.Count} values.");
+                        _lastTraceTime = DateTime.Now;
+                    }
+
+                    return ExitType.FirstExit;
+                }
+
                 // Transmit the collected values to all managed LiveLink objects
                 // Since we don't have a specific object name, we'll transmit to all registered objects
                 if (dataValues.Count > 0)
@@ -26,6 +26,13 @@ namespace SimioUnrealEngineLiveLinkConnector.Steps
             elementProperty.CategoryName = "Element";
             elementProperty.Required = true;
 
+            // Optional data subject target (properties only, no transform payload)
+            var dataSubjectProperty = schema.AddStringProperty("DataSubjectName", "");
+            dataSubjectProperty.DisplayName = "Data Subject Name";
+            dataSubjectProperty.Description = "Optional. When set, the values are sent to this LiveLink data subject (Basic role, no transform) instead of to every LiveLink object.";
+            dataSubjectProperty.CategoryName = "Data";
+            dataSubjectProperty.Required = false;
+
             // Repeat group for data values
             var valuesGroup = schema.AddRepeatGroupProperty("Values");
             valuesGroup.DisplayName = "Data Values";
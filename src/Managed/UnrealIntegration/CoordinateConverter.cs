@@ -24,19 +24,8 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         /// <returns>Array [unrealX, unrealY, unrealZ] in centimeters</returns>
         public static double[] SimioPositionToUnreal(double simioX, double simioY, double simioZ)
         {
-            // Handle NaN/infinity
-            if (!IsFinite(simioX) || !IsFinite(simioY) || !IsFinite(simioZ))
-            {
-                return new double[] { 0.0, 0.0, 0.0 };
-            }
-
-            // Axis remapping: Simio(X,Y,Z) → Unreal(X,-Z,Y) and convert to centimeters
-            return new double[]
-            {
-                simioX * METERS_TO_CENTIMETERS,  // X stays X
-                -simioZ * METERS_TO_CENTIMETERS, // Z becomes -Y (flip for handedness)
-                simioY * METERS_TO_CENTIMETERS   // Y becomes Z (up axis change)
-            };
+            ConvertPosition(simioX, simioY, simioZ, out double unrealX, out double unrealY, out double unrealZ);
+            return new double[] { unrealX, unrealY, unrealZ };
         }
 
         /// <summary>
@@ -49,20 +38,8 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         /// <returns>Array [unrealX, unrealY, unrealZ] scale factors</returns>
         public static double[] SimioScaleToUnreal(double simioX, double simioY, double simioZ)
         {
-            // Handle invalid scale values
-            if (!IsFinite(simioX) || !IsFinite(simioY) || !IsFinite(simioZ) ||
-                simioX <= 0.0 || simioY <= 0.0 || simioZ <= 0.0)
-            {
-                return new double[] { 1.0, 1.0, 1.0 }; // Default to unit scale
-            }
-
-            // Axis remapping: Simio(X,Y,Z) → Unreal(X,Z,Y)
-            return new double[]
-            {
-                simioX, // X stays X
-                simioZ, // Z becomes Y
-                simioY  // Y becomes Z
-            };
+            ConvertScale(simioX, simioY, simioZ, out double unrealX, out double unrealY, out double unrealZ);
+            return new double[] { unrealX, unrealY, unrealZ };
         }
 
         /// <summary>
@@ -74,11 +51,123 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         /// <param name="simioRotZ">Rotation around Z-axis in degrees</param>
         /// <returns>Quaternion array [X,Y,Z,W] for Unreal coordinate system</returns>
         public static double[] EulerToQuaternion(double simioRotX, double simioRotY, double simioRotZ)
+        {
+            ConvertRotation(simioRotX, simioRotY, simioRotZ, out double qx, out double qy, out double qz, out double qw);
+            return new double[] { qx, qy, qz, qw };
+        }
+
+        /// <summary>
+        /// Creates a complete ULL_Transform from Simio coordinates
+        /// </summary>
+        /// <param name="simioX">Simio X position in meters</param>
+        /// <param name="simioY">Simio Y position in meters</param>
+        /// <param name="simioZ">Simio Z position in meters</param>
+        /// <param name="simioRotX">Simio X rotation in degrees</param>
+        /// <param name="simioRotY">Simio Y rotation in degrees</param>
+        /// <param name="simioRotZ">Simio Z rotation in degrees</param>
+        /// <param name="simioScaleX">Simio X scale factor (default 1.0)</param>
+        /// <param name="simioScaleY">Simio Y scale factor (default 1.0)</param>
+        /// <param name="simioScaleZ">Simio Z scale factor (default 1.0)</param>
+        /// <returns>ULL_Transform ready for native P/Invoke</returns>
+        public static ULL_Transform SimioToUnrealTransform(
+            double simioX, double simioY, double simioZ,
+            double simioRotX, double simioRotY, double simioRotZ,
+            double simioScaleX = 1.0, double simioScaleY = 1.0, double simioScaleZ = 1.0)
+        {
+            var position = SimioPositionToUnreal(simioX, simioY, simioZ);
+            var rotation = EulerToQuaternion(simioRotX, simioRotY, simioRotZ);
+            var scale = SimioScaleToUnreal(simioScaleX, simioScaleY, simioScaleZ);
+
+            return new ULL_Transform
+            {
+                position = position,
+                rotation = rotation,
+                scale = scale
+            };
+        }
+
+        /// <summary>
+        /// Converts Simio coordinates into an existing blittable transform (no allocation)
+        /// Same conversion as SimioToUnrealTransform; use it to fill reused or batch buffers
+        /// </summary>
+        /// <param name="destination">Transform to overwrite, e.g. an element of a ULL_TransformData[] batch</param>
+        /// <param name="simioX">Simio X position in meters</param>
+        /// <param name="simioY">Simio Y position in meters</param>
+        /// <param name="simioZ">Simio Z position in meters</param>
+        /// <param name="simioRotX">Simio X rotation in degrees</param>
+        /// <param name="simioRotY">Simio Y rotation in degrees</param>
+        /// <param name="simioRotZ">Simio Z rotation in degrees</param>
+        /// <param name="simioScaleX">Simio X scale factor (default 1.0)</param>
+        /// <param name="simioScaleY">Simio Y scale factor (default 1.0)</param>
+        /// <param name="simioScaleZ">Simio Z scale factor (default 1.0)</param>
+        public static void SimioToUnrealTransform(
+            ref ULL_TransformData destination,
+            double simioX, double simioY, double simioZ,
+            double simioRotX, double simioRotY, double simioRotZ,
+            double simioScaleX = 1.0, double simioScaleY = 1.0, double simioScaleZ = 1.0)
+        {
+            ConvertPosition(simioX, simioY, simioZ,
+                out destination.positionX, out destination.positionY, out destination.positionZ);
+            ConvertRotation(simioRotX, simioRotY, simioRotZ,
+                out destination.rotationX, out destination.rotationY, out destination.rotationZ, out destination.rotationW);
+            ConvertScale(simioScaleX, simioScaleY, simioScaleZ,
+                out destination.scaleX, out destination.scaleY, out destination.scaleZ);
+        }
+
+        /// <summary>
+        /// Simio (X,Y,Z) meters → Unreal (X,-Z,Y) centimeters; non-finite input maps to the origin
+        /// </summary>
+        private static void ConvertPosition(
+            double simioX, double simioY, double simioZ,
+            out double unrealX, out double unrealY, out double unrealZ)
+        {
+            // Handle NaN/infinity
+            if (!IsFinite(simioX) || !IsFinite(simioY) || !IsFinite(simioZ))
+            {
+                unrealX = unrealY = unrealZ = 0.0;
+                return;
+            }
+
+            // Axis remapping: Simio(X,Y,Z) → Unreal(X,-Z,Y) and convert to centimeters
+            unrealX = simioX * METERS_TO_CENTIMETERS;  // X stays X
+            unrealY = -simioZ * METERS_TO_CENTIMETERS; // Z becomes -Y (flip for handedness)
+            unrealZ = simioY * METERS_TO_CENTIMETERS;  // Y becomes Z (up axis change)
+        }
+
+        /// <summary>
+        /// Simio (X,Y,Z) → Unreal (X,Z,Y) scale; non-finite or non-positive input maps to unit scale
+        /// </summary>
+        private static void ConvertScale(
+            double simioX, double simioY, double simioZ,
+            out double unrealX, out double unrealY, out double unrealZ)
+        {
+            // Handle invalid scale values
+            if (!IsFinite(simioX) || !IsFinite(simioY) || !IsFinite(simioZ) ||
+                simioX <= 0.0 || simioY <= 0.0 || simioZ <= 0.0)
+            {
+                unrealX = unrealY = unrealZ = 1.0; // Default to unit scale
+                return;
+            }
+
+            // Axis remapping: Simio(X,Y,Z) → Unreal(X,Z,Y)
+            unrealX = simioX; // X stays X
+            unrealY = simioZ; // Z becomes Y
+            unrealZ = simioY; // Y becomes Z
+        }
+
+        /// <summary>
+        /// Simio Euler angles (degrees) → normalized Unreal quaternion; non-finite input maps to identity
+        /// </summary>
+        private static void ConvertRotation(
+            double simioRotX, double simioRotY, double simioRotZ,
+            out double qx, out double qy, out double qz, out double qw)
         {
             // Handle NaN/infinity
             if (!IsFinite(simioRotX) || !IsFinite(simioRotY) || !IsFinite(simioRotZ))
             {
-                return new double[] { 0.0, 0.0, 0.0, 1.0 }; // Identity quaternion
+                qx = qy = qz = 0.0;
+                qw = 1.0; // Identity quaternion
+                return;
             }
 
             // Convert degrees to radians
@@ -101,55 +190,24 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             double sinZ = Math.Sin(unrealRotZ * 0.5);
 
             // Compute quaternion components
-            double qw = cosX * cosY * cosZ + sinX * sinY * sinZ;
-            double qx = sinX * cosY * cosZ - cosX * sinY * sinZ;
-            double qy = cosX * sinY * cosZ + sinX * cosY * sinZ;
-            double qz = cosX * cosY * sinZ - sinX * sinY * cosZ;
+            double w = cosX * cosY * cosZ + sinX * sinY * sinZ;
+            double x = sinX * cosY * cosZ - cosX * sinY * sinZ;
+            double y = cosX * sinY * cosZ + sinX * cosY * sinZ;
+            double z = cosX * cosY * sinZ - sinX * sinY * cosZ;
 
             // Normalize quaternion
-            double magnitude = Math.Sqrt(qx * qx + qy * qy + qz * qz + qw * qw);
+            double magnitude = Math.Sqrt(x * x + y * y + z * z + w * w);
             if (magnitude < 1e-10) // Avoid division by zero
             {
-                return new double[] { 0.0, 0.0, 0.0, 1.0 }; // Identity quaternion
+                qx = qy = qz = 0.0;
+                qw = 1.0; // Identity quaternion
+                return;
             }
 
-            return new double[]
-            {
-                qx / magnitude,
-                qy / magnitude,
-                qz / magnitude,
-                qw / magnitude
-            };
-        }
-
-        /// <summary>
-        /// Creates a complete ULL_Transform from Simio coordinates
-        /// </summary>
-        /// <param name="simioX">Simio X position in meters</param>
-        /// <param name="simioY">Simio Y position in meters</param>
-        /// <param name="simioZ">Simio Z position in meters</param>
-        /// <param name="simioRotX">Simio X rotation in degrees</param>
-        /// <param name="simioRotY">Simio Y rotation in degrees</param>
-        /// <param name="simioRotZ">Simio Z rotation in degrees</param>
-        /// <param name="simioScaleX">Simio X scale factor (default 1.0)</param>
-        /// <param name="simioScaleY">Simio Y scale factor (default 1.0)</param>
-        /// <param name="simioScaleZ">Simio Z scale factor (default 1.0)</param>
-        /// <returns>ULL_Transform ready for native P/Invoke</returns>
-        public static ULL_Transform SimioToUnrealTransform(
-            double simioX, double simioY, double simioZ,
-            double simioRotX, double simioRotY, double simioRotZ,
-            double simioScaleX = 1.0, double simioScaleY = 1.0, double simioScaleZ = 1.0)
-        {
-            var position = SimioPositionToUnreal(simioX, simioY, simioZ);
-            var rotation = EulerToQuaternion(simioRotX, simioRotY, simioRotZ);
-            var scale = SimioScaleToUnreal(simioScaleX, simioScaleY, simioScaleZ);
-
-            return new ULL_Transform
-            {
-                position = position,
-                rotation = rotation,
-                scale = scale
-            };
+            qx = x / magnitude;
+            qy = y / magnitude;
+            qz = z / magnitude;
+            qw = w / magnitude;
         }
 
         /// <summary>
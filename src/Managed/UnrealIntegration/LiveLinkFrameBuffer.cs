@@ -0,0 +1,251 @@
+using System;
+using System.Collections.Generic;
+
+namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
+{
+    /// <summary>
+    /// Double-buffered frame of deferred object updates (LiveLinkConfiguration.DeferredUpdates).
+    /// Updates are written into struct-of-arrays batches (one per property count) instead of
+    /// crossing into native code; Flush() swaps the buffers and submits the whole frame with
+    /// one native batch call per property count. An object updated several times within a
+    /// frame keeps only its latest state.
+    /// Thread-safe: writers and Flush() may run on different threads.
+    /// </summary>
+    public sealed class LiveLinkFrameBuffer
+    {
+        private const int InitialCapacity = 64;
+
+        private readonly object _writeLock = new object(); // Guards the front frame
+        private readonly object _flushLock = new object(); // Serializes Flush() callers across the swap and the native calls
+        private Frame _front = new Frame(1);
+        private Frame _back = new Frame(0);
+        private long _framesFlushed;
+        private long _objectsFlushed;
+
+        /// <summary>
+        /// Gets the number of object updates waiting in the current frame
+        /// </summary>
+        public int PendingCount
+        {
+            get
+            {
+                lock (_writeLock)
+                {
+                    return _front.Count;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets the number of non-empty frames submitted so far
+        /// </summary>
+        public long FramesFlushed => System.Threading.Interlocked.Read(ref _framesFlushed);
+
+        /// <summary>
+        /// Gets the number of object updates submitted so far
+        /// </summary>
+        public long ObjectsFlushed => System.Threading.Interlocked.Read(ref _objectsFlushed);
+
+        /// <summary>
+        /// Writes an object update into the current frame (memory only, no native call)
+        /// </summary>
+        /// <param name="handle">Native subject handle (must be valid)</param>
+        /// <param name="transform">Transform in Unreal coordinates</param>
+        /// <param name="propertyValues">Property values, or null when propertyCount is 0</param>
+        /// <param name="propertyCount">Number of property values (fixed per object)</param>
+        /// <param name="simulationTimeSeconds">Simulation time of this state, or NaN to send with the flush time</param>
+        /// <param name="slot">Caller-owned slot of this object in the frame (updated)</param>
+        /// <param name="generation">Caller-owned frame generation of slot (updated); 0 = not in any frame</param>
+        internal void Write(
+            int handle, ref ULL_TransformData transform, float[]? propertyValues, int propertyCount,
+            double simulationTimeSeconds, ref int slot, ref long generation)
+        {
+            lock (_writeLock)
+            {
+                var batch = _front.GetBatch(propertyCount);
+                if (generation != _front.Generation)
+                {
+                    slot = batch.Append();
+                    generation = _front.Generation;
+                    _front.Count++;
+                }
+
+                batch.Handles[slot] = handle;
+                batch.Transforms[slot] = transform;
+                if (propertyCount > 0)
+                {
+                    Array.Copy(propertyValues!, 0, batch.PropertyValues, slot * propertyCount, propertyCount);
+                }
+
+                if (!double.IsNaN(simulationTimeSeconds))
+                {
+                    // Frame-aligned: the whole frame is stamped with the latest simulation time written into it
+                    _front.SimulationTime = _front.HasSimulationTime
+                        ? Math.Max(_front.SimulationTime, simulationTimeSeconds)
+                        : simulationTimeSeconds;
+                    _front.HasSimulationTime = true;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Drops an object's pending update from the current frame (e.g. before its handle is removed)
+        /// </summary>
+        /// <param name="propertyCount">Property count the object was written with</param>
+        /// <param name="slot">Slot returned by Write</param>
+        /// <param name="generation">Generation returned by Write (reset to 0)</param>
+        internal void Cancel(int propertyCount, int slot, ref long generation)
+        {
+            lock (_writeLock)
+            {
+                if (generation == _front.Generation)
+                {
+                    // Invalid handles are ignored by the native batch calls
+                    _front.GetBatch(propertyCount).Handles[slot] = UnrealLiveLinkNative.ULL_INVALID_HANDLE;
+                }
+
+                generation = 0;
+            }
+        }
+
+        /// <summary>
+        /// Submits the current frame through the native batch API and starts a new one
+        /// </summary>
+        /// <returns>Number of object updates submitted</returns>
+        public int Flush()
+        {
+            lock (_flushLock)
+            {
+                Frame frame;
+                lock (_writeLock)
+                {
+                    if (_front.Count == 0)
+                    {
+                        return 0;
+                    }
+
+                    // Swap: writers continue into the other buffer while this frame is sent
+                    frame = _front;
+                    _front = _back;
+                    _front.Reset(frame.Generation + 1);
+                    _back = frame;
+                }
+
+                foreach (var batch in frame.Batches)
+                {
+                    if (batch.Count == 0)
+                    {
+                        continue;
+                    }
+
+                    if (frame.HasSimulationTime)
+                    {
+                        UnrealLiveLinkNative.ULL_UpdateObjectsBatchAtTimeH(
+                            batch.Handles, batch.Transforms, batch.PropertyCount > 0 ? batch.PropertyValues : null,
+                            batch.PropertyCount, batch.Count, frame.SimulationTime);
+                    }
+                    else if (batch.PropertyCount > 0)
+                    {
+                        UnrealLiveLinkNative.ULL_UpdateObjectsBatchWithPropertiesH(
+                            batch.Handles, batch.Transforms, batch.PropertyValues, batch.PropertyCount, batch.Count);
+                    }
+                    else
+                    {
+                        UnrealLiveLinkNative.ULL_UpdateObjectsBatchH(batch.Handles, batch.Transforms, batch.Count);
+                    }
+                }
+
+                System.Threading.Interlocked.Increment(ref _framesFlushed);
+                System.Threading.Interlocked.Add(ref _objectsFlushed, frame.Count);
+                return frame.Count;
+            }
+        }
+
+        /// <summary>
+        /// Discards the current frame without sending it
+        /// </summary>
+        public void Clear()
+        {
+            lock (_writeLock)
+            {
+                _front.Reset(_front.Generation + 1);
+            }
+        }
+
+        /// <summary>
+        /// One buffer: the batches of every property count written during a frame
+        /// </summary>
+        private sealed class Frame
+        {
+            public readonly List<FrameBatch> Batches = new List<FrameBatch>();
+            public long Generation;
+            public int Count;
+            public bool HasSimulationTime;
+            public double SimulationTime;
+
+            public Frame(long generation)
+            {
+                Generation = generation;
+            }
+
+            public FrameBatch GetBatch(int propertyCount)
+            {
+                // Models use few distinct property counts; a linear scan beats a dictionary here
+                for (int i = 0; i < Batches.Count; i++)
+                {
+                    if (Batches[i].PropertyCount == propertyCount)
+                    {
+                        return Batches[i];
+                    }
+                }
+
+                var batch = new FrameBatch(propertyCount);
+                Batches.Add(batch);
+                return batch;
+            }
+
+            public void Reset(long generation)
+            {
+                Generation = generation;
+                Count = 0;
+                HasSimulationTime = false;
+                SimulationTime = 0.0;
+                foreach (var batch in Batches)
+                {
+                    batch.Count = 0; // Arrays are kept for the next frame
+                }
+            }
+        }
+
+        /// <summary>
+        /// Struct-of-arrays batch in the layout the native batch calls take (arrays are pinned, not copied)
+        /// </summary>
+        private sealed class FrameBatch
+        {
+            public readonly int PropertyCount;
+            public int[] Handles = new int[InitialCapacity];
+            public ULL_TransformData[] Transforms = new ULL_TransformData[InitialCapacity];
+            public float[] PropertyValues;
+            public int Count;
+
+            public FrameBatch(int propertyCount)
+            {
+                PropertyCount = propertyCount;
+                PropertyValues = new float[InitialCapacity * propertyCount];
+            }
+
+            public int Append()
+            {
+                if (Count == Handles.Length)
+                {
+                    int capacity = Handles.Length * 2;
+                    Array.Resize(ref Handles, capacity);
+                    Array.Resize(ref Transforms, capacity);
+                    Array.Resize(ref PropertyValues, capacity * PropertyCount);
+                }
+
+                return Count++;
+            }
+        }
+    }
+}
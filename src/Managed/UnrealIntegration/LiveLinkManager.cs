@@ -1,6 +1,7 @@
 using System;
 using System.Collections.Concurrent;
 using System.Collections.Generic;
+using System.Linq;
 
 namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
 {
@@ -19,11 +20,25 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         private readonly ConcurrentDictionary<string, LiveLinkObjectUpdater> _objects = 
             new ConcurrentDictionary<string, LiveLinkObjectUpdater>(StringComparer.Ordinal);
 
+        // Data subjects registered natively, with the property layout they were registered with
+        private readonly ConcurrentDictionary<string, string[]> _dataSubjects =
+            new ConcurrentDictionary<string, string[]>(StringComparer.Ordinal);
+
+        // Update-rate tiers for data subjects (priority, max rate), applied on every native registration
+        private readonly ConcurrentDictionary<string, (LiveLinkPriority Priority, int MaxRateHz)> _dataSubjectSchedules =
+            new ConcurrentDictionary<string, (LiveLinkPriority Priority, int MaxRateHz)>(StringComparer.Ordinal);
+
+        // Native property schema IDs keyed by the property names joined with '\n'
+        private readonly ConcurrentDictionary<string, int> _propertySchemas =
+            new ConcurrentDictionary<string, int>(StringComparer.Ordinal);
+
         private bool _isInitialized;
         private string? _currentSourceName;
         private LiveLinkConfiguration? _currentConfiguration; // 🆕 Store full configuration
         private volatile bool _lastConnectionCheck;
         private DateTime _lastConnectionCheckTime = DateTime.MinValue;
+        private volatile LiveLinkFrameBuffer? _deferredFrame; // Non-null while DeferredUpdates is on
+        private System.Threading.Timer? _flushTimer; // DeferredFlushRateHz > 0 only
 
         // Connection check caching (avoid expensive P/Invoke calls)
         private const double CONNECTION_CHECK_CACHE_SECONDS = 1.0;
@@ -83,6 +98,18 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             }
         }
 
+        /// <summary>
+        /// Gets the deferred frame object updates are written into (null unless initialized with DeferredUpdates)
+        /// </summary>
+        public LiveLinkFrameBuffer? DeferredFrame => _deferredFrame;
+
+        /// <summary>
+        /// Gets the native initialization state: ULL_INIT_STATE_STAGING while the Unreal runtime starts
+        /// in the background (AsyncInitialization), then ULL_INIT_STATE_READY or ULL_INIT_STATE_FAILED;
+        /// ULL_NOT_INITIALIZED before Initialize
+        /// </summary>
+        public int InitState => _isInitialized ? UnrealLiveLinkNative.ULL_GetInitState() : UnrealLiveLinkNative.ULL_NOT_INITIALIZED;
+
         /// <summary>
         /// Gets the number of registered objects
         /// </summary>
@@ -130,8 +157,32 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             // Store the configuration for use by other components
             _currentConfiguration = configuration;
 
-            // Call the existing Initialize method with the source name
-            return Initialize(configuration.SourceName);
+            return InitializeCore(configuration.SourceName, configuration);
+        }
+
+        /// <summary>
+        /// Initializes LiveLink with validated configuration and pre-registers the model's known objects
+        /// The first wave of object updates then skips per-object registration
+        /// </summary>
+        /// <param name="configuration">LiveLink configuration settings</param>
+        /// <param name="knownObjectNames">Object names known at model start (see PrewarmObjects)</param>
+        /// <param name="propertyNames">Property names shared by the known objects, or null for transform-only objects</param>
+        /// <returns>True if initialization succeeded or was already initialized</returns>
+        /// <exception cref="ArgumentNullException">Thrown if configuration is null</exception>
+        /// <exception cref="ArgumentException">Thrown if configuration is invalid</exception>
+        /// <exception cref="InvalidOperationException">Thrown if already initialized with different source name</exception>
+        /// <exception cref="DllNotFoundException">Thrown if native DLL is not available</exception>
+        /// <exception cref="LiveLinkInitializationException">Thrown if native initialization fails</exception>
+        public bool Initialize(LiveLinkConfiguration configuration, string[]? knownObjectNames, string[]? propertyNames = null)
+        {
+            bool initialized = Initialize(configuration);
+
+            if (initialized && knownObjectNames != null && knownObjectNames.Length > 0)
+            {
+                PrewarmObjects(knownObjectNames, propertyNames);
+            }
+
+            return initialized;
         }
 
         /// <summary>
@@ -151,6 +202,15 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
                 throw new ArgumentException("Source name cannot be null or empty", nameof(sourceName));
             }
 
+            return InitializeCore(sourceName, null);
+        }
+
+        /// <summary>
+        /// Shared initialization path. Send options are taken from configuration when provided;
+        /// otherwise the native default (synchronous send) is used.
+        /// </summary>
+        private bool InitializeCore(string sourceName, LiveLinkConfiguration? configuration)
+        {
             lock (_initializationLock)
             {
                 // Check if already initialized
@@ -200,7 +260,17 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
                 // Initialize native LiveLink
                 try
                 {
-                    int result = UnrealLiveLinkNative.ULL_Initialize(sourceName);
+                    int result;
+                    if (configuration != null && configuration.RequiresInitOptions)
+                    {
+                        var options = ULL_InitOptions.FromConfiguration(configuration);
+                        result = UnrealLiveLinkNative.ULL_InitializeEx(sourceName, ref options);
+                    }
+                    else
+                    {
+                        result = UnrealLiveLinkNative.ULL_Initialize(sourceName);
+                    }
+
                     if (!UnrealLiveLinkNative.IsSuccess(result))
                     {
                         string errorDescription = UnrealLiveLinkNative.GetReturnCodeDescription(result);
@@ -213,6 +283,11 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
                     _lastConnectionCheck = false; // Will be checked on first IsConnectionHealthy call
                     _lastConnectionCheckTime = DateTime.MinValue;
 
+                    if (configuration != null && configuration.DeferredUpdates)
+                    {
+                        StartDeferredFrame(configuration.DeferredFlushRateHz);
+                    }
+
                     return true;
                 }
                 catch (Exception ex) when (!(ex is LiveLinkInitializationException))
@@ -239,6 +314,9 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
 
                 try
                 {
+                    // Send the last deferred frame while its handles are still registered
+                    StopDeferredFrame();
+
                     // Dispose all managed objects
                     var objectsToDispose = new List<LiveLinkObjectUpdater>(_objects.Values);
                     _objects.Clear();
@@ -255,6 +333,11 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
                         }
                     }
 
+                    // Native shutdown removes data subjects and property schemas too
+                    _dataSubjects.Clear();
+                    _dataSubjectSchedules.Clear();
+                    _propertySchemas.Clear();
+
                     // Shutdown native LiveLink
                     UnrealLiveLinkNative.ULL_Shutdown();
                 }
@@ -292,6 +375,71 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             return _objects.GetOrAdd(objectName, name => new LiveLinkObjectUpdater(name));
         }
 
+        /// <summary>
+        /// Registers a known list of objects natively in one call before their first update (startup warm-up)
+        /// Objects that already have an updater are skipped; objects that fail here register lazily as usual
+        /// Thread-safe operation
+        /// </summary>
+        /// <param name="objectNames">Object identifiers to register</param>
+        /// <param name="propertyNames">Property names shared by all objects, or null for transform-only objects</param>
+        /// <returns>Number of objects registered by this call</returns>
+        /// <exception cref="ArgumentNullException">Thrown if objectNames is null</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public int PrewarmObjects(string[] objectNames, string[]? propertyNames = null)
+        {
+            if (objectNames == null)
+            {
+                throw new ArgumentNullException(nameof(objectNames));
+            }
+
+            ThrowIfNotInitialized();
+
+            string[] names = objectNames
+                .Where(name => !string.IsNullOrWhiteSpace(name) && !_objects.ContainsKey(name))
+                .Distinct(StringComparer.Ordinal)
+                .ToArray();
+
+            if (names.Length == 0)
+            {
+                return 0;
+            }
+
+            int[]? schemaIds = null;
+            if (propertyNames != null)
+            {
+                int schemaId = GetPropertySchemaId(propertyNames);
+                if (schemaId < 0)
+                {
+                    return 0;
+                }
+
+                schemaIds = Enumerable.Repeat(schemaId, names.Length).ToArray();
+            }
+
+            var handles = new int[names.Length];
+            if (UnrealLiveLinkNative.ULL_RegisterObjectsBatchH(names, schemaIds, names.Length, handles) <= 0)
+            {
+                return 0;
+            }
+
+            int adopted = 0;
+            for (int i = 0; i < names.Length; i++)
+            {
+                if (handles[i] < 0)
+                {
+                    continue;
+                }
+
+                var updater = _objects.GetOrAdd(names[i], name => new LiveLinkObjectUpdater(name));
+                if (updater.AdoptRegistration(handles[i], propertyNames))
+                {
+                    adopted++;
+                }
+            }
+
+            return adopted;
+        }
+
         /// <summary>
         /// Gets an existing object updater (does not create if not found)
         /// Thread-safe operation
@@ -378,6 +526,332 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             }
         }
 
+        /// <summary>
+        /// Submits the deferred frame: every object updated since the last flush, in one batch call per property count
+        /// No-op unless initialized with DeferredUpdates
+        /// Thread-safe operation
+        /// </summary>
+        /// <returns>Number of object updates submitted</returns>
+        public int FlushFrame()
+        {
+            var frame = _deferredFrame;
+            return frame != null && _isInitialized ? frame.Flush() : 0;
+        }
+
+        /// <summary>
+        /// Updates transforms for many objects with a single native call
+        /// Objects are registered (without properties) on first use, same as LiveLinkObjectUpdater.UpdateTransform()
+        /// Uses native subject handles when every object has one
+        /// </summary>
+        /// <param name="objectNames">Object identifiers</param>
+        /// <param name="transforms">Transforms already converted to Unreal coordinates (see CoordinateConverter)</param>
+        /// <exception cref="ArgumentNullException">Thrown if objectNames or transforms is null</exception>
+        /// <exception cref="ArgumentException">Thrown if arrays have different lengths or a name is null/empty</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized or an object was registered with properties</exception>
+        public void UpdateObjectsBatch(string[] objectNames, ULL_Transform[] transforms)
+        {
+            ValidateBatchArguments(objectNames, transforms);
+
+            ThrowIfNotInitialized();
+
+            if (objectNames.Length == 0)
+            {
+                return;
+            }
+
+            // Track every object so Dispose()/Shutdown() still removes it natively
+            int[]? handles = CollectBatchHandles(objectNames, null);
+
+            if (handles != null)
+            {
+                UnrealLiveLinkNative.ULL_UpdateObjectsBatchH(handles, transforms, handles.Length);
+            }
+            else
+            {
+                UnrealLiveLinkNative.ULL_UpdateObjectsBatch(objectNames, transforms, objectNames.Length);
+            }
+        }
+
+        /// <summary>
+        /// Updates transforms for many registered objects with a single native call and no allocation
+        /// Both arrays are pinned and read in place, so callers can keep them and refill them every step
+        /// (see CoordinateConverter.SimioToUnrealTransform(ref ULL_TransformData, ...))
+        /// </summary>
+        /// <param name="handles">Native handles (LiveLinkObjectUpdater.Handle); invalid handles are ignored natively</param>
+        /// <param name="transforms">Transforms in Unreal coordinates, in handle order</param>
+        /// <param name="count">Number of leading entries to send</param>
+        /// <exception cref="ArgumentNullException">Thrown if handles or transforms is null</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if count is negative or exceeds either array</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public void UpdateObjectsBatch(int[] handles, ULL_TransformData[] transforms, int count)
+        {
+            if (handles == null)
+            {
+                throw new ArgumentNullException(nameof(handles));
+            }
+
+            if (transforms == null)
+            {
+                throw new ArgumentNullException(nameof(transforms));
+            }
+
+            if (count < 0 || count > handles.Length || count > transforms.Length)
+            {
+                throw new ArgumentOutOfRangeException(nameof(count),
+                    $"Count must be between 0 and the array lengths (handles: {handles.Length}, transforms: {transforms.Length})");
+            }
+
+            ThrowIfNotInitialized();
+
+            if (count == 0)
+            {
+                return;
+            }
+
+            UnrealLiveLinkNative.ULL_UpdateObjectsBatchH(handles, transforms, count);
+        }
+
+        /// <summary>
+        /// Updates transforms for many objects from raw Simio values with a single native call
+        /// The Simio → Unreal conversion runs natively, so no per-object CoordinateConverter call or ULL_Transform is needed
+        /// </summary>
+        /// <param name="objectNames">Object identifiers</param>
+        /// <param name="simioValues">
+        /// Columns of objectNames.Length values each: x, y, z (meters), rotX, rotY, rotZ (degrees)
+        /// and optionally scaleX, scaleY, scaleZ (same arguments as CoordinateConverter.SimioToUnrealTransform)
+        /// </param>
+        /// <exception cref="ArgumentNullException">Thrown if objectNames or simioValues is null</exception>
+        /// <exception cref="ArgumentException">Thrown if simioValues does not hold 6 or 9 columns or a name is null/empty</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized or an object was registered with properties</exception>
+        public void UpdateObjectsBatchFromSimio(string[] objectNames, double[] simioValues)
+        {
+            if (objectNames == null)
+            {
+                throw new ArgumentNullException(nameof(objectNames));
+            }
+
+            if (simioValues == null)
+            {
+                throw new ArgumentNullException(nameof(simioValues));
+            }
+
+            int componentCount = simioValues.Length == objectNames.Length * UnrealLiveLinkNative.ULL_SIMIO_TRANSFORM_COMPONENTS
+                ? UnrealLiveLinkNative.ULL_SIMIO_TRANSFORM_COMPONENTS
+                : UnrealLiveLinkNative.ULL_SIMIO_POSE_COMPONENTS;
+
+            if (simioValues.Length != objectNames.Length * componentCount)
+            {
+                throw new ArgumentException(
+                    $"Simio values must contain {UnrealLiveLinkNative.ULL_SIMIO_POSE_COMPONENTS} or " +
+                    $"{UnrealLiveLinkNative.ULL_SIMIO_TRANSFORM_COMPONENTS} columns of {objectNames.Length} values, " +
+                    $"but has {simioValues.Length}",
+                    nameof(simioValues));
+            }
+
+            for (int i = 0; i < objectNames.Length; i++)
+            {
+                if (string.IsNullOrWhiteSpace(objectNames[i]))
+                {
+                    throw new ArgumentException($"Object name at index {i} cannot be null or empty", nameof(objectNames));
+                }
+            }
+
+            ThrowIfNotInitialized();
+
+            if (objectNames.Length == 0)
+            {
+                return;
+            }
+
+            int[]? handles = CollectBatchHandles(objectNames, null);
+
+            if (handles != null)
+            {
+                UnrealLiveLinkNative.ULL_UpdateObjectsBatchSimioH(handles, simioValues, componentCount, null, 0, handles.Length);
+            }
+            else
+            {
+                var transforms = new ULL_Transform[objectNames.Length];
+                UnrealLiveLinkNative.ULL_ConvertSimioTransforms(simioValues, componentCount, objectNames.Length, transforms);
+                UnrealLiveLinkNative.ULL_UpdateObjectsBatch(objectNames, transforms, objectNames.Length);
+            }
+        }
+
+        /// <summary>
+        /// Updates transforms for many objects from compact transforms (20 bytes per object instead of 80)
+        /// </summary>
+        /// <param name="objectNames">Object identifiers</param>
+        /// <param name="transforms">Compact transforms in Unreal coordinates (see ULL_CompactTransform.Create)</param>
+        /// <param name="scales">Scale triples (X, Y, Z) of the transforms with HasScale, in batch order (null if none)</param>
+        /// <exception cref="ArgumentNullException">Thrown if objectNames or transforms is null</exception>
+        /// <exception cref="ArgumentException">Thrown if lengths are inconsistent or a name is null/empty</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized or an object was registered with properties</exception>
+        public void UpdateObjectsBatchCompact(string[] objectNames, ULL_CompactTransform[] transforms, float[]? scales = null)
+        {
+            if (objectNames == null)
+            {
+                throw new ArgumentNullException(nameof(objectNames));
+            }
+
+            if (transforms == null)
+            {
+                throw new ArgumentNullException(nameof(transforms));
+            }
+
+            if (objectNames.Length != transforms.Length)
+            {
+                throw new ArgumentException(
+                    $"Object names and transforms must have the same length. " +
+                    $"Names: {objectNames.Length}, Transforms: {transforms.Length}");
+            }
+
+            int scaleCount = 0;
+            for (int i = 0; i < objectNames.Length; i++)
+            {
+                if (string.IsNullOrWhiteSpace(objectNames[i]))
+                {
+                    throw new ArgumentException($"Object name at index {i} cannot be null or empty", nameof(objectNames));
+                }
+
+                if (transforms[i].HasScale)
+                {
+                    scaleCount++;
+                }
+            }
+
+            if ((scales?.Length ?? 0) != scaleCount * 3)
+            {
+                throw new ArgumentException(
+                    $"Scales must contain 3 values for each of the {scaleCount} transforms with HasScale, " +
+                    $"but has {scales?.Length ?? 0}",
+                    nameof(scales));
+            }
+
+            ThrowIfNotInitialized();
+
+            if (objectNames.Length == 0)
+            {
+                return;
+            }
+
+            int[]? handles = CollectBatchHandles(objectNames, null);
+
+            if (handles != null)
+            {
+                UnrealLiveLinkNative.ULL_UpdateObjectsBatchCompactH(
+                    handles, transforms, scales, scaleCount, null, 0, handles.Length);
+            }
+            else
+            {
+                // No name-based compact call: expand here and use the regular batch
+                var expanded = new ULL_Transform[transforms.Length];
+                int nextScale = 0;
+                for (int i = 0; i < transforms.Length; i++)
+                {
+                    if (transforms[i].HasScale)
+                    {
+                        expanded[i] = transforms[i].ToTransform(scales![nextScale * 3], scales[nextScale * 3 + 1], scales[nextScale * 3 + 2]);
+                        nextScale++;
+                    }
+                    else
+                    {
+                        expanded[i] = transforms[i].ToTransform();
+                    }
+                }
+
+                UnrealLiveLinkNative.ULL_UpdateObjectsBatch(objectNames, expanded, objectNames.Length);
+            }
+        }
+
+        /// <summary>
+        /// Updates transforms for many objects with a single native call, timestamped with simulation time
+        /// Unreal places the frames on a timeline derived from simulation time, so sparse updates can be interpolated
+        /// </summary>
+        /// <param name="objectNames">Object identifiers</param>
+        /// <param name="transforms">Transforms already converted to Unreal coordinates (see CoordinateConverter)</param>
+        /// <param name="simulationTimeSeconds">Simulation time of this state in seconds</param>
+        /// <exception cref="ArgumentNullException">Thrown if objectNames or transforms is null</exception>
+        /// <exception cref="ArgumentException">Thrown if arrays have different lengths or a name is null/empty</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized or an object was registered with properties</exception>
+        public void UpdateObjectsBatchAtTime(string[] objectNames, ULL_Transform[] transforms, double simulationTimeSeconds)
+        {
+            ValidateBatchArguments(objectNames, transforms);
+
+            ThrowIfNotInitialized();
+
+            if (objectNames.Length == 0)
+            {
+                return;
+            }
+
+            int[]? handles = CollectBatchHandles(objectNames, null);
+
+            if (handles != null)
+            {
+                UnrealLiveLinkNative.ULL_UpdateObjectsBatchAtTimeH(handles, transforms, null, 0, handles.Length, simulationTimeSeconds);
+            }
+            else
+            {
+                // Simulation time is only carried by the handle path
+                UnrealLiveLinkNative.ULL_UpdateObjectsBatch(objectNames, transforms, objectNames.Length);
+            }
+        }
+
+        /// <summary>
+        /// Updates transforms and properties for many objects with a single native call
+        /// All objects in the batch share the same property layout
+        /// </summary>
+        /// <param name="objectNames">Object identifiers</param>
+        /// <param name="transforms">Transforms already converted to Unreal coordinates (see CoordinateConverter)</param>
+        /// <param name="propertyNames">Property names shared by every object in the batch</param>
+        /// <param name="propertyValues">Contiguous values, propertyNames.Length per object, in objectNames order</param>
+        /// <exception cref="ArgumentNullException">Thrown if any array is null</exception>
+        /// <exception cref="ArgumentException">Thrown if array lengths are inconsistent or a name is null/empty</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized or an object is registered with different properties</exception>
+        public void UpdateObjectsBatchWithProperties(
+            string[] objectNames, ULL_Transform[] transforms, string[] propertyNames, float[] propertyValues)
+        {
+            ValidateBatchArguments(objectNames, transforms);
+
+            if (propertyNames == null)
+            {
+                throw new ArgumentNullException(nameof(propertyNames));
+            }
+
+            if (propertyValues == null)
+            {
+                throw new ArgumentNullException(nameof(propertyValues));
+            }
+
+            if (propertyValues.Length != objectNames.Length * propertyNames.Length)
+            {
+                throw new ArgumentException(
+                    $"Property values must contain {propertyNames.Length} values per object " +
+                    $"({objectNames.Length * propertyNames.Length} total), but has {propertyValues.Length}",
+                    nameof(propertyValues));
+            }
+
+            ThrowIfNotInitialized();
+
+            if (objectNames.Length == 0)
+            {
+                return;
+            }
+
+            int[]? handles = CollectBatchHandles(objectNames, propertyNames);
+
+            if (handles != null)
+            {
+                UnrealLiveLinkNative.ULL_UpdateObjectsBatchWithPropertiesH(
+                    handles, transforms, propertyValues, propertyNames.Length, handles.Length);
+            }
+            else
+            {
+                UnrealLiveLinkNative.ULL_UpdateObjectsBatchWithProperties(
+                    objectNames, transforms, propertyValues, propertyNames.Length, objectNames.Length);
+            }
+        }
+
         /// <summary>
         /// Updates a data subject (metrics/KPIs without 3D representation)
         /// This is a convenience method that directly calls the native API
@@ -407,31 +881,380 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
 
             ThrowIfNotInitialized();
 
+            if (propertyNames != null)
+            {
+                EnsureDataSubjectRegistered(subjectName, propertyNames);
+            }
+
             UnrealLiveLinkNative.ULL_UpdateDataSubject(
-                subjectName, propertyNames, propertyValues, propertyValues.Length);
+                subjectName, null, propertyValues, propertyValues.Length);
         }
 
         /// <summary>
-        /// Removes a data subject from LiveLink
+        /// Updates many data subjects with a single native call
+        /// All subjects in the batch share the same property layout
+        /// Subjects are registered on first use (and re-registered if the layout changes)
         /// </summary>
-        /// <param name="subjectName">Subject identifier to remove</param>
-        /// <exception cref="ArgumentException">Thrown if subjectName is null or empty</exception>
+        /// <param name="subjectNames">Data subject identifiers</param>
+        /// <param name="propertyNames">Property names shared by every subject in the batch</param>
+        /// <param name="propertyValues">Contiguous values, propertyNames.Length per subject, in subjectNames order</param>
+        /// <exception cref="ArgumentNullException">Thrown if any array is null</exception>
+        /// <exception cref="ArgumentException">Thrown if array lengths are inconsistent or a name is null/empty</exception>
         /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
-        public void RemoveDataSubject(string subjectName)
+        public void UpdateDataSubjectsBatch(string[] subjectNames, string[] propertyNames, float[] propertyValues)
         {
-            if (string.IsNullOrWhiteSpace(subjectName))
+            if (subjectNames == null)
             {
-                throw new ArgumentException("Subject name cannot be null or empty", nameof(subjectName));
+                throw new ArgumentNullException(nameof(subjectNames));
             }
 
-            ThrowIfNotInitialized();
+            if (propertyNames == null)
+            {
+                throw new ArgumentNullException(nameof(propertyNames));
+            }
 
-            UnrealLiveLinkNative.ULL_RemoveDataSubject(subjectName);
-        }
+            if (propertyValues == null)
+            {
+                throw new ArgumentNullException(nameof(propertyValues));
+            }
 
-        /// <summary>
-        /// Gets debug information about the manager state
-        /// </summary>
+            if (propertyValues.Length != subjectNames.Length * propertyNames.Length)
+            {
+                throw new ArgumentException(
+                    $"Property values must contain {propertyNames.Length} values per subject " +
+                    $"({subjectNames.Length * propertyNames.Length} total), but has {propertyValues.Length}",
+                    nameof(propertyValues));
+            }
+
+            for (int i = 0; i < subjectNames.Length; i++)
+            {
+                if (string.IsNullOrWhiteSpace(subjectNames[i]))
+                {
+                    throw new ArgumentException($"Subject name at index {i} cannot be null or empty", nameof(subjectNames));
+                }
+            }
+
+            ThrowIfNotInitialized();
+
+            if (subjectNames.Length == 0)
+            {
+                return;
+            }
+
+            foreach (string subjectName in subjectNames)
+            {
+                EnsureDataSubjectRegistered(subjectName, propertyNames);
+            }
+
+            UnrealLiveLinkNative.ULL_UpdateDataSubjectsBatch(
+                subjectNames, propertyValues, propertyNames.Length, subjectNames.Length);
+        }
+
+        /// <summary>
+        /// Removes a data subject from LiveLink
+        /// </summary>
+        /// <param name="subjectName">Subject identifier to remove</param>
+        /// <exception cref="ArgumentException">Thrown if subjectName is null or empty</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public void RemoveDataSubject(string subjectName)
+        {
+            if (string.IsNullOrWhiteSpace(subjectName))
+            {
+                throw new ArgumentException("Subject name cannot be null or empty", nameof(subjectName));
+            }
+
+            ThrowIfNotInitialized();
+
+            _dataSubjects.TryRemove(subjectName, out _);
+            UnrealLiveLinkNative.ULL_RemoveDataSubject(subjectName);
+        }
+
+        /// <summary>
+        /// Sets the publish priority and maximum rate of a data subject (coalescing mode, PublishRateHz > 0)
+        /// Typical use: KPI subjects at 2-5 Hz. Applied now if registered, otherwise on registration.
+        /// </summary>
+        /// <param name="subjectName">Data subject identifier</param>
+        /// <param name="priority">Order under the publish budget (Low is held back first)</param>
+        /// <param name="maxRateHz">Maximum frames per second (0 = every publish pass)</param>
+        /// <exception cref="ArgumentException">Thrown if subjectName is null or empty</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if maxRateHz is negative</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public void SetDataSubjectSchedule(string subjectName, LiveLinkPriority priority, int maxRateHz = UnrealLiveLinkNative.ULL_RATE_UNLIMITED)
+        {
+            if (string.IsNullOrWhiteSpace(subjectName))
+            {
+                throw new ArgumentException("Subject name cannot be null or empty", nameof(subjectName));
+            }
+
+            if (maxRateHz < 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(maxRateHz), "Maximum rate must not be negative");
+            }
+
+            ThrowIfNotInitialized();
+
+            _dataSubjectSchedules[subjectName] = (priority, maxRateHz);
+            if (_dataSubjects.ContainsKey(subjectName))
+            {
+                UnrealLiveLinkNative.ULL_SetSubjectSchedule(subjectName, (int)priority, maxRateHz);
+            }
+        }
+
+        /// <summary>
+        /// Reads the native change-detection (deadband) counters
+        /// </summary>
+        /// <returns>Counters since initialization (all 0 when the deadband is disabled)</returns>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public LiveLinkDeadbandCounters GetDeadbandCounters()
+        {
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_GetDeadbandCounters(out ulong sent, out ulong suppressed, out ulong keepAlive);
+            return new LiveLinkDeadbandCounters
+            {
+                SentFrames = sent,
+                SuppressedFrames = suppressed,
+                KeepAliveFrames = keepAlive
+            };
+        }
+
+        /// <summary>
+        /// Declares the regions the viewers look at. Objects outside every region are sent at
+        /// outsideRateHz instead of on every update (their latest position is sent as soon as a
+        /// region covers them). Call again whenever a viewer moves.
+        /// </summary>
+        /// <param name="regions">Regions in Unreal coordinates; null or empty streams every object</param>
+        /// <param name="outsideRateHz">Frames per second outside every region (ULL_INTEREST_SUPPRESS = none)</param>
+        /// <exception cref="ArgumentException">Thrown if there are more than ULL_MAX_INTEREST_REGIONS regions or one is invalid</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if outsideRateHz is negative or above the native maximum</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public void SetInterestRegions(ULL_InterestRegion[]? regions, int outsideRateHz = UnrealLiveLinkNative.ULL_INTEREST_SUPPRESS)
+        {
+            ValidateInterestRegions(regions, outsideRateHz);
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_SetInterestRegions(regions, regions?.Length ?? 0, outsideRateHz);
+        }
+
+        /// <summary>
+        /// Reads the native interest-region counters
+        /// </summary>
+        /// <returns>Counters since initialization (all 0 until regions are declared)</returns>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public LiveLinkInterestCounters GetInterestCounters()
+        {
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_GetInterestCounters(out ulong held, out ulong outside, out int cells);
+            return new LiveLinkInterestCounters
+            {
+                HeldFrames = held,
+                OutsideFrames = outside,
+                GridCells = cells
+            };
+        }
+
+        /// <summary>
+        /// Reads the native Message Bus pump thread statistics
+        /// </summary>
+        /// <returns>Pump statistics (running is 0 when the pump is disabled)</returns>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public ULL_PumpStats GetPumpStats()
+        {
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_GetPumpStats(out ULL_PumpStats stats);
+            return stats;
+        }
+
+        /// <summary>
+        /// Reads the native hot-path statistics (cheap enough to poll from a dashboard)
+        /// </summary>
+        /// <returns>Counters since initialization or the last ResetStats()</returns>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public ULL_Stats GetStats()
+        {
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_GetStats(out ULL_Stats stats);
+            return stats;
+        }
+
+        /// <summary>
+        /// Zeroes the native statistics counters (subject counts are live and unaffected)
+        /// </summary>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public void ResetStats()
+        {
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_ResetStats();
+        }
+
+        /// <summary>
+        /// Starts the native latency probe: a reserved subject sent through the update path
+        /// and timed at each stage (the Unreal-side echo is the SimioLiveLinkSharedMemory plugin)
+        /// </summary>
+        /// <param name="rateHz">Probes per second</param>
+        /// <param name="echoPort">UDP port the Unreal-side echo reports to (0 = in-process stages only)</param>
+        /// <param name="csvPath">CSV file with one row of statistics per second (null or empty = none)</param>
+        /// <returns>True if the probe started (false with subject pools, the shared-memory transport,
+        /// a port in use or an unwritable path)</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if rateHz or echoPort is out of range</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public bool StartLatencyProbe(int rateHz, int echoPort = UnrealLiveLinkNative.ULL_LATENCY_ECHO_DEFAULT_PORT, string? csvPath = null)
+        {
+            if (rateHz < 1 || rateHz > UnrealLiveLinkNative.ULL_LATENCY_MAX_RATE_HZ)
+            {
+                throw new ArgumentOutOfRangeException(nameof(rateHz),
+                    $"Latency probe rate must be between 1 and {UnrealLiveLinkNative.ULL_LATENCY_MAX_RATE_HZ} Hz");
+            }
+            if (echoPort < 0 || echoPort > 65535)
+            {
+                throw new ArgumentOutOfRangeException(nameof(echoPort), "Echo port must be between 0 and 65535");
+            }
+
+            ThrowIfNotInitialized();
+
+            string? path = string.IsNullOrWhiteSpace(csvPath) ? null : csvPath;
+            return UnrealLiveLinkNative.IsSuccess(UnrealLiveLinkNative.ULL_StartLatencyProbe(rateHz, echoPort, path));
+        }
+
+        /// <summary>
+        /// Stops the latency probe and writes its last CSV row (Shutdown also stops it)
+        /// </summary>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public void StopLatencyProbe()
+        {
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_StopLatencyProbe();
+        }
+
+        /// <summary>
+        /// Reads the latency probe statistics (kept after the probe stops until it restarts)
+        /// </summary>
+        /// <returns>Probe counters and per-stage percentiles (zeroed if no probe has run)</returns>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public ULL_LatencyStats GetLatencyStats()
+        {
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_GetLatencyStats(out ULL_LatencyStats stats);
+            return stats;
+        }
+
+        /// <summary>
+        /// Starts recording every frame sent to Unreal to a capture file for later replay
+        /// </summary>
+        /// <param name="filePath">Capture file path (overwritten)</param>
+        /// <returns>True if the capture started (false with the shared-memory transport or an unwritable path)</returns>
+        /// <exception cref="ArgumentException">Thrown if filePath is null or empty</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public bool StartCapture(string filePath)
+        {
+            if (string.IsNullOrWhiteSpace(filePath))
+            {
+                throw new ArgumentException("Capture file path cannot be null or empty", nameof(filePath));
+            }
+
+            ThrowIfNotInitialized();
+
+            return UnrealLiveLinkNative.IsSuccess(UnrealLiveLinkNative.ULL_StartCapture(filePath));
+        }
+
+        /// <summary>
+        /// Finalizes and closes the capture file (Shutdown also closes it)
+        /// </summary>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public void StopCapture()
+        {
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_StopCapture();
+        }
+
+        /// <summary>
+        /// Streams a capture file to Unreal on a native replay thread
+        /// </summary>
+        /// <param name="filePath">Capture file written by StartCapture</param>
+        /// <param name="speed">Playback speed multiplier (1.0 = real time, 0 = start paused)</param>
+        /// <param name="loop">Restart at the end of the capture</param>
+        /// <returns>True if the replay started</returns>
+        /// <exception cref="ArgumentException">Thrown if filePath is null or empty</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if speed is negative or above the native maximum</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public bool StartReplay(string filePath, double speed = 1.0, bool loop = false)
+        {
+            if (string.IsNullOrWhiteSpace(filePath))
+            {
+                throw new ArgumentException("Capture file path cannot be null or empty", nameof(filePath));
+            }
+
+            ValidateReplaySpeed(speed);
+            ThrowIfNotInitialized();
+
+            return UnrealLiveLinkNative.IsSuccess(UnrealLiveLinkNative.ULL_StartReplay(filePath, speed, loop ? 1 : 0));
+        }
+
+        /// <summary>
+        /// Changes replay speed (0 pauses at the current position)
+        /// </summary>
+        /// <param name="speed">Playback speed multiplier</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if speed is negative or above the native maximum</exception>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public void SetReplaySpeed(double speed)
+        {
+            ValidateReplaySpeed(speed);
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_SetReplaySpeed(speed);
+        }
+
+        /// <summary>
+        /// Jumps to a capture time; every subject shows its state at that time
+        /// </summary>
+        /// <param name="seconds">Seconds from the start of the capture (clamped to the capture)</param>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public void SeekReplay(double seconds)
+        {
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_SeekReplay(seconds);
+        }
+
+        /// <summary>
+        /// Stops the replay and removes the replayed subjects from Unreal
+        /// </summary>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public void StopReplay()
+        {
+            ThrowIfNotInitialized();
+
+            UnrealLiveLinkNative.ULL_StopReplay();
+        }
+
+        /// <summary>
+        /// Reads the replay position
+        /// </summary>
+        /// <returns>Position and capture length (IsRunning false when no replay is running)</returns>
+        /// <exception cref="InvalidOperationException">Thrown if not initialized</exception>
+        public LiveLinkReplayStatus GetReplayStatus()
+        {
+            ThrowIfNotInitialized();
+
+            int result = UnrealLiveLinkNative.ULL_GetReplayStatus(out double position, out double duration);
+            return new LiveLinkReplayStatus
+            {
+                IsRunning = UnrealLiveLinkNative.IsSuccess(result),
+                PositionSeconds = position,
+                DurationSeconds = duration
+            };
+        }
+
+        /// <summary>
+        /// Gets debug information about the manager state
+        /// </summary>
         /// <returns>Debug string with initialization status and object count</returns>
         public override string ToString()
         {
@@ -440,9 +1263,215 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             return $"LiveLinkManager({status}{source}, Objects: {_objects.Count})";
         }
 
+        /// <summary>
+        /// Ensures every batch object has a registered updater and collects their native handles
+        /// </summary>
+        /// <param name="objectNames">Object identifiers in batch order</param>
+        /// <param name="propertyNames">Property names to register with, or null for transform-only objects</param>
+        /// <returns>Handles in batch order, or null if any object has no valid handle (use the name-based call)</returns>
+        private int[]? CollectBatchHandles(string[] objectNames, string[]? propertyNames)
+        {
+            var handles = new int[objectNames.Length];
+            bool allValid = true;
+
+            for (int i = 0; i < objectNames.Length; i++)
+            {
+                var updater = GetOrCreateObject(objectNames[i]);
+                if (propertyNames != null)
+                {
+                    updater.RegisterObjectWithProperties(propertyNames);
+                }
+                else
+                {
+                    updater.RegisterObject();
+                }
+
+                handles[i] = updater.Handle;
+                allValid &= handles[i] >= 0;
+            }
+
+            return allValid ? handles : null;
+        }
+
+        /// <summary>
+        /// Validates the name/transform arrays shared by the batch update methods
+        /// </summary>
+        private static void ValidateBatchArguments(string[] objectNames, ULL_Transform[] transforms)
+        {
+            if (objectNames == null)
+            {
+                throw new ArgumentNullException(nameof(objectNames));
+            }
+
+            if (transforms == null)
+            {
+                throw new ArgumentNullException(nameof(transforms));
+            }
+
+            if (objectNames.Length != transforms.Length)
+            {
+                throw new ArgumentException(
+                    $"Object names and transforms must have the same length. " +
+                    $"Names: {objectNames.Length}, Transforms: {transforms.Length}");
+            }
+
+            for (int i = 0; i < objectNames.Length; i++)
+            {
+                if (string.IsNullOrWhiteSpace(objectNames[i]))
+                {
+                    throw new ArgumentException($"Object name at index {i} cannot be null or empty", nameof(objectNames));
+                }
+            }
+        }
+
         /// <summary>
         /// Throws InvalidOperationException if not initialized
         /// </summary>
+        /// <summary>
+        /// Registers a data subject natively unless it is already registered with the same property names
+        /// </summary>
+        private void EnsureDataSubjectRegistered(string subjectName, string[] propertyNames)
+        {
+            if (_dataSubjects.TryGetValue(subjectName, out string[]? registered) &&
+                registered.SequenceEqual(propertyNames, StringComparer.Ordinal))
+            {
+                return;
+            }
+
+            // Copy so later changes to the caller's array are detected as a new layout
+            string[] layout = (string[])propertyNames.Clone();
+            UnrealLiveLinkNative.ULL_RegisterDataSubject(subjectName, layout, layout.Length);
+            _dataSubjects[subjectName] = layout;
+
+            // A new native registration starts at the default tier
+            if (_dataSubjectSchedules.TryGetValue(subjectName, out var schedule))
+            {
+                UnrealLiveLinkNative.ULL_SetSubjectSchedule(subjectName, (int)schedule.Priority, schedule.MaxRateHz);
+            }
+        }
+
+        /// <summary>
+        /// Validates interest regions and the outside rate against the native limits
+        /// (shared with LiveLinkSession)
+        /// </summary>
+        internal static void ValidateInterestRegions(ULL_InterestRegion[]? regions, int outsideRateHz)
+        {
+            if (regions != null)
+            {
+                if (regions.Length > UnrealLiveLinkNative.ULL_MAX_INTEREST_REGIONS)
+                {
+                    throw new ArgumentException(
+                        $"At most {UnrealLiveLinkNative.ULL_MAX_INTEREST_REGIONS} interest regions are supported", nameof(regions));
+                }
+
+                for (int i = 0; i < regions.Length; i++)
+                {
+                    if (!regions[i].IsValid())
+                    {
+                        throw new ArgumentException($"Interest region {i} is invalid: {regions[i]}", nameof(regions));
+                    }
+                }
+            }
+
+            if (outsideRateHz < 0 || outsideRateHz > LiveLinkConfiguration.MaxPublishRateHz)
+            {
+                throw new ArgumentOutOfRangeException(nameof(outsideRateHz),
+                    $"Outside rate must be between 0 and {LiveLinkConfiguration.MaxPublishRateHz} Hz");
+            }
+        }
+
+        /// <summary>
+        /// Validates a replay speed multiplier against the native range
+        /// </summary>
+        private static void ValidateReplaySpeed(double speed)
+        {
+            if (double.IsNaN(speed) || speed < UnrealLiveLinkNative.ULL_REPLAY_PAUSED || speed > UnrealLiveLinkNative.ULL_REPLAY_MAX_SPEED)
+            {
+                throw new ArgumentOutOfRangeException(nameof(speed),
+                    $"Replay speed must be between {UnrealLiveLinkNative.ULL_REPLAY_PAUSED} and {UnrealLiveLinkNative.ULL_REPLAY_MAX_SPEED}");
+            }
+        }
+
+        /// <summary>
+        /// Returns the native schema ID for a property layout, registering it on first use
+        /// </summary>
+        /// <param name="propertyNames">Property names in registration order</param>
+        /// <returns>Schema ID, or a negative return code if the schema could not be registered</returns>
+        internal int GetPropertySchemaId(string[] propertyNames)
+        {
+            string key = string.Join("\n", propertyNames);
+            if (_propertySchemas.TryGetValue(key, out int schemaId))
+            {
+                return schemaId;
+            }
+
+            schemaId = UnrealLiveLinkNative.ULL_RegisterPropertySchema(propertyNames, propertyNames.Length);
+            if (schemaId >= 0)
+            {
+                _propertySchemas[key] = schemaId;
+            }
+
+            return schemaId;
+        }
+
+        /// <summary>
+        /// Creates the deferred frame and the wall-clock flush timer
+        /// Note: Caller must hold _initializationLock
+        /// </summary>
+        private void StartDeferredFrame(int flushRateHz)
+        {
+            _deferredFrame = new LiveLinkFrameBuffer();
+
+            if (flushRateHz > 0)
+            {
+                int periodMs = Math.Max(1, 1000 / flushRateHz);
+                _flushTimer = new System.Threading.Timer(_ =>
+                {
+                    try
+                    {
+                        FlushFrame();
+                    }
+                    catch (Exception)
+                    {
+                        // Timer callbacks must not throw; the next tick retries
+                    }
+                }, null, periodMs, periodMs);
+            }
+        }
+
+        /// <summary>
+        /// Stops the flush timer, sends the pending frame and leaves deferred mode
+        /// Note: Caller must hold _initializationLock
+        /// </summary>
+        private void StopDeferredFrame()
+        {
+            var frame = _deferredFrame;
+            if (frame == null)
+            {
+                return;
+            }
+
+            if (_flushTimer != null)
+            {
+                // Wait for a running callback so no flush races the native shutdown
+                using (var stopped = new System.Threading.ManualResetEvent(false))
+                {
+                    _flushTimer.Dispose(stopped);
+                    stopped.WaitOne();
+                }
+                _flushTimer = null;
+            }
+
+            try
+            {
+                frame.Flush();
+            }
+            finally
+            {
+                _deferredFrame = null;
+            }
+        }
+
         private void ThrowIfNotInitialized()
         {
             if (!_isInitialized)
@@ -11,9 +11,18 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
     {
         private readonly string _objectName;
         private bool _isRegistered;
+        private int _handle; // Native subject handle (ULL_INVALID_HANDLE until registered)
         private bool _hasProperties;
         private string[]? _registeredPropertyNames;
         private float[]? _propertyBuffer; // Reused to avoid allocations
+        private ULL_TransformData _transform; // Reused conversion target, passed to native by pointer
+        private byte[]? _objectNameUtf8; // Cached for the name-based fallback (no per-call string marshaling)
+        private int _frameSlot; // Slot in LiveLinkManager.DeferredFrame while _frameGeneration matches it
+        private long _frameGeneration; // 0 = no pending deferred update
+        private int _framePropertyCount;
+        private LiveLinkPriority _priority = LiveLinkPriority.Normal;
+        private int _maxRateHz; // UnrealLiveLinkNative.ULL_RATE_UNLIMITED unless SetSchedule was called
+        private bool _hasSchedule; // Applied to the native subject on registration
         private bool _disposed;
 
         /// <summary>
@@ -26,16 +35,36 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         /// </summary>
         public bool IsRegistered => _isRegistered;
 
+        /// <summary>
+        /// Gets the native subject handle (ULL_INVALID_HANDLE if not registered or registration failed)
+        /// </summary>
+        public int Handle => _handle;
+
         /// <summary>
         /// Gets whether this object has custom properties
         /// </summary>
         public bool HasProperties => _hasProperties;
 
+        /// <summary>
+        /// Gets whether this updater has been disposed (e.g. by LiveLinkManager.RemoveObject)
+        /// </summary>
+        public bool IsDisposed => _disposed;
+
         /// <summary>
         /// Gets the registered property names (read-only copy)
         /// </summary>
         public string[]? PropertyNames => _registeredPropertyNames?.ToArray();
 
+        /// <summary>
+        /// Gets the publish priority (LiveLinkPriority.Normal unless SetSchedule was called)
+        /// </summary>
+        public LiveLinkPriority Priority => _priority;
+
+        /// <summary>
+        /// Gets the maximum publish rate in Hz (0 = every publish pass)
+        /// </summary>
+        public int MaxRateHz => _maxRateHz;
+
         /// <summary>
         /// Creates a new LiveLink object updater
         /// </summary>
@@ -50,6 +79,7 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
 
             _objectName = objectName;
             _isRegistered = false;
+            _handle = UnrealLiveLinkNative.ULL_INVALID_HANDLE;
             _hasProperties = false;
             _registeredPropertyNames = null;
             _propertyBuffer = null;
@@ -75,27 +105,69 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             double simioRotX, double simioRotY, double simioRotZ,
             double simioScaleX = 1.0, double simioScaleY = 1.0, double simioScaleZ = 1.0)
         {
-            ThrowIfDisposed();
+            PrepareTransformOnlyUpdate(
+                simioX, simioY, simioZ,
+                simioRotX, simioRotY, simioRotZ,
+                simioScaleX, simioScaleY, simioScaleZ);
 
-            // Ensure object is registered without properties
-            EnsureRegistered(withProperties: false);
+            if (TryDefer(ref _transform, 0, double.NaN))
+            {
+                return;
+            }
 
-            // Validate that this object wasn't registered with properties
-            if (_hasProperties)
+            // Update via P/Invoke (handle path skips native name lookup)
+            if (_handle >= 0)
             {
-                throw new InvalidOperationException(
-                    $"Object '{_objectName}' was registered with properties. " +
-                    "Use UpdateWithProperties() instead of UpdateTransform().");
+                UnrealLiveLinkNative.ULL_UpdateObjectH(_handle, ref _transform);
+            }
+            else
+            {
+                UnrealLiveLinkNative.ULL_UpdateObject(GetObjectNameUtf8(), ref _transform);
             }
+        }
 
-            // Convert coordinates
-            var transform = CoordinateConverter.SimioToUnrealTransform(
+        /// <summary>
+        /// Updates object transform only, timestamped with simulation time
+        /// Unreal places the frame on a timeline derived from simulation time, so sparse updates can be interpolated
+        /// Auto-registers object if not already registered
+        /// </summary>
+        /// <param name="simulationTimeSeconds">Simulation time of this state in seconds</param>
+        /// <param name="simioX">Simio X position in meters</param>
+        /// <param name="simioY">Simio Y position in meters</param>
+        /// <param name="simioZ">Simio Z position in meters</param>
+        /// <param name="simioRotX">Simio X rotation in degrees</param>
+        /// <param name="simioRotY">Simio Y rotation in degrees</param>
+        /// <param name="simioRotZ">Simio Z rotation in degrees</param>
+        /// <param name="simioScaleX">Simio X scale factor (optional, default 1.0)</param>
+        /// <param name="simioScaleY">Simio Y scale factor (optional, default 1.0)</param>
+        /// <param name="simioScaleZ">Simio Z scale factor (optional, default 1.0)</param>
+        /// <exception cref="ObjectDisposedException">Thrown if updater has been disposed</exception>
+        /// <exception cref="InvalidOperationException">Thrown if object was registered with properties</exception>
+        public void UpdateTransformAtTime(
+            double simulationTimeSeconds,
+            double simioX, double simioY, double simioZ,
+            double simioRotX, double simioRotY, double simioRotZ,
+            double simioScaleX = 1.0, double simioScaleY = 1.0, double simioScaleZ = 1.0)
+        {
+            PrepareTransformOnlyUpdate(
                 simioX, simioY, simioZ,
                 simioRotX, simioRotY, simioRotZ,
                 simioScaleX, simioScaleY, simioScaleZ);
 
-            // Update via P/Invoke
-            UnrealLiveLinkNative.ULL_UpdateObject(_objectName, ref transform);
+            if (TryDefer(ref _transform, 0, simulationTimeSeconds))
+            {
+                return;
+            }
+
+            // Simulation time is only carried by the handle path
+            if (_handle >= 0)
+            {
+                UnrealLiveLinkNative.ULL_UpdateObjectAtTimeH(_handle, ref _transform, null, 0, simulationTimeSeconds);
+            }
+            else
+            {
+                UnrealLiveLinkNative.ULL_UpdateObject(GetObjectNameUtf8(), ref _transform);
+            }
         }
 
         /// <summary>
@@ -148,7 +220,8 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             }
 
             // Convert coordinates
-            var transform = CoordinateConverter.SimioToUnrealTransform(
+            CoordinateConverter.SimioToUnrealTransform(
+                ref _transform,
                 simioX, simioY, simioZ,
                 simioRotX, simioRotY, simioRotZ,
                 simioScaleX, simioScaleY, simioScaleZ);
@@ -158,8 +231,7 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             Array.Copy(propertyValues, _propertyBuffer, propertyValues.Length);
 
             // Update via P/Invoke
-            UnrealLiveLinkNative.ULL_UpdateObjectWithProperties(
-                _objectName, ref transform, _propertyBuffer!, propertyValues.Length);
+            UpdateWithPropertiesNative(ref _transform, propertyValues.Length);
         }
 
         /// <summary>
@@ -192,6 +264,27 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             EnsureRegisteredWithProperties(propertyNames);
         }
 
+        /// <summary>
+        /// Sets the publish priority and maximum rate of this object (coalescing mode, PublishRateHz > 0)
+        /// Applied now if registered, otherwise when the object registers
+        /// </summary>
+        /// <param name="priority">Order under the publish budget (Low is held back first)</param>
+        /// <param name="maxRateHz">Maximum frames per second for this object (0 = every publish pass)</param>
+        /// <exception cref="ObjectDisposedException">Thrown if updater has been disposed</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if maxRateHz is negative</exception>
+        public void SetSchedule(LiveLinkPriority priority, int maxRateHz = UnrealLiveLinkNative.ULL_RATE_UNLIMITED)
+        {
+            ThrowIfDisposed();
+
+            if (maxRateHz < 0)
+                throw new ArgumentOutOfRangeException(nameof(maxRateHz), "Maximum rate must not be negative");
+
+            _priority = priority;
+            _maxRateHz = maxRateHz;
+            _hasSchedule = true;
+            ApplySchedule();
+        }
+
         /// <summary>
         /// Removes this object from LiveLink
         /// Object becomes stale in Unreal after ~5 seconds
@@ -203,8 +296,23 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
 
             if (_isRegistered)
             {
-                UnrealLiveLinkNative.ULL_RemoveObject(_objectName);
+                if (_frameGeneration != 0)
+                {
+                    // Do not let a pending deferred update reach the handle after it is removed
+                    LiveLinkManager.Instance.DeferredFrame?.Cancel(_framePropertyCount, _frameSlot, ref _frameGeneration);
+                    _frameGeneration = 0;
+                }
+
+                if (_handle >= 0)
+                {
+                    UnrealLiveLinkNative.ULL_RemoveObjectH(_handle);
+                }
+                else
+                {
+                    UnrealLiveLinkNative.ULL_RemoveObject(_objectName);
+                }
                 _isRegistered = false;
+                _handle = UnrealLiveLinkNative.ULL_INVALID_HANDLE;
                 _hasProperties = false;
                 _registeredPropertyNames = null;
             }
@@ -252,19 +360,13 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             }
 
             // Update properties using zero transform (position/rotation won't change)
-            var transform = new ULL_Transform
-            {
-                position = new double[] { 0, 0, 0 },
-                rotation = new double[] { 0, 0, 0, 1 }, // Identity quaternion
-                scale = new double[] { 1, 1, 1 }
-            };
+            var transform = ULL_TransformData.Identity;
 
             // Copy values to our reusable buffer (matching registered property order)
             Array.Copy(propertyValues, _propertyBuffer!, Math.Min(propertyValues.Length, _propertyBuffer!.Length));
 
             // Update via P/Invoke (transform stays at origin, only properties change)
-            UnrealLiveLinkNative.ULL_UpdateObjectWithProperties(
-                _objectName, ref transform, _propertyBuffer!, propertyValues.Length);
+            UpdateWithPropertiesNative(ref transform, propertyValues.Length);
         }
 
         /// <summary>
@@ -362,9 +464,10 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
                     "Use EnsureRegisteredWithProperties() instead.");
             }
 
-            UnrealLiveLinkNative.ULL_RegisterObject(_objectName);
+            _handle = UnrealLiveLinkNative.ULL_RegisterObjectH(_objectName);
             _isRegistered = true;
             _hasProperties = false;
+            ApplySchedule();
         }
 
         /// <summary>
@@ -395,13 +498,132 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
                 return;
             }
 
-            // Register for the first time with properties
-            UnrealLiveLinkNative.ULL_RegisterObjectWithProperties(
-                _objectName, propertyNames, propertyNames.Length);
+            // Register for the first time with properties (objects with the same layout share one native schema)
+            int schemaId = LiveLinkManager.Instance.GetPropertySchemaId(propertyNames);
+            _handle = schemaId >= 0
+                ? UnrealLiveLinkNative.ULL_RegisterObjectWithSchemaH(_objectName, schemaId)
+                : UnrealLiveLinkNative.ULL_RegisterObjectWithPropertiesH(_objectName, propertyNames, propertyNames.Length);
 
             _isRegistered = true;
             _hasProperties = true;
             _registeredPropertyNames = propertyNames.ToArray(); // Store a copy
+            ApplySchedule();
+        }
+
+        /// <summary>
+        /// Takes over a handle registered natively by a batch registration (LiveLinkManager.PrewarmObjects)
+        /// </summary>
+        /// <param name="handle">Native subject handle</param>
+        /// <param name="propertyNames">Property names the handle was registered with, or null for transform only</param>
+        /// <returns>True if adopted, false if this updater was already registered</returns>
+        internal bool AdoptRegistration(int handle, string[]? propertyNames)
+        {
+            ThrowIfDisposed();
+
+            if (_isRegistered)
+            {
+                return false;
+            }
+
+            _handle = handle;
+            _isRegistered = true;
+            _hasProperties = propertyNames != null;
+            _registeredPropertyNames = propertyNames?.ToArray();
+            ApplySchedule();
+            return true;
+        }
+
+        /// <summary>
+        /// Sends the schedule set by SetSchedule to the native subject (no-op until registered with a handle)
+        /// </summary>
+        private void ApplySchedule()
+        {
+            if (_hasSchedule && _handle >= 0)
+            {
+                UnrealLiveLinkNative.ULL_SetObjectScheduleH(_handle, (int)_priority, _maxRateHz);
+            }
+        }
+
+        /// <summary>
+        /// Registers without properties if needed and converts a transform-only update into the reused transform
+        /// </summary>
+        private void PrepareTransformOnlyUpdate(
+            double simioX, double simioY, double simioZ,
+            double simioRotX, double simioRotY, double simioRotZ,
+            double simioScaleX, double simioScaleY, double simioScaleZ)
+        {
+            ThrowIfDisposed();
+
+            // Ensure object is registered without properties
+            EnsureRegistered(withProperties: false);
+
+            // Validate that this object wasn't registered with properties
+            if (_hasProperties)
+            {
+                throw new InvalidOperationException(
+                    $"Object '{_objectName}' was registered with properties. " +
+                    "Use UpdateWithProperties() instead of UpdateTransform().");
+            }
+
+            // Convert coordinates
+            CoordinateConverter.SimioToUnrealTransform(
+                ref _transform,
+                simioX, simioY, simioZ,
+                simioRotX, simioRotY, simioRotZ,
+                simioScaleX, simioScaleY, simioScaleZ);
+        }
+
+        /// <summary>
+        /// Sends the property buffer, using the native handle when registration returned one
+        /// </summary>
+        /// <param name="transform">Transform in Unreal coordinates</param>
+        /// <param name="propertyCount">Number of values in the property buffer to send</param>
+        private void UpdateWithPropertiesNative(ref ULL_TransformData transform, int propertyCount)
+        {
+            if (TryDefer(ref transform, propertyCount, double.NaN))
+            {
+                return;
+            }
+
+            if (_handle >= 0)
+            {
+                UnrealLiveLinkNative.ULL_UpdateObjectWithPropertiesH(
+                    _handle, ref transform, _propertyBuffer!, propertyCount);
+            }
+            else
+            {
+                UnrealLiveLinkNative.ULL_UpdateObjectWithProperties(
+                    GetObjectNameUtf8(), ref transform, _propertyBuffer!, propertyCount);
+            }
+        }
+
+        /// <summary>
+        /// Writes the update into the deferred frame instead of sending it (deferred mode with a valid handle)
+        /// </summary>
+        /// <param name="transform">Transform in Unreal coordinates</param>
+        /// <param name="propertyCount">Number of values in the property buffer to send</param>
+        /// <param name="simulationTimeSeconds">Simulation time of this state, or NaN</param>
+        /// <returns>True if deferred, false if the caller must send now</returns>
+        private bool TryDefer(ref ULL_TransformData transform, int propertyCount, double simulationTimeSeconds)
+        {
+            var frame = LiveLinkManager.Instance.DeferredFrame;
+            if (frame == null || _handle < 0)
+            {
+                return false;
+            }
+
+            frame.Write(_handle, ref transform, _propertyBuffer, propertyCount, simulationTimeSeconds,
+                ref _frameSlot, ref _frameGeneration);
+            _framePropertyCount = propertyCount;
+            return true;
+        }
+
+        /// <summary>
+        /// Gets the null-terminated UTF-8 object name, encoding it on first use
+        /// </summary>
+        private byte[] GetObjectNameUtf8()
+        {
+            return _objectNameUtf8 ??= UnrealLiveLinkNative.GetUtf8Name(_objectName);
         }
 
         /// <summary>
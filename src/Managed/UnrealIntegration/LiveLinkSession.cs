@@ -0,0 +1,214 @@
+using System;
+using System.Threading;
+
+namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
+{
+    /// <summary>
+    /// Independent native LiveLink session with its own provider, subject tables, lock and
+    /// worker threads. Use one per model or experiment replication running in parallel in the
+    /// same process, so they neither serialize on the LiveLinkManager bridge nor share a
+    /// subject namespace. Handles are only valid in the session that returned them.
+    /// </summary>
+    public sealed class LiveLinkSession : IDisposable
+    {
+        private readonly string _providerName;
+        private int _sessionId; // ULL_DEFAULT_SESSION once disposed
+
+        /// <summary>
+        /// Gets the native session ID
+        /// </summary>
+        public int SessionId => _sessionId;
+
+        /// <summary>
+        /// Gets the provider name shown in Unreal's LiveLink window
+        /// </summary>
+        public string ProviderName => _providerName;
+
+        /// <summary>
+        /// Gets whether the session has been destroyed
+        /// </summary>
+        public bool IsDisposed => _sessionId == UnrealLiveLinkNative.ULL_DEFAULT_SESSION;
+
+        private LiveLinkSession(int sessionId, string providerName)
+        {
+            _sessionId = sessionId;
+            _providerName = providerName;
+        }
+
+        /// <summary>
+        /// Creates a native session
+        /// </summary>
+        /// <param name="providerName">Provider name, unique among live sessions and the LiveLinkManager source</param>
+        /// <param name="configuration">Native settings (send mode, publish rate, deadband...); null = defaults</param>
+        /// <returns>The new session</returns>
+        /// <exception cref="ArgumentException">Thrown if providerName is null or empty</exception>
+        /// <exception cref="LiveLinkInitializationException">Thrown if the native session could not be created</exception>
+        public static LiveLinkSession Create(string providerName, LiveLinkConfiguration? configuration = null)
+        {
+            if (string.IsNullOrWhiteSpace(providerName))
+                throw new ArgumentException("Provider name cannot be null or empty", nameof(providerName));
+
+            var options = ULL_InitOptions.FromConfiguration(configuration ?? new LiveLinkConfiguration { SourceName = providerName });
+            int sessionId = UnrealLiveLinkNative.ULL_CreateSession(providerName, ref options);
+            if (sessionId <= UnrealLiveLinkNative.ULL_DEFAULT_SESSION)
+            {
+                throw new LiveLinkInitializationException(
+                    $"Native LiveLink session '{providerName}' could not be created " +
+                    $"(provider name in use, {UnrealLiveLinkNative.ULL_MAX_SESSIONS} sessions open, or initialization failed)");
+            }
+
+            return new LiveLinkSession(sessionId, providerName);
+        }
+
+        /// <summary>
+        /// Registers a transform subject in this session
+        /// </summary>
+        /// <param name="objectName">Subject name (unique within the session)</param>
+        /// <param name="propertyNames">Custom property names, or null for transform only</param>
+        /// <returns>Handle (>= 0), or a negative ULL_* return code</returns>
+        /// <exception cref="ArgumentException">Thrown if objectName is null or empty</exception>
+        /// <exception cref="ObjectDisposedException">Thrown if the session has been destroyed</exception>
+        public int RegisterObject(string objectName, string[]? propertyNames = null)
+        {
+            if (string.IsNullOrWhiteSpace(objectName))
+                throw new ArgumentException("Object name cannot be null or empty", nameof(objectName));
+            ThrowIfDisposed();
+
+            return propertyNames != null && propertyNames.Length > 0
+                ? UnrealLiveLinkNative.ULL_SessionRegisterObjectWithPropertiesH(_sessionId, objectName, propertyNames, propertyNames.Length)
+                : UnrealLiveLinkNative.ULL_SessionRegisterObjectH(_sessionId, objectName);
+        }
+
+        /// <summary>
+        /// Updates many objects of this session in one native call
+        /// </summary>
+        /// <param name="handles">Handles returned by RegisterObject</param>
+        /// <param name="transforms">Transforms in Unreal coordinates (one per handle)</param>
+        /// <param name="propertyValues">propertyCount values per handle, or null</param>
+        /// <param name="propertyCount">Property values per object (must match registration)</param>
+        /// <exception cref="ArgumentNullException">Thrown if handles or transforms is null</exception>
+        /// <exception cref="ArgumentException">Thrown if the array lengths do not match</exception>
+        /// <exception cref="ObjectDisposedException">Thrown if the session has been destroyed</exception>
+        public void UpdateObjects(int[] handles, ULL_Transform[] transforms, float[]? propertyValues = null, int propertyCount = 0)
+        {
+            if (handles == null)
+                throw new ArgumentNullException(nameof(handles));
+            if (transforms == null)
+                throw new ArgumentNullException(nameof(transforms));
+            if (handles.Length != transforms.Length)
+                throw new ArgumentException("Handles and transforms must have the same length", nameof(transforms));
+            if (propertyCount < 0 || (propertyCount > 0 && (propertyValues == null || propertyValues.Length < handles.Length * propertyCount)))
+                throw new ArgumentException("Property values must hold propertyCount values per object", nameof(propertyValues));
+            ThrowIfDisposed();
+
+            if (handles.Length == 0)
+                return;
+
+            UnrealLiveLinkNative.ULL_SessionUpdateObjectsBatchWithPropertiesH(
+                _sessionId, handles, transforms, propertyCount > 0 ? propertyValues : null, propertyCount, handles.Length);
+        }
+
+        /// <summary>
+        /// Removes a transform subject of this session (invalid handles are ignored)
+        /// </summary>
+        /// <param name="handle">Handle returned by RegisterObject</param>
+        public void RemoveObject(int handle)
+        {
+            if (IsDisposed)
+                return;
+
+            UnrealLiveLinkNative.ULL_SessionRemoveObjectH(_sessionId, handle);
+        }
+
+        /// <summary>
+        /// Updates a data subject of this session, registering it on first use when property names are given
+        /// </summary>
+        /// <param name="subjectName">Data subject name</param>
+        /// <param name="propertyNames">Property names (required for the first update), or null</param>
+        /// <param name="propertyValues">Property values</param>
+        /// <exception cref="ArgumentException">Thrown if subjectName is null or empty, or the arrays do not match</exception>
+        /// <exception cref="ArgumentNullException">Thrown if propertyValues is null</exception>
+        /// <exception cref="ObjectDisposedException">Thrown if the session has been destroyed</exception>
+        public void UpdateDataSubject(string subjectName, string[]? propertyNames, float[] propertyValues)
+        {
+            if (string.IsNullOrWhiteSpace(subjectName))
+                throw new ArgumentException("Subject name cannot be null or empty", nameof(subjectName));
+            if (propertyValues == null)
+                throw new ArgumentNullException(nameof(propertyValues));
+            if (propertyNames != null && propertyNames.Length != propertyValues.Length)
+                throw new ArgumentException("Property names and values must have the same length", nameof(propertyValues));
+            ThrowIfDisposed();
+
+            UnrealLiveLinkNative.ULL_SessionUpdateDataSubject(_sessionId, subjectName, propertyNames, propertyValues, propertyValues.Length);
+        }
+
+        /// <summary>
+        /// Removes a data subject of this session
+        /// </summary>
+        /// <param name="subjectName">Data subject name</param>
+        public void RemoveDataSubject(string subjectName)
+        {
+            if (string.IsNullOrWhiteSpace(subjectName) || IsDisposed)
+                return;
+
+            UnrealLiveLinkNative.ULL_SessionRemoveDataSubject(_sessionId, subjectName);
+        }
+
+        /// <summary>
+        /// Declares the regions the viewers of this session look at (see LiveLinkManager.SetInterestRegions)
+        /// </summary>
+        /// <param name="regions">Regions in Unreal coordinates; null or empty streams every object</param>
+        /// <param name="outsideRateHz">Frames per second outside every region (ULL_INTEREST_SUPPRESS = none)</param>
+        /// <exception cref="ArgumentException">Thrown if there are more than ULL_MAX_INTEREST_REGIONS regions or one is invalid</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if outsideRateHz is negative or above the native maximum</exception>
+        /// <exception cref="ObjectDisposedException">Thrown if the session has been destroyed</exception>
+        public void SetInterestRegions(ULL_InterestRegion[]? regions, int outsideRateHz = UnrealLiveLinkNative.ULL_INTEREST_SUPPRESS)
+        {
+            LiveLinkManager.ValidateInterestRegions(regions, outsideRateHz);
+            ThrowIfDisposed();
+
+            UnrealLiveLinkNative.ULL_SessionSetInterestRegions(_sessionId, regions, regions?.Length ?? 0, outsideRateHz);
+        }
+
+        /// <summary>
+        /// Reads this session's native hot-path statistics
+        /// </summary>
+        /// <returns>Counters since the session was created</returns>
+        /// <exception cref="ObjectDisposedException">Thrown if the session has been destroyed</exception>
+        public ULL_Stats GetStats()
+        {
+            ThrowIfDisposed();
+
+            UnrealLiveLinkNative.ULL_SessionGetStats(_sessionId, out ULL_Stats stats);
+            return stats;
+        }
+
+        /// <summary>
+        /// Destroys the native session and removes its subjects from Unreal. Safe to call multiple times.
+        /// </summary>
+        public void Dispose()
+        {
+            int sessionId = Interlocked.Exchange(ref _sessionId, UnrealLiveLinkNative.ULL_DEFAULT_SESSION);
+            if (sessionId != UnrealLiveLinkNative.ULL_DEFAULT_SESSION)
+            {
+                UnrealLiveLinkNative.ULL_DestroySession(sessionId);
+            }
+        }
+
+        /// <summary>
+        /// Returns string representation for debugging
+        /// </summary>
+        public override string ToString()
+        {
+            return IsDisposed
+                ? $"LiveLinkSession[{_providerName}, Disposed]"
+                : $"LiveLinkSession[{_providerName}, Id={_sessionId}]";
+        }
+
+        private void ThrowIfDisposed()
+        {
+            if (IsDisposed)
+                throw new ObjectDisposedException(nameof(LiveLinkSession), $"Session '{_providerName}' has been destroyed");
+        }
+    }
+}
@@ -1,3 +1,4 @@
+using System;
 using System.Runtime.InteropServices;
 
 namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
@@ -98,6 +99,982 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         }
     }
 
+    /// <summary>
+    /// Blittable 80-byte transform with the same layout as native ULL_Transform.
+    /// Unlike ULL_Transform, it holds no arrays: it costs no allocation to build and
+    /// is passed to native code by pointer (arrays of it are pinned, not copied).
+    /// Use it on the per-step update path; fill it with CoordinateConverter.SimioToUnrealTransform(ref ...).
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ULL_TransformData
+    {
+        /// <summary>
+        /// Position in centimeters (Unreal coordinate system)
+        /// </summary>
+        public double positionX;
+        public double positionY;
+        public double positionZ;
+
+        /// <summary>
+        /// Rotation as normalized quaternion
+        /// </summary>
+        public double rotationX;
+        public double rotationY;
+        public double rotationZ;
+        public double rotationW;
+
+        /// <summary>
+        /// Scale factors
+        /// </summary>
+        public double scaleX;
+        public double scaleY;
+        public double scaleZ;
+
+        /// <summary>
+        /// Transform at origin with no rotation and unit scale
+        /// </summary>
+        public static ULL_TransformData Identity => new ULL_TransformData
+        {
+            rotationW = 1.0,
+            scaleX = 1.0,
+            scaleY = 1.0,
+            scaleZ = 1.0
+        };
+
+        /// <summary>
+        /// Copies an array-based transform
+        /// </summary>
+        /// <param name="transform">Transform in Unreal coordinates (must be valid)</param>
+        /// <returns>Blittable copy</returns>
+        /// <exception cref="ArgumentException">Thrown if transform arrays are missing or have wrong dimensions</exception>
+        public static ULL_TransformData FromTransform(ULL_Transform transform)
+        {
+            if (!transform.IsValid())
+                throw new ArgumentException("Transform arrays must hold 3 position, 4 rotation and 3 scale values", nameof(transform));
+
+            return new ULL_TransformData
+            {
+                positionX = transform.position[0],
+                positionY = transform.position[1],
+                positionZ = transform.position[2],
+                rotationX = transform.rotation[0],
+                rotationY = transform.rotation[1],
+                rotationZ = transform.rotation[2],
+                rotationW = transform.rotation[3],
+                scaleX = transform.scale[0],
+                scaleY = transform.scale[1],
+                scaleZ = transform.scale[2]
+            };
+        }
+
+        /// <summary>
+        /// Creates an array-based copy (allocates)
+        /// </summary>
+        /// <returns>Equivalent ULL_Transform</returns>
+        public ULL_Transform ToTransform()
+        {
+            return ULL_Transform.Create(
+                positionX, positionY, positionZ,
+                rotationX, rotationY, rotationZ, rotationW,
+                scaleX, scaleY, scaleZ);
+        }
+
+        /// <summary>
+        /// String representation for debugging
+        /// </summary>
+        /// <returns>Human-readable transform description</returns>
+        public override string ToString()
+        {
+            return $"ULL_TransformData(pos:[{positionX:F2},{positionY:F2},{positionZ:F2}], " +
+                   $"rot:[{rotationX:F3},{rotationY:F3},{rotationZ:F3},{rotationW:F3}], " +
+                   $"scale:[{scaleX:F2},{scaleY:F2},{scaleZ:F2}])";
+        }
+    }
+
+    /// <summary>
+    /// 20-byte transform matching native ULL_CompactTransform layout (blittable).
+    /// Float32 position and a smallest-three quantized quaternion; scale is unit unless
+    /// ULL_COMPACT_HAS_SCALE is set, in which case the scale triple is passed separately.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Pack = 4)]
+    public struct ULL_CompactTransform
+    {
+        private static readonly double Sqrt2 = Math.Sqrt(2.0);
+
+        /// <summary>
+        /// Position X in centimeters (Unreal coordinate system)
+        /// </summary>
+        public float positionX;
+
+        /// <summary>
+        /// Position Y in centimeters
+        /// </summary>
+        public float positionY;
+
+        /// <summary>
+        /// Position Z in centimeters
+        /// </summary>
+        public float positionZ;
+
+        /// <summary>
+        /// Smallest-three quaternion components (16 bits each, or 3 x 10 bits across the first two)
+        /// </summary>
+        public ushort rotation0;
+        public ushort rotation1;
+        public ushort rotation2;
+
+        /// <summary>
+        /// ULL_COMPACT_* flags (dropped component index, scale, rotation encoding)
+        /// </summary>
+        public ushort flags;
+
+        /// <summary>
+        /// True when this transform takes a scale triple from the batch's scales array
+        /// </summary>
+        public bool HasScale => (flags & UnrealLiveLinkNative.ULL_COMPACT_HAS_SCALE) != 0;
+
+        /// <summary>
+        /// Packs a full transform. Non-unit scale sets ULL_COMPACT_HAS_SCALE; the caller passes the scale itself.
+        /// </summary>
+        /// <param name="transform">Transform in Unreal coordinates</param>
+        /// <param name="rotation32">Use the 32-bit rotation encoding instead of 48-bit</param>
+        /// <returns>Compact transform</returns>
+        public static ULL_CompactTransform FromTransform(ULL_Transform transform, bool rotation32 = false)
+        {
+            var compact = Create(
+                transform.position[0], transform.position[1], transform.position[2],
+                transform.rotation[0], transform.rotation[1], transform.rotation[2], transform.rotation[3],
+                rotation32);
+
+            if (transform.scale[0] != 1.0 || transform.scale[1] != 1.0 || transform.scale[2] != 1.0)
+            {
+                compact.flags |= UnrealLiveLinkNative.ULL_COMPACT_HAS_SCALE;
+            }
+
+            return compact;
+        }
+
+        /// <summary>
+        /// Packs a position and normalized quaternion (unit scale)
+        /// </summary>
+        /// <param name="posX">X position in centimeters</param>
+        /// <param name="posY">Y position in centimeters</param>
+        /// <param name="posZ">Z position in centimeters</param>
+        /// <param name="rotX">Quaternion X component</param>
+        /// <param name="rotY">Quaternion Y component</param>
+        /// <param name="rotZ">Quaternion Z component</param>
+        /// <param name="rotW">Quaternion W component</param>
+        /// <param name="rotation32">Use the 32-bit rotation encoding instead of 48-bit</param>
+        /// <returns>Compact transform</returns>
+        public static ULL_CompactTransform Create(
+            double posX, double posY, double posZ,
+            double rotX, double rotY, double rotZ, double rotW,
+            bool rotation32 = false)
+        {
+            // Scalars only: this runs per object update, so it must not allocate
+            int largest = 0;
+            double largestValue = rotX;
+            if (Math.Abs(rotY) > Math.Abs(largestValue)) { largest = 1; largestValue = rotY; }
+            if (Math.Abs(rotZ) > Math.Abs(largestValue)) { largest = 2; largestValue = rotZ; }
+            if (Math.Abs(rotW) > Math.Abs(largestValue)) { largest = 3; largestValue = rotW; }
+
+            // The other three components, in order
+            double small0 = largest == 0 ? rotY : rotX;
+            double small1 = largest <= 1 ? rotZ : rotY;
+            double small2 = largest <= 2 ? rotW : rotZ;
+
+            // q and -q are the same rotation: make the dropped component positive
+            double sign = largestValue < 0.0 ? -1.0 : 1.0;
+            double maxValue = rotation32 ? 1023.0 : 65535.0;
+            uint quantized0 = QuantizeComponent(sign * small0, maxValue);
+            uint quantized1 = QuantizeComponent(sign * small1, maxValue);
+            uint quantized2 = QuantizeComponent(sign * small2, maxValue);
+
+            var compact = new ULL_CompactTransform
+            {
+                positionX = (float)posX,
+                positionY = (float)posY,
+                positionZ = (float)posZ,
+                flags = (ushort)(largest | (rotation32 ? UnrealLiveLinkNative.ULL_COMPACT_ROTATION_32 : 0))
+            };
+
+            if (rotation32)
+            {
+                uint packed = quantized0 | (quantized1 << 10) | (quantized2 << 20);
+                compact.rotation0 = (ushort)(packed & 0xFFFF);
+                compact.rotation1 = (ushort)(packed >> 16);
+            }
+            else
+            {
+                compact.rotation0 = (ushort)quantized0;
+                compact.rotation1 = (ushort)quantized1;
+                compact.rotation2 = (ushort)quantized2;
+            }
+
+            return compact;
+        }
+
+        private static uint QuantizeComponent(double value, double maxValue)
+        {
+            double normalized = (value * Sqrt2 + 1.0) * 0.5;
+            return (uint)Math.Round(Math.Max(0.0, Math.Min(1.0, normalized)) * maxValue);
+        }
+
+        /// <summary>
+        /// Expands to a full transform the way the native layer does (for diagnostics and tests)
+        /// </summary>
+        /// <param name="scaleX">X scale (used when HasScale)</param>
+        /// <param name="scaleY">Y scale (used when HasScale)</param>
+        /// <param name="scaleZ">Z scale (used when HasScale)</param>
+        /// <returns>Full transform</returns>
+        public ULL_Transform ToTransform(double scaleX = 1.0, double scaleY = 1.0, double scaleZ = 1.0)
+        {
+            var small = new double[3];
+            if ((flags & UnrealLiveLinkNative.ULL_COMPACT_ROTATION_32) != 0)
+            {
+                uint packed = rotation0 | ((uint)rotation1 << 16);
+                for (int k = 0; k < 3; k++)
+                {
+                    small[k] = (((packed >> (10 * k)) & 0x3FF) * (2.0 / 1023.0) - 1.0) / Sqrt2;
+                }
+            }
+            else
+            {
+                small[0] = (rotation0 * (2.0 / 65535.0) - 1.0) / Sqrt2;
+                small[1] = (rotation1 * (2.0 / 65535.0) - 1.0) / Sqrt2;
+                small[2] = (rotation2 * (2.0 / 65535.0) - 1.0) / Sqrt2;
+            }
+
+            int largest = flags & UnrealLiveLinkNative.ULL_COMPACT_LARGEST_MASK;
+            double largestValue = Math.Sqrt(Math.Max(0.0, 1.0 - (small[0] * small[0] + small[1] * small[1] + small[2] * small[2])));
+            var quaternion = new double[4];
+            for (int c = 0, k = 0; c < 4; c++)
+            {
+                quaternion[c] = c == largest ? largestValue : small[k++];
+            }
+
+            double magnitude = Math.Sqrt(quaternion[0] * quaternion[0] + quaternion[1] * quaternion[1] +
+                                         quaternion[2] * quaternion[2] + quaternion[3] * quaternion[3]);
+
+            return ULL_Transform.Create(
+                positionX, positionY, positionZ,
+                quaternion[0] / magnitude, quaternion[1] / magnitude, quaternion[2] / magnitude, quaternion[3] / magnitude,
+                HasScale ? scaleX : 1.0, HasScale ? scaleY : 1.0, HasScale ? scaleZ : 1.0);
+        }
+    }
+
+    /// <summary>
+    /// How the native layer delivers frames to LiveLink
+    /// </summary>
+    public enum LiveLinkSendMode
+    {
+        /// <summary>
+        /// Frames are sent on the calling thread (original behavior)
+        /// </summary>
+        Synchronous = 0,
+
+        /// <summary>
+        /// Frames are queued and sent by a dedicated native worker thread
+        /// </summary>
+        Asynchronous = 1
+    }
+
+    /// <summary>
+    /// What the native send queue does when it is full (asynchronous send mode only)
+    /// </summary>
+    public enum LiveLinkQueuePolicy
+    {
+        /// <summary>
+        /// Discard the oldest queued frame so the caller never waits
+        /// </summary>
+        DropOldest = 0,
+
+        /// <summary>
+        /// Wait until the worker thread frees space
+        /// </summary>
+        Block = 1
+    }
+
+    /// <summary>
+    /// How transform frames reach Unreal Engine (data subjects always use the Message Bus)
+    /// </summary>
+    public enum LiveLinkTransport
+    {
+        /// <summary>
+        /// LiveLink Message Bus (UDP multicast), works across machines
+        /// </summary>
+        MessageBus = 0,
+
+        /// <summary>
+        /// Same-host shared memory read by the SimioLiveLinkSharedMemory Unreal plugin
+        /// </summary>
+        SharedMemory = 1
+    }
+
+    /// <summary>
+    /// Publish priority of a subject under the publish budget (coalescing mode only)
+    /// </summary>
+    public enum LiveLinkPriority
+    {
+        /// <summary>
+        /// Published first (objects near the camera)
+        /// </summary>
+        High = 0,
+
+        /// <summary>
+        /// Default for every subject
+        /// </summary>
+        Normal = 1,
+
+        /// <summary>
+        /// Held back first when the publish budget is spent (far-away objects, KPIs)
+        /// </summary>
+        Low = 2
+    }
+
+    /// <summary>
+    /// Initialization options matching native ULL_InitOptions layout (passed to ULL_InitializeEx)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Pack = 4)]
+    public struct ULL_InitOptions
+    {
+        /// <summary>
+        /// Size of this structure in bytes (lets the native side accept older/newer callers)
+        /// </summary>
+        public int structSize;
+
+        /// <summary>
+        /// ULL_SEND_MODE_SYNC (0) or ULL_SEND_MODE_ASYNC (1)
+        /// </summary>
+        public int sendMode;
+
+        /// <summary>
+        /// Send queue capacity in frames (0 = native default)
+        /// </summary>
+        public int queueDepth;
+
+        /// <summary>
+        /// ULL_QUEUE_POLICY_DROP_OLDEST (0) or ULL_QUEUE_POLICY_BLOCK (1)
+        /// </summary>
+        public int queuePolicy;
+
+        /// <summary>
+        /// Coalescing publish rate in Hz (0 = send every update immediately)
+        /// </summary>
+        public int publishRateHz;
+
+        /// <summary>
+        /// Skip frames unchanged within the deadband thresholds (0 = disabled, 1 = enabled)
+        /// </summary>
+        public int deadbandEnabled;
+
+        /// <summary>
+        /// Position deadband in centimeters
+        /// </summary>
+        public float positionDeadband;
+
+        /// <summary>
+        /// Rotation deadband in degrees
+        /// </summary>
+        public float rotationDeadbandDegrees;
+
+        /// <summary>
+        /// Absolute property value deadband
+        /// </summary>
+        public float propertyDeadband;
+
+        /// <summary>
+        /// Resend interval for unchanged subjects in milliseconds (0 = native default)
+        /// </summary>
+        public int keepAliveIntervalMs;
+
+        /// <summary>
+        /// Message Bus pump thread rate in Hz (0 = native default, -1 = disabled)
+        /// </summary>
+        public int pumpRateHz;
+
+        /// <summary>
+        /// ULL_TRANSPORT_MESSAGE_BUS (0) or ULL_TRANSPORT_SHARED_MEMORY (1)
+        /// </summary>
+        public int transport;
+
+        /// <summary>
+        /// Shared-memory subject slots (0 = native default)
+        /// </summary>
+        public int sharedMemoryCapacity;
+
+        /// <summary>
+        /// Shared-memory property values per subject (0 = native default)
+        /// </summary>
+        public int sharedMemoryMaxProperties;
+
+        /// <summary>
+        /// Playback seconds per simulation second for ULL_Update*AtTimeH (0 = 1.0)
+        /// </summary>
+        public float simTimeScale;
+
+        /// <summary>
+        /// Scene time frame rate for ULL_Update*AtTimeH (0 = native default)
+        /// </summary>
+        public int sceneFrameRate;
+
+        /// <summary>
+        /// Pooled subjects per property schema (0 = pool mode off)
+        /// </summary>
+        public int subjectPoolSize;
+
+        /// <summary>
+        /// Publish budget in frames per second across all subjects (0 = unlimited)
+        /// </summary>
+        public int publishFrameBudget;
+
+        /// <summary>
+        /// Publish budget in estimated bytes per second across all subjects (0 = unlimited)
+        /// </summary>
+        public int publishByteBudget;
+
+        /// <summary>
+        /// ULL_INIT_MODE_SYNC (0) or ULL_INIT_MODE_ASYNC (1, engine runtime staged in the background)
+        /// </summary>
+        public int initMode;
+
+        /// <summary>
+        /// Creates options with structSize filled in
+        /// </summary>
+        /// <param name="sendMode">Frame delivery mode</param>
+        /// <param name="queueDepth">Send queue capacity in frames</param>
+        /// <param name="queuePolicy">Full-queue behavior</param>
+        /// <param name="publishRateHz">Coalescing publish rate in Hz (0 = disabled)</param>
+        /// <returns>Options ready to pass to ULL_InitializeEx</returns>
+        public static ULL_InitOptions Create(LiveLinkSendMode sendMode, int queueDepth, LiveLinkQueuePolicy queuePolicy, int publishRateHz = 0)
+        {
+            return new ULL_InitOptions
+            {
+                structSize = Marshal.SizeOf(typeof(ULL_InitOptions)),
+                sendMode = (int)sendMode,
+                queueDepth = queueDepth,
+                queuePolicy = (int)queuePolicy,
+                publishRateHz = publishRateHz
+            };
+        }
+
+        /// <summary>
+        /// Creates options from every native setting in a configuration
+        /// </summary>
+        /// <param name="configuration">Validated configuration</param>
+        /// <returns>Options ready to pass to ULL_InitializeEx</returns>
+        public static ULL_InitOptions FromConfiguration(LiveLinkConfiguration configuration)
+        {
+            var options = Create(configuration.SendMode, configuration.QueueDepth, configuration.QueuePolicy, configuration.PublishRateHz);
+            options.deadbandEnabled = configuration.EnableDeadband ? 1 : 0;
+            options.positionDeadband = (float)configuration.PositionDeadband;
+            options.rotationDeadbandDegrees = (float)configuration.RotationDeadbandDegrees;
+            options.propertyDeadband = (float)configuration.PropertyDeadband;
+            options.keepAliveIntervalMs = configuration.KeepAliveIntervalMs;
+            options.pumpRateHz = configuration.MessageBusPumpRateHz > 0
+                ? configuration.MessageBusPumpRateHz
+                : UnrealLiveLinkNative.ULL_PUMP_DISABLED;
+            options.transport = (int)configuration.Transport;
+            options.sharedMemoryCapacity = configuration.SharedMemoryCapacity;
+            options.sharedMemoryMaxProperties = configuration.SharedMemoryMaxProperties;
+            options.simTimeScale = (float)configuration.SimulationTimeScale;
+            options.sceneFrameRate = configuration.SceneFrameRate;
+            options.subjectPoolSize = configuration.SubjectPoolSize;
+            options.publishFrameBudget = configuration.PublishFrameBudget;
+            options.publishByteBudget = configuration.PublishByteBudget;
+            options.initMode = configuration.AsyncInitialization
+                ? UnrealLiveLinkNative.ULL_INIT_MODE_ASYNC
+                : UnrealLiveLinkNative.ULL_INIT_MODE_SYNC;
+            return options;
+        }
+    }
+
+    /// <summary>
+    /// Message Bus pump thread statistics matching native ULL_PumpStats layout
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ULL_PumpStats
+    {
+        /// <summary>
+        /// Ticks run since initialization
+        /// </summary>
+        public ulong tickCount;
+
+        /// <summary>
+        /// Ticks that took longer than the pump interval (the pump is falling behind)
+        /// </summary>
+        public ulong overrunCount;
+
+        /// <summary>
+        /// Duration of the most recent tick in milliseconds
+        /// </summary>
+        public double lastTickMs;
+
+        /// <summary>
+        /// Longest tick in milliseconds
+        /// </summary>
+        public double maxTickMs;
+
+        /// <summary>
+        /// Mean tick duration in milliseconds
+        /// </summary>
+        public double averageTickMs;
+
+        /// <summary>
+        /// Configured rate in Hz (0 when the pump is not running)
+        /// </summary>
+        public int rateHz;
+
+        /// <summary>
+        /// 1 if the pump thread is running
+        /// </summary>
+        public int running;
+
+        /// <summary>
+        /// String representation for debugging
+        /// </summary>
+        /// <returns>Human-readable pump statistics</returns>
+        public override string ToString()
+        {
+            if (running == 0)
+                return "ULL_PumpStats(not running)";
+
+            return $"ULL_PumpStats({rateHz}Hz, ticks:{tickCount}, overruns:{overrunCount}, " +
+                   $"last:{lastTickMs:F3}ms, avg:{averageTickMs:F3}ms, max:{maxTickMs:F3}ms)";
+        }
+    }
+
+    /// <summary>
+    /// Native hot-path statistics matching native ULL_Stats layout (296 bytes)
+    /// Update counters are per subject: received = sent + dropped + deadbandSuppressed + coalescedUpdates (+ pending)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ULL_Stats
+    {
+        /// <summary>
+        /// Number of buckets in frameDataHistogram (native ULL_STATS_HISTOGRAM_BUCKETS)
+        /// </summary>
+        public const int HistogramBuckets = 16;
+
+        /// <summary>
+        /// Transform subject updates received by the native layer
+        /// </summary>
+        public ulong transformUpdatesReceived;
+
+        /// <summary>
+        /// Transform frames handed to LiveLink (or queued in async mode)
+        /// </summary>
+        public ulong transformUpdatesSent;
+
+        /// <summary>
+        /// Transform updates rejected (not initialized, no source, property count mismatch, stale handle)
+        /// </summary>
+        public ulong transformUpdatesDropped;
+
+        /// <summary>
+        /// Data subject updates received by the native layer
+        /// </summary>
+        public ulong dataUpdatesReceived;
+
+        /// <summary>
+        /// Data frames handed to LiveLink (or queued in async mode)
+        /// </summary>
+        public ulong dataUpdatesSent;
+
+        /// <summary>
+        /// Data subject updates rejected
+        /// </summary>
+        public ulong dataUpdatesDropped;
+
+        /// <summary>
+        /// Batch API calls
+        /// </summary>
+        public ulong batchCalls;
+
+        /// <summary>
+        /// Updates overwritten before the coalescing publish pass sent them
+        /// </summary>
+        public ulong coalescedUpdates;
+
+        /// <summary>
+        /// Unchanged frames not sent by the deadband filter
+        /// </summary>
+        public ulong deadbandSuppressed;
+
+        /// <summary>
+        /// Frames evicted from the async queue (drop-oldest policy)
+        /// </summary>
+        public ulong queueDropped;
+
+        /// <summary>
+        /// Subject/property name lookups served from the native name cache
+        /// </summary>
+        public ulong nameCacheHits;
+
+        /// <summary>
+        /// Name lookups that created a new cache entry
+        /// </summary>
+        public ulong nameCacheMisses;
+
+        /// <summary>
+        /// Native bridge lock acquisitions by update calls
+        /// </summary>
+        public ulong lockAcquisitions;
+
+        /// <summary>
+        /// Lock acquisitions that had to wait for another thread
+        /// </summary>
+        public ulong lockContentions;
+
+        /// <summary>
+        /// Total time spent waiting for the lock in milliseconds
+        /// </summary>
+        public double lockWaitTotalMs;
+
+        /// <summary>
+        /// Longest single lock wait in milliseconds
+        /// </summary>
+        public double lockWaitMaxMs;
+
+        /// <summary>
+        /// LiveLink UpdateSubjectFrameData calls (either thread in async mode)
+        /// </summary>
+        public ulong frameDataCalls;
+
+        /// <summary>
+        /// Total time in UpdateSubjectFrameData in milliseconds
+        /// </summary>
+        public double frameDataTotalMs;
+
+        /// <summary>
+        /// Longest UpdateSubjectFrameData call in milliseconds
+        /// </summary>
+        public double frameDataMaxMs;
+
+        /// <summary>
+        /// UpdateSubjectFrameData durations: [0] &lt; 1 µs, [i] in [2^(i-1), 2^i) µs, last bucket open-ended
+        /// </summary>
+        [MarshalAs(UnmanagedType.ByValArray, SizeConst = HistogramBuckets)]
+        public ulong[] frameDataHistogram;
+
+        /// <summary>
+        /// Currently registered transform subjects
+        /// </summary>
+        public int registeredTransformSubjects;
+
+        /// <summary>
+        /// Currently registered data subjects
+        /// </summary>
+        public int registeredDataSubjects;
+
+        /// <summary>
+        /// Names held in the native name cache
+        /// </summary>
+        public int nameCacheEntries;
+
+        /// <summary>
+        /// Reserved (always 0)
+        /// </summary>
+        public int reserved;
+
+        /// <summary>
+        /// Mean UpdateSubjectFrameData duration in milliseconds
+        /// </summary>
+        public double AverageFrameDataMs => frameDataCalls > 0 ? frameDataTotalMs / frameDataCalls : 0.0;
+
+        /// <summary>
+        /// String representation for debugging
+        /// </summary>
+        /// <returns>Human-readable statistics summary</returns>
+        public override string ToString()
+        {
+            return $"ULL_Stats(transform {transformUpdatesSent}/{transformUpdatesReceived} sent, {transformUpdatesDropped} dropped; " +
+                   $"data {dataUpdatesSent}/{dataUpdatesReceived} sent, {dataUpdatesDropped} dropped; " +
+                   $"subjects:{registeredTransformSubjects}+{registeredDataSubjects}, " +
+                   $"names:{nameCacheHits} hits/{nameCacheMisses} misses, " +
+                   $"lock waits:{lockContentions}/{lockAcquisitions} ({lockWaitTotalMs:F3}ms), " +
+                   $"frame data avg:{AverageFrameDataMs:F3}ms max:{frameDataMaxMs:F3}ms)";
+        }
+    }
+
+    /// <summary>
+    /// Latency of one probe stage matching native ULL_LatencyStage layout (40 bytes)
+    /// Percentiles and maximum cover the latest native ULL_LATENCY_WINDOW samples
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ULL_LatencyStage
+    {
+        /// <summary>
+        /// Samples since the probe started
+        /// </summary>
+        public ulong samples;
+
+        /// <summary>
+        /// Median latency in milliseconds
+        /// </summary>
+        public double p50Ms;
+
+        /// <summary>
+        /// 90th percentile latency in milliseconds
+        /// </summary>
+        public double p90Ms;
+
+        /// <summary>
+        /// 99th percentile latency in milliseconds
+        /// </summary>
+        public double p99Ms;
+
+        /// <summary>
+        /// Longest latency in milliseconds
+        /// </summary>
+        public double maxMs;
+
+        /// <summary>
+        /// String representation for debugging
+        /// </summary>
+        /// <returns>Human-readable stage summary</returns>
+        public override string ToString()
+        {
+            return samples == 0
+                ? "no samples"
+                : $"p50:{p50Ms:F3}ms p90:{p90Ms:F3}ms p99:{p99Ms:F3}ms max:{maxMs:F3}ms ({samples} samples)";
+        }
+    }
+
+    /// <summary>
+    /// Latency probe statistics matching native ULL_LatencyStats layout (176 bytes)
+    /// Stages: enqueue (call to bridge), send (bridge to provider), receipt (provider to Unreal evaluation), total
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ULL_LatencyStats
+    {
+        /// <summary>
+        /// Number of stages (native ULL_LATENCY_STAGES)
+        /// </summary>
+        public const int StageCount = 4;
+
+        /// <summary>
+        /// Probes submitted through the update path
+        /// </summary>
+        public ulong probesSent;
+
+        /// <summary>
+        /// Probes the Unreal-side echo reported evaluating
+        /// </summary>
+        public ulong probesEchoed;
+
+        /// <summary>
+        /// Per-stage latency indexed by native ULL_LATENCY_STAGE_* (enqueue, send, receipt, total)
+        /// </summary>
+        [MarshalAs(UnmanagedType.ByValArray, SizeConst = StageCount)]
+        public ULL_LatencyStage[] stages;
+
+        /// <summary>
+        /// ULL_* call to the bridge accepting the frame (lock wait, validation)
+        /// </summary>
+        public ULL_LatencyStage Enqueue => stages?[0] ?? default;
+
+        /// <summary>
+        /// Bridge to ILiveLinkProvider (coalescing wait, async queue)
+        /// </summary>
+        public ULL_LatencyStage Send => stages?[1] ?? default;
+
+        /// <summary>
+        /// Provider to the Unreal subject evaluation (network, Unreal tick); needs the echo
+        /// </summary>
+        public ULL_LatencyStage Receipt => stages?[2] ?? default;
+
+        /// <summary>
+        /// ULL_* call to the Unreal subject evaluation; needs the echo
+        /// </summary>
+        public ULL_LatencyStage Total => stages?[3] ?? default;
+
+        /// <summary>
+        /// String representation for debugging
+        /// </summary>
+        /// <returns>Human-readable latency summary</returns>
+        public override string ToString()
+        {
+            return $"ULL_LatencyStats({probesEchoed}/{probesSent} echoed; enqueue {Enqueue}; send {Send}; " +
+                   $"receipt {Receipt}; total {Total})";
+        }
+    }
+
+    /// <summary>
+    /// Change-detection (deadband) counters reported by the native layer
+    /// </summary>
+    public class LiveLinkDeadbandCounters
+    {
+        /// <summary>
+        /// Frames sent to Unreal (includes keep-alive resends)
+        /// </summary>
+        public ulong SentFrames { get; set; }
+
+        /// <summary>
+        /// Frames skipped because nothing changed beyond the deadband
+        /// </summary>
+        public ulong SuppressedFrames { get; set; }
+
+        /// <summary>
+        /// Unchanged frames resent so Unreal does not mark the subject stale
+        /// </summary>
+        public ulong KeepAliveFrames { get; set; }
+
+        /// <summary>
+        /// Fraction of frames suppressed (0 when nothing was submitted)
+        /// </summary>
+        public double SuppressionRatio
+        {
+            get
+            {
+                ulong total = SentFrames + SuppressedFrames;
+                return total == 0 ? 0.0 : (double)SuppressedFrames / total;
+            }
+        }
+
+        /// <summary>
+        /// String representation for debugging
+        /// </summary>
+        /// <returns>Human-readable counter summary</returns>
+        public override string ToString()
+        {
+            return $"LiveLinkDeadbandCounters(Sent:{SentFrames}, Suppressed:{SuppressedFrames}, KeepAlive:{KeepAliveFrames}, " +
+                   $"Suppression:{SuppressionRatio:P1})";
+        }
+    }
+
+    /// <summary>
+    /// Axis-aligned region of interest matching native ULL_InterestRegion layout (48 bytes, blittable).
+    /// Corners are in Unreal coordinates (centimeters), like ULL_Transform.position.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ULL_InterestRegion
+    {
+        /// <summary>
+        /// Lower corner in centimeters
+        /// </summary>
+        public double minX;
+        public double minY;
+        public double minZ;
+
+        /// <summary>
+        /// Upper corner in centimeters (at least the lower corner on every axis)
+        /// </summary>
+        public double maxX;
+        public double maxY;
+        public double maxZ;
+
+        /// <summary>
+        /// Creates a region from two opposite corners in Unreal coordinates (any order)
+        /// </summary>
+        /// <returns>Region spanning both corners</returns>
+        public static ULL_InterestRegion FromCorners(
+            double x1, double y1, double z1,
+            double x2, double y2, double z2)
+        {
+            return new ULL_InterestRegion
+            {
+                minX = Math.Min(x1, x2), minY = Math.Min(y1, y2), minZ = Math.Min(z1, z2),
+                maxX = Math.Max(x1, x2), maxY = Math.Max(y1, y2), maxZ = Math.Max(z1, z2)
+            };
+        }
+
+        /// <summary>
+        /// Creates a region around a viewer position in Unreal coordinates
+        /// </summary>
+        /// <param name="centerX">Center X in centimeters</param>
+        /// <param name="centerY">Center Y in centimeters</param>
+        /// <param name="centerZ">Center Z in centimeters</param>
+        /// <param name="radius">Half the box edge in centimeters</param>
+        /// <returns>Cube of edge 2 * radius centered on the position</returns>
+        public static ULL_InterestRegion AroundPoint(double centerX, double centerY, double centerZ, double radius)
+        {
+            return FromCorners(
+                centerX - radius, centerY - radius, centerZ - radius,
+                centerX + radius, centerY + radius, centerZ + radius);
+        }
+
+        /// <summary>
+        /// True if every corner is a number and the lower corner is not above the upper one
+        /// </summary>
+        public bool IsValid()
+        {
+            // Written so NaN corners fail as well
+            return minX <= maxX && minY <= maxY && minZ <= maxZ;
+        }
+
+        /// <summary>
+        /// String representation for debugging
+        /// </summary>
+        /// <returns>Human-readable corners</returns>
+        public override string ToString()
+        {
+            return $"ULL_InterestRegion([{minX:F0},{minY:F0},{minZ:F0}] - [{maxX:F0},{maxY:F0},{maxZ:F0}])";
+        }
+    }
+
+    /// <summary>
+    /// Interest-region counters reported by the native layer
+    /// </summary>
+    public class LiveLinkInterestCounters
+    {
+        /// <summary>
+        /// Updates of subjects outside every region that were not sent
+        /// </summary>
+        public ulong HeldFrames { get; set; }
+
+        /// <summary>
+        /// Frames sent for subjects outside every region at the outside rate
+        /// </summary>
+        public ulong OutsideFrames { get; set; }
+
+        /// <summary>
+        /// Occupied cells of the native spatial grid
+        /// </summary>
+        public int GridCells { get; set; }
+
+        /// <summary>
+        /// String representation for debugging
+        /// </summary>
+        /// <returns>Human-readable counter summary</returns>
+        public override string ToString()
+        {
+            return $"LiveLinkInterestCounters(Held:{HeldFrames}, Outside:{OutsideFrames}, Cells:{GridCells})";
+        }
+    }
+
+    /// <summary>
+    /// Replay position reported by the native layer
+    /// </summary>
+    public class LiveLinkReplayStatus
+    {
+        /// <summary>
+        /// Whether a replay is running (position and duration are 0 otherwise)
+        /// </summary>
+        public bool IsRunning { get; set; }
+
+        /// <summary>
+        /// Current capture time in seconds
+        /// </summary>
+        public double PositionSeconds { get; set; }
+
+        /// <summary>
+        /// Capture length in seconds
+        /// </summary>
+        public double DurationSeconds { get; set; }
+
+        /// <summary>
+        /// String representation for debugging
+        /// </summary>
+        /// <returns>Human-readable replay position</returns>
+        public override string ToString()
+        {
+            return IsRunning
+                ? $"LiveLinkReplayStatus({PositionSeconds:F1} / {DurationSeconds:F1} s)"
+                : "LiveLinkReplayStatus(NOT_RUNNING)";
+        }
+    }
+
     /// <summary>
     /// Configuration object for LiveLink connection initialization
     /// Uses Message Bus (UDP multicast) for automatic discovery - no manual network configuration needed
@@ -115,6 +1092,196 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         /// </summary>
         public bool EnableLogging { get; set; } = false;
 
+        /// <summary>
+        /// Minimum send queue depth accepted by the native layer
+        /// </summary>
+        public const int MinQueueDepth = 16;
+
+        /// <summary>
+        /// Maximum send queue depth accepted by the native layer
+        /// </summary>
+        public const int MaxQueueDepth = 1 << 20;
+
+        /// <summary>
+        /// Default send queue depth (matches native ULL_DEFAULT_QUEUE_DEPTH)
+        /// </summary>
+        public const int DefaultQueueDepth = 4096;
+
+        /// <summary>
+        /// Send frames on the calling thread or on a dedicated native worker thread
+        /// </summary>
+        public LiveLinkSendMode SendMode { get; set; } = LiveLinkSendMode.Synchronous;
+
+        /// <summary>
+        /// Send queue capacity in frames (asynchronous send mode only)
+        /// </summary>
+        public int QueueDepth { get; set; } = DefaultQueueDepth;
+
+        /// <summary>
+        /// Behavior when the send queue is full (asynchronous send mode only)
+        /// </summary>
+        public LiveLinkQueuePolicy QueuePolicy { get; set; } = LiveLinkQueuePolicy.DropOldest;
+
+        /// <summary>
+        /// Maximum coalescing publish rate accepted by the native layer
+        /// </summary>
+        public const int MaxPublishRateHz = 1000;
+
+        /// <summary>
+        /// Publish only the latest transform per object at this rate in Hz (0 = send every update immediately)
+        /// </summary>
+        public int PublishRateHz { get; set; } = 0;
+
+        /// <summary>
+        /// Skip frames whose transform and properties have not changed beyond the deadband thresholds
+        /// </summary>
+        public bool EnableDeadband { get; set; } = false;
+
+        /// <summary>
+        /// Position change in centimeters below which a frame is considered unchanged
+        /// </summary>
+        public double PositionDeadband { get; set; } = 0.0;
+
+        /// <summary>
+        /// Rotation change in degrees below which a frame is considered unchanged
+        /// </summary>
+        public double RotationDeadbandDegrees { get; set; } = 0.0;
+
+        /// <summary>
+        /// Property value change below which a frame is considered unchanged
+        /// </summary>
+        public double PropertyDeadband { get; set; } = 0.0;
+
+        /// <summary>
+        /// Default keep-alive interval (matches native ULL_DEFAULT_KEEPALIVE_MS)
+        /// </summary>
+        public const int DefaultKeepAliveIntervalMs = 1000;
+
+        /// <summary>
+        /// Unchanged objects are still resent after this many milliseconds so Unreal keeps them live
+        /// </summary>
+        public int KeepAliveIntervalMs { get; set; } = DefaultKeepAliveIntervalMs;
+
+        /// <summary>
+        /// Default Message Bus pump rate (matches native ULL_DEFAULT_PUMP_RATE_HZ)
+        /// </summary>
+        public const int DefaultMessageBusPumpRateHz = 60;
+
+        /// <summary>
+        /// Rate of the native thread that ticks Message Bus housekeeping (discovery, heartbeats) in Hz (0 = disabled)
+        /// </summary>
+        public int MessageBusPumpRateHz { get; set; } = DefaultMessageBusPumpRateHz;
+
+        /// <summary>
+        /// Default shared-memory subject slots (matches native ULL_SHM_DEFAULT_CAPACITY)
+        /// </summary>
+        public const int DefaultSharedMemoryCapacity = 16384;
+
+        /// <summary>
+        /// Maximum shared-memory subject slots accepted by the native layer
+        /// </summary>
+        public const int MaxSharedMemoryCapacity = 1 << 20;
+
+        /// <summary>
+        /// Default shared-memory property values per subject (matches native ULL_SHM_DEFAULT_MAX_PROPERTIES)
+        /// </summary>
+        public const int DefaultSharedMemoryMaxProperties = 16;
+
+        /// <summary>
+        /// Maximum shared-memory property values per subject accepted by the native layer
+        /// </summary>
+        public const int MaxSharedMemoryMaxProperties = 256;
+
+        /// <summary>
+        /// Send transform frames over the Message Bus or through same-host shared memory
+        /// </summary>
+        public LiveLinkTransport Transport { get; set; } = LiveLinkTransport.MessageBus;
+
+        /// <summary>
+        /// Objects that fit in the shared-memory table (shared-memory transport only)
+        /// </summary>
+        public int SharedMemoryCapacity { get; set; } = DefaultSharedMemoryCapacity;
+
+        /// <summary>
+        /// Property values each object can carry in the shared-memory table (shared-memory transport only)
+        /// </summary>
+        public int SharedMemoryMaxProperties { get; set; } = DefaultSharedMemoryMaxProperties;
+
+        /// <summary>
+        /// Timestamp transform frames with Simio simulation time so Unreal can interpolate between updates
+        /// </summary>
+        public bool UseSimulationTime { get; set; } = false;
+
+        /// <summary>
+        /// Maximum simulation time scale accepted by this configuration
+        /// </summary>
+        public const double MaxSimulationTimeScale = 1000000.0;
+
+        /// <summary>
+        /// Playback seconds per simulation second (1.0 = real time, 0.1 = ten times faster than real time)
+        /// </summary>
+        public double SimulationTimeScale { get; set; } = 1.0;
+
+        /// <summary>
+        /// Default scene time frame rate (matches native ULL_DEFAULT_SCENE_FRAME_RATE)
+        /// </summary>
+        public const int DefaultSceneFrameRate = 60;
+
+        /// <summary>
+        /// Frame rate of the scene time attached to simulation-time frames
+        /// </summary>
+        public int SceneFrameRate { get; set; } = DefaultSceneFrameRate;
+
+        /// <summary>
+        /// Maximum subject pool size (matches native ULL_MAX_POOL_SIZE)
+        /// </summary>
+        public const int MaxSubjectPoolSize = 65536;
+
+        /// <summary>
+        /// Pooled LiveLink subjects pre-registered per property schema (0 = register and remove each object).
+        /// In pool mode destroyed objects are hidden (zero scale, "Visible" = 0) and their subject is reused.
+        /// </summary>
+        public int SubjectPoolSize { get; set; } = 0;
+
+        /// <summary>
+        /// Frames per second the publish pass may send across all subjects (0 = unlimited).
+        /// Requires PublishRateHz > 0; low-priority subjects are held back first when it is exceeded.
+        /// </summary>
+        public int PublishFrameBudget { get; set; } = 0;
+
+        /// <summary>
+        /// Estimated bytes per second the publish pass may send across all subjects (0 = unlimited).
+        /// Requires PublishRateHz > 0.
+        /// </summary>
+        public int PublishByteBudget { get; set; } = 0;
+
+        /// <summary>
+        /// Start the Unreal runtime in the background so the first run does not wait for it.
+        /// Updates sent meanwhile are buffered as each subject's latest value and published once it
+        /// is up (LiveLinkManager.InitState). Ignored with pool mode or the shared-memory transport.
+        /// </summary>
+        public bool AsyncInitialization { get; set; } = false;
+
+        /// <summary>
+        /// Hold object updates in a managed frame instead of sending each one; the frame is submitted
+        /// with one batch call per flush (LiveLinkManager.FlushFrame, the FlushLiveLinkFrame step or
+        /// DeferredFlushRateHz). Managed only: does not require native init options.
+        /// </summary>
+        public bool DeferredUpdates { get; set; } = false;
+
+        /// <summary>
+        /// Wall-clock rate at which the deferred frame is flushed automatically in Hz (0 = explicit flushes only)
+        /// </summary>
+        public int DeferredFlushRateHz { get; set; } = 0;
+
+        /// <summary>
+        /// True when any option requires ULL_InitializeEx instead of ULL_Initialize
+        /// </summary>
+        public bool RequiresInitOptions => SendMode == LiveLinkSendMode.Asynchronous || PublishRateHz > 0 || EnableDeadband ||
+                                           MessageBusPumpRateHz != DefaultMessageBusPumpRateHz || Transport != LiveLinkTransport.MessageBus ||
+                                           (UseSimulationTime && (SimulationTimeScale != 1.0 || SceneFrameRate != DefaultSceneFrameRate)) ||
+                                           SubjectPoolSize > 0 || PublishFrameBudget > 0 || PublishByteBudget > 0 || AsyncInitialization;
+
         /// <summary>
         /// Validates the configuration and returns any error messages
         /// </summary>
@@ -128,6 +1295,80 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
                 errors.Add("Source Name must not be empty");
             }
 
+            if (SendMode == LiveLinkSendMode.Asynchronous &&
+                (QueueDepth < MinQueueDepth || QueueDepth > MaxQueueDepth))
+            {
+                errors.Add($"Queue Depth must be between {MinQueueDepth} and {MaxQueueDepth}");
+            }
+
+            if (PublishRateHz < 0 || PublishRateHz > MaxPublishRateHz)
+            {
+                errors.Add($"Publish Rate must be between 0 and {MaxPublishRateHz} Hz");
+            }
+
+            if (MessageBusPumpRateHz < 0 || MessageBusPumpRateHz > MaxPublishRateHz)
+            {
+                errors.Add($"Message Bus Pump Rate must be between 0 and {MaxPublishRateHz} Hz");
+            }
+
+            if (Transport == LiveLinkTransport.SharedMemory)
+            {
+                if (SharedMemoryCapacity < 1 || SharedMemoryCapacity > MaxSharedMemoryCapacity)
+                {
+                    errors.Add($"Shared Memory Capacity must be between 1 and {MaxSharedMemoryCapacity}");
+                }
+
+                if (SharedMemoryMaxProperties < 1 || SharedMemoryMaxProperties > MaxSharedMemoryMaxProperties)
+                {
+                    errors.Add($"Shared Memory Max Properties must be between 1 and {MaxSharedMemoryMaxProperties}");
+                }
+            }
+
+            if (SubjectPoolSize < 0 || SubjectPoolSize > MaxSubjectPoolSize)
+            {
+                errors.Add($"Subject Pool Size must be between 0 and {MaxSubjectPoolSize}");
+            }
+
+            if (PublishFrameBudget < 0 || PublishByteBudget < 0)
+            {
+                errors.Add("Publish budgets must not be negative");
+            }
+            else if ((PublishFrameBudget > 0 || PublishByteBudget > 0) && PublishRateHz == 0)
+            {
+                errors.Add("Publish budgets require a Publish Rate greater than 0 Hz");
+            }
+
+            if (DeferredFlushRateHz < 0 || DeferredFlushRateHz > MaxPublishRateHz)
+            {
+                errors.Add($"Deferred Flush Rate must be between 0 and {MaxPublishRateHz} Hz");
+            }
+
+            if (UseSimulationTime)
+            {
+                if (SimulationTimeScale <= 0 || SimulationTimeScale > MaxSimulationTimeScale)
+                {
+                    errors.Add($"Simulation Time Scale must be greater than 0 and at most {MaxSimulationTimeScale}");
+                }
+
+                if (SceneFrameRate < 1 || SceneFrameRate > MaxPublishRateHz)
+                {
+                    errors.Add($"Scene Frame Rate must be between 1 and {MaxPublishRateHz}");
+                }
+            }
+
+            if (EnableDeadband)
+            {
+                if (PositionDeadband < 0 || RotationDeadbandDegrees < 0 || PropertyDeadband < 0)
+                {
+                    errors.Add("Deadband thresholds must not be negative");
+                }
+
+                if (KeepAliveIntervalMs <= 0)
+                {
+                    errors.Add("Keep Alive Interval must be greater than 0 ms");
+                }
+            }
+
             return errors.ToArray();
         }
 
@@ -140,7 +1381,29 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             return new LiveLinkConfiguration
             {
                 SourceName = string.IsNullOrWhiteSpace(SourceName) ? "SimioSimulation" : SourceName.Trim(),
-                EnableLogging = EnableLogging
+                EnableLogging = EnableLogging,
+                SendMode = SendMode,
+                QueueDepth = Math.Max(MinQueueDepth, Math.Min(MaxQueueDepth, QueueDepth)),
+                QueuePolicy = QueuePolicy,
+                PublishRateHz = Math.Max(0, Math.Min(MaxPublishRateHz, PublishRateHz)),
+                EnableDeadband = EnableDeadband,
+                PositionDeadband = Math.Max(0.0, PositionDeadband),
+                RotationDeadbandDegrees = Math.Max(0.0, RotationDeadbandDegrees),
+                PropertyDeadband = Math.Max(0.0, PropertyDeadband),
+                KeepAliveIntervalMs = KeepAliveIntervalMs > 0 ? KeepAliveIntervalMs : DefaultKeepAliveIntervalMs,
+                MessageBusPumpRateHz = Math.Max(0, Math.Min(MaxPublishRateHz, MessageBusPumpRateHz)),
+                Transport = Transport,
+                SharedMemoryCapacity = Math.Max(1, Math.Min(MaxSharedMemoryCapacity, SharedMemoryCapacity)),
+                SharedMemoryMaxProperties = Math.Max(1, Math.Min(MaxSharedMemoryMaxProperties, SharedMemoryMaxProperties)),
+                UseSimulationTime = UseSimulationTime,
+                SimulationTimeScale = SimulationTimeScale > 0 ? Math.Min(MaxSimulationTimeScale, SimulationTimeScale) : 1.0,
+                SceneFrameRate = SceneFrameRate > 0 ? Math.Min(MaxPublishRateHz, SceneFrameRate) : DefaultSceneFrameRate,
+                SubjectPoolSize = Math.Max(0, Math.Min(MaxSubjectPoolSize, SubjectPoolSize)),
+                PublishFrameBudget = Math.Max(0, PublishFrameBudget),
+                PublishByteBudget = Math.Max(0, PublishByteBudget),
+                AsyncInitialization = AsyncInitialization,
+                DeferredUpdates = DeferredUpdates,
+                DeferredFlushRateHz = Math.Max(0, Math.Min(MaxPublishRateHz, DeferredFlushRateHz))
             };
         }
 
@@ -150,7 +1413,16 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         /// <returns>Human-readable configuration description</returns>
         public override string ToString()
         {
-            return $"LiveLinkConfiguration(Source:'{SourceName}', Logging:{EnableLogging})";
+            return $"LiveLinkConfiguration(Source:'{SourceName}', Logging:{EnableLogging}, " +
+                   $"SendMode:{SendMode}, QueueDepth:{QueueDepth}, QueuePolicy:{QueuePolicy}, PublishRate:{PublishRateHz}Hz, " +
+                   $"Deadband:{(EnableDeadband ? $"{PositionDeadband}cm/{RotationDeadbandDegrees}deg/{PropertyDeadband}, KeepAlive:{KeepAliveIntervalMs}ms" : "Off")}, " +
+                   $"Pump:{MessageBusPumpRateHz}Hz, " +
+                   $"Transport:{(Transport == LiveLinkTransport.SharedMemory ? $"SharedMemory({SharedMemoryCapacity}x{SharedMemoryMaxProperties})" : "MessageBus")}, " +
+                   $"SimTime:{(UseSimulationTime ? $"x{SimulationTimeScale}@{SceneFrameRate}fps" : "Off")}, " +
+                   $"Pool:{(SubjectPoolSize > 0 ? SubjectPoolSize.ToString() : "Off")}, " +
+                   $"Budget:{(PublishFrameBudget > 0 || PublishByteBudget > 0 ? $"{PublishFrameBudget}fps/{PublishByteBudget}Bps" : "Off")}, " +
+                   $"AsyncInit:{AsyncInitialization}, " +
+                   $"Deferred:{(DeferredUpdates ? (DeferredFlushRateHz > 0 ? $"{DeferredFlushRateHz}Hz" : "Explicit") : "Off")})";
         }
     }
 }
@@ -1,5 +1,6 @@
 using System;
 using System.Runtime.InteropServices;
+using System.Security;
 
 namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
 {
@@ -25,6 +26,54 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         public const int ULL_NOT_CONNECTED = -2;
         public const int ULL_NOT_INITIALIZED = -3;
 
+        // Returned by ULL_Register*H when no handle could be assigned (same value as ULL_ERROR)
+        public const int ULL_INVALID_HANDLE = -1;
+
+        // ULL_InitOptions values matching native definitions
+        public const int ULL_SEND_MODE_SYNC = 0;
+        public const int ULL_SEND_MODE_ASYNC = 1;
+        public const int ULL_QUEUE_POLICY_DROP_OLDEST = 0;
+        public const int ULL_QUEUE_POLICY_BLOCK = 1;
+        public const int ULL_PUMP_DISABLED = -1;
+        public const int ULL_TRANSPORT_MESSAGE_BUS = 0;
+        public const int ULL_TRANSPORT_SHARED_MEMORY = 1;
+        public const int ULL_INIT_MODE_SYNC = 0;
+        public const int ULL_INIT_MODE_ASYNC = 1;
+
+        // ULL_GetInitState values matching native definitions
+        public const int ULL_INIT_STATE_STAGING = 1;
+        public const int ULL_INIT_STATE_READY = 2;
+        public const int ULL_INIT_STATE_FAILED = 3;
+
+        // Column counts of a Simio value block (ULL_ConvertSimioTransforms / ULL_UpdateObjectsBatchSimioH)
+        public const int ULL_SIMIO_POSE_COMPONENTS = 6;
+        public const int ULL_SIMIO_TRANSFORM_COMPONENTS = 9;
+
+        // ULL_CompactTransform.flags values matching native definitions
+        public const int ULL_COMPACT_LARGEST_MASK = 0x0003;
+        public const int ULL_COMPACT_HAS_SCALE = 0x0004;
+        public const int ULL_COMPACT_ROTATION_32 = 0x0008;
+
+        // Update-rate tier values matching native definitions (priorities are LiveLinkPriority)
+        public const int ULL_RATE_UNLIMITED = 0;
+
+        // Session values matching native definitions (ULL_Session* functions)
+        public const int ULL_DEFAULT_SESSION = 0;
+        public const int ULL_MAX_SESSIONS = 64;
+
+        // Interest region values matching native definitions (ULL_SetInterestRegions)
+        public const int ULL_MAX_INTEREST_REGIONS = 16;
+        public const int ULL_INTEREST_SUPPRESS = 0;
+
+        // Latency probe values matching native definitions (UnrealLiveLink.LatencyProbe.h)
+        public const string ULL_LATENCY_PROBE_SUBJECT = "SimioLatencyProbe";
+        public const int ULL_LATENCY_ECHO_DEFAULT_PORT = 6670;
+        public const int ULL_LATENCY_MAX_RATE_HZ = 100;
+
+        // Replay speed values matching native definitions (UnrealLiveLink.Capture.h)
+        public const double ULL_REPLAY_PAUSED = 0.0;
+        public const double ULL_REPLAY_MAX_SPEED = 1000.0;
+
         //=============================================================================
         // Lifecycle Management
         //=============================================================================
@@ -42,6 +91,22 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
         public static extern int ULL_Initialize([MarshalAs(UnmanagedType.LPStr)] string providerName);
 
+        /// <summary>
+        /// Initialize LiveLink system with provider name and send options.
+        /// Use instead of ULL_Initialize to enable the asynchronous send mode.
+        /// </summary>
+        /// <param name="providerName">Name displayed in Unreal's LiveLink window</param>
+        /// <param name="options">Send mode, queue depth, full-queue policy and publish rate (structSize must be set)</param>
+        /// <returns>ULL_OK on success, ULL_ERROR on failure</returns>
+        /// <remarks>
+        /// Options are only applied on first initialization; later calls return ULL_OK unchanged.
+        /// NOT thread-safe - call from main thread only.
+        /// </remarks>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_InitializeEx(
+            [MarshalAs(UnmanagedType.LPStr)] string providerName,
+            ref ULL_InitOptions options);
+
         /// <summary>
         /// Shutdown LiveLink system.
         /// Flushes all messages and releases resources.
@@ -75,6 +140,17 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
         public static extern int ULL_IsConnected();
 
+        /// <summary>
+        /// Get the initialization state (see LiveLinkConfiguration.AsyncInitialization)
+        /// </summary>
+        /// <returns>ULL_INIT_STATE_STAGING, ULL_INIT_STATE_READY, ULL_INIT_STATE_FAILED, or ULL_NOT_INITIALIZED</returns>
+        /// <remarks>
+        /// STAGING while the engine runtime starts in the background; updates sent meanwhile
+        /// are published as each subject's latest value once it is READY.
+        /// </remarks>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_GetInitState();
+
         //=============================================================================
         // Transform Subjects (3D Objects)
         //=============================================================================
@@ -151,6 +227,432 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
         public static extern void ULL_RemoveObject([MarshalAs(UnmanagedType.LPStr)] string subjectName);
 
+        //=============================================================================
+        // Batch Updates (Many Objects per Call)
+        //=============================================================================
+
+        /// <summary>
+        /// Update transforms for many objects in a single call.
+        /// Registers objects automatically if not already registered.
+        /// </summary>
+        /// <param name="subjectNames">Array of object identifiers</param>
+        /// <param name="transforms">Array of transforms (same order and length as subjectNames)</param>
+        /// <param name="count">Number of objects in the batch</param>
+        /// <remarks>
+        /// One P/Invoke transition and one native lock acquisition for the whole batch.
+        /// Prefer this over per-object ULL_UpdateObject when flushing many objects per tick.
+        /// </remarks>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern void ULL_UpdateObjectsBatch(
+            [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPStr)] string[] subjectNames,
+            [In] ULL_Transform[] transforms,
+            int count);
+
+        /// <summary>
+        /// Update transforms and property values for many objects in a single call.
+        /// </summary>
+        /// <param name="subjectNames">Array of object identifiers</param>
+        /// <param name="transforms">Array of transforms (same order and length as subjectNames)</param>
+        /// <param name="propertyValues">Contiguous property values, propertyCount per object</param>
+        /// <param name="propertyCount">Number of property values per object</param>
+        /// <param name="count">Number of objects in the batch</param>
+        /// <remarks>
+        /// All objects in one batch share the same property count.
+        /// Objects whose registration count differs are skipped.
+        /// Unregistered objects are only registered automatically when propertyCount is 0;
+        /// register objects with properties first (ULL_RegisterObjectWithProperties).
+        /// </remarks>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern void ULL_UpdateObjectsBatchWithProperties(
+            [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPStr)] string[] subjectNames,
+            [In] ULL_Transform[] transforms,
+            [MarshalAs(UnmanagedType.LPArray)] float[] propertyValues,
+            int propertyCount,
+            int count);
+
+        //=============================================================================
+        // Handle-Based Transform Subjects (Hot Path)
+        //=============================================================================
+
+        /// <summary>
+        /// Register a transform subject and return an integer handle for updates.
+        /// </summary>
+        /// <param name="subjectName">Unique identifier for this object</param>
+        /// <returns>Handle (>= 0) on success, negative return code on failure</returns>
+        /// <remarks>
+        /// Registering an existing name returns its current handle.
+        /// Handle-based updates avoid per-call string marshaling and native name lookups.
+        /// </remarks>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_RegisterObjectH([MarshalAs(UnmanagedType.LPStr)] string subjectName);
+
+        /// <summary>
+        /// Register a transform subject with custom properties and return a handle.
+        /// </summary>
+        /// <param name="subjectName">Unique identifier for this object</param>
+        /// <param name="propertyNames">Array of property names</param>
+        /// <param name="propertyCount">Number of properties</param>
+        /// <returns>Handle (>= 0) on success, negative return code on failure</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_RegisterObjectWithPropertiesH(
+            [MarshalAs(UnmanagedType.LPStr)] string subjectName,
+            [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPStr)] string[] propertyNames,
+            int propertyCount);
+
+        /// <summary>
+        /// Intern a property name list and return its schema ID.
+        /// </summary>
+        /// <param name="propertyNames">Array of property names</param>
+        /// <param name="propertyCount">Number of properties</param>
+        /// <returns>Schema ID (>= 0) on success, negative return code on failure</returns>
+        /// <remarks>
+        /// Identical lists return the same ID until ULL_Shutdown.
+        /// </remarks>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_RegisterPropertySchema(
+            [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPStr)] string[] propertyNames,
+            int propertyCount);
+
+        /// <summary>
+        /// Register a transform subject with a schema from ULL_RegisterPropertySchema and return a handle.
+        /// </summary>
+        /// <param name="subjectName">Unique identifier for this object</param>
+        /// <param name="schemaId">Schema ID</param>
+        /// <returns>Handle (>= 0) on success, negative return code on failure</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_RegisterObjectWithSchemaH(
+            [MarshalAs(UnmanagedType.LPStr)] string subjectName,
+            int schemaId);
+
+        /// <summary>
+        /// Register many transform subjects in one call (startup warm-up).
+        /// </summary>
+        /// <param name="subjectNames">Array of subject names</param>
+        /// <param name="schemaIds">Schema ID per subject, or null for no properties</param>
+        /// <param name="count">Number of subjects</param>
+        /// <param name="outHandles">Receives a handle or negative return code per subject</param>
+        /// <returns>Number of subjects registered, or negative return code on failure</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_RegisterObjectsBatchH(
+            [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPStr)] string[] subjectNames,
+            [In] int[]? schemaIds,
+            int count,
+            [Out] int[] outHandles);
+
+        /// <summary>
+        /// Set the publish priority and maximum rate of a transform subject (coalescing mode).
+        /// </summary>
+        /// <param name="handle">Subject handle</param>
+        /// <param name="priority">LiveLinkPriority value</param>
+        /// <param name="maxRateHz">Maximum frames per second (ULL_RATE_UNLIMITED = every publish pass)</param>
+        /// <returns>ULL_OK, ULL_ERROR or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_SetObjectScheduleH(
+            int handle,
+            int priority,
+            int maxRateHz);
+
+        /// <summary>
+        /// Set the publish priority and maximum rate of a transform or data subject by name (coalescing mode).
+        /// </summary>
+        /// <param name="subjectName">Registered subject name</param>
+        /// <param name="priority">LiveLinkPriority value</param>
+        /// <param name="maxRateHz">Maximum frames per second (ULL_RATE_UNLIMITED = every publish pass)</param>
+        /// <returns>ULL_OK, ULL_ERROR or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_SetSubjectSchedule(
+            [MarshalAs(UnmanagedType.LPStr)] string subjectName,
+            int priority,
+            int maxRateHz);
+
+        /// <summary>
+        /// Update transform for a registered subject handle.
+        /// </summary>
+        /// <param name="handle">Handle returned by ULL_RegisterObjectH</param>
+        /// <param name="transform">Transform data</param>
+        /// <remarks>
+        /// Does not auto-register. Invalid or stale handles are ignored.
+        /// </remarks>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectH(int handle, ref ULL_Transform transform);
+
+        /// <summary>
+        /// Update transform and property values for a registered subject handle.
+        /// </summary>
+        /// <param name="handle">Handle returned by ULL_RegisterObjectWithPropertiesH</param>
+        /// <param name="transform">Transform data</param>
+        /// <param name="propertyValues">Array of property values (must match registration order)</param>
+        /// <param name="propertyCount">Number of property values (must match registration count)</param>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectWithPropertiesH(
+            int handle,
+            ref ULL_Transform transform,
+            [MarshalAs(UnmanagedType.LPArray)] float[] propertyValues,
+            int propertyCount);
+
+        /// <summary>
+        /// Update transforms for many subject handles in a single call.
+        /// </summary>
+        /// <param name="handles">Array of subject handles</param>
+        /// <param name="transforms">Array of transforms (same order and length as handles)</param>
+        /// <param name="count">Number of subjects in the batch</param>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectsBatchH(
+            [In] int[] handles,
+            [In] ULL_Transform[] transforms,
+            int count);
+
+        /// <summary>
+        /// Update transforms and property values for many subject handles in a single call.
+        /// </summary>
+        /// <param name="handles">Array of subject handles</param>
+        /// <param name="transforms">Array of transforms (same order and length as handles)</param>
+        /// <param name="propertyValues">Contiguous property values, propertyCount per subject</param>
+        /// <param name="propertyCount">Number of property values per subject</param>
+        /// <param name="count">Number of subjects in the batch</param>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectsBatchWithPropertiesH(
+            [In] int[] handles,
+            [In] ULL_Transform[] transforms,
+            [MarshalAs(UnmanagedType.LPArray)] float[] propertyValues,
+            int propertyCount,
+            int count);
+
+        /// <summary>
+        /// Update transform and property values for a subject handle, timestamped with simulation time.
+        /// </summary>
+        /// <param name="handle">Handle returned by ULL_RegisterObjectH or ULL_RegisterObjectWithPropertiesH</param>
+        /// <param name="transform">Transform data</param>
+        /// <param name="propertyValues">Array of property values (null when propertyCount is 0)</param>
+        /// <param name="propertyCount">Number of property values (must match registration count)</param>
+        /// <param name="simTime">Simulation time of this state in seconds</param>
+        /// <remarks>
+        /// WorldTime and scene time are derived from simTime using the simTimeScale and
+        /// sceneFrameRate init options, so Unreal can interpolate between sparse updates.
+        /// </remarks>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectAtTimeH(
+            int handle,
+            ref ULL_Transform transform,
+            [MarshalAs(UnmanagedType.LPArray)] float[]? propertyValues,
+            int propertyCount,
+            double simTime);
+
+        /// <summary>
+        /// Update transforms and property values for many subject handles at one simulation time.
+        /// </summary>
+        /// <param name="handles">Array of subject handles</param>
+        /// <param name="transforms">Array of transforms (same order and length as handles)</param>
+        /// <param name="propertyValues">Contiguous property values, propertyCount per subject (null when propertyCount is 0)</param>
+        /// <param name="propertyCount">Number of property values per subject</param>
+        /// <param name="count">Number of subjects in the batch</param>
+        /// <param name="simTime">Simulation time of this state in seconds</param>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectsBatchAtTimeH(
+            [In] int[] handles,
+            [In] ULL_Transform[] transforms,
+            [MarshalAs(UnmanagedType.LPArray)] float[]? propertyValues,
+            int propertyCount,
+            int count,
+            double simTime);
+
+        /// <summary>
+        /// Remove a transform subject by handle. The handle becomes invalid.
+        /// </summary>
+        /// <param name="handle">Handle to remove</param>
+        /// <remarks>
+        /// Safe to call with invalid or already-removed handles (no error).
+        /// </remarks>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_RemoveObjectH(int handle);
+
+        //=============================================================================
+        // Blittable Hot Path (ULL_TransformData)
+        //=============================================================================
+        // Same exports as above, declared with blittable arguments only: transforms are passed
+        // by pointer and arrays are pinned, so a call allocates nothing and copies nothing.
+        // SuppressUnmanagedCodeSecurity skips the per-call security stack walk.
+
+        /// <summary>
+        /// Update transform by subject name given as cached null-terminated UTF-8 bytes (see GetUtf8Name).
+        /// </summary>
+        /// <param name="subjectNameUtf8">Null-terminated UTF-8 subject name</param>
+        /// <param name="transform">Transform data</param>
+        [SuppressUnmanagedCodeSecurity]
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObject(
+            [In] byte[] subjectNameUtf8,
+            ref ULL_TransformData transform);
+
+        /// <summary>
+        /// Update transform and properties by subject name given as cached null-terminated UTF-8 bytes.
+        /// </summary>
+        /// <param name="subjectNameUtf8">Null-terminated UTF-8 subject name</param>
+        /// <param name="transform">Transform data</param>
+        /// <param name="propertyValues">Array of property values (must match registration order)</param>
+        /// <param name="propertyCount">Number of property values (must match registration count)</param>
+        [SuppressUnmanagedCodeSecurity]
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectWithProperties(
+            [In] byte[] subjectNameUtf8,
+            ref ULL_TransformData transform,
+            [In] float[] propertyValues,
+            int propertyCount);
+
+        /// <summary>
+        /// Update transform for a registered subject handle.
+        /// </summary>
+        /// <param name="handle">Handle returned by ULL_RegisterObjectH</param>
+        /// <param name="transform">Transform data</param>
+        [SuppressUnmanagedCodeSecurity]
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectH(int handle, ref ULL_TransformData transform);
+
+        /// <summary>
+        /// Update transform and property values for a registered subject handle.
+        /// </summary>
+        /// <param name="handle">Handle returned by ULL_RegisterObjectWithPropertiesH</param>
+        /// <param name="transform">Transform data</param>
+        /// <param name="propertyValues">Array of property values (must match registration order)</param>
+        /// <param name="propertyCount">Number of property values (must match registration count)</param>
+        [SuppressUnmanagedCodeSecurity]
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectWithPropertiesH(
+            int handle,
+            ref ULL_TransformData transform,
+            [In] float[] propertyValues,
+            int propertyCount);
+
+        /// <summary>
+        /// Update transform and property values for a subject handle, timestamped with simulation time.
+        /// </summary>
+        /// <param name="handle">Handle returned by ULL_RegisterObjectH or ULL_RegisterObjectWithPropertiesH</param>
+        /// <param name="transform">Transform data</param>
+        /// <param name="propertyValues">Array of property values (null when propertyCount is 0)</param>
+        /// <param name="propertyCount">Number of property values (must match registration count)</param>
+        /// <param name="simTime">Simulation time of this state in seconds</param>
+        [SuppressUnmanagedCodeSecurity]
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectAtTimeH(
+            int handle,
+            ref ULL_TransformData transform,
+            [In] float[]? propertyValues,
+            int propertyCount,
+            double simTime);
+
+        /// <summary>
+        /// Update transforms for many subject handles in a single call.
+        /// </summary>
+        /// <param name="handles">Array of subject handles</param>
+        /// <param name="transforms">Array of transforms (at least count elements, same order as handles)</param>
+        /// <param name="count">Number of subjects in the batch</param>
+        [SuppressUnmanagedCodeSecurity]
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectsBatchH(
+            [In] int[] handles,
+            [In] ULL_TransformData[] transforms,
+            int count);
+
+        /// <summary>
+        /// Update transforms and property values for many subject handles in a single call.
+        /// </summary>
+        /// <param name="handles">Array of subject handles</param>
+        /// <param name="transforms">Array of transforms (at least count elements, same order as handles)</param>
+        /// <param name="propertyValues">Contiguous property values, propertyCount per subject</param>
+        /// <param name="propertyCount">Number of property values per subject</param>
+        /// <param name="count">Number of subjects in the batch</param>
+        [SuppressUnmanagedCodeSecurity]
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectsBatchWithPropertiesH(
+            [In] int[] handles,
+            [In] ULL_TransformData[] transforms,
+            [In] float[] propertyValues,
+            int propertyCount,
+            int count);
+
+        /// <summary>
+        /// Update transforms and property values for many subject handles at one simulation time.
+        /// </summary>
+        /// <param name="handles">Array of subject handles</param>
+        /// <param name="transforms">Array of transforms (at least count elements, same order as handles)</param>
+        /// <param name="propertyValues">Contiguous property values, propertyCount per subject (null when propertyCount is 0)</param>
+        /// <param name="propertyCount">Number of property values per subject</param>
+        /// <param name="count">Number of subjects in the batch</param>
+        /// <param name="simTime">Simulation time of this state in seconds</param>
+        [SuppressUnmanagedCodeSecurity]
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectsBatchAtTimeH(
+            [In] int[] handles,
+            [In] ULL_TransformData[] transforms,
+            [In] float[]? propertyValues,
+            int propertyCount,
+            int count,
+            double simTime);
+
+        //=============================================================================
+        // Simio Coordinate Batches
+        //=============================================================================
+
+        /// <summary>
+        /// Convert raw Simio values to Unreal transforms natively (same conventions as CoordinateConverter).
+        /// </summary>
+        /// <param name="simioValues">Columns of count values: x, y, z, rotX, rotY, rotZ[, scaleX, scaleY, scaleZ]</param>
+        /// <param name="componentCount">ULL_SIMIO_POSE_COMPONENTS or ULL_SIMIO_TRANSFORM_COMPONENTS</param>
+        /// <param name="count">Number of objects</param>
+        /// <param name="outTransforms">Receives count transforms</param>
+        /// <returns>ULL_OK on success, ULL_ERROR on invalid arguments</returns>
+        /// <remarks>
+        /// Does not require ULL_Initialize.
+        /// </remarks>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_ConvertSimioTransforms(
+            [In] double[] simioValues,
+            int componentCount,
+            int count,
+            [Out] ULL_Transform[] outTransforms);
+
+        /// <summary>
+        /// Convert raw Simio values and update many subject handles in a single call.
+        /// </summary>
+        /// <param name="handles">Array of subject handles</param>
+        /// <param name="simioValues">Columns of count values: x, y, z, rotX, rotY, rotZ[, scaleX, scaleY, scaleZ]</param>
+        /// <param name="componentCount">ULL_SIMIO_POSE_COMPONENTS or ULL_SIMIO_TRANSFORM_COMPONENTS</param>
+        /// <param name="propertyValues">Contiguous property values, propertyCount per subject (null when propertyCount is 0)</param>
+        /// <param name="propertyCount">Number of property values per subject</param>
+        /// <param name="count">Number of subjects in the batch</param>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectsBatchSimioH(
+            [In] int[] handles,
+            [In] double[] simioValues,
+            int componentCount,
+            [MarshalAs(UnmanagedType.LPArray)] float[]? propertyValues,
+            int propertyCount,
+            int count);
+
+        //=============================================================================
+        // Compact Transforms
+        //=============================================================================
+
+        /// <summary>
+        /// Update transforms and property values for many subject handles from 20-byte compact transforms.
+        /// </summary>
+        /// <param name="handles">Array of subject handles</param>
+        /// <param name="transforms">Compact transforms (same order and length as handles)</param>
+        /// <param name="scales">Scale triples of the transforms with ULL_COMPACT_HAS_SCALE, in batch order (null when scaleCount is 0)</param>
+        /// <param name="scaleCount">Number of scale triples</param>
+        /// <param name="propertyValues">Contiguous property values, propertyCount per subject (null when propertyCount is 0)</param>
+        /// <param name="propertyCount">Number of property values per subject</param>
+        /// <param name="count">Number of subjects in the batch</param>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_UpdateObjectsBatchCompactH(
+            [In] int[] handles,
+            [In] ULL_CompactTransform[] transforms,
+            [MarshalAs(UnmanagedType.LPArray)] float[]? scales,
+            int scaleCount,
+            [MarshalAs(UnmanagedType.LPArray)] float[]? propertyValues,
+            int propertyCount,
+            int count);
+
         //=============================================================================
         // Data Subjects (Metrics/KPIs) - NEW!
         //=============================================================================
@@ -192,6 +694,24 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             [MarshalAs(UnmanagedType.LPArray)] float[] propertyValues,
             int propertyCount);
 
+        /// <summary>
+        /// Update property values for many data subjects in a single call.
+        /// </summary>
+        /// <param name="subjectNames">Array of subject identifiers</param>
+        /// <param name="propertyValues">Contiguous property values, propertyCount per subject</param>
+        /// <param name="propertyCount">Number of property values per subject</param>
+        /// <param name="count">Number of subjects in the batch</param>
+        /// <remarks>
+        /// Register each subject first (ULL_RegisterDataSubject) so Unreal knows the property names.
+        /// Subjects whose registration count differs are skipped.
+        /// </remarks>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern void ULL_UpdateDataSubjectsBatch(
+            [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPStr)] string[] subjectNames,
+            [MarshalAs(UnmanagedType.LPArray)] float[] propertyValues,
+            int propertyCount,
+            int count);
+
         /// <summary>
         /// Remove a data subject from LiveLink.
         /// </summary>
@@ -199,6 +719,285 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
         [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
         public static extern void ULL_RemoveDataSubject([MarshalAs(UnmanagedType.LPStr)] string subjectName);
 
+        //=============================================================================
+        // Diagnostics
+        //=============================================================================
+
+        /// <summary>
+        /// Read change-detection (deadband) counters since initialization
+        /// </summary>
+        /// <param name="sentFrames">Frames sent (includes keep-alive resends)</param>
+        /// <param name="suppressedFrames">Frames skipped as unchanged</param>
+        /// <param name="keepAliveFrames">Unchanged frames resent after the keep-alive interval</param>
+        /// <returns>ULL_OK, or ULL_NOT_INITIALIZED (counters set to 0)</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_GetDeadbandCounters(
+            out ulong sentFrames,
+            out ulong suppressedFrames,
+            out ulong keepAliveFrames);
+
+        /// <summary>
+        /// Read Message Bus pump thread statistics
+        /// </summary>
+        /// <param name="stats">Receives tick count, overruns and tick durations (zeroed when not running)</param>
+        /// <returns>ULL_OK, or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_GetPumpStats(out ULL_PumpStats stats);
+
+        /// <summary>
+        /// Read hot-path statistics (update counters, name cache, lock wait, frame data histogram)
+        /// </summary>
+        /// <param name="stats">Receives the statistics (zeroed when not initialized)</param>
+        /// <returns>ULL_OK, or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_GetStats(out ULL_Stats stats);
+
+        /// <summary>
+        /// Zero the statistics counters (also the deadband counters)
+        /// </summary>
+        /// <returns>ULL_OK, or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_ResetStats();
+
+        //=============================================================================
+        // Capture and Replay
+        //=============================================================================
+
+        /// <summary>
+        /// Start recording every frame sent to LiveLink to a capture file (overwritten)
+        /// </summary>
+        /// <param name="filePath">Capture file path</param>
+        /// <returns>ULL_OK, ULL_ERROR (file not created, or shared-memory transport), or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_StartCapture([MarshalAs(UnmanagedType.LPStr)] string filePath);
+
+        /// <summary>
+        /// Finalize and close the capture file
+        /// </summary>
+        /// <returns>ULL_OK (also when no capture is running), or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_StopCapture();
+
+        /// <summary>
+        /// Stream a capture file to LiveLink on a native replay thread
+        /// </summary>
+        /// <param name="filePath">Capture file written by ULL_StartCapture</param>
+        /// <param name="speed">Playback speed multiplier (1.0 = real time, ULL_REPLAY_PAUSED = start paused)</param>
+        /// <param name="loop">Non-zero to restart at the end of the capture</param>
+        /// <returns>ULL_OK, ULL_ERROR (unreadable file), ULL_NOT_CONNECTED, or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_StartReplay([MarshalAs(UnmanagedType.LPStr)] string filePath, double speed, int loop);
+
+        /// <summary>
+        /// Change replay speed (ULL_REPLAY_PAUSED to pause)
+        /// </summary>
+        /// <returns>ULL_OK, ULL_ERROR if no replay is running, or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_SetReplaySpeed(double speed);
+
+        /// <summary>
+        /// Jump to a capture time and publish each subject's state at that time
+        /// </summary>
+        /// <returns>ULL_OK, ULL_ERROR if no replay is running, or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_SeekReplay(double seconds);
+
+        /// <summary>
+        /// Stop the replay and remove the replayed subjects
+        /// </summary>
+        /// <returns>ULL_OK (also when no replay is running), or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_StopReplay();
+
+        /// <summary>
+        /// Read the replay position and capture length
+        /// </summary>
+        /// <returns>ULL_OK, ULL_ERROR if no replay is running, or ULL_NOT_INITIALIZED (outputs set to 0)</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_GetReplayStatus(out double positionSeconds, out double durationSeconds);
+
+        /// <summary>
+        /// Read back the last frame the replay sent for a subject (what a seek rebuilt)
+        /// </summary>
+        /// <param name="subjectName">Captured subject name</param>
+        /// <param name="transform">Receives the transform (identity for data subjects)</param>
+        /// <param name="propertyValues">Receives up to maxPropertyCount values (may be null when maxPropertyCount is 0)</param>
+        /// <param name="maxPropertyCount">Capacity of propertyValues</param>
+        /// <returns>The subject's property count, ULL_ERROR (no replay or no frame of the subject), or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_GetReplayFrame(
+            [MarshalAs(UnmanagedType.LPStr)] string subjectName,
+            out ULL_Transform transform,
+            [Out] float[]? propertyValues,
+            int maxPropertyCount);
+
+        //=============================================================================
+        // Sessions
+        //=============================================================================
+
+        /// <summary>
+        /// Create an independent session with its own provider, subject tables, lock and threads
+        /// </summary>
+        /// <param name="providerName">Name displayed in Unreal's LiveLink window (unique among live sessions)</param>
+        /// <param name="options">Options with structSize set (see ULL_InitOptions.FromConfiguration)</param>
+        /// <returns>Session ID (> ULL_DEFAULT_SESSION), or ULL_ERROR</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_CreateSession(
+            [MarshalAs(UnmanagedType.LPStr)] string providerName,
+            ref ULL_InitOptions options);
+
+        /// <summary>
+        /// Shut down a session and remove its subjects; its handles become invalid
+        /// </summary>
+        /// <returns>ULL_OK, or ULL_ERROR for unknown IDs and ULL_DEFAULT_SESSION</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_DestroySession(int sessionId);
+
+        /// <summary>
+        /// Register a transform subject in a session (ULL_DEFAULT_SESSION = ULL_Initialize bridge)
+        /// </summary>
+        /// <returns>Handle (>= 0) on success, negative return code on failure</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_SessionRegisterObjectH(
+            int sessionId,
+            [MarshalAs(UnmanagedType.LPStr)] string subjectName);
+
+        /// <summary>
+        /// Register a transform subject with custom properties in a session
+        /// </summary>
+        /// <returns>Handle (>= 0) on success, negative return code on failure</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_SessionRegisterObjectWithPropertiesH(
+            int sessionId,
+            [MarshalAs(UnmanagedType.LPStr)] string subjectName,
+            [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPStr)] string[] propertyNames,
+            int propertyCount);
+
+        /// <summary>
+        /// Update transforms and property values for many handles of a session
+        /// </summary>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_SessionUpdateObjectsBatchWithPropertiesH(
+            int sessionId,
+            [In] int[] handles,
+            [In] ULL_Transform[] transforms,
+            [MarshalAs(UnmanagedType.LPArray)] float[]? propertyValues,
+            int propertyCount,
+            int count);
+
+        /// <summary>
+        /// Remove a transform subject of a session by handle
+        /// </summary>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ULL_SessionRemoveObjectH(int sessionId, int handle);
+
+        /// <summary>
+        /// Update a data subject of a session (registered first when propertyNames is given)
+        /// </summary>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern void ULL_SessionUpdateDataSubject(
+            int sessionId,
+            [MarshalAs(UnmanagedType.LPStr)] string subjectName,
+            [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPStr)] string[]? propertyNames,
+            [MarshalAs(UnmanagedType.LPArray)] float[] propertyValues,
+            int propertyCount);
+
+        /// <summary>
+        /// Remove a data subject of a session
+        /// </summary>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern void ULL_SessionRemoveDataSubject(
+            int sessionId,
+            [MarshalAs(UnmanagedType.LPStr)] string subjectName);
+
+        /// <summary>
+        /// Read a session's hot-path statistics
+        /// </summary>
+        /// <returns>ULL_OK, ULL_ERROR for unknown sessions, or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_SessionGetStats(int sessionId, out ULL_Stats stats);
+
+        /// <summary>
+        /// Get a session's initialization state (see ULL_GetInitState)
+        /// </summary>
+        /// <returns>ULL_INIT_STATE_* value, ULL_ERROR for unknown sessions, or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_SessionGetInitState(int sessionId);
+
+        //=============================================================================
+        // Interest Regions
+        //=============================================================================
+
+        /// <summary>
+        /// Declare the regions of interest; transform subjects outside every region are sent at outsideRateHz
+        /// </summary>
+        /// <param name="regions">Boxes in Unreal coordinates, or null when count is 0</param>
+        /// <param name="count">Number of regions (0 = every subject streams, max ULL_MAX_INTEREST_REGIONS)</param>
+        /// <param name="outsideRateHz">Frames per second outside every region (ULL_INTEREST_SUPPRESS = none)</param>
+        /// <returns>ULL_OK, ULL_ERROR (invalid regions or rate), or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_SetInterestRegions(
+            [In] ULL_InterestRegion[]? regions,
+            int count,
+            int outsideRateHz);
+
+        /// <summary>
+        /// Declare the regions of interest of a session (see ULL_SetInterestRegions)
+        /// </summary>
+        /// <returns>ULL_OK, ULL_ERROR (unknown session, invalid regions or rate), or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_SessionSetInterestRegions(
+            int sessionId,
+            [In] ULL_InterestRegion[]? regions,
+            int count,
+            int outsideRateHz);
+
+        /// <summary>
+        /// Read the interest-region counters since initialization
+        /// </summary>
+        /// <param name="heldFrames">Updates outside every region that were not sent</param>
+        /// <param name="outsideFrames">Frames sent from outside every region at the outside rate</param>
+        /// <param name="gridCells">Occupied spatial grid cells</param>
+        /// <returns>ULL_OK, or ULL_NOT_INITIALIZED (outputs set to 0)</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_GetInterestCounters(
+            out ulong heldFrames,
+            out ulong outsideFrames,
+            out int gridCells);
+
+        //=============================================================================
+        // Latency Probe
+        //=============================================================================
+
+        /// <summary>
+        /// Send the reserved probe subject through the update path and measure each stage it passes
+        /// </summary>
+        /// <param name="rateHz">Probes per second (1 to ULL_LATENCY_MAX_RATE_HZ)</param>
+        /// <param name="echoPort">UDP port the Unreal-side echo reports to (0 = in-process stages only)</param>
+        /// <param name="csvPath">CSV file with one row of statistics per second, or null for none</param>
+        /// <returns>ULL_OK, ULL_ERROR (invalid rate or port, port in use, file not created, subject pools
+        /// or shared-memory transport), or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int ULL_StartLatencyProbe(
+            int rateHz,
+            int echoPort,
+            [MarshalAs(UnmanagedType.LPStr)] string? csvPath);
+
+        /// <summary>
+        /// Stop the probe, write the last CSV row and unregister the probe subject
+        /// </summary>
+        /// <returns>ULL_OK (also when no probe is running), or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_StopLatencyProbe();
+
+        /// <summary>
+        /// Read the probe counters and per-stage latency percentiles
+        /// </summary>
+        /// <param name="stats">Statistics (zeroed on failure; kept after the probe stops until it restarts)</param>
+        /// <returns>ULL_OK, or ULL_NOT_INITIALIZED</returns>
+        [DllImport(DLL_NAME, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int ULL_GetLatencyStats(out ULL_LatencyStats stats);
+
         //=============================================================================
         // Helper Methods for Error Handling
         //=============================================================================
@@ -286,6 +1085,22 @@ namespace SimioUnrealEngineLiveLinkConnector.UnrealIntegration
             }
         }
 
+        /// <summary>
+        /// Encodes a subject name once for the byte[] overloads (null-terminated UTF-8, as the native layer decodes it)
+        /// </summary>
+        /// <param name="name">Subject name</param>
+        /// <returns>Null-terminated UTF-8 bytes; cache and reuse them across updates</returns>
+        /// <exception cref="ArgumentNullException">Thrown if name is null</exception>
+        public static byte[] GetUtf8Name(string name)
+        {
+            if (name == null)
+                throw new ArgumentNullException(nameof(name));
+
+            byte[] bytes = new byte[System.Text.Encoding.UTF8.GetByteCount(name) + 1];
+            System.Text.Encoding.UTF8.GetBytes(name, 0, name.Length, bytes, 0);
+            return bytes;
+        }
+
         /// <summary>
         /// Gets the expected API version that this managed layer was built for
         /// </summary>
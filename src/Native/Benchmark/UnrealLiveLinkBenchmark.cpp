@@ -0,0 +1,778 @@
+// UnrealLiveLinkBenchmark.cpp
+// Standalone benchmark for the UnrealLiveLink.Native C API
+//
+// Loads UnrealLiveLink.Native.dll at runtime (real bridge or mock, see --dll) and drives the
+// exported ULL_* functions with configurable subject, property and thread counts and an optional
+// per-subject update rate. Reports per-call latency percentiles, subject updates per second and
+// memory growth for each scenario, plus the native ULL_GetStats counters when available.
+//
+// Exports are resolved by name, so the same binary runs against older DLLs: scenarios whose
+// functions are missing are skipped. See README.md for usage.
+
+#include "../UnrealLiveLink.Native/Public/UnrealLiveLink.Types.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <dlfcn.h>
+#include <sys/resource.h>
+#endif
+
+//
+// Harness Allocation Counter
+//
+// Counts this executable's heap allocations. The measured loops must not allocate, so a non-zero
+// count during a scenario means the harness itself disturbed the timing. Allocations inside the
+// DLL use its own allocator and show up in the process memory delta instead.
+//
+
+static std::atomic<unsigned long long> g_harnessAllocations{0};
+
+void* operator new(size_t size) {
+    g_harnessAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t) noexcept { std::free(memory); }
+
+//
+// Native API Function Pointers
+//
+
+typedef int  (*FN_Initialize)(const char*);
+typedef int  (*FN_InitializeEx)(const char*, const ULL_InitOptions*);
+typedef void (*FN_Shutdown)();
+typedef int  (*FN_GetVersion)();
+typedef void (*FN_RegisterObjectWithProperties)(const char*, const char**, int);
+typedef void (*FN_UpdateObject)(const char*, const ULL_Transform*);
+typedef void (*FN_UpdateObjectWithProperties)(const char*, const ULL_Transform*, const float*, int);
+typedef void (*FN_UpdateObjectsBatchWithProperties)(const char**, const ULL_Transform*, const float*, int, int);
+typedef int  (*FN_RegisterObjectWithPropertiesH)(const char*, const char**, int);
+typedef void (*FN_UpdateObjectWithPropertiesH)(int, const ULL_Transform*, const float*, int);
+typedef void (*FN_UpdateObjectsBatchWithPropertiesH)(const int*, const ULL_Transform*, const float*, int, int);
+typedef void (*FN_UpdateObjectsBatchSimioH)(const int*, const double*, int, const float*, int, int);
+typedef void (*FN_UpdateObjectsBatchCompactH)(const int*, const ULL_CompactTransform*, const float*, int, const float*, int, int);
+typedef int  (*FN_GetStats)(ULL_Stats*);
+typedef int  (*FN_ResetStats)();
+
+struct FNativeApi {
+    FN_Initialize Initialize = nullptr;
+    FN_InitializeEx InitializeEx = nullptr;
+    FN_Shutdown Shutdown = nullptr;
+    FN_GetVersion GetVersion = nullptr;
+    FN_RegisterObjectWithProperties RegisterObjectWithProperties = nullptr;
+    FN_UpdateObject UpdateObject = nullptr;
+    FN_UpdateObjectWithProperties UpdateObjectWithProperties = nullptr;
+    FN_UpdateObjectsBatchWithProperties UpdateObjectsBatchWithProperties = nullptr;
+    FN_RegisterObjectWithPropertiesH RegisterObjectWithPropertiesH = nullptr;
+    FN_UpdateObjectWithPropertiesH UpdateObjectWithPropertiesH = nullptr;
+    FN_UpdateObjectsBatchWithPropertiesH UpdateObjectsBatchWithPropertiesH = nullptr;
+    FN_UpdateObjectsBatchSimioH UpdateObjectsBatchSimioH = nullptr;
+    FN_UpdateObjectsBatchCompactH UpdateObjectsBatchCompactH = nullptr;
+    FN_GetStats GetStats = nullptr;
+    FN_ResetStats ResetStats = nullptr;
+};
+
+#ifdef _WIN32
+typedef HMODULE LibraryHandle;
+static LibraryHandle OpenLibrary(const char* path) { return LoadLibraryA(path); }
+static void* FindSymbol(LibraryHandle library, const char* name) { return (void*)GetProcAddress(library, name); }
+#else
+typedef void* LibraryHandle;
+static LibraryHandle OpenLibrary(const char* path) { return dlopen(path, RTLD_NOW); }
+static void* FindSymbol(LibraryHandle library, const char* name) { return dlsym(library, name); }
+#endif
+
+template<typename T>
+static void Resolve(LibraryHandle library, T& function, const char* name) {
+    function = reinterpret_cast<T>(FindSymbol(library, name));
+}
+
+static bool LoadNativeApi(const char* path, FNativeApi& api) {
+    LibraryHandle library = OpenLibrary(path);
+    if (!library) {
+        return false;
+    }
+
+    Resolve(library, api.Initialize, "ULL_Initialize");
+    Resolve(library, api.InitializeEx, "ULL_InitializeEx");
+    Resolve(library, api.Shutdown, "ULL_Shutdown");
+    Resolve(library, api.GetVersion, "ULL_GetVersion");
+    Resolve(library, api.RegisterObjectWithProperties, "ULL_RegisterObjectWithProperties");
+    Resolve(library, api.UpdateObject, "ULL_UpdateObject");
+    Resolve(library, api.UpdateObjectWithProperties, "ULL_UpdateObjectWithProperties");
+    Resolve(library, api.UpdateObjectsBatchWithProperties, "ULL_UpdateObjectsBatchWithProperties");
+    Resolve(library, api.RegisterObjectWithPropertiesH, "ULL_RegisterObjectWithPropertiesH");
+    Resolve(library, api.UpdateObjectWithPropertiesH, "ULL_UpdateObjectWithPropertiesH");
+    Resolve(library, api.UpdateObjectsBatchWithPropertiesH, "ULL_UpdateObjectsBatchWithPropertiesH");
+    Resolve(library, api.UpdateObjectsBatchSimioH, "ULL_UpdateObjectsBatchSimioH");
+    Resolve(library, api.UpdateObjectsBatchCompactH, "ULL_UpdateObjectsBatchCompactH");
+    Resolve(library, api.GetStats, "ULL_GetStats");
+    Resolve(library, api.ResetStats, "ULL_ResetStats");
+
+    // The library stays loaded for the life of the process (ULL_Shutdown does the cleanup)
+    return api.Initialize && api.Shutdown && api.RegisterObjectWithProperties && api.UpdateObjectWithProperties;
+}
+
+//
+// Configuration
+//
+
+struct FBenchmarkConfig {
+#ifdef _WIN32
+    std::string dllPath = "UnrealLiveLink.Native.dll";
+#else
+    std::string dllPath = "./UnrealLiveLink.Native.so";
+#endif
+    std::string providerName = "UnrealLiveLinkBenchmark";
+    std::string scenario = "all";
+    int subjects = 1000;
+    int properties = 0;
+    int rateHz = 0;              // Updates per second per subject (0 = as fast as possible)
+    int threads = 1;
+    int scalingMaxThreads = 0;   // Rerun the scenarios at 1, 2, 4, ... threads up to this (0 = off)
+    double durationSeconds = 5.0;
+    double warmupSeconds = 1.0;
+    int sendMode = ULL_SEND_MODE_SYNC;
+    int publishRateHz = 0;
+    bool csv = false;
+};
+
+static void PrintUsage() {
+    std::printf(
+        "Usage: UnrealLiveLinkBenchmark [options]\n"
+        "  --dll <path>           Native DLL to load (real bridge or mock)\n"
+        "  --scenario <name>      name | handle | batch | batch-h | simio | compact | all (default all)\n"
+        "  --subjects <n>         Transform subjects (default 1000)\n"
+        "  --properties <n>       Property values per subject (default 0)\n"
+        "  --rate <hz>            Updates per second per subject, 0 = as fast as possible (default 0)\n"
+        "  --threads <n>          Update threads, subjects are split between them (default 1)\n"
+        "  --scaling <max>        Rerun each scenario at 1, 2, 4, ... threads up to max (instead of --threads)\n"
+        "  --duration <s>         Measured seconds per scenario (default 5)\n"
+        "  --warmup <s>           Unmeasured seconds before each scenario (default 1)\n"
+        "  --async                Initialize with ULL_SEND_MODE_ASYNC\n"
+        "  --publish-rate <hz>    Initialize with coalescing at this rate\n"
+        "  --provider <name>      LiveLink provider name\n"
+        "  --csv                  One CSV row per scenario instead of the table\n");
+}
+
+static bool ParseArguments(int argc, char** argv, FBenchmarkConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--dll" && hasValue) config.dllPath = argv[++i];
+        else if (arg == "--scenario" && hasValue) config.scenario = argv[++i];
+        else if (arg == "--subjects" && hasValue) config.subjects = std::atoi(argv[++i]);
+        else if (arg == "--properties" && hasValue) config.properties = std::atoi(argv[++i]);
+        else if (arg == "--rate" && hasValue) config.rateHz = std::atoi(argv[++i]);
+        else if (arg == "--threads" && hasValue) config.threads = std::atoi(argv[++i]);
+        else if (arg == "--scaling" && hasValue) config.scalingMaxThreads = std::atoi(argv[++i]);
+        else if (arg == "--duration" && hasValue) config.durationSeconds = std::atof(argv[++i]);
+        else if (arg == "--warmup" && hasValue) config.warmupSeconds = std::atof(argv[++i]);
+        else if (arg == "--publish-rate" && hasValue) config.publishRateHz = std::atoi(argv[++i]);
+        else if (arg == "--provider" && hasValue) config.providerName = argv[++i];
+        else if (arg == "--async") config.sendMode = ULL_SEND_MODE_ASYNC;
+        else if (arg == "--csv") config.csv = true;
+        else return false;
+    }
+
+    return config.subjects > 0 && config.properties >= 0 && config.rateHz >= 0 &&
+           config.threads > 0 && config.threads <= config.subjects && config.scalingMaxThreads >= 0 &&
+           config.durationSeconds > 0.0 && config.warmupSeconds >= 0.0;
+}
+
+//
+// Process Memory
+//
+
+static long long GetProcessMemoryBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS_EX counters = {};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&counters, sizeof(counters))) {
+        return (long long)counters.PrivateUsage;
+    }
+    return 0;
+#else
+    // Peak resident set (kilobytes on Linux); only grows, which is what a leak check needs
+    struct rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    return (long long)usage.ru_maxrss * 1024;
+#endif
+}
+
+//
+// Scenarios
+//
+
+typedef std::chrono::steady_clock Clock;
+
+enum class EScenario { Name, Handle, Batch, BatchHandle, Simio, Compact };
+
+struct FScenarioInfo {
+    EScenario scenario;
+    const char* name;
+    bool batched;    // One call per thread per frame instead of one per subject
+};
+
+static const FScenarioInfo g_scenarios[] = {
+    { EScenario::Name,        "name",    false },
+    { EScenario::Handle,      "handle",  false },
+    { EScenario::Batch,       "batch",   true  },
+    { EScenario::BatchHandle, "batch-h", true  },
+    { EScenario::Simio,       "simio",   true  },
+    { EScenario::Compact,     "compact", true  },
+};
+
+static bool IsScenarioAvailable(const FNativeApi& api, EScenario scenario) {
+    switch (scenario) {
+        case EScenario::Name:        return true;
+        case EScenario::Handle:      return api.UpdateObjectWithPropertiesH != nullptr;
+        case EScenario::Batch:       return api.UpdateObjectsBatchWithProperties != nullptr;
+        case EScenario::BatchHandle: return api.UpdateObjectsBatchWithPropertiesH != nullptr;
+        case EScenario::Simio:       return api.UpdateObjectsBatchSimioH != nullptr;
+        case EScenario::Compact:     return api.UpdateObjectsBatchCompactH != nullptr;
+    }
+    return false;
+}
+
+// Subjects registered once and shared by every scenario
+struct FSubjectSet {
+    std::vector<std::string> names;
+    std::vector<const char*> namePointers;
+    std::vector<int> handles;
+    bool hasHandles = false;
+};
+
+// One update thread's slice of the subjects and its preallocated buffers
+struct FThreadWork {
+    int first = 0;
+    int count = 0;
+    std::vector<ULL_Transform> transforms;
+    std::vector<ULL_CompactTransform> compactTransforms;
+    std::vector<double> simioValues;     // ULL_SIMIO_POSE_COMPONENTS columns of count values
+    std::vector<float> propertyValues;
+    std::vector<double> latenciesNs;     // Reserved up front, recording stops when full
+    unsigned long long calls = 0;
+    unsigned long long updates = 0;
+    unsigned long long overruns = 0;     // Frames that started after their scheduled time
+};
+
+static const size_t MaxLatencySamplesPerThread = 4000000;
+
+static void PrepareThreadWork(FThreadWork& work, int first, int count, int propertyCount) {
+    work.first = first;
+    work.count = count;
+    work.transforms.resize(count);
+    work.compactTransforms.resize(count);
+    work.simioValues.assign((size_t)ULL_SIMIO_POSE_COMPONENTS * count, 0.0);
+    work.propertyValues.assign((size_t)propertyCount * count, 0.0f);
+    work.latenciesNs.clear();
+    work.latenciesNs.reserve(MaxLatencySamplesPerThread);
+
+    for (int i = 0; i < count; ++i) {
+        ULL_Transform& transform = work.transforms[i];
+        transform.position[0] = 100.0 * (first + i);
+        transform.position[1] = 0.0;
+        transform.position[2] = 0.0;
+        transform.rotation[0] = 0.0;
+        transform.rotation[1] = 0.0;
+        transform.rotation[2] = 0.0;
+        transform.rotation[3] = 1.0;
+        transform.scale[0] = 1.0;
+        transform.scale[1] = 1.0;
+        transform.scale[2] = 1.0;
+
+        // Identity rotation: W dropped, the other three components quantized to 0
+        ULL_CompactTransform& compact = work.compactTransforms[i];
+        compact.position[0] = (float)transform.position[0];
+        compact.position[1] = 0.0f;
+        compact.position[2] = 0.0f;
+        compact.rotation[0] = 32768;
+        compact.rotation[1] = 32768;
+        compact.rotation[2] = 32768;
+        compact.flags = 3;
+
+        work.simioValues[i] = (first + i);    // X column, meters
+    }
+}
+
+// Moves every subject of the slice a little so change detection never suppresses a frame
+static void AdvanceFrame(FThreadWork& work, unsigned long long frame) {
+    const double offset = (double)(frame & 1023);
+    for (int i = 0; i < work.count; ++i) {
+        work.transforms[i].position[1] = offset;
+        work.compactTransforms[i].position[1] = (float)offset;
+        work.simioValues[(size_t)2 * work.count + i] = offset * 0.01;    // Z column (Simio height)
+    }
+    for (float& value : work.propertyValues) {
+        value = (float)offset;
+    }
+}
+
+static void RecordCall(FThreadWork& work, Clock::time_point start, Clock::time_point end, bool record) {
+    if (record && work.latenciesNs.size() < work.latenciesNs.capacity()) {
+        work.latenciesNs.push_back((double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+}
+
+// Runs one frame: every subject of the slice is updated once
+static void RunFrame(const FNativeApi& api, EScenario scenario, const FSubjectSet& subjects,
+                     FThreadWork& work, int propertyCount, bool record) {
+    const float* properties = propertyCount > 0 ? work.propertyValues.data() : nullptr;
+    const char* const* names = subjects.namePointers.data() + work.first;
+    const int* handles = subjects.hasHandles ? subjects.handles.data() + work.first : nullptr;
+
+    switch (scenario) {
+        case EScenario::Name:
+            for (int i = 0; i < work.count; ++i) {
+                Clock::time_point start = Clock::now();
+                if (propertyCount > 0) {
+                    api.UpdateObjectWithProperties(names[i], &work.transforms[i], properties + (size_t)i * propertyCount, propertyCount);
+                } else {
+                    api.UpdateObject(names[i], &work.transforms[i]);
+                }
+                RecordCall(work, start, Clock::now(), record);
+            }
+            work.calls += work.count;
+            break;
+
+        case EScenario::Handle:
+            for (int i = 0; i < work.count; ++i) {
+                Clock::time_point start = Clock::now();
+                api.UpdateObjectWithPropertiesH(handles[i], &work.transforms[i],
+                                                properties ? properties + (size_t)i * propertyCount : nullptr, propertyCount);
+                RecordCall(work, start, Clock::now(), record);
+            }
+            work.calls += work.count;
+            break;
+
+        case EScenario::Batch: {
+            Clock::time_point start = Clock::now();
+            api.UpdateObjectsBatchWithProperties(const_cast<const char**>(names), work.transforms.data(), properties, propertyCount, work.count);
+            RecordCall(work, start, Clock::now(), record);
+            work.calls++;
+            break;
+        }
+
+        case EScenario::BatchHandle: {
+            Clock::time_point start = Clock::now();
+            api.UpdateObjectsBatchWithPropertiesH(handles, work.transforms.data(), properties, propertyCount, work.count);
+            RecordCall(work, start, Clock::now(), record);
+            work.calls++;
+            break;
+        }
+
+        case EScenario::Simio: {
+            Clock::time_point start = Clock::now();
+            api.UpdateObjectsBatchSimioH(handles, work.simioValues.data(), ULL_SIMIO_POSE_COMPONENTS, properties, propertyCount, work.count);
+            RecordCall(work, start, Clock::now(), record);
+            work.calls++;
+            break;
+        }
+
+        case EScenario::Compact: {
+            Clock::time_point start = Clock::now();
+            api.UpdateObjectsBatchCompactH(handles, work.compactTransforms.data(), nullptr, 0, properties, propertyCount, work.count);
+            RecordCall(work, start, Clock::now(), record);
+            work.calls++;
+            break;
+        }
+    }
+
+    work.updates += work.count;
+}
+
+// Frame loop of one update thread: warm-up, then the measured phase
+static void RunThread(const FNativeApi& api, const FBenchmarkConfig& config, EScenario scenario,
+                      const FSubjectSet& subjects, FThreadWork& work,
+                      std::atomic<int>& readyThreads, std::atomic<bool>& startFlag,
+                      std::atomic<Clock::rep>& measureStartTicks) {
+    readyThreads.fetch_add(1);
+    while (!startFlag.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+
+    const Clock::time_point warmupEnd = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(config.warmupSeconds));
+    const Clock::duration framePeriod = config.rateHz > 0
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / config.rateHz))
+        : Clock::duration::zero();
+
+    unsigned long long frame = 0;
+    while (Clock::now() < warmupEnd) {
+        AdvanceFrame(work, frame++);
+        RunFrame(api, scenario, subjects, work, config.properties, false);
+        if (config.rateHz > 0) {
+            std::this_thread::sleep_for(framePeriod);
+        }
+    }
+
+    work.calls = 0;
+    work.updates = 0;
+    work.overruns = 0;
+
+    // All threads measure against the same start time, set by the main thread after warm-up
+    Clock::time_point measureStart;
+    do {
+        std::this_thread::yield();
+        measureStart = Clock::time_point(Clock::duration(measureStartTicks.load(std::memory_order_acquire)));
+    } while (Clock::now() < measureStart);
+
+    const Clock::time_point measureEnd = measureStart + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(config.durationSeconds));
+    Clock::time_point nextFrame = measureStart;
+
+    while (Clock::now() < measureEnd) {
+        AdvanceFrame(work, frame++);
+        RunFrame(api, scenario, subjects, work, config.properties, true);
+
+        if (config.rateHz > 0) {
+            nextFrame += framePeriod;
+            if (Clock::now() > nextFrame) {
+                work.overruns++;
+            } else {
+                std::this_thread::sleep_until(nextFrame);
+            }
+        }
+    }
+}
+
+struct FScenarioResult {
+    const char* name = "";
+    int threads = 0;
+    double seconds = 0.0;
+    double speedup = 0.0;        // Updates/s relative to the 1-thread run (--scaling only)
+    unsigned long long calls = 0;
+    unsigned long long updates = 0;
+    unsigned long long overruns = 0;
+    double p50Us = 0.0, p90Us = 0.0, p99Us = 0.0, p999Us = 0.0, maxUs = 0.0;
+    long long memoryDeltaBytes = 0;
+    unsigned long long harnessAllocations = 0;
+    bool hasStats = false;
+    ULL_Stats stats = {};
+};
+
+static double Percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t index = (size_t)std::ceil(fraction * sorted.size());
+    index = index == 0 ? 0 : index - 1;
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+static FScenarioResult RunScenario(const FNativeApi& api, const FBenchmarkConfig& config,
+                                   const FScenarioInfo& info, const FSubjectSet& subjects,
+                                   std::vector<FThreadWork>& works) {
+    FScenarioResult result;
+    result.name = info.name;
+    result.threads = (int)works.size();
+
+    if (api.ResetStats) {
+        api.ResetStats();
+    }
+
+    std::atomic<int> readyThreads{0};
+    std::atomic<bool> startFlag{false};
+    std::atomic<Clock::rep> measureStartTicks{Clock::time_point::max().time_since_epoch().count()};
+
+    std::vector<std::thread> threads;
+    threads.reserve(works.size());
+    for (FThreadWork& work : works) {
+        work.latenciesNs.clear();
+        threads.emplace_back(RunThread, std::cref(api), std::cref(config), info.scenario, std::cref(subjects),
+                             std::ref(work), std::ref(readyThreads), std::ref(startFlag), std::ref(measureStartTicks));
+    }
+
+    while (readyThreads.load() < (int)works.size()) {
+        std::this_thread::yield();
+    }
+    startFlag.store(true, std::memory_order_release);
+
+    // Measurement starts for every thread at the same instant, after the warm-up
+    std::this_thread::sleep_for(std::chrono::duration<double>(config.warmupSeconds));
+    const long long memoryBefore = GetProcessMemoryBytes();
+    const unsigned long long allocationsBefore = g_harnessAllocations.load();
+    const Clock::time_point start = Clock::now() + std::chrono::milliseconds(10);
+    measureStartTicks.store(start.time_since_epoch().count(), std::memory_order_release);
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const Clock::time_point end = Clock::now();
+
+    result.harnessAllocations = g_harnessAllocations.load() - allocationsBefore;
+    result.memoryDeltaBytes = GetProcessMemoryBytes() - memoryBefore;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+
+    std::vector<double> latencies;
+    for (const FThreadWork& work : works) {
+        result.calls += work.calls;
+        result.updates += work.updates;
+        result.overruns += work.overruns;
+        latencies.insert(latencies.end(), work.latenciesNs.begin(), work.latenciesNs.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    result.p50Us = Percentile(latencies, 0.50) / 1000.0;
+    result.p90Us = Percentile(latencies, 0.90) / 1000.0;
+    result.p99Us = Percentile(latencies, 0.99) / 1000.0;
+    result.p999Us = Percentile(latencies, 0.999) / 1000.0;
+    result.maxUs = latencies.empty() ? 0.0 : latencies.back() / 1000.0;
+
+    if (api.GetStats && api.GetStats(&result.stats) == ULL_OK) {
+        result.hasStats = true;
+    }
+
+    return result;
+}
+
+//
+// Setup and Reporting
+//
+
+static bool RegisterSubjects(const FNativeApi& api, const FBenchmarkConfig& config, FSubjectSet& subjects, double& outSeconds) {
+    std::vector<std::string> propertyNames;
+    std::vector<const char*> propertyPointers;
+    for (int i = 0; i < config.properties; ++i) {
+        propertyNames.push_back("Property" + std::to_string(i));
+    }
+    for (const std::string& name : propertyNames) {
+        propertyPointers.push_back(name.c_str());
+    }
+
+    subjects.names.resize(config.subjects);
+    subjects.namePointers.resize(config.subjects);
+    subjects.handles.assign(config.subjects, ULL_INVALID_HANDLE);
+    subjects.hasHandles = api.RegisterObjectWithPropertiesH != nullptr;
+
+    for (int i = 0; i < config.subjects; ++i) {
+        subjects.names[i] = "BenchSubject_" + std::to_string(i);
+        subjects.namePointers[i] = subjects.names[i].c_str();
+    }
+
+    const Clock::time_point start = Clock::now();
+    for (int i = 0; i < config.subjects; ++i) {
+        if (subjects.hasHandles) {
+            subjects.handles[i] = api.RegisterObjectWithPropertiesH(
+                subjects.namePointers[i], propertyPointers.empty() ? nullptr : propertyPointers.data(), config.properties);
+            if (subjects.handles[i] < 0) {
+                std::fprintf(stderr, "Registration of '%s' failed (%d)\n", subjects.namePointers[i], subjects.handles[i]);
+                return false;
+            }
+        } else {
+            api.RegisterObjectWithProperties(
+                subjects.namePointers[i], propertyPointers.empty() ? nullptr : propertyPointers.data(), config.properties);
+        }
+    }
+    outSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return true;
+}
+
+static void PrintResult(const FBenchmarkConfig& config, const FScenarioResult& result, bool header) {
+    const double updatesPerSecond = result.seconds > 0.0 ? result.updates / result.seconds : 0.0;
+    const double callsPerSecond = result.seconds > 0.0 ? result.calls / result.seconds : 0.0;
+
+    if (config.csv) {
+        if (header) {
+            std::printf("scenario,subjects,properties,threads,rateHz,seconds,calls,updates,callsPerSec,updatesPerSec,"
+                        "p50Us,p90Us,p99Us,p999Us,maxUs,overruns,memoryDeltaBytes,harnessAllocations,"
+                        "sent,dropped,coalesced,deadbandSuppressed,queueDropped,lockContentions,speedup\n");
+        }
+        std::printf("%s,%d,%d,%d,%d,%.3f,%llu,%llu,%.0f,%.0f,%.3f,%.3f,%.3f,%.3f,%.3f,%llu,%lld,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%.3f\n",
+                    result.name, config.subjects, config.properties, result.threads, config.rateHz, result.seconds,
+                    result.calls, result.updates, callsPerSecond, updatesPerSecond,
+                    result.p50Us, result.p90Us, result.p99Us, result.p999Us, result.maxUs,
+                    result.overruns, result.memoryDeltaBytes, result.harnessAllocations,
+                    result.stats.transformUpdatesSent, result.stats.transformUpdatesDropped,
+                    result.stats.coalescedUpdates, result.stats.deadbandSuppressed,
+                    result.stats.queueDropped, result.stats.lockContentions, result.speedup);
+        return;
+    }
+
+    if (header) {
+        std::printf("\n%-8s %12s %14s %9s %9s %9s %9s %10s %9s %12s %7s\n",
+                    "Scenario", "Calls/s", "Updates/s", "p50 us", "p90 us", "p99 us", "p99.9 us", "max us",
+                    "Overruns", "Memory +KB", "Allocs");
+    }
+    std::printf("%-8s %12.0f %14.0f %9.3f %9.3f %9.3f %9.3f %10.3f %9llu %12lld %7llu\n",
+                result.name, callsPerSecond, updatesPerSecond,
+                result.p50Us, result.p90Us, result.p99Us, result.p999Us, result.maxUs,
+                result.overruns, result.memoryDeltaBytes / 1024, result.harnessAllocations);
+    if (result.hasStats) {
+        std::printf("         native: sent %llu, dropped %llu, coalesced %llu, deadband %llu, queue dropped %llu, "
+                    "lock contentions %llu/%llu\n",
+                    result.stats.transformUpdatesSent, result.stats.transformUpdatesDropped,
+                    result.stats.coalescedUpdates, result.stats.deadbandSuppressed, result.stats.queueDropped,
+                    result.stats.lockContentions, result.stats.lockAcquisitions);
+    }
+    if (result.speedup > 0.0) {
+        std::printf("         scaling: %d threads, %.2fx the 1-thread updates/s\n", result.threads, result.speedup);
+    }
+}
+
+// Subjects are split into contiguous slices, one per thread
+static void PrepareWorks(const FBenchmarkConfig& config, int threadCount, std::vector<FThreadWork>& works) {
+    works.clear();
+    works.resize(threadCount);
+    const int perThread = config.subjects / threadCount;
+    for (int t = 0; t < threadCount; ++t) {
+        const int first = t * perThread;
+        const int count = t == threadCount - 1 ? config.subjects - first : perThread;
+        PrepareThreadWork(works[t], first, count, config.properties);
+    }
+}
+
+static void PrintScalingSummary(const std::vector<int>& threadCounts, const std::vector<std::vector<double>>& updatesPerSecond) {
+    std::printf("\nScaling (updates/s, speedup over 1 thread)\n%-8s", "Scenario");
+    for (int threadCount : threadCounts) {
+        std::printf(" %20d", threadCount);
+    }
+    std::printf("\n");
+
+    const size_t scenarioCount = sizeof(g_scenarios) / sizeof(g_scenarios[0]);
+    for (size_t s = 0; s < scenarioCount; ++s) {
+        if (updatesPerSecond[s].empty() || updatesPerSecond[s][0] <= 0.0) {
+            continue;
+        }
+        std::printf("%-8s", g_scenarios[s].name);
+        for (double rate : updatesPerSecond[s]) {
+            std::printf(" %12.0f (%5.2fx)", rate, rate / updatesPerSecond[s][0]);
+        }
+        std::printf("\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    FBenchmarkConfig config;
+    if (!ParseArguments(argc, argv, config)) {
+        PrintUsage();
+        return 2;
+    }
+
+    FNativeApi api;
+    if (!LoadNativeApi(config.dllPath.c_str(), api)) {
+        std::fprintf(stderr, "Cannot load '%s' or it lacks the core ULL_* exports\n", config.dllPath.c_str());
+        return 1;
+    }
+
+    // Init options are only needed when a non-default mode is benchmarked
+    int initResult;
+    if ((config.sendMode != ULL_SEND_MODE_SYNC || config.publishRateHz > 0) && api.InitializeEx) {
+        ULL_InitOptions options = {};
+        options.structSize = (int)sizeof(ULL_InitOptions);
+        options.sendMode = config.sendMode;
+        options.queuePolicy = ULL_QUEUE_POLICY_DROP_OLDEST;
+        options.publishRateHz = config.publishRateHz;
+        initResult = api.InitializeEx(config.providerName.c_str(), &options);
+    } else {
+        initResult = api.Initialize(config.providerName.c_str());
+    }
+    if (initResult != ULL_OK) {
+        std::fprintf(stderr, "ULL_Initialize failed (%d)\n", initResult);
+        return 1;
+    }
+
+    if (!config.csv) {
+        std::printf("UnrealLiveLink benchmark: %s (API version %d)\n",
+                    config.dllPath.c_str(), api.GetVersion ? api.GetVersion() : 0);
+        std::printf("  %d subjects, %d properties, %s threads, rate %s, send mode %s, publish rate %d Hz, %.1f s per scenario\n",
+                    config.subjects, config.properties,
+                    config.scalingMaxThreads > 0 ? ("1-" + std::to_string(config.scalingMaxThreads)).c_str()
+                                                 : std::to_string(config.threads).c_str(),
+                    config.rateHz > 0 ? (std::to_string(config.rateHz) + " Hz").c_str() : "unlimited",
+                    config.sendMode == ULL_SEND_MODE_ASYNC ? "async" : "sync",
+                    config.publishRateHz, config.durationSeconds);
+    }
+
+    FSubjectSet subjects;
+    double registrationSeconds = 0.0;
+    if (!RegisterSubjects(api, config, subjects, registrationSeconds)) {
+        api.Shutdown();
+        return 1;
+    }
+    if (!config.csv) {
+        std::printf("  Registration: %.1f ms (%.2f us per subject, %s)\n",
+                    registrationSeconds * 1000.0, registrationSeconds * 1e6 / config.subjects,
+                    subjects.hasHandles ? "handles" : "names only");
+    }
+
+    // --scaling doubles the thread count from 1 (capped by the subject count, one subject per thread)
+    std::vector<int> threadCounts;
+    if (config.scalingMaxThreads > 0) {
+        for (int threadCount = 1; threadCount <= config.scalingMaxThreads && threadCount <= config.subjects; threadCount *= 2) {
+            threadCounts.push_back(threadCount);
+        }
+    } else {
+        threadCounts.push_back(config.threads);
+    }
+
+    const size_t scenarioTotal = sizeof(g_scenarios) / sizeof(g_scenarios[0]);
+    std::vector<std::vector<double>> scalingRates(scenarioTotal);
+    std::vector<FThreadWork> works;
+    bool header = true;
+    int scenarioCount = 0;
+    for (int threadCount : threadCounts) {
+        PrepareWorks(config, threadCount, works);
+        if (config.scalingMaxThreads > 0 && !config.csv) {
+            std::printf("\n  %d thread%s\n", threadCount, threadCount == 1 ? "" : "s");
+            header = true;
+        }
+
+        for (size_t s = 0; s < scenarioTotal; ++s) {
+            const FScenarioInfo& info = g_scenarios[s];
+            if (config.scenario != "all" && config.scenario != info.name) {
+                continue;
+            }
+            scenarioCount++;
+
+            if (!IsScenarioAvailable(api, info.scenario) ||
+                (info.scenario != EScenario::Name && info.scenario != EScenario::Batch && !subjects.hasHandles)) {
+                if (!config.csv) {
+                    std::printf("%-8s skipped (export not available in this DLL)\n", info.name);
+                }
+                continue;
+            }
+
+            FScenarioResult result = RunScenario(api, config, info, subjects, works);
+            if (config.scalingMaxThreads > 0) {
+                const double updatesPerSecond = result.seconds > 0.0 ? result.updates / result.seconds : 0.0;
+                scalingRates[s].push_back(updatesPerSecond);
+                result.speedup = scalingRates[s][0] > 0.0 ? updatesPerSecond / scalingRates[s][0] : 0.0;
+            }
+            PrintResult(config, result, header);
+            header = false;
+        }
+    }
+
+    if (config.scalingMaxThreads > 0 && !config.csv) {
+        PrintScalingSummary(threadCounts, scalingRates);
+    }
+
+    api.Shutdown();
+
+    if (scenarioCount == 0) {
+        std::fprintf(stderr, "Unknown scenario '%s'\n", config.scenario.c_str());
+        PrintUsage();
+        return 2;
+    }
+    return 0;
+}
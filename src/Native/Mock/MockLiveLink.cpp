@@ -8,6 +8,18 @@
 #include <sstream>
 #include <fstream>
 #include <ctime>
+#include <cstddef>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <windows.h>
 
 //
@@ -20,59 +32,425 @@ static std::unordered_set<std::string> g_transformObjects;
 static std::unordered_map<std::string, std::vector<std::string>> g_transformObjectProperties;
 static std::unordered_map<std::string, std::vector<std::string>> g_dataSubjectProperties;
 
+// Handle table: index = handle, empty string = released slot (mock does not reuse slots)
+static std::vector<std::string> g_handleNames;
+static std::unordered_map<std::string, int> g_nameToHandle;
+
+// Interned property schemas (index = schema ID)
+static std::vector<std::vector<std::string>> g_propertySchemas;
+
+// Capture and replay (mock records and sends nothing; replay position is simulated)
+static std::string g_capturePath;
+static bool g_replayRunning = false;
+static bool g_replayLoop = false;
+static double g_replaySpeed = 1.0;
+static double g_replayDuration = 0.0;
+static double g_replayBasePosition = 0.0;                     // Position at g_replayBaseTime
+static std::chrono::steady_clock::time_point g_replayBaseTime;
+
+// Latency probe (mock only writes the CSV header)
+static bool g_latencyProbeRunning = false;
+
+// Sessions created by ULL_CreateSession (session 0 is the state above). Sessions may be used from
+// several threads at once, so their table is locked; logging is not (the async mode is the safe one).
+struct MockSession {
+    std::string providerName;
+    std::vector<std::string> handleNames;    // Index = handle, empty string = released slot
+    std::unordered_map<std::string, int> nameToHandle;
+    std::unordered_set<std::string> dataSubjects;
+};
+static std::mutex g_sessionMutex;
+static std::map<int, MockSession> g_sessions;
+static int g_nextSessionId = 1;
+
+// Leading fields of ULL_CaptureFileHeader (UnrealLiveLink.Capture.h)
+static const unsigned int MockCaptureMagic = 0x434C4C55u;    // "ULLC"
+static const unsigned int MockCaptureVersion = 1;
+static const size_t MockCaptureHeaderBytes = 64;
+static const size_t MockCaptureDurationOffset = 48;
+
+//
+// Logging Configuration
+//
+// Read from the environment when the log is opened (ULL_Initialize, or the first call before it):
+//   ULL_MOCK_LOG_PATH     Text log file (default %TEMP%\SimioUnrealLiveLink_Mock.log)
+//   ULL_MOCK_LOG_MODE     sync  = every line written and flushed by the caller, echoed to the console (default)
+//                         async = lines queued to a background writer thread, no console output
+//                         off   = errors and the shutdown call counts only
+//   ULL_MOCK_LOG_UPDATES  text (default), binary (MockUpdateRecord per object to <path>.bin) or none
+//   ULL_MOCK_LOG_SAMPLE   Log every Nth call of each update function (default 1 = every call)
+//
+// Update calls skip all formatting when their line is not logged, so async/off/sampled runs can be
+// used to load-test Simio models without the mock becoming the bottleneck.
+//
+
+enum class MockLogMode { Sync, Async, Off };
+enum class MockUpdateLog { None, Text, Binary };
+
+struct MockLogConfig {
+    MockLogMode mode = MockLogMode::Sync;
+    MockUpdateLog updates = MockUpdateLog::Text;
+    unsigned long long sampleInterval = 1;
+    std::string path;
+};
+
+static MockLogConfig g_logConfig;
+static bool g_logOpen = false;
+static std::ofstream g_logFile;
+static std::ofstream g_binaryLogFile;
+static std::chrono::steady_clock::time_point g_logStartTime;
+
+// Per-API call counters (calls since ULL_Initialize), written at ULL_Shutdown. API calls come from
+// any thread, so this is a fixed open-addressed table keyed by the function name literal: a slot
+// is claimed once with a CAS, after which counting is a single atomic increment (no locks).
+struct MockCallCounter {
+    std::atomic<const char*> functionName{nullptr};
+    std::atomic<unsigned long long> calls{0};
+};
+
+static const size_t MockCallCounterSlots = 256;    // Power of two, well above the number of exports
+
+static MockCallCounter g_callCounts[MockCallCounterSlots];
+static std::atomic<unsigned long long> g_errorCount{0};
+
+// Returns the call count including this call (0 if the table is full)
+static unsigned long long CountCall(const char* functionName) {
+    size_t index = (reinterpret_cast<uintptr_t>(functionName) >> 3) & (MockCallCounterSlots - 1);
+    for (size_t probe = 0; probe < MockCallCounterSlots; ++probe) {
+        MockCallCounter& counter = g_callCounts[index];
+        const char* name = counter.functionName.load(std::memory_order_acquire);
+        if (name == nullptr && counter.functionName.compare_exchange_strong(name, functionName, std::memory_order_acq_rel)) {
+            name = functionName;
+        }
+        if (name == functionName) {
+            return counter.calls.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+        index = (index + 1) & (MockCallCounterSlots - 1);
+    }
+    return 0;
+}
+
+// Only called from ULL_Initialize/ULL_Shutdown, which are not concurrent with other API calls
+static void ResetCallCounts() {
+    for (MockCallCounter& counter : g_callCounts) {
+        counter.functionName.store(nullptr, std::memory_order_relaxed);
+        counter.calls.store(0, std::memory_order_relaxed);
+    }
+    g_errorCount.store(0, std::memory_order_relaxed);
+}
+
+//
+// Async Log Queue
+//
+// Bounded multi-producer ring (one CAS per record, no locks). The writer thread is the only consumer.
+// A full ring drops the record instead of blocking the caller; drops are reported at shutdown.
+//
+
+static const size_t MockLogQueueSlots = 16384;    // Power of two (4 MB of 256-byte slots)
+static const size_t MockLogPayloadBytes = 244;    // Longer text lines are truncated
+
+enum MockLogRecordKind : unsigned short { MockRecordText = 0, MockRecordBinary = 1 };
+
+struct MockLogSlot {
+    std::atomic<size_t> sequence;
+    unsigned short kind;
+    unsigned short length;
+    char payload[MockLogPayloadBytes];
+};
+
+static_assert(sizeof(MockUpdateRecord) <= MockLogPayloadBytes, "Binary update records must fit a log slot");
+
+class MockLogQueue {
+public:
+    MockLogQueue() : slots(new MockLogSlot[MockLogQueueSlots]) {
+        for (size_t i = 0; i < MockLogQueueSlots; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    
+    bool TryPush(unsigned short kind, const char* data, size_t length) {
+        size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        MockLogSlot* slot;
+        for (;;) {
+            slot = &slots[position & (MockLogQueueSlots - 1)];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+            if (difference == 0) {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false; // Full
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        
+        slot->kind = kind;
+        slot->length = (unsigned short)std::min(length, MockLogPayloadBytes);
+        std::memcpy(slot->payload, data, slot->length);
+        slot->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+    
+    // Single consumer: returns the next published slot or nullptr, Release() hands it back to producers
+    MockLogSlot* Peek() {
+        MockLogSlot* slot = &slots[dequeuePosition & (MockLogQueueSlots - 1)];
+        return slot->sequence.load(std::memory_order_acquire) == dequeuePosition + 1 ? slot : nullptr;
+    }
+    
+    void Release(MockLogSlot* slot) {
+        slot->sequence.store(dequeuePosition + MockLogQueueSlots, std::memory_order_release);
+        ++dequeuePosition;
+    }
+    
+private:
+    std::unique_ptr<MockLogSlot[]> slots;
+    std::atomic<size_t> enqueuePosition{0};
+    size_t dequeuePosition = 0;
+};
+
+static std::unique_ptr<MockLogQueue> g_logQueue;
+static std::thread g_logWriter;
+static std::atomic<bool> g_logWriterStop{false};
+static std::atomic<unsigned long long> g_logDropped{0};
+static std::mutex g_syncLogLock;
+
+static bool DrainLogQueue() {
+    bool wrote = false;
+    while (MockLogSlot* slot = g_logQueue->Peek()) {
+        if (slot->kind == MockRecordBinary) {
+            g_binaryLogFile.write(slot->payload, slot->length);
+        } else {
+            g_logFile.write(slot->payload, slot->length);
+            g_logFile.put('\n');
+        }
+        g_logQueue->Release(slot);
+        wrote = true;
+    }
+    return wrote;
+}
+
+static void LogWriterLoop() {
+    for (;;) {
+        if (DrainLogQueue()) {
+            continue;
+        }
+        
+        if (g_logWriterStop.load(std::memory_order_acquire)) {
+            DrainLogQueue();
+            break;
+        }
+        
+        // Idle: make what was written visible, then poll again
+        g_logFile.flush();
+        g_binaryLogFile.flush();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    
+    g_logFile.flush();
+    g_binaryLogFile.flush();
+}
+
+// Releases the writer if ULL_Shutdown never ran. It is detached, not joined: this destructor only
+// runs at process exit (P/Invoke never unloads the DLL), when Windows has already terminated the
+// writer, so a join would wait forever. Detaching only keeps std::thread from calling
+// std::terminate; records still queued are lost, as they would be with any exit without ULL_Shutdown.
+struct MockLogWriterGuard {
+    ~MockLogWriterGuard() {
+        if (g_logWriter.joinable()) {
+            g_logWriter.detach();
+        }
+    }
+};
+static MockLogWriterGuard g_logWriterGuard;
+
 //
 // Logging Helpers
 //
 
-void LogCall(const std::string& functionName, const std::string& params = "") {
-    // Get current timestamp
-    auto now = std::time(nullptr);
-    auto tm = *std::localtime(&now);
-    char timestamp[20];
-    std::strftime(timestamp, sizeof(timestamp), "%H:%M:%S", &tm);
+static std::string GetEnvironmentString(const char* name) {
+    char buffer[1024];
+    DWORD length = GetEnvironmentVariableA(name, buffer, sizeof(buffer));
+    return (length > 0 && length < sizeof(buffer)) ? std::string(buffer, length) : std::string();
+}
+
+static MockLogConfig ReadLogConfig() {
+    MockLogConfig config;
     
-    std::string message = "[" + std::string(timestamp) + "] [MOCK] " + functionName;
-    if (!params.empty()) {
-        message += "(" + params + ")";
+    config.path = GetEnvironmentString("ULL_MOCK_LOG_PATH");
+    if (config.path.empty()) {
+        char tempPath[MAX_PATH];
+        DWORD length = GetTempPathA(MAX_PATH, tempPath);
+        config.path = std::string(tempPath, (length > 0 && length < MAX_PATH) ? length : 0) + "SimioUnrealLiveLink_Mock.log";
     }
     
-    // Write to log file in tests directory
-    std::ofstream logFile("C:\\repos\\SimioUnrealEngineLiveLinkConnector\\tests\\Simio.Tests\\SimioUnrealLiveLink_Mock.log", std::ios::app);
-    if (logFile.is_open()) {
-        logFile << message << std::endl;
-        logFile.close();
+    std::string mode = GetEnvironmentString("ULL_MOCK_LOG_MODE");
+    if (mode == "async") config.mode = MockLogMode::Async;
+    else if (mode == "off") config.mode = MockLogMode::Off;
+    
+    std::string updates = GetEnvironmentString("ULL_MOCK_LOG_UPDATES");
+    if (updates == "binary") config.updates = MockUpdateLog::Binary;
+    else if (updates == "none") config.updates = MockUpdateLog::None;
+    
+    std::string sample = GetEnvironmentString("ULL_MOCK_LOG_SAMPLE");
+    if (!sample.empty()) {
+        long long interval = std::atoll(sample.c_str());
+        config.sampleInterval = interval > 1 ? (unsigned long long)interval : 1;
     }
     
-    // Also output to console for standalone testing
-    std::cout << message << std::endl;
+    if (config.mode == MockLogMode::Off) {
+        config.updates = MockUpdateLog::None;
+    }
+    return config;
 }
 
-void LogError(const std::string& functionName, const std::string& error) {
-    // Get current timestamp
-    auto now = std::time(nullptr);
-    auto tm = *std::localtime(&now);
-    char timestamp[20];
-    std::strftime(timestamp, sizeof(timestamp), "%H:%M:%S", &tm);
+static void OpenLog(bool truncate) {
+    g_logConfig = ReadLogConfig();
+    g_logStartTime = std::chrono::steady_clock::now();
     
-    std::string message = "[" + std::string(timestamp) + "] [MOCK ERROR] " + functionName + ": " + error;
+    std::ios::openmode openMode = truncate ? std::ios::trunc : std::ios::app;
+    g_logFile.open(g_logConfig.path, std::ios::out | openMode);
+    if (g_logConfig.updates == MockUpdateLog::Binary) {
+        g_binaryLogFile.open(g_logConfig.path + ".bin", std::ios::out | std::ios::binary | openMode);
+    }
+    
+    if (g_logConfig.mode == MockLogMode::Async) {
+        g_logQueue.reset(new MockLogQueue());
+        g_logWriterStop.store(false);
+        g_logWriter = std::thread(LogWriterLoop);
+    }
+    g_logOpen = true;
+}
+
+static void CloseLog() {
+    if (g_logWriter.joinable()) {
+        g_logWriterStop.store(true, std::memory_order_release);
+        g_logWriter.join();
+    }
+    g_logQueue.reset();
+    g_logFile.close();
+    g_binaryLogFile.close();
+    g_logOpen = false;
+}
+
+static void EnsureLogOpen() {
+    if (!g_logOpen) {
+        OpenLog(false);
+    }
+}
+
+static void EmitRecord(MockLogRecordKind kind, const char* data, size_t length) {
+    if (g_logQueue) {
+        if (!g_logQueue->TryPush(kind, data, length)) {
+            g_logDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
     
-    // Write to log file
-    std::ofstream logFile("C:\\repos\\SimioUnrealEngineLiveLinkConnector\\tests\\Simio.Tests\\SimioUnrealLiveLink_Mock.log", std::ios::app);
-    if (logFile.is_open()) {
-        logFile << message << std::endl;
-        logFile.close();
+    // Sync mode writes on the calling thread: one line at a time across API threads
+    std::lock_guard<std::mutex> lock(g_syncLogLock);
+    if (kind == MockRecordBinary) {
+        g_binaryLogFile.write(data, length);
+    } else {
+        g_logFile.write(data, length);
+        g_logFile << std::endl;
+        
+        // Also output to console for standalone testing
+        std::cout.write(data, length);
+        std::cout << std::endl;
+    }
+}
+
+static void EmitLine(const char* tag, const char* functionName, const std::string& text) {
+    // localtime/strftime only once per second (per thread: API calls come from any thread)
+    thread_local std::time_t lastTime = 0;
+    thread_local char timestamp[20] = "";
+    std::time_t now = std::time(nullptr);
+    if (now != lastTime) {
+        std::tm tm = {};
+        localtime_s(&tm, &now);    // std::localtime shares one buffer across threads
+        std::strftime(timestamp, sizeof(timestamp), "%H:%M:%S", &tm);
+        lastTime = now;
     }
     
-    // Also output to console
-    std::cout << message << std::endl;
+    EnsureLogOpen();
+    
+    std::string message;
+    message.reserve(32 + std::strlen(functionName) + text.size());
+    message += '[';
+    message += timestamp;
+    message += "] ";
+    message += tag;
+    message += ' ';
+    message += functionName;
+    message += text;
+    EmitRecord(MockRecordText, message.data(), message.size());
+}
+
+// Writes the call line without counting (update calls are counted by SampleUpdate)
+static void WriteCallLine(const char* functionName, const std::string& params) {
+    EnsureLogOpen();
+    if (g_logConfig.mode == MockLogMode::Off) {
+        return;
+    }
+    EmitLine("[MOCK]", functionName, params.empty() ? params : "(" + params + ")");
+}
+
+void LogCall(const char* functionName, const std::string& params = "") {
+    CountCall(functionName);
+    WriteCallLine(functionName, params);
+}
+
+void LogError(const char* functionName, const std::string& error) {
+    g_errorCount.fetch_add(1, std::memory_order_relaxed);
+    EmitLine("[MOCK ERROR]", functionName, ": " + error);
+}
+
+// Counts an update call and decides how it is logged; callers format nothing for MockUpdateLog::None
+static MockUpdateLog SampleUpdate(const char* functionName) {
+    unsigned long long calls = CountCall(functionName);
+    EnsureLogOpen();
+    if (g_logConfig.updates == MockUpdateLog::None || (calls - 1) % g_logConfig.sampleInterval != 0) {
+        return MockUpdateLog::None;
+    }
+    return g_logConfig.updates;
+}
+
+static void WriteUpdateRecord(int handle, const char* subjectName, const ULL_Transform* transform,
+                              const float* propertyValues, int propertyCount, unsigned short flags) {
+    MockUpdateRecord record = {};
+    record.timestampUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - g_logStartTime).count();
+    record.handle = handle;
+    record.flags = flags;
+    if (subjectName) {
+        std::strncpy(record.subjectName, subjectName, MOCK_RECORD_NAME_CHARS - 1);
+    }
+    if (transform) {
+        record.transform = *transform;
+    }
+    if (propertyValues && propertyCount > 0) {
+        record.propertyCount = (unsigned short)std::min(propertyCount, MOCK_RECORD_MAX_PROPERTIES);
+        std::memcpy(record.properties, propertyValues, record.propertyCount * sizeof(float));
+    }
+    EmitRecord(MockRecordBinary, reinterpret_cast<const char*>(&record), sizeof(record));
 }
 
-void ClearLogFile() {
-    // Clear the log file at the start of each simulation run
-    std::ofstream logFile("C:\\repos\\SimioUnrealEngineLiveLinkConnector\\tests\\Simio.Tests\\SimioUnrealLiveLink_Mock.log", std::ios::trunc);
-    if (logFile.is_open()) {
-        logFile.close();
+// Written at ULL_Shutdown: calls per API (sorted by name), errors and dropped async records
+static void LogCallCounts() {
+    std::map<std::string, unsigned long long> counts;
+    for (const MockCallCounter& counter : g_callCounts) {
+        if (const char* name = counter.functionName.load(std::memory_order_acquire)) {
+            counts[name] += counter.calls.load(std::memory_order_relaxed);
+        }
     }
+    
+    for (const auto& entry : counts) {
+        EmitLine("[MOCK]", "Calls", ": " + entry.first + "=" + std::to_string(entry.second));
+    }
+    EmitLine("[MOCK]", "Calls", ": errors=" + std::to_string(g_errorCount.load()) +
+             ", droppedLogRecords=" + std::to_string(g_logDropped.load()));
 }
 
 std::string FormatTransform(const ULL_Transform* transform) {
@@ -130,27 +508,110 @@ int ULL_Initialize(const char* providerName) {
         return 1; // Error
     }
     
-    // Clear the log file at the start of each new simulation run
-    ClearLogFile();
+    // Same rule as ULL_CreateSession, checked and claimed under its lock: the default provider
+    // may not take a session's name
+    {
+        std::lock_guard<std::mutex> lock(g_sessionMutex);
+        for (const auto& entry : g_sessions) {
+            if (entry.second.providerName == providerName) {
+                LogError("ULL_Initialize", "providerName '" + std::string(providerName) + "' is in use by a session");
+                return -1; // ULL_ERROR, as ULL_CreateSession returns for a name in use
+            }
+        }
+        g_providerName = providerName;
+        g_isInitialized = true;
+    }
+    
+    // Start a fresh log (and call counts) for each new simulation run
+    CloseLog();
+    OpenLog(true);
+    ResetCallCounts();
+    g_logDropped.store(0);
     
-    g_providerName = providerName;
-    g_isInitialized = true;
     g_transformObjects.clear();
     g_transformObjectProperties.clear();
     g_dataSubjectProperties.clear();
+    g_handleNames.clear();
+    g_nameToHandle.clear();
+    g_propertySchemas.clear();
     
     LogCall("ULL_Initialize", "providerName='" + g_providerName + "'");
     return 0; // Success
 }
 
+int ULL_InitializeEx(const char* providerName, const ULL_InitOptions* options) {
+    int result = ULL_Initialize(providerName);
+    if (result != 0) {
+        return result;
+    }
+    
+    // Mock has no sender thread - record the requested options for test verification
+    std::string params = "providerName='" + g_providerName + "'";
+    if (options) {
+        params += ", structSize=" + std::to_string(options->structSize) +
+                  ", sendMode=" + std::to_string(options->sendMode) +
+                  ", queueDepth=" + std::to_string(options->queueDepth) +
+                  ", queuePolicy=" + std::to_string(options->queuePolicy);
+        if (options->structSize >= (int)(offsetof(ULL_InitOptions, publishRateHz) + sizeof(int))) {
+            params += ", publishRateHz=" + std::to_string(options->publishRateHz);
+        }
+        if (options->structSize >= (int)(offsetof(ULL_InitOptions, keepAliveIntervalMs) + sizeof(int))) {
+            params += ", deadbandEnabled=" + std::to_string(options->deadbandEnabled) +
+                      ", positionDeadband=" + std::to_string(options->positionDeadband) +
+                      ", rotationDeadbandDegrees=" + std::to_string(options->rotationDeadbandDegrees) +
+                      ", propertyDeadband=" + std::to_string(options->propertyDeadband) +
+                      ", keepAliveIntervalMs=" + std::to_string(options->keepAliveIntervalMs);
+        }
+        if (options->structSize >= (int)(offsetof(ULL_InitOptions, pumpRateHz) + sizeof(int))) {
+            params += ", pumpRateHz=" + std::to_string(options->pumpRateHz);
+        }
+        if (options->structSize >= (int)(offsetof(ULL_InitOptions, sharedMemoryMaxProperties) + sizeof(int))) {
+            // Mock has no shared-memory table either - all subjects stay in the mock's own tracking
+            params += ", transport=" + std::to_string(options->transport) +
+                      ", sharedMemoryCapacity=" + std::to_string(options->sharedMemoryCapacity) +
+                      ", sharedMemoryMaxProperties=" + std::to_string(options->sharedMemoryMaxProperties);
+        }
+        if (options->structSize >= (int)(offsetof(ULL_InitOptions, sceneFrameRate) + sizeof(int))) {
+            params += ", simTimeScale=" + std::to_string(options->simTimeScale) +
+                      ", sceneFrameRate=" + std::to_string(options->sceneFrameRate);
+        }
+        if (options->structSize >= (int)(offsetof(ULL_InitOptions, subjectPoolSize) + sizeof(int))) {
+            // Mock keeps registering subjects individually - pool mode only changes what Unreal sees
+            params += ", subjectPoolSize=" + std::to_string(options->subjectPoolSize);
+        }
+        if (options->structSize >= (int)(offsetof(ULL_InitOptions, publishByteBudget) + sizeof(int))) {
+            // Mock sends nothing, so the budget is only logged
+            params += ", publishFrameBudget=" + std::to_string(options->publishFrameBudget) +
+                      ", publishByteBudget=" + std::to_string(options->publishByteBudget);
+        }
+        if (options->structSize >= (int)sizeof(ULL_InitOptions)) {
+            // Mock has no engine runtime to stage - initialization is always immediate
+            params += ", initMode=" + std::to_string(options->initMode);
+        }
+    } else {
+        params += ", options=NULL";
+    }
+    LogCall("ULL_InitializeEx", params);
+    return 0;
+}
+
 void ULL_Shutdown() {
     LogCall("ULL_Shutdown");
+    LogCallCounts();
+    CloseLog();
+    ResetCallCounts();
     
     g_isInitialized = false;
     g_providerName.clear();
     g_transformObjects.clear();
     g_transformObjectProperties.clear();
     g_dataSubjectProperties.clear();
+    g_handleNames.clear();
+    g_nameToHandle.clear();
+    g_propertySchemas.clear();
+    g_capturePath.clear();
+    g_replayRunning = false;
+    g_latencyProbeRunning = false;
 }
 
 int ULL_GetVersion() {
@@ -169,6 +630,16 @@ int ULL_IsConnected() {
     return 0; // Connected
 }
 
+int ULL_GetInitState() {
+    if (!g_isInitialized) {
+        LogCall("ULL_GetInitState", "result=NOT_INITIALIZED");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    LogCall("ULL_GetInitState", "result=READY");
+    return ULL_INIT_STATE_READY;
+}
+
 //=============================================================================
 // Transform Subjects (3D Objects)
 //=============================================================================
@@ -236,8 +707,13 @@ void ULL_UpdateObject(const char* subjectName, const ULL_Transform* transform) {
         g_transformObjects.insert(subjectName);
     }
     
-    std::string params = "subjectName='" + std::string(subjectName) + "', transform=" + FormatTransform(transform);
-    LogCall("ULL_UpdateObject", params);
+    MockUpdateLog log = SampleUpdate("ULL_UpdateObject");
+    if (log == MockUpdateLog::Binary) {
+        WriteUpdateRecord(-1, subjectName, transform, nullptr, 0, 0);
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "subjectName='" + std::string(subjectName) + "', transform=" + FormatTransform(transform);
+        WriteCallLine("ULL_UpdateObject", params);
+    }
 }
 
 void ULL_UpdateObjectWithProperties(const char* subjectName, const ULL_Transform* transform, const float* propertyValues, int propertyCount) {
@@ -271,9 +747,14 @@ void ULL_UpdateObjectWithProperties(const char* subjectName, const ULL_Transform
         g_transformObjects.insert(subjectName);
     }
     
-    std::string params = "subjectName='" + std::string(subjectName) + "', transform=" + FormatTransform(transform) +
-                        ", properties=" + FormatPropertyArray(propertyValues, propertyCount);
-    LogCall("ULL_UpdateObjectWithProperties", params);
+    MockUpdateLog log = SampleUpdate("ULL_UpdateObjectWithProperties");
+    if (log == MockUpdateLog::Binary) {
+        WriteUpdateRecord(-1, subjectName, transform, propertyValues, propertyCount, 0);
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "subjectName='" + std::string(subjectName) + "', transform=" + FormatTransform(transform) +
+                            ", properties=" + FormatPropertyArray(propertyValues, propertyCount);
+        WriteCallLine("ULL_UpdateObjectWithProperties", params);
+    }
 }
 
 void ULL_RemoveObject(const char* subjectName) {
@@ -290,30 +771,174 @@ void ULL_RemoveObject(const char* subjectName) {
     g_transformObjects.erase(subjectName);
     g_transformObjectProperties.erase(subjectName);
     
+    auto handleIt = g_nameToHandle.find(subjectName);
+    if (handleIt != g_nameToHandle.end()) {
+        g_handleNames[handleIt->second].clear();
+        g_nameToHandle.erase(handleIt);
+    }
+    
     LogCall("ULL_RemoveObject", "subjectName='" + std::string(subjectName) + "'");
 }
 
 //=============================================================================
-// Data Subjects (Metrics/KPIs)
+// Batch Updates
 //=============================================================================
 
-void ULL_RegisterDataSubject(const char* subjectName, const char** propertyNames, int propertyCount) {
-    if (!subjectName) {
-        LogError("ULL_RegisterDataSubject", "subjectName is NULL");
+void ULL_UpdateObjectsBatch(const char** subjectNames, const ULL_Transform* transforms, int count) {
+    if (!g_isInitialized) {
+        LogError("ULL_UpdateObjectsBatch", "Not initialized");
+        return;
+    }
+    
+    if (count < 0) {
+        LogError("ULL_UpdateObjectsBatch", "count is negative");
+        return;
+    }
+    
+    if (count > 0 && (!subjectNames || !transforms)) {
+        LogError("ULL_UpdateObjectsBatch", "subjectNames or transforms is NULL");
         return;
     }
     
+    // Auto-register any new objects (matches ULL_UpdateObject)
+    for (int i = 0; i < count; ++i) {
+        if (subjectNames[i]) {
+            g_transformObjects.insert(subjectNames[i]);
+        }
+    }
+    
+    MockUpdateLog log = SampleUpdate("ULL_UpdateObjectsBatch");
+    if (log == MockUpdateLog::Binary) {
+        for (int i = 0; i < count; ++i) {
+            WriteUpdateRecord(-1, subjectNames[i], &transforms[i], nullptr, 0, 0);
+        }
+    } else if (log == MockUpdateLog::Text) {
+        // Log a summary only - per-object logging would dominate large batches
+        std::string params = "count=" + std::to_string(count);
+        if (count > 0) {
+            params += ", first='" + std::string(subjectNames[0] ? subjectNames[0] : "NULL") + 
+                      "', transform=" + FormatTransform(&transforms[0]);
+        }
+        WriteCallLine("ULL_UpdateObjectsBatch", params);
+    }
+}
+
+void ULL_UpdateObjectsBatchWithProperties(const char** subjectNames, const ULL_Transform* transforms, const float* propertyValues, int propertyCount, int count) {
     if (!g_isInitialized) {
-        LogError("ULL_RegisterDataSubject", "Not initialized");
+        LogError("ULL_UpdateObjectsBatchWithProperties", "Not initialized");
         return;
     }
     
-    if (propertyCount < 0) {
-        LogError("ULL_RegisterDataSubject", "propertyCount is negative");
+    if (count < 0 || propertyCount < 0) {
+        LogError("ULL_UpdateObjectsBatchWithProperties", "count or propertyCount is negative");
         return;
     }
     
-    // Store property names
+    if (count > 0 && (!subjectNames || !transforms)) {
+        LogError("ULL_UpdateObjectsBatchWithProperties", "subjectNames or transforms is NULL");
+        return;
+    }
+    
+    if (propertyCount > 0 && count > 0 && !propertyValues) {
+        LogError("ULL_UpdateObjectsBatchWithProperties", "propertyValues is NULL");
+        return;
+    }
+    
+    int skipped = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!subjectNames[i]) {
+            continue;
+        }
+        
+        // Same property count rule as ULL_UpdateObjectWithProperties, applied per object
+        auto it = g_transformObjectProperties.find(subjectNames[i]);
+        if (it != g_transformObjectProperties.end() && propertyCount != (int)it->second.size()) {
+            LogError("ULL_UpdateObjectsBatchWithProperties", "Property count mismatch for '" + std::string(subjectNames[i]) + 
+                    "': expected " + std::to_string(it->second.size()) + ", got " + std::to_string(propertyCount));
+            ++skipped;
+            continue;
+        }
+        
+        // Property names are unknown here, so only property-less objects auto-register (matches native)
+        if (propertyCount == 0) {
+            g_transformObjects.insert(subjectNames[i]);
+        }
+    }
+    
+    MockUpdateLog log = SampleUpdate("ULL_UpdateObjectsBatchWithProperties");
+    if (log == MockUpdateLog::Binary) {
+        for (int i = 0; i < count; ++i) {
+            WriteUpdateRecord(-1, subjectNames[i], &transforms[i],
+                              propertyCount > 0 ? propertyValues + (size_t)i * propertyCount : nullptr, propertyCount, 0);
+        }
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "count=" + std::to_string(count) + ", propertyCount=" + std::to_string(propertyCount) +
+                            ", skipped=" + std::to_string(skipped);
+        if (count > 0) {
+            params += ", first='" + std::string(subjectNames[0] ? subjectNames[0] : "NULL") + 
+                      "', properties=" + FormatPropertyArray(propertyValues, propertyCount);
+        }
+        WriteCallLine("ULL_UpdateObjectsBatchWithProperties", params);
+    }
+}
+
+//=============================================================================
+// Handle-Based Transform Subjects
+//=============================================================================
+
+static int AssignHandle(const std::string& subjectName) {
+    auto it = g_nameToHandle.find(subjectName);
+    if (it != g_nameToHandle.end()) {
+        return it->second;
+    }
+    
+    int handle = (int)g_handleNames.size();
+    g_handleNames.push_back(subjectName);
+    g_nameToHandle[subjectName] = handle;
+    return handle;
+}
+
+static const char* ResolveHandle(int handle) {
+    if (handle < 0 || handle >= (int)g_handleNames.size() || g_handleNames[handle].empty()) {
+        return nullptr;
+    }
+    return g_handleNames[handle].c_str();
+}
+
+int ULL_RegisterObjectH(const char* subjectName) {
+    if (!subjectName) {
+        LogError("ULL_RegisterObjectH", "subjectName is NULL");
+        return -1;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_RegisterObjectH", "Not initialized");
+        return -1;
+    }
+    
+    g_transformObjects.insert(subjectName);
+    int handle = AssignHandle(subjectName);
+    
+    LogCall("ULL_RegisterObjectH", "subjectName='" + std::string(subjectName) + "', handle=" + std::to_string(handle));
+    return handle;
+}
+
+int ULL_RegisterObjectWithPropertiesH(const char* subjectName, const char** propertyNames, int propertyCount) {
+    if (!subjectName) {
+        LogError("ULL_RegisterObjectWithPropertiesH", "subjectName is NULL");
+        return -1;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_RegisterObjectWithPropertiesH", "Not initialized");
+        return -1;
+    }
+    
+    if (propertyCount < 0) {
+        LogError("ULL_RegisterObjectWithPropertiesH", "propertyCount is negative");
+        return -1;
+    }
+    
     std::vector<std::string> properties;
     if (propertyNames && propertyCount > 0) {
         for (int i = 0; i < propertyCount; ++i) {
@@ -321,74 +946,1264 @@ void ULL_RegisterDataSubject(const char* subjectName, const char** propertyNames
         }
     }
     
-    g_dataSubjectProperties[subjectName] = properties;
+    g_transformObjects.insert(subjectName);
+    g_transformObjectProperties[subjectName] = properties;
+    int handle = AssignHandle(subjectName);
     
     std::string params = "subjectName='" + std::string(subjectName) + "', propertyNames=" + 
-                        FormatStringArray(propertyNames, propertyCount) + ", count=" + std::to_string(propertyCount);
-    LogCall("ULL_RegisterDataSubject", params);
+                        FormatStringArray(propertyNames, propertyCount) + ", handle=" + std::to_string(handle);
+    LogCall("ULL_RegisterObjectWithPropertiesH", params);
+    return handle;
 }
 
-void ULL_UpdateDataSubject(const char* subjectName, const char** propertyNames, const float* propertyValues, int propertyCount) {
-    if (!subjectName) {
-        LogError("ULL_UpdateDataSubject", "subjectName is NULL");
-        return;
+//=============================================================================
+// Property Schemas
+//=============================================================================
+
+int ULL_RegisterPropertySchema(const char** propertyNames, int propertyCount) {
+    if (!g_isInitialized) {
+        LogError("ULL_RegisterPropertySchema", "Not initialized");
+        return -1;
     }
     
-    if (!g_isInitialized) {
-        LogError("ULL_UpdateDataSubject", "Not initialized");
-        return;
+    if (propertyCount < 0 || (propertyCount > 0 && !propertyNames)) {
+        LogError("ULL_RegisterPropertySchema", "invalid property array");
+        return -1;
     }
     
-    if (propertyCount < 0) {
-        LogError("ULL_UpdateDataSubject", "propertyCount is negative");
-        return;
+    std::vector<std::string> properties;
+    for (int i = 0; i < propertyCount; ++i) {
+        properties.push_back(propertyNames[i] ? propertyNames[i] : "NULL");
     }
     
-    // Check if subject is registered
-    auto it = g_dataSubjectProperties.find(subjectName);
-    if (it != g_dataSubjectProperties.end()) {
-        // Already registered - check property count
-        if (propertyCount != (int)it->second.size()) {
-            LogError("ULL_UpdateDataSubject", "Property count mismatch: expected " + 
-                    std::to_string(it->second.size()) + ", got " + std::to_string(propertyCount));
-            return;
-        }
-    } else {
-        // Auto-register with provided property names
-        if (propertyNames && propertyCount > 0) {
-            std::vector<std::string> properties;
-            for (int i = 0; i < propertyCount; ++i) {
-                properties.push_back(propertyNames[i] ? propertyNames[i] : "NULL");
-            }
-            g_dataSubjectProperties[subjectName] = properties;
+    int schemaId = -1;
+    for (size_t i = 0; i < g_propertySchemas.size(); ++i) {
+        if (g_propertySchemas[i] == properties) {
+            schemaId = (int)i;
+            break;
         }
     }
-    
-    std::string params = "subjectName='" + std::string(subjectName) + "'";
-    if (propertyNames) {
-        params += ", propertyNames=" + FormatStringArray(propertyNames, propertyCount);
-    } else {
-        params += ", propertyNames=NULL";
+    if (schemaId < 0) {
+        schemaId = (int)g_propertySchemas.size();
+        g_propertySchemas.push_back(properties);
     }
-    params += ", values=" + FormatPropertyArray(propertyValues, propertyCount);
     
-    LogCall("ULL_UpdateDataSubject", params);
+    LogCall("ULL_RegisterPropertySchema", "propertyNames=" + FormatStringArray(propertyNames, propertyCount) +
+            ", schemaId=" + std::to_string(schemaId));
+    return schemaId;
 }
 
-void ULL_RemoveDataSubject(const char* subjectName) {
+int ULL_RegisterObjectWithSchemaH(const char* subjectName, int schemaId) {
     if (!subjectName) {
-        LogError("ULL_RemoveDataSubject", "subjectName is NULL");
-        return;
+        LogError("ULL_RegisterObjectWithSchemaH", "subjectName is NULL");
+        return -1;
     }
     
     if (!g_isInitialized) {
-        LogError("ULL_RemoveDataSubject", "Not initialized");
-        return;
+        LogError("ULL_RegisterObjectWithSchemaH", "Not initialized");
+        return -1;
     }
     
-    g_dataSubjectProperties.erase(subjectName);
+    if (schemaId < 0 || schemaId >= (int)g_propertySchemas.size()) {
+        LogError("ULL_RegisterObjectWithSchemaH", "Unknown schema " + std::to_string(schemaId));
+        return -1;
+    }
     
-    LogCall("ULL_RemoveDataSubject", "subjectName='" + std::string(subjectName) + "'");
+    g_transformObjects.insert(subjectName);
+    g_transformObjectProperties[subjectName] = g_propertySchemas[schemaId];
+    int handle = AssignHandle(subjectName);
+    
+    LogCall("ULL_RegisterObjectWithSchemaH", "subjectName='" + std::string(subjectName) + "', schemaId=" +
+            std::to_string(schemaId) + ", handle=" + std::to_string(handle));
+    return handle;
 }
 
-} // extern "C"
\ No newline at end of file
+int ULL_RegisterObjectsBatchH(const char** subjectNames, const int* schemaIds, int count, int* outHandles) {
+    if (count < 0 || (count > 0 && (!subjectNames || !outHandles))) {
+        LogError("ULL_RegisterObjectsBatchH", "Invalid arrays (count " + std::to_string(count) + ")");
+        return -1;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_RegisterObjectsBatchH", "Not initialized");
+        return -1;
+    }
+    
+    int registered = 0;
+    for (int i = 0; i < count; ++i) {
+        int schemaId = schemaIds ? schemaIds[i] : -1;
+        if (!subjectNames[i] || (schemaIds && (schemaId < 0 || schemaId >= (int)g_propertySchemas.size()))) {
+            outHandles[i] = -1;
+            continue;
+        }
+        
+        g_transformObjects.insert(subjectNames[i]);
+        if (schemaIds) {
+            g_transformObjectProperties[subjectNames[i]] = g_propertySchemas[schemaId];
+        }
+        outHandles[i] = AssignHandle(subjectNames[i]);
+        registered++;
+    }
+    
+    LogCall("ULL_RegisterObjectsBatchH", "count=" + std::to_string(count) + ", registered=" + std::to_string(registered) +
+            ", schemaIds=" + (schemaIds ? "set" : "NULL"));
+    return registered;
+}
+
+static bool IsValidSchedule(int priority, int maxRateHz) {
+    return priority >= 0 && priority <= 2 && maxRateHz >= 0;
+}
+
+int ULL_SetObjectScheduleH(int handle, int priority, int maxRateHz) {
+    if (!g_isInitialized) {
+        LogError("ULL_SetObjectScheduleH", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    const char* subjectName = ResolveHandle(handle);
+    if (!subjectName || !IsValidSchedule(priority, maxRateHz)) {
+        LogError("ULL_SetObjectScheduleH", "Invalid handle " + std::to_string(handle) + " or schedule (priority " +
+                 std::to_string(priority) + ", " + std::to_string(maxRateHz) + " Hz)");
+        return -1;
+    }
+    
+    LogCall("ULL_SetObjectScheduleH", "handle=" + std::to_string(handle) + " ('" + subjectName + "'), priority=" +
+            std::to_string(priority) + ", maxRateHz=" + std::to_string(maxRateHz));
+    return 0; // ULL_OK
+}
+
+int ULL_SetSubjectSchedule(const char* subjectName, int priority, int maxRateHz) {
+    if (!subjectName) {
+        LogError("ULL_SetSubjectSchedule", "subjectName is NULL");
+        return -1;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_SetSubjectSchedule", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    bool registered = g_transformObjects.count(subjectName) > 0 || g_dataSubjectProperties.count(subjectName) > 0;
+    if (!registered || !IsValidSchedule(priority, maxRateHz)) {
+        LogError("ULL_SetSubjectSchedule", "Unknown subject '" + std::string(subjectName) + "' or invalid schedule");
+        return -1;
+    }
+    
+    LogCall("ULL_SetSubjectSchedule", "subjectName='" + std::string(subjectName) + "', priority=" +
+            std::to_string(priority) + ", maxRateHz=" + std::to_string(maxRateHz));
+    return 0; // ULL_OK
+}
+
+void ULL_UpdateObjectH(int handle, const ULL_Transform* transform) {
+    if (!g_isInitialized) {
+        LogError("ULL_UpdateObjectH", "Not initialized");
+        return;
+    }
+    
+    const char* subjectName = ResolveHandle(handle);
+    if (!subjectName) {
+        LogError("ULL_UpdateObjectH", "Invalid handle " + std::to_string(handle));
+        return;
+    }
+    
+    MockUpdateLog log = SampleUpdate("ULL_UpdateObjectH");
+    if (log == MockUpdateLog::Binary) {
+        WriteUpdateRecord(handle, subjectName, transform, nullptr, 0, 0);
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "handle=" + std::to_string(handle) + " ('" + subjectName + "'), transform=" + FormatTransform(transform);
+        WriteCallLine("ULL_UpdateObjectH", params);
+    }
+}
+
+void ULL_UpdateObjectWithPropertiesH(int handle, const ULL_Transform* transform, const float* propertyValues, int propertyCount) {
+    if (!g_isInitialized) {
+        LogError("ULL_UpdateObjectWithPropertiesH", "Not initialized");
+        return;
+    }
+    
+    const char* subjectName = ResolveHandle(handle);
+    if (!subjectName) {
+        LogError("ULL_UpdateObjectWithPropertiesH", "Invalid handle " + std::to_string(handle));
+        return;
+    }
+    
+    auto it = g_transformObjectProperties.find(subjectName);
+    int expected = (it != g_transformObjectProperties.end()) ? (int)it->second.size() : 0;
+    if (propertyCount != expected) {
+        LogError("ULL_UpdateObjectWithPropertiesH", "Property count mismatch: expected " + 
+                std::to_string(expected) + ", got " + std::to_string(propertyCount));
+        return;
+    }
+    
+    MockUpdateLog log = SampleUpdate("ULL_UpdateObjectWithPropertiesH");
+    if (log == MockUpdateLog::Binary) {
+        WriteUpdateRecord(handle, subjectName, transform, propertyValues, propertyCount, 0);
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "handle=" + std::to_string(handle) + " ('" + subjectName + "'), transform=" + FormatTransform(transform) +
+                            ", properties=" + FormatPropertyArray(propertyValues, propertyCount);
+        WriteCallLine("ULL_UpdateObjectWithPropertiesH", params);
+    }
+}
+
+void ULL_UpdateObjectsBatchH(const int* handles, const ULL_Transform* transforms, int count) {
+    ULL_UpdateObjectsBatchWithPropertiesH(handles, transforms, nullptr, 0, count);
+}
+
+void ULL_UpdateObjectsBatchWithPropertiesH(const int* handles, const ULL_Transform* transforms, const float* propertyValues, int propertyCount, int count) {
+    if (!g_isInitialized) {
+        LogError("ULL_UpdateObjectsBatchWithPropertiesH", "Not initialized");
+        return;
+    }
+    
+    if (count < 0 || propertyCount < 0) {
+        LogError("ULL_UpdateObjectsBatchWithPropertiesH", "count or propertyCount is negative");
+        return;
+    }
+    
+    if (count > 0 && (!handles || !transforms || (propertyCount > 0 && !propertyValues))) {
+        LogError("ULL_UpdateObjectsBatchWithPropertiesH", "NULL array");
+        return;
+    }
+    
+    int skipped = 0;
+    for (int i = 0; i < count; ++i) {
+        const char* subjectName = ResolveHandle(handles[i]);
+        if (!subjectName) {
+            ++skipped;
+            continue;
+        }
+        
+        auto it = g_transformObjectProperties.find(subjectName);
+        int expected = (it != g_transformObjectProperties.end()) ? (int)it->second.size() : 0;
+        if (expected != propertyCount) {
+            ++skipped;
+        }
+    }
+    
+    MockUpdateLog log = SampleUpdate("ULL_UpdateObjectsBatchWithPropertiesH");
+    if (log == MockUpdateLog::Binary) {
+        for (int i = 0; i < count; ++i) {
+            WriteUpdateRecord(handles[i], ResolveHandle(handles[i]), &transforms[i],
+                              propertyCount > 0 ? propertyValues + (size_t)i * propertyCount : nullptr, propertyCount, 0);
+        }
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "count=" + std::to_string(count) + ", propertyCount=" + std::to_string(propertyCount) +
+                            ", skipped=" + std::to_string(skipped);
+        WriteCallLine("ULL_UpdateObjectsBatchWithPropertiesH", params);
+    }
+}
+
+void ULL_UpdateObjectAtTimeH(int handle, const ULL_Transform* transform, const float* propertyValues, int propertyCount, double simTime) {
+    if (!g_isInitialized) {
+        LogError("ULL_UpdateObjectAtTimeH", "Not initialized");
+        return;
+    }
+    
+    const char* subjectName = ResolveHandle(handle);
+    if (!subjectName) {
+        LogError("ULL_UpdateObjectAtTimeH", "Invalid handle " + std::to_string(handle));
+        return;
+    }
+    
+    auto it = g_transformObjectProperties.find(subjectName);
+    int expected = (it != g_transformObjectProperties.end()) ? (int)it->second.size() : 0;
+    if (propertyCount != expected) {
+        LogError("ULL_UpdateObjectAtTimeH", "Property count mismatch: expected " + 
+                std::to_string(expected) + ", got " + std::to_string(propertyCount));
+        return;
+    }
+    
+    MockUpdateLog log = SampleUpdate("ULL_UpdateObjectAtTimeH");
+    if (log == MockUpdateLog::Binary) {
+        WriteUpdateRecord(handle, subjectName, transform, propertyValues, propertyCount, MOCK_RECORD_TIMED);
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "handle=" + std::to_string(handle) + " ('" + subjectName + "'), transform=" + FormatTransform(transform) +
+                            ", properties=" + FormatPropertyArray(propertyValues, propertyCount) + ", simTime=" + std::to_string(simTime);
+        WriteCallLine("ULL_UpdateObjectAtTimeH", params);
+    }
+}
+
+void ULL_UpdateObjectsBatchAtTimeH(const int* handles, const ULL_Transform* transforms, const float* propertyValues, int propertyCount, int count, double simTime) {
+    if (!g_isInitialized) {
+        LogError("ULL_UpdateObjectsBatchAtTimeH", "Not initialized");
+        return;
+    }
+    
+    if (count < 0 || propertyCount < 0) {
+        LogError("ULL_UpdateObjectsBatchAtTimeH", "count or propertyCount is negative");
+        return;
+    }
+    
+    if (count > 0 && (!handles || !transforms || (propertyCount > 0 && !propertyValues))) {
+        LogError("ULL_UpdateObjectsBatchAtTimeH", "NULL array");
+        return;
+    }
+    
+    MockUpdateLog log = SampleUpdate("ULL_UpdateObjectsBatchAtTimeH");
+    if (log == MockUpdateLog::Binary) {
+        for (int i = 0; i < count; ++i) {
+            WriteUpdateRecord(handles[i], ResolveHandle(handles[i]), &transforms[i],
+                              propertyCount > 0 ? propertyValues + (size_t)i * propertyCount : nullptr, propertyCount, MOCK_RECORD_TIMED);
+        }
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "count=" + std::to_string(count) + ", propertyCount=" + std::to_string(propertyCount) +
+                            ", simTime=" + std::to_string(simTime);
+        WriteCallLine("ULL_UpdateObjectsBatchAtTimeH", params);
+    }
+}
+
+void ULL_RemoveObjectH(int handle) {
+    if (!g_isInitialized) {
+        LogError("ULL_RemoveObjectH", "Not initialized");
+        return;
+    }
+    
+    const char* subjectName = ResolveHandle(handle);
+    if (!subjectName) {
+        // Safe to call on removed handles (matches ULL_RemoveObject)
+        LogCall("ULL_RemoveObjectH", "handle=" + std::to_string(handle) + " (not found)");
+        return;
+    }
+    
+    std::string name = subjectName;
+    g_transformObjects.erase(name);
+    g_transformObjectProperties.erase(name);
+    g_nameToHandle.erase(name);
+    g_handleNames[handle].clear();
+    
+    LogCall("ULL_RemoveObjectH", "handle=" + std::to_string(handle) + " ('" + name + "')");
+}
+
+//=============================================================================
+// Simio Coordinate Batches
+//=============================================================================
+
+// Scalar port of CoordinateConverter.SimioToUnrealTransform (the native DLL vectorizes the same math)
+static void ConvertSimioTransform(const double* values, int componentCount, int count, int i, ULL_Transform* out) {
+    const double degreesToRadians = 3.14159265358979323846 / 180.0;
+    double x = values[i], y = values[count + i], z = values[2 * count + i];
+    double rotX = values[3 * count + i], rotY = values[4 * count + i], rotZ = values[5 * count + i];
+    
+    bool positionValid = std::isfinite(x) && std::isfinite(y) && std::isfinite(z);
+    out->position[0] = positionValid ? x * 100.0 : 0.0;
+    out->position[1] = positionValid ? -z * 100.0 : 0.0;
+    out->position[2] = positionValid ? y * 100.0 : 0.0;
+    
+    out->rotation[0] = 0.0; out->rotation[1] = 0.0; out->rotation[2] = 0.0; out->rotation[3] = 1.0;
+    if (std::isfinite(rotX) && std::isfinite(rotY) && std::isfinite(rotZ)) {
+        double ux = rotX * degreesToRadians, uy = rotZ * degreesToRadians, uz = -rotY * degreesToRadians;
+        double cx = std::cos(ux * 0.5), sx = std::sin(ux * 0.5);
+        double cy = std::cos(uy * 0.5), sy = std::sin(uy * 0.5);
+        double cz = std::cos(uz * 0.5), sz = std::sin(uz * 0.5);
+        double qw = cx * cy * cz + sx * sy * sz;
+        double qx = sx * cy * cz - cx * sy * sz;
+        double qy = cx * sy * cz + sx * cy * sz;
+        double qz = cx * cy * sz - sx * sy * cz;
+        double magnitude = std::sqrt(qx * qx + qy * qy + qz * qz + qw * qw);
+        out->rotation[0] = qx / magnitude; out->rotation[1] = qy / magnitude;
+        out->rotation[2] = qz / magnitude; out->rotation[3] = qw / magnitude;
+    }
+    
+    out->scale[0] = 1.0; out->scale[1] = 1.0; out->scale[2] = 1.0;
+    if (componentCount == ULL_SIMIO_TRANSFORM_COMPONENTS) {
+        double sx = values[6 * count + i], sy = values[7 * count + i], sz = values[8 * count + i];
+        if (std::isfinite(sx) && std::isfinite(sy) && std::isfinite(sz) && sx > 0.0 && sy > 0.0 && sz > 0.0) {
+            out->scale[0] = sx; out->scale[1] = sz; out->scale[2] = sy;
+        }
+    }
+}
+
+static bool ValidateSimioValues(const char* functionName, const double* simioValues, int componentCount, int count) {
+    if (count < 0 || (componentCount != ULL_SIMIO_POSE_COMPONENTS && componentCount != ULL_SIMIO_TRANSFORM_COMPONENTS)) {
+        LogError(functionName, "Invalid block (count=" + std::to_string(count) + ", componentCount=" + std::to_string(componentCount) + ")");
+        return false;
+    }
+    if (count > 0 && !simioValues) {
+        LogError(functionName, "simioValues is NULL");
+        return false;
+    }
+    return true;
+}
+
+int ULL_ConvertSimioTransforms(const double* simioValues, int componentCount, int count, ULL_Transform* outTransforms) {
+    if (!ValidateSimioValues("ULL_ConvertSimioTransforms", simioValues, componentCount, count)) {
+        return -1; // ULL_ERROR
+    }
+    
+    if (count > 0 && !outTransforms) {
+        LogError("ULL_ConvertSimioTransforms", "outTransforms is NULL");
+        return -1; // ULL_ERROR
+    }
+    
+    for (int i = 0; i < count; i++) {
+        ConvertSimioTransform(simioValues, componentCount, count, i, &outTransforms[i]);
+    }
+    
+    LogCall("ULL_ConvertSimioTransforms", "count=" + std::to_string(count) + ", componentCount=" + std::to_string(componentCount));
+    return 0; // ULL_OK
+}
+
+void ULL_UpdateObjectsBatchSimioH(const int* handles, const double* simioValues, int componentCount, const float* propertyValues, int propertyCount, int count) {
+    if (!g_isInitialized) {
+        LogError("ULL_UpdateObjectsBatchSimioH", "Not initialized");
+        return;
+    }
+    
+    if (!ValidateSimioValues("ULL_UpdateObjectsBatchSimioH", simioValues, componentCount, count)) {
+        return;
+    }
+    
+    if (count > 0 && (propertyCount < 0 || !handles || (propertyCount > 0 && !propertyValues))) {
+        LogError("ULL_UpdateObjectsBatchSimioH", "Invalid arrays");
+        return;
+    }
+    
+    int skipped = 0;
+    for (int i = 0; i < count; i++) {
+        if (!ResolveHandle(handles[i])) {
+            skipped++;
+        }
+    }
+    
+    MockUpdateLog log = SampleUpdate("ULL_UpdateObjectsBatchSimioH");
+    if (log == MockUpdateLog::Binary) {
+        for (int i = 0; i < count; i++) {
+            ULL_Transform transform;
+            ConvertSimioTransform(simioValues, componentCount, count, i, &transform);
+            WriteUpdateRecord(handles[i], ResolveHandle(handles[i]), &transform,
+                              propertyCount > 0 ? propertyValues + (size_t)i * propertyCount : nullptr, propertyCount, 0);
+        }
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "count=" + std::to_string(count) + ", componentCount=" + std::to_string(componentCount) +
+                            ", propertyCount=" + std::to_string(propertyCount) + ", skipped=" + std::to_string(skipped);
+        WriteCallLine("ULL_UpdateObjectsBatchSimioH", params);
+    }
+}
+
+//=============================================================================
+// Compact Transforms
+//=============================================================================
+
+void ULL_UpdateObjectsBatchCompactH(const int* handles, const ULL_CompactTransform* transforms, const float* scales, int scaleCount, const float* propertyValues, int propertyCount, int count) {
+    if (!g_isInitialized) {
+        LogError("ULL_UpdateObjectsBatchCompactH", "Not initialized");
+        return;
+    }
+    
+    if (count < 0 || scaleCount < 0 || propertyCount < 0) {
+        LogError("ULL_UpdateObjectsBatchCompactH", "count, scaleCount or propertyCount is negative");
+        return;
+    }
+    
+    if (count > 0 && (!handles || !transforms || (scaleCount > 0 && !scales) || (propertyCount > 0 && !propertyValues))) {
+        LogError("ULL_UpdateObjectsBatchCompactH", "NULL array");
+        return;
+    }
+    
+    int skipped = 0;
+    int scaled = 0;
+    for (int i = 0; i < count; i++) {
+        if (!ResolveHandle(handles[i])) {
+            skipped++;
+        }
+        if (transforms[i].flags & ULL_COMPACT_HAS_SCALE) {
+            scaled++;
+        }
+    }
+    
+    if (scaled > scaleCount) {
+        LogError("ULL_UpdateObjectsBatchCompactH", std::to_string(scaled) + " objects flagged with scale but scaleCount is " + std::to_string(scaleCount));
+    }
+    
+    MockUpdateLog log = SampleUpdate("ULL_UpdateObjectsBatchCompactH");
+    if (log == MockUpdateLog::Binary) {
+        for (int i = 0; i < count; i++) {
+            ULL_Transform transform = {};
+            transform.position[0] = transforms[i].position[0];
+            transform.position[1] = transforms[i].position[1];
+            transform.position[2] = transforms[i].position[2];
+            WriteUpdateRecord(handles[i], ResolveHandle(handles[i]), &transform,
+                              propertyCount > 0 ? propertyValues + (size_t)i * propertyCount : nullptr, propertyCount, MOCK_RECORD_COMPACT);
+        }
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "count=" + std::to_string(count) + ", scaleCount=" + std::to_string(scaleCount) +
+                            ", propertyCount=" + std::to_string(propertyCount) + ", skipped=" + std::to_string(skipped);
+        WriteCallLine("ULL_UpdateObjectsBatchCompactH", params);
+    }
+}
+
+//=============================================================================
+// Data Subjects (Metrics/KPIs)
+//=============================================================================
+
+void ULL_RegisterDataSubject(const char* subjectName, const char** propertyNames, int propertyCount) {
+    if (!subjectName) {
+        LogError("ULL_RegisterDataSubject", "subjectName is NULL");
+        return;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_RegisterDataSubject", "Not initialized");
+        return;
+    }
+    
+    if (propertyCount < 0) {
+        LogError("ULL_RegisterDataSubject", "propertyCount is negative");
+        return;
+    }
+    
+    // Store property names
+    std::vector<std::string> properties;
+    if (propertyNames && propertyCount > 0) {
+        for (int i = 0; i < propertyCount; ++i) {
+            properties.push_back(propertyNames[i] ? propertyNames[i] : "NULL");
+        }
+    }
+    
+    g_dataSubjectProperties[subjectName] = properties;
+    
+    std::string params = "subjectName='" + std::string(subjectName) + "', propertyNames=" + 
+                        FormatStringArray(propertyNames, propertyCount) + ", count=" + std::to_string(propertyCount);
+    LogCall("ULL_RegisterDataSubject", params);
+}
+
+void ULL_UpdateDataSubject(const char* subjectName, const char** propertyNames, const float* propertyValues, int propertyCount) {
+    if (!subjectName) {
+        LogError("ULL_UpdateDataSubject", "subjectName is NULL");
+        return;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_UpdateDataSubject", "Not initialized");
+        return;
+    }
+    
+    if (propertyCount < 0) {
+        LogError("ULL_UpdateDataSubject", "propertyCount is negative");
+        return;
+    }
+    
+    // Check if subject is registered
+    auto it = g_dataSubjectProperties.find(subjectName);
+    if (it != g_dataSubjectProperties.end()) {
+        // Already registered - check property count
+        if (propertyCount != (int)it->second.size()) {
+            LogError("ULL_UpdateDataSubject", "Property count mismatch: expected " + 
+                    std::to_string(it->second.size()) + ", got " + std::to_string(propertyCount));
+            return;
+        }
+    } else {
+        // Auto-register with provided property names
+        if (propertyNames && propertyCount > 0) {
+            std::vector<std::string> properties;
+            for (int i = 0; i < propertyCount; ++i) {
+                properties.push_back(propertyNames[i] ? propertyNames[i] : "NULL");
+            }
+            g_dataSubjectProperties[subjectName] = properties;
+        }
+    }
+    
+    MockUpdateLog log = SampleUpdate("ULL_UpdateDataSubject");
+    if (log == MockUpdateLog::Binary) {
+        WriteUpdateRecord(-1, subjectName, nullptr, propertyValues, propertyCount, MOCK_RECORD_DATA_SUBJECT);
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "subjectName='" + std::string(subjectName) + "'";
+        if (propertyNames) {
+            params += ", propertyNames=" + FormatStringArray(propertyNames, propertyCount);
+        } else {
+            params += ", propertyNames=NULL";
+        }
+        params += ", values=" + FormatPropertyArray(propertyValues, propertyCount);
+        
+        WriteCallLine("ULL_UpdateDataSubject", params);
+    }
+}
+
+void ULL_UpdateDataSubjectsBatch(const char** subjectNames, const float* propertyValues, int propertyCount, int count) {
+    if (!g_isInitialized) {
+        LogError("ULL_UpdateDataSubjectsBatch", "Not initialized");
+        return;
+    }
+    
+    if (count < 0 || propertyCount < 0) {
+        LogError("ULL_UpdateDataSubjectsBatch", "count or propertyCount is negative");
+        return;
+    }
+    
+    if (count > 0 && !subjectNames) {
+        LogError("ULL_UpdateDataSubjectsBatch", "subjectNames is NULL");
+        return;
+    }
+    
+    if (propertyCount > 0 && count > 0 && !propertyValues) {
+        LogError("ULL_UpdateDataSubjectsBatch", "propertyValues is NULL");
+        return;
+    }
+    
+    int skipped = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!subjectNames[i]) {
+            continue;
+        }
+        
+        // Same property count rule as ULL_UpdateDataSubject, applied per subject
+        auto it = g_dataSubjectProperties.find(subjectNames[i]);
+        if (it != g_dataSubjectProperties.end() && propertyCount != (int)it->second.size()) {
+            LogError("ULL_UpdateDataSubjectsBatch", "Property count mismatch for '" + std::string(subjectNames[i]) + 
+                    "': expected " + std::to_string(it->second.size()) + ", got " + std::to_string(propertyCount));
+            ++skipped;
+        }
+    }
+    
+    MockUpdateLog log = SampleUpdate("ULL_UpdateDataSubjectsBatch");
+    if (log == MockUpdateLog::Binary) {
+        for (int i = 0; i < count; ++i) {
+            WriteUpdateRecord(-1, subjectNames[i], nullptr,
+                              propertyCount > 0 ? propertyValues + (size_t)i * propertyCount : nullptr, propertyCount, MOCK_RECORD_DATA_SUBJECT);
+        }
+    } else if (log == MockUpdateLog::Text) {
+        std::string params = "count=" + std::to_string(count) + ", propertyCount=" + std::to_string(propertyCount) +
+                            ", skipped=" + std::to_string(skipped);
+        if (count > 0) {
+            params += ", first='" + std::string(subjectNames[0] ? subjectNames[0] : "NULL") + 
+                      "', properties=" + FormatPropertyArray(propertyValues, propertyCount);
+        }
+        WriteCallLine("ULL_UpdateDataSubjectsBatch", params);
+    }
+}
+
+void ULL_RemoveDataSubject(const char* subjectName) {
+    if (!subjectName) {
+        LogError("ULL_RemoveDataSubject", "subjectName is NULL");
+        return;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_RemoveDataSubject", "Not initialized");
+        return;
+    }
+    
+    g_dataSubjectProperties.erase(subjectName);
+    
+    LogCall("ULL_RemoveDataSubject", "subjectName='" + std::string(subjectName) + "'");
+}
+
+// Diagnostics API Implementation
+
+int ULL_GetDeadbandCounters(
+    unsigned long long* outSentFrames,
+    unsigned long long* outSuppressedFrames,
+    unsigned long long* outKeepAliveFrames) {
+    // Mock sends nothing, so every counter stays 0
+    if (outSentFrames) *outSentFrames = 0;
+    if (outSuppressedFrames) *outSuppressedFrames = 0;
+    if (outKeepAliveFrames) *outKeepAliveFrames = 0;
+    
+    if (!g_isInitialized) {
+        LogCall("ULL_GetDeadbandCounters", "result=NOT_INITIALIZED");
+        return 2; // Not initialized
+    }
+    
+    LogCall("ULL_GetDeadbandCounters");
+    return 0;
+}
+
+int ULL_GetPumpStats(ULL_PumpStats* outStats) {
+    if (!outStats) {
+        LogError("ULL_GetPumpStats", "outStats is NULL");
+        return 1; // Error
+    }
+    
+    // Mock has no Message Bus, so no pump thread runs
+    *outStats = ULL_PumpStats{};
+    
+    if (!g_isInitialized) {
+        LogCall("ULL_GetPumpStats", "result=NOT_INITIALIZED");
+        return 2; // Not initialized
+    }
+    
+    LogCall("ULL_GetPumpStats", "running=0");
+    return 0;
+}
+
+int ULL_GetStats(ULL_Stats* outStats) {
+    if (!outStats) {
+        LogError("ULL_GetStats", "outStats is NULL");
+        return 1; // Error
+    }
+    
+    // Mock sends nothing and has no name cache or lock, so only subject counts are real
+    *outStats = ULL_Stats{};
+    
+    if (!g_isInitialized) {
+        LogCall("ULL_GetStats", "result=NOT_INITIALIZED");
+        return 2; // Not initialized
+    }
+    
+    outStats->registeredTransformSubjects = (int)g_transformObjects.size();
+    outStats->registeredDataSubjects = (int)g_dataSubjectProperties.size();
+    
+    LogCall("ULL_GetStats", "transformSubjects=" + std::to_string(outStats->registeredTransformSubjects) +
+            ", dataSubjects=" + std::to_string(outStats->registeredDataSubjects));
+    return 0;
+}
+
+int ULL_ResetStats() {
+    if (!g_isInitialized) {
+        LogCall("ULL_ResetStats", "result=NOT_INITIALIZED");
+        return 2; // Not initialized
+    }
+    
+    LogCall("ULL_ResetStats");
+    return 0;
+}
+
+// Capture and Replay API Implementation
+
+static double MockReplayPosition() {
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - g_replayBaseTime).count();
+    double position = g_replayBasePosition + elapsed * g_replaySpeed;
+    if (g_replayLoop && g_replayDuration > 0.0) {
+        return std::fmod(position, g_replayDuration);
+    }
+    return (std::min)(position, g_replayDuration);
+}
+
+// Re-anchor the simulated position before the speed or position changes
+static void MockReplayRebase(double position) {
+    g_replayBasePosition = position;
+    g_replayBaseTime = std::chrono::steady_clock::now();
+}
+
+int ULL_StartCapture(const char* filePath) {
+    if (!filePath || filePath[0] == '\0') {
+        LogError("ULL_StartCapture", "filePath is NULL or empty");
+        return -1;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_StartCapture", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    // Header of a capture with no records, so the file replays (as an empty capture)
+    unsigned char header[MockCaptureHeaderBytes] = {};
+    const unsigned int fields[4] = { MockCaptureMagic, MockCaptureVersion, (unsigned int)MockCaptureHeaderBytes, 1u << 20 };
+    std::memcpy(header, fields, sizeof(fields));
+    
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.write(reinterpret_cast<const char*>(header), sizeof(header))) {
+        LogError("ULL_StartCapture", "Cannot create '" + std::string(filePath) + "'");
+        return -1;
+    }
+    
+    g_capturePath = filePath;
+    LogCall("ULL_StartCapture", "filePath='" + g_capturePath + "'");
+    return 0; // ULL_OK
+}
+
+int ULL_StopCapture() {
+    if (!g_isInitialized) {
+        LogError("ULL_StopCapture", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    LogCall("ULL_StopCapture", g_capturePath.empty() ? "running=0" : "filePath='" + g_capturePath + "'");
+    g_capturePath.clear();
+    return 0; // ULL_OK
+}
+
+int ULL_StartReplay(const char* filePath, double speed, int loop) {
+    if (!filePath || filePath[0] == '\0') {
+        LogError("ULL_StartReplay", "filePath is NULL or empty");
+        return -1;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_StartReplay", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    unsigned char header[MockCaptureHeaderBytes] = {};
+    std::ifstream file(filePath, std::ios::binary);
+    unsigned int magic = 0;
+    unsigned int version = 0;
+    if (file.read(reinterpret_cast<char*>(header), sizeof(header))) {
+        std::memcpy(&magic, header, sizeof(magic));
+        std::memcpy(&version, header + sizeof(magic), sizeof(version));
+    }
+    if (magic != MockCaptureMagic || version != MockCaptureVersion) {
+        LogError("ULL_StartReplay", "'" + std::string(filePath) + "' is not a capture file");
+        return -1;
+    }
+    
+    std::memcpy(&g_replayDuration, header + MockCaptureDurationOffset, sizeof(g_replayDuration));
+    g_replayRunning = true;
+    g_replayLoop = loop != 0;
+    g_replaySpeed = (std::max)(speed, 0.0);
+    MockReplayRebase(0.0);
+    
+    std::ostringstream params;
+    params << "filePath='" << filePath << "', speed=" << g_replaySpeed << ", loop=" << (g_replayLoop ? 1 : 0)
+           << ", duration=" << g_replayDuration;
+    LogCall("ULL_StartReplay", params.str());
+    return 0; // ULL_OK
+}
+
+int ULL_SetReplaySpeed(double speed) {
+    if (!g_isInitialized) {
+        LogError("ULL_SetReplaySpeed", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    if (!g_replayRunning) {
+        LogError("ULL_SetReplaySpeed", "No replay running");
+        return -1;
+    }
+    
+    MockReplayRebase(MockReplayPosition());
+    g_replaySpeed = (std::max)(speed, 0.0);
+    LogCall("ULL_SetReplaySpeed", "speed=" + std::to_string(g_replaySpeed));
+    return 0; // ULL_OK
+}
+
+int ULL_SeekReplay(double seconds) {
+    if (!g_isInitialized) {
+        LogError("ULL_SeekReplay", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    if (!g_replayRunning) {
+        LogError("ULL_SeekReplay", "No replay running");
+        return -1;
+    }
+    
+    MockReplayRebase((std::min)((std::max)(seconds, 0.0), g_replayDuration));
+    LogCall("ULL_SeekReplay", "seconds=" + std::to_string(g_replayBasePosition));
+    return 0; // ULL_OK
+}
+
+int ULL_StopReplay() {
+    if (!g_isInitialized) {
+        LogError("ULL_StopReplay", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    LogCall("ULL_StopReplay", g_replayRunning ? "running=1" : "running=0");
+    g_replayRunning = false;
+    return 0; // ULL_OK
+}
+
+int ULL_GetReplayStatus(double* outPositionSeconds, double* outDurationSeconds) {
+    if (outPositionSeconds) *outPositionSeconds = 0.0;
+    if (outDurationSeconds) *outDurationSeconds = 0.0;
+    
+    if (!g_isInitialized) {
+        LogError("ULL_GetReplayStatus", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    if (!g_replayRunning) {
+        LogError("ULL_GetReplayStatus", "No replay running");
+        return -1;
+    }
+    
+    if (outPositionSeconds) *outPositionSeconds = MockReplayPosition();
+    if (outDurationSeconds) *outDurationSeconds = g_replayDuration;
+    LogCall("ULL_GetReplayStatus");
+    return 0; // ULL_OK
+}
+
+int ULL_GetReplayFrame(const char* subjectName, ULL_Transform* outTransform, float* outPropertyValues, int maxPropertyCount) {
+    if (!subjectName || subjectName[0] == '\0' || !outTransform) {
+        LogError("ULL_GetReplayFrame", "subjectName is NULL or empty, or outTransform is NULL");
+        return -1;
+    }
+    
+    if (maxPropertyCount < 0 || (maxPropertyCount > 0 && !outPropertyValues)) {
+        LogError("ULL_GetReplayFrame", "Invalid property buffer (maxPropertyCount=" + std::to_string(maxPropertyCount) + ")");
+        return -1;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_GetReplayFrame", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    // The mock replay sends nothing, so no subject ever has a frame
+    LogCall("ULL_GetReplayFrame", std::string("subject=") + subjectName + (g_replayRunning ? " running=1" : " running=0"));
+    return -1;
+}
+
+//=============================================================================
+// Sessions API
+//=============================================================================
+
+// Note: Caller must hold g_sessionMutex
+static MockSession* FindMockSession(int sessionId) {
+    auto it = g_sessions.find(sessionId);
+    return it != g_sessions.end() ? &it->second : nullptr;
+}
+
+int ULL_CreateSession(const char* providerName, const ULL_InitOptions* options) {
+    if (!providerName || providerName[0] == '\0') {
+        LogError("ULL_CreateSession", "providerName is NULL or empty");
+        return -1;
+    }
+    
+    std::lock_guard<std::mutex> lock(g_sessionMutex);
+    
+    bool nameInUse = g_isInitialized && g_providerName == providerName;
+    for (const auto& entry : g_sessions) {
+        nameInUse = nameInUse || entry.second.providerName == providerName;
+    }
+    if (nameInUse) {
+        LogError("ULL_CreateSession", "providerName '" + std::string(providerName) + "' is in use");
+        return -1;
+    }
+    
+    int sessionId = g_nextSessionId++;
+    g_sessions[sessionId].providerName = providerName;
+    
+    LogCall("ULL_CreateSession", "providerName='" + std::string(providerName) + "', options=" +
+            (options ? "set" : "NULL") + ", sessionId=" + std::to_string(sessionId));
+    return sessionId;
+}
+
+int ULL_DestroySession(int sessionId) {
+    std::lock_guard<std::mutex> lock(g_sessionMutex);
+    
+    if (g_sessions.erase(sessionId) == 0) {
+        LogError("ULL_DestroySession", "Unknown session " + std::to_string(sessionId));
+        return -1;
+    }
+    
+    LogCall("ULL_DestroySession", "sessionId=" + std::to_string(sessionId));
+    return 0; // ULL_OK
+}
+
+int ULL_SessionRegisterObjectH(int sessionId, const char* subjectName) {
+    return ULL_SessionRegisterObjectWithPropertiesH(sessionId, subjectName, nullptr, 0);
+}
+
+int ULL_SessionRegisterObjectWithPropertiesH(int sessionId, const char* subjectName, const char** propertyNames, int propertyCount) {
+    if (sessionId == 0) {
+        return ULL_RegisterObjectWithPropertiesH(subjectName, propertyNames, propertyCount);
+    }
+    
+    if (!subjectName || propertyCount < 0 || (propertyCount > 0 && !propertyNames)) {
+        LogError("ULL_SessionRegisterObjectWithPropertiesH", "Invalid parameters");
+        return -1;
+    }
+    
+    std::lock_guard<std::mutex> lock(g_sessionMutex);
+    
+    MockSession* session = FindMockSession(sessionId);
+    if (!session) {
+        LogError("ULL_SessionRegisterObjectWithPropertiesH", "Unknown session " + std::to_string(sessionId));
+        return -1;
+    }
+    
+    auto it = session->nameToHandle.find(subjectName);
+    int handle = it != session->nameToHandle.end() ? it->second : (int)session->handleNames.size();
+    if (it == session->nameToHandle.end()) {
+        session->handleNames.push_back(subjectName);
+        session->nameToHandle[subjectName] = handle;
+    }
+    
+    LogCall("ULL_SessionRegisterObjectWithPropertiesH", "sessionId=" + std::to_string(sessionId) +
+            ", subjectName='" + std::string(subjectName) + "', propertyCount=" + std::to_string(propertyCount) +
+            ", handle=" + std::to_string(handle));
+    return handle;
+}
+
+void ULL_SessionUpdateObjectsBatchWithPropertiesH(int sessionId, const int* handles, const ULL_Transform* transforms,
+                                                  const float* propertyValues, int propertyCount, int count) {
+    if (sessionId == 0) {
+        ULL_UpdateObjectsBatchWithPropertiesH(handles, transforms, propertyValues, propertyCount, count);
+        return;
+    }
+    
+    if (count < 0 || propertyCount < 0 || (count > 0 && (!handles || !transforms)) ||
+        (count > 0 && propertyCount > 0 && !propertyValues)) {
+        LogError("ULL_SessionUpdateObjectsBatchWithPropertiesH", "Invalid parameters");
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(g_sessionMutex);
+    
+    MockSession* session = FindMockSession(sessionId);
+    if (!session) {
+        LogError("ULL_SessionUpdateObjectsBatchWithPropertiesH", "Unknown session " + std::to_string(sessionId));
+        return;
+    }
+    
+    int validCount = 0;
+    for (int i = 0; i < count; ++i) {
+        if (handles[i] >= 0 && handles[i] < (int)session->handleNames.size() && !session->handleNames[handles[i]].empty()) {
+            validCount++;
+        }
+    }
+    
+    if (SampleUpdate("ULL_SessionUpdateObjectsBatchWithPropertiesH") != MockUpdateLog::None) {
+        WriteCallLine("ULL_SessionUpdateObjectsBatchWithPropertiesH", "sessionId=" + std::to_string(sessionId) +
+                      ", count=" + std::to_string(count) + ", valid=" + std::to_string(validCount));
+    }
+}
+
+void ULL_SessionRemoveObjectH(int sessionId, int handle) {
+    if (sessionId == 0) {
+        ULL_RemoveObjectH(handle);
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(g_sessionMutex);
+    
+    MockSession* session = FindMockSession(sessionId);
+    if (!session) {
+        LogError("ULL_SessionRemoveObjectH", "Unknown session " + std::to_string(sessionId));
+        return;
+    }
+    
+    if (handle >= 0 && handle < (int)session->handleNames.size() && !session->handleNames[handle].empty()) {
+        session->nameToHandle.erase(session->handleNames[handle]);
+        session->handleNames[handle].clear();
+    }
+    
+    LogCall("ULL_SessionRemoveObjectH", "sessionId=" + std::to_string(sessionId) + ", handle=" + std::to_string(handle));
+}
+
+void ULL_SessionUpdateDataSubject(int sessionId, const char* subjectName, const char** propertyNames,
+                                  const float* propertyValues, int propertyCount) {
+    if (sessionId == 0) {
+        ULL_UpdateDataSubject(subjectName, propertyNames, propertyValues, propertyCount);
+        return;
+    }
+    
+    if (!subjectName || propertyCount < 0 || (propertyCount > 0 && !propertyValues)) {
+        LogError("ULL_SessionUpdateDataSubject", "Invalid parameters");
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(g_sessionMutex);
+    
+    MockSession* session = FindMockSession(sessionId);
+    if (!session) {
+        LogError("ULL_SessionUpdateDataSubject", "Unknown session " + std::to_string(sessionId));
+        return;
+    }
+    
+    if (propertyNames) {
+        session->dataSubjects.insert(subjectName);
+    }
+    
+    if (SampleUpdate("ULL_SessionUpdateDataSubject") != MockUpdateLog::None) {
+        WriteCallLine("ULL_SessionUpdateDataSubject", "sessionId=" + std::to_string(sessionId) +
+                      ", subjectName='" + std::string(subjectName) + "', propertyCount=" + std::to_string(propertyCount));
+    }
+}
+
+void ULL_SessionRemoveDataSubject(int sessionId, const char* subjectName) {
+    if (sessionId == 0) {
+        ULL_RemoveDataSubject(subjectName);
+        return;
+    }
+    
+    if (!subjectName) {
+        LogError("ULL_SessionRemoveDataSubject", "subjectName is NULL");
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(g_sessionMutex);
+    
+    MockSession* session = FindMockSession(sessionId);
+    if (!session) {
+        LogError("ULL_SessionRemoveDataSubject", "Unknown session " + std::to_string(sessionId));
+        return;
+    }
+    
+    session->dataSubjects.erase(subjectName);
+    LogCall("ULL_SessionRemoveDataSubject", "sessionId=" + std::to_string(sessionId) + ", subjectName='" + std::string(subjectName) + "'");
+}
+
+int ULL_SessionGetStats(int sessionId, ULL_Stats* outStats) {
+    if (sessionId == 0) {
+        return ULL_GetStats(outStats);
+    }
+    
+    if (!outStats) {
+        LogError("ULL_SessionGetStats", "outStats is NULL");
+        return -1;
+    }
+    
+    *outStats = ULL_Stats{};
+    
+    std::lock_guard<std::mutex> lock(g_sessionMutex);
+    
+    MockSession* session = FindMockSession(sessionId);
+    if (!session) {
+        LogError("ULL_SessionGetStats", "Unknown session " + std::to_string(sessionId));
+        return -1;
+    }
+    
+    outStats->registeredTransformSubjects = (int)session->nameToHandle.size();
+    outStats->registeredDataSubjects = (int)session->dataSubjects.size();
+    LogCall("ULL_SessionGetStats", "sessionId=" + std::to_string(sessionId) +
+            ", transformSubjects=" + std::to_string(outStats->registeredTransformSubjects));
+    return 0; // ULL_OK
+}
+
+int ULL_SessionGetInitState(int sessionId) {
+    if (sessionId == 0) {
+        return ULL_GetInitState();
+    }
+    
+    std::lock_guard<std::mutex> lock(g_sessionMutex);
+    
+    if (!FindMockSession(sessionId)) {
+        LogError("ULL_SessionGetInitState", "Unknown session " + std::to_string(sessionId));
+        return -1;
+    }
+    
+    LogCall("ULL_SessionGetInitState", "sessionId=" + std::to_string(sessionId) + ", result=READY");
+    return ULL_INIT_STATE_READY;
+}
+
+} // extern "C"
+//=============================================================================
+// Interest Regions API
+//=============================================================================
+
+// Note: Logs the rejected argument; the mock sends no frames, so valid regions only get logged
+static bool ValidateInterestRegions(const char* functionName, const ULL_InterestRegion* regions, int count, int outsideRateHz) {
+    if (count < 0 || count > ULL_MAX_INTEREST_REGIONS || (count > 0 && !regions) ||
+        outsideRateHz < 0 || outsideRateHz > 1000) {    // 1000 = ULL_MAX_PUBLISH_RATE_HZ
+        LogError(functionName, "Invalid region count " + std::to_string(count) + " or outside rate " + std::to_string(outsideRateHz));
+        return false;
+    }
+    
+    for (int i = 0; i < count; ++i) {
+        for (int axis = 0; axis < 3; ++axis) {
+            // Written so NaN corners fail as well
+            if (!(regions[i].min[axis] <= regions[i].max[axis])) {
+                LogError(functionName, "Region " + std::to_string(i) + " has a corner that is NaN or min above max");
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int ULL_SetInterestRegions(const ULL_InterestRegion* regions, int count, int outsideRateHz) {
+    if (!ValidateInterestRegions("ULL_SetInterestRegions", regions, count, outsideRateHz)) {
+        return -1;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_SetInterestRegions", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    LogCall("ULL_SetInterestRegions", "count=" + std::to_string(count) + ", outsideRateHz=" + std::to_string(outsideRateHz));
+    return 0; // ULL_OK
+}
+
+int ULL_SessionSetInterestRegions(int sessionId, const ULL_InterestRegion* regions, int count, int outsideRateHz) {
+    if (sessionId == 0) {
+        return ULL_SetInterestRegions(regions, count, outsideRateHz);
+    }
+    
+    if (!ValidateInterestRegions("ULL_SessionSetInterestRegions", regions, count, outsideRateHz)) {
+        return -1;
+    }
+    
+    std::lock_guard<std::mutex> lock(g_sessionMutex);
+    
+    if (!FindMockSession(sessionId)) {
+        LogError("ULL_SessionSetInterestRegions", "Unknown session " + std::to_string(sessionId));
+        return -1;
+    }
+    
+    LogCall("ULL_SessionSetInterestRegions", "sessionId=" + std::to_string(sessionId) + ", count=" + std::to_string(count) +
+            ", outsideRateHz=" + std::to_string(outsideRateHz));
+    return 0; // ULL_OK
+}
+
+int ULL_GetInterestCounters(unsigned long long* outHeldFrames, unsigned long long* outOutsideFrames, int* outGridCells) {
+    // Mock sends nothing, so nothing is held and the grid stays empty
+    if (outHeldFrames) *outHeldFrames = 0;
+    if (outOutsideFrames) *outOutsideFrames = 0;
+    if (outGridCells) *outGridCells = 0;
+    
+    if (!g_isInitialized) {
+        LogCall("ULL_GetInterestCounters", "result=NOT_INITIALIZED");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    LogCall("ULL_GetInterestCounters");
+    return 0; // ULL_OK
+}
+
+//=============================================================================
+// Latency Probe API
+//=============================================================================
+
+int ULL_StartLatencyProbe(int rateHz, int echoPort, const char* csvPath) {
+    if (rateHz < 1 || rateHz > ULL_LATENCY_MAX_RATE_HZ || echoPort < 0 || echoPort > 65535) {
+        LogError("ULL_StartLatencyProbe", "Invalid rate " + std::to_string(rateHz) + " or echo port " + std::to_string(echoPort));
+        return -1;
+    }
+    
+    if (!g_isInitialized) {
+        LogError("ULL_StartLatencyProbe", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    // Same header as the native probe, so scripts reading the CSV can run against the mock
+    if (csvPath && csvPath[0] != '\0') {
+        std::ofstream file(csvPath, std::ios::trunc);
+        file << "seconds,probesSent,probesEchoed";
+        for (const char* stage : { "enqueue", "send", "receipt", "total" }) {
+            file << "," << stage << "Samples," << stage << "P50Ms," << stage << "P90Ms," << stage << "P99Ms," << stage << "MaxMs";
+        }
+        file << "\n";
+        if (!file) {
+            LogError("ULL_StartLatencyProbe", "Cannot create '" + std::string(csvPath) + "'");
+            return -1;
+        }
+    }
+    
+    g_latencyProbeRunning = true;
+    LogCall("ULL_StartLatencyProbe", "rateHz=" + std::to_string(rateHz) + ", echoPort=" + std::to_string(echoPort) +
+            ", csvPath='" + std::string(csvPath ? csvPath : "") + "'");
+    return 0; // ULL_OK
+}
+
+int ULL_StopLatencyProbe() {
+    if (!g_isInitialized) {
+        LogError("ULL_StopLatencyProbe", "Not initialized");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    LogCall("ULL_StopLatencyProbe", g_latencyProbeRunning ? "running=1" : "running=0");
+    g_latencyProbeRunning = false;
+    return 0; // ULL_OK
+}
+
+int ULL_GetLatencyStats(ULL_LatencyStats* outStats) {
+    if (!outStats) {
+        LogError("ULL_GetLatencyStats", "outStats is NULL");
+        return -1;
+    }
+    
+    // Mock probes nothing: no samples in any stage
+    *outStats = ULL_LatencyStats{};
+    
+    if (!g_isInitialized) {
+        LogCall("ULL_GetLatencyStats", "result=NOT_INITIALIZED");
+        return -3; // ULL_NOT_INITIALIZED
+    }
+    
+    LogCall("ULL_GetLatencyStats");
+    return 0; // ULL_OK
+}
@@ -12,6 +12,142 @@ typedef struct {
     double scale[3];       // X, Y, Z scale factors (typically 1.0)
 } ULL_Transform;
 
+// Compact transform matching native ULL_CompactTransform (20 bytes)
+#define ULL_COMPACT_LARGEST_MASK    0x0003
+#define ULL_COMPACT_HAS_SCALE       0x0004
+#define ULL_COMPACT_ROTATION_32     0x0008
+
+#pragma pack(push, 4)
+typedef struct {
+    float position[3];              // X, Y, Z in centimeters
+    unsigned short rotation[3];     // Smallest-three quaternion
+    unsigned short flags;           // ULL_COMPACT_*
+} ULL_CompactTransform;
+#pragma pack(pop)
+
+// Simio value block column counts matching native UnrealLiveLink.Types.h
+#define ULL_SIMIO_POSE_COMPONENTS       6
+#define ULL_SIMIO_TRANSFORM_COMPONENTS  9
+
+// Initialization options matching native ULL_InitOptions (80 bytes)
+typedef struct {
+    int structSize;      // sizeof(ULL_InitOptions)
+    int sendMode;        // 0 = sync, 1 = async
+    int queueDepth;      // Async queue capacity (0 = default)
+    int queuePolicy;     // 0 = drop oldest, 1 = block
+    int publishRateHz;   // 0 = send immediately, > 0 = coalesce and publish at this rate
+    int deadbandEnabled;            // 0 = disabled, 1 = skip unchanged frames
+    float positionDeadband;         // Centimeters
+    float rotationDeadbandDegrees;  // Degrees
+    float propertyDeadband;         // Absolute difference per value
+    int keepAliveIntervalMs;        // Resend interval for unchanged subjects
+    int pumpRateHz;                 // Message Bus pump rate (0 = default, -1 = disabled)
+    int transport;                  // 0 = Message Bus, 1 = shared memory (transform subjects)
+    int sharedMemoryCapacity;       // Subject slots (0 = default)
+    int sharedMemoryMaxProperties;  // Property values per subject (0 = default)
+    float simTimeScale;             // Playback seconds per simulation second (0 = 1.0)
+    int sceneFrameRate;             // Scene time frame rate (0 = default)
+    int subjectPoolSize;            // Pooled subjects per property schema (0 = pool mode off)
+    int publishFrameBudget;         // Frames per second across subjects (0 = unlimited)
+    int publishByteBudget;          // Estimated bytes per second across subjects (0 = unlimited)
+    int initMode;                   // 0 = sync, 1 = async (engine runtime staged in the background)
+} ULL_InitOptions;
+
+// Initialization states matching native ULL_INIT_STATE_*
+#define ULL_INIT_STATE_STAGING  1
+#define ULL_INIT_STATE_READY    2
+#define ULL_INIT_STATE_FAILED   3
+
+// Interest region matching native ULL_InterestRegion (48 bytes)
+#define ULL_MAX_INTEREST_REGIONS       16
+#define ULL_INTEREST_SUPPRESS           0
+
+typedef struct {
+    double min[3];       // Lower corner X, Y, Z (cm)
+    double max[3];       // Upper corner X, Y, Z (cm)
+} ULL_InterestRegion;
+
+// Pump statistics matching native ULL_PumpStats (48 bytes)
+typedef struct {
+    unsigned long long tickCount;
+    unsigned long long overrunCount;
+    double lastTickMs;
+    double maxTickMs;
+    double averageTickMs;
+    int rateHz;
+    int running;
+} ULL_PumpStats;
+
+// Hot-path statistics matching native ULL_Stats (296 bytes)
+#define ULL_STATS_HISTOGRAM_BUCKETS 16
+
+typedef struct {
+    unsigned long long transformUpdatesReceived;
+    unsigned long long transformUpdatesSent;
+    unsigned long long transformUpdatesDropped;
+    unsigned long long dataUpdatesReceived;
+    unsigned long long dataUpdatesSent;
+    unsigned long long dataUpdatesDropped;
+    unsigned long long batchCalls;
+    unsigned long long coalescedUpdates;
+    unsigned long long deadbandSuppressed;
+    unsigned long long queueDropped;
+    unsigned long long nameCacheHits;
+    unsigned long long nameCacheMisses;
+    unsigned long long lockAcquisitions;
+    unsigned long long lockContentions;
+    double lockWaitTotalMs;
+    double lockWaitMaxMs;
+    unsigned long long frameDataCalls;
+    double frameDataTotalMs;
+    double frameDataMaxMs;
+    unsigned long long frameDataHistogram[ULL_STATS_HISTOGRAM_BUCKETS];
+    int registeredTransformSubjects;
+    int registeredDataSubjects;
+    int nameCacheEntries;
+    int reserved;
+} ULL_Stats;
+
+// Latency probe statistics matching native ULL_LatencyStats (176 bytes)
+#define ULL_LATENCY_STAGE_ENQUEUE   0
+#define ULL_LATENCY_STAGE_SEND      1
+#define ULL_LATENCY_STAGE_RECEIPT   2
+#define ULL_LATENCY_STAGE_TOTAL     3
+#define ULL_LATENCY_STAGES          4
+#define ULL_LATENCY_MAX_RATE_HZ     100
+
+typedef struct {
+    unsigned long long samples;
+    double p50Ms;
+    double p90Ms;
+    double p99Ms;
+    double maxMs;
+} ULL_LatencyStage;
+
+typedef struct {
+    unsigned long long probesSent;
+    unsigned long long probesEchoed;
+    ULL_LatencyStage stages[ULL_LATENCY_STAGES];
+} ULL_LatencyStats;
+
+// Binary update record written to <ULL_MOCK_LOG_PATH>.bin when ULL_MOCK_LOG_UPDATES=binary (mock only, 160 bytes)
+// One record per updated object, back to back with no file header
+#define MOCK_RECORD_NAME_CHARS      32
+#define MOCK_RECORD_MAX_PROPERTIES  8
+#define MOCK_RECORD_DATA_SUBJECT    0x0001  // Data subject update (transform is zeroed)
+#define MOCK_RECORD_COMPACT         0x0002  // position from the compact transform, rotation not expanded (zeroed)
+#define MOCK_RECORD_TIMED           0x0004  // Update carried a simulation time (AtTimeH functions)
+
+typedef struct {
+    long long timestampUs;                      // Microseconds since ULL_Initialize
+    int handle;                                 // -1 for name-based calls
+    unsigned short propertyCount;               // Values stored (at most MOCK_RECORD_MAX_PROPERTIES)
+    unsigned short flags;                       // MOCK_RECORD_*
+    char subjectName[MOCK_RECORD_NAME_CHARS];   // Truncated, NUL-terminated
+    ULL_Transform transform;
+    float properties[MOCK_RECORD_MAX_PROPERTIES];
+} MockUpdateRecord;
+
 //
 // Core Lifecycle API - MUST MATCH UnrealLiveLinkNative.cs EXACTLY
 //
@@ -23,6 +159,14 @@ typedef struct {
 /// <returns>0 on success, error code on failure</returns>
 __declspec(dllexport) int ULL_Initialize(const char* providerName);
 
+/// <summary>
+/// Initialize LiveLink with provider name and options (options are logged, mock is always synchronous)
+/// </summary>
+/// <param name="providerName">Name for this LiveLink provider</param>
+/// <param name="options">Initialization options (may be NULL)</param>
+/// <returns>0 on success, error code on failure</returns>
+__declspec(dllexport) int ULL_InitializeEx(const char* providerName, const ULL_InitOptions* options);
+
 /// <summary>
 /// Shutdown LiveLink and clean up all resources
 /// </summary>
@@ -40,6 +184,12 @@ __declspec(dllexport) int ULL_GetVersion();
 /// <returns>0 if connected, error code otherwise</returns>
 __declspec(dllexport) int ULL_IsConnected();
 
+/// <summary>
+/// Get the initialization state (mock: READY as soon as initialized)
+/// </summary>
+/// <returns>ULL_INIT_STATE_READY, or -3 if not initialized</returns>
+__declspec(dllexport) int ULL_GetInitState();
+
 //
 // Transform Subjects (3D Objects) - MUST MATCH UnrealLiveLinkNative.cs EXACTLY
 //
@@ -92,6 +242,210 @@ __declspec(dllexport) void ULL_UpdateObjectWithProperties(
 /// <param name="subjectName">Object identifier to remove</param>
 __declspec(dllexport) void ULL_RemoveObject(const char* subjectName);
 
+//
+// Batch Updates - MUST MATCH UnrealLiveLinkNative.cs EXACTLY
+//
+
+/// <summary>
+/// Update transforms for many objects in a single call
+/// </summary>
+/// <param name="subjectNames">Array of object identifiers</param>
+/// <param name="transforms">Array of transforms (same order as subjectNames)</param>
+/// <param name="count">Number of objects in the batch</param>
+__declspec(dllexport) void ULL_UpdateObjectsBatch(
+    const char** subjectNames, 
+    const ULL_Transform* transforms,
+    int count
+);
+
+/// <summary>
+/// Update transforms and property values for many objects in a single call
+/// </summary>
+/// <param name="subjectNames">Array of object identifiers</param>
+/// <param name="transforms">Array of transforms (same order as subjectNames)</param>
+/// <param name="propertyValues">Contiguous property values, propertyCount per object</param>
+/// <param name="propertyCount">Number of property values per object</param>
+/// <param name="count">Number of objects in the batch</param>
+/// <remarks>Unregistered objects are only auto-registered when propertyCount is 0 (matches native)</remarks>
+__declspec(dllexport) void ULL_UpdateObjectsBatchWithProperties(
+    const char** subjectNames, 
+    const ULL_Transform* transforms,
+    const float* propertyValues,
+    int propertyCount,
+    int count
+);
+
+//
+// Handle-Based Transform Subjects - MUST MATCH UnrealLiveLinkNative.cs EXACTLY
+//
+
+/// <summary>
+/// Register a transform subject and return a handle (>= 0), or -1 on error
+/// </summary>
+__declspec(dllexport) int ULL_RegisterObjectH(const char* subjectName);
+
+/// <summary>
+/// Register a transform subject with properties and return a handle (>= 0), or -1 on error
+/// </summary>
+__declspec(dllexport) int ULL_RegisterObjectWithPropertiesH(
+    const char* subjectName, 
+    const char** propertyNames, 
+    int propertyCount
+);
+
+/// <summary>
+/// Intern a property name list and return its schema ID (>= 0), or -1 on error
+/// </summary>
+__declspec(dllexport) int ULL_RegisterPropertySchema(
+    const char** propertyNames, 
+    int propertyCount
+);
+
+/// <summary>
+/// Register a transform subject with a schema ID and return a handle (>= 0), or -1 on error
+/// </summary>
+__declspec(dllexport) int ULL_RegisterObjectWithSchemaH(
+    const char* subjectName, 
+    int schemaId
+);
+
+/// <summary>
+/// Register many transform subjects; returns the number registered, or -1 on error
+/// </summary>
+__declspec(dllexport) int ULL_RegisterObjectsBatchH(
+    const char** subjectNames, 
+    const int* schemaIds, 
+    int count, 
+    int* outHandles
+);
+
+/// <summary>
+/// Set priority (0 = high, 1 = normal, 2 = low) and max rate of a transform subject; 0 or -1 on error
+/// </summary>
+__declspec(dllexport) int ULL_SetObjectScheduleH(
+    int handle, 
+    int priority, 
+    int maxRateHz
+);
+
+/// <summary>
+/// Set priority and max rate of a transform or data subject by name; 0 or -1 on error
+/// </summary>
+__declspec(dllexport) int ULL_SetSubjectSchedule(
+    const char* subjectName, 
+    int priority, 
+    int maxRateHz
+);
+
+/// <summary>
+/// Update transform for a registered handle
+/// </summary>
+__declspec(dllexport) void ULL_UpdateObjectH(
+    int handle, 
+    const ULL_Transform* transform
+);
+
+/// <summary>
+/// Update transform and property values for a registered handle
+/// </summary>
+__declspec(dllexport) void ULL_UpdateObjectWithPropertiesH(
+    int handle, 
+    const ULL_Transform* transform,
+    const float* propertyValues,
+    int propertyCount
+);
+
+/// <summary>
+/// Update transforms for many handles in a single call
+/// </summary>
+__declspec(dllexport) void ULL_UpdateObjectsBatchH(
+    const int* handles, 
+    const ULL_Transform* transforms,
+    int count
+);
+
+/// <summary>
+/// Update transforms and property values for many handles in a single call
+/// </summary>
+__declspec(dllexport) void ULL_UpdateObjectsBatchWithPropertiesH(
+    const int* handles, 
+    const ULL_Transform* transforms,
+    const float* propertyValues,
+    int propertyCount,
+    int count
+);
+
+/// <summary>
+/// Update transform and property values for a handle at a simulation time
+/// </summary>
+__declspec(dllexport) void ULL_UpdateObjectAtTimeH(
+    int handle, 
+    const ULL_Transform* transform,
+    const float* propertyValues,
+    int propertyCount,
+    double simTime
+);
+
+/// <summary>
+/// Update transforms and property values for many handles at one simulation time
+/// </summary>
+__declspec(dllexport) void ULL_UpdateObjectsBatchAtTimeH(
+    const int* handles, 
+    const ULL_Transform* transforms,
+    const float* propertyValues,
+    int propertyCount,
+    int count,
+    double simTime
+);
+
+/// <summary>
+/// Remove an object by handle
+/// </summary>
+__declspec(dllexport) void ULL_RemoveObjectH(int handle);
+
+//
+// Simio Coordinate Batches - MUST MATCH UnrealLiveLinkNative.cs EXACTLY
+//
+
+/// <summary>
+/// Convert raw Simio value columns to Unreal transforms (works without initialization)
+/// </summary>
+__declspec(dllexport) int ULL_ConvertSimioTransforms(
+    const double* simioValues,
+    int componentCount,
+    int count,
+    ULL_Transform* outTransforms
+);
+
+/// <summary>
+/// Convert raw Simio value columns and update many handles in one call
+/// </summary>
+__declspec(dllexport) void ULL_UpdateObjectsBatchSimioH(
+    const int* handles,
+    const double* simioValues,
+    int componentCount,
+    const float* propertyValues,
+    int propertyCount,
+    int count
+);
+
+//
+// Compact Transforms - MUST MATCH UnrealLiveLinkNative.cs EXACTLY
+//
+
+/// <summary>
+/// Update many handles from compact transforms (scale triples only for flagged objects)
+/// </summary>
+__declspec(dllexport) void ULL_UpdateObjectsBatchCompactH(
+    const int* handles,
+    const ULL_CompactTransform* transforms,
+    const float* scales,
+    int scaleCount,
+    const float* propertyValues,
+    int propertyCount,
+    int count
+);
+
 //
 // Data Subjects (Metrics/KPIs) - MUST MATCH UnrealLiveLinkNative.cs EXACTLY
 //
@@ -122,12 +476,228 @@ __declspec(dllexport) void ULL_UpdateDataSubject(
     int propertyCount
 );
 
+/// <summary>
+/// Update property values for many data subjects in a single call
+/// </summary>
+/// <param name="subjectNames">Array of subject identifiers (count entries)</param>
+/// <param name="propertyValues">Contiguous property values, propertyCount per subject</param>
+/// <param name="propertyCount">Number of property values per subject</param>
+/// <param name="count">Number of subjects in the batch</param>
+__declspec(dllexport) void ULL_UpdateDataSubjectsBatch(
+    const char** subjectNames,
+    const float* propertyValues,
+    int propertyCount,
+    int count
+);
+
 /// <summary>
 /// Remove a data subject from LiveLink
 /// </summary>
 /// <param name="subjectName">Subject identifier to remove</param>
 __declspec(dllexport) void ULL_RemoveDataSubject(const char* subjectName);
 
+//
+// Diagnostics API
+//
+
+/// <summary>
+/// Read change-detection counters (mock has no filter: always 0)
+/// </summary>
+/// <returns>0 on success, 2 if not initialized</returns>
+__declspec(dllexport) int ULL_GetDeadbandCounters(
+    unsigned long long* outSentFrames,
+    unsigned long long* outSuppressedFrames,
+    unsigned long long* outKeepAliveFrames);
+
+/// <summary>
+/// Read Message Bus pump statistics (mock has no pump: zeroed, running = 0)
+/// </summary>
+/// <returns>0 on success, 1 if outStats is NULL, 2 if not initialized</returns>
+__declspec(dllexport) int ULL_GetPumpStats(ULL_PumpStats* outStats);
+
+/// <summary>
+/// Read hot-path statistics (mock: subject counts only, every counter 0)
+/// </summary>
+/// <returns>0 on success, 1 if outStats is NULL, 2 if not initialized</returns>
+__declspec(dllexport) int ULL_GetStats(ULL_Stats* outStats);
+
+/// <summary>
+/// Zero the statistics counters (mock: no-op)
+/// </summary>
+/// <returns>0 on success, 2 if not initialized</returns>
+__declspec(dllexport) int ULL_ResetStats();
+
+//
+// Capture and Replay API
+//
+
+/// <summary>
+/// Start a capture (mock: writes an empty capture file header, records nothing)
+/// </summary>
+/// <returns>0 on success, -1 if filePath is NULL/empty or the file cannot be created, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_StartCapture(const char* filePath);
+
+/// <summary>
+/// Stop the running capture
+/// </summary>
+/// <returns>0 on success, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_StopCapture();
+
+/// <summary>
+/// Start a replay (mock: validates the capture header, sends nothing; the position advances with speed)
+/// </summary>
+/// <returns>0 on success, -1 if filePath is NULL/empty or not a capture file, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_StartReplay(const char* filePath, double speed, int loop);
+
+/// <summary>
+/// Change replay speed (0 = paused)
+/// </summary>
+/// <returns>0 on success, -1 if no replay is running, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_SetReplaySpeed(double speed);
+
+/// <summary>
+/// Jump to a capture time
+/// </summary>
+/// <returns>0 on success, -1 if no replay is running, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_SeekReplay(double seconds);
+
+/// <summary>
+/// Stop the replay
+/// </summary>
+/// <returns>0 on success, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_StopReplay();
+
+/// <summary>
+/// Read the replay position and capture length
+/// </summary>
+/// <returns>0 on success, -1 if no replay is running, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_GetReplayStatus(double* outPositionSeconds, double* outDurationSeconds);
+
+/// <summary>
+/// Read back the last frame the replay sent for a subject (mock: replays send nothing)
+/// </summary>
+/// <returns>-1 (invalid arguments, or no frame of the subject), -3 if not initialized</returns>
+__declspec(dllexport) int ULL_GetReplayFrame(const char* subjectName, ULL_Transform* outTransform, float* outPropertyValues, int maxPropertyCount);
+
+//
+// Sessions API
+//
+
+/// <summary>
+/// Create a session (mock: tracks its provider name, handles and data subjects)
+/// </summary>
+/// <returns>Session ID (> 0), or -1 if providerName is NULL/empty or already used by a live session</returns>
+__declspec(dllexport) int ULL_CreateSession(const char* providerName, const ULL_InitOptions* options);
+
+/// <summary>
+/// Destroy a session
+/// </summary>
+/// <returns>0 on success, -1 for unknown IDs and session 0</returns>
+__declspec(dllexport) int ULL_DestroySession(int sessionId);
+
+/// <summary>
+/// Register a transform subject in a session (session 0 = ULL_RegisterObjectH)
+/// </summary>
+/// <returns>Handle (>= 0), or -1 on invalid parameters or unknown sessions</returns>
+__declspec(dllexport) int ULL_SessionRegisterObjectH(int sessionId, const char* subjectName);
+
+/// <summary>
+/// Register a transform subject with properties in a session
+/// </summary>
+/// <returns>Handle (>= 0), or -1 on invalid parameters or unknown sessions</returns>
+__declspec(dllexport) int ULL_SessionRegisterObjectWithPropertiesH(
+    int sessionId,
+    const char* subjectName,
+    const char** propertyNames,
+    int propertyCount);
+
+/// <summary>
+/// Update many handles of a session
+/// </summary>
+__declspec(dllexport) void ULL_SessionUpdateObjectsBatchWithPropertiesH(
+    int sessionId,
+    const int* handles,
+    const ULL_Transform* transforms,
+    const float* propertyValues,
+    int propertyCount,
+    int count);
+
+/// <summary>
+/// Remove a transform subject of a session by handle
+/// </summary>
+__declspec(dllexport) void ULL_SessionRemoveObjectH(int sessionId, int handle);
+
+/// <summary>
+/// Update a data subject of a session (registers it when propertyNames is provided)
+/// </summary>
+__declspec(dllexport) void ULL_SessionUpdateDataSubject(
+    int sessionId,
+    const char* subjectName,
+    const char** propertyNames,
+    const float* propertyValues,
+    int propertyCount);
+
+/// <summary>
+/// Remove a data subject of a session
+/// </summary>
+__declspec(dllexport) void ULL_SessionRemoveDataSubject(int sessionId, const char* subjectName);
+
+/// <summary>
+/// Read a session's statistics (mock: subject counts only)
+/// </summary>
+/// <returns>0 on success, -1 if outStats is NULL or the session is unknown</returns>
+__declspec(dllexport) int ULL_SessionGetStats(int sessionId, ULL_Stats* outStats);
+
+/// <summary>
+/// Get a session's initialization state (mock: READY for every live session)
+/// </summary>
+/// <returns>ULL_INIT_STATE_READY, or -1 if the session is unknown</returns>
+__declspec(dllexport) int ULL_SessionGetInitState(int sessionId);
+
+//
+// Interest Regions API
+//
+
+/// <summary>
+/// Declare regions of interest (mock: validates and logs; counters stay 0)
+/// </summary>
+/// <returns>0 on success, -1 on invalid regions or rate, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_SetInterestRegions(const ULL_InterestRegion* regions, int count, int outsideRateHz);
+
+/// <summary>
+/// Declare regions of interest of a session (session 0 = ULL_SetInterestRegions)
+/// </summary>
+/// <returns>0 on success, -1 on invalid regions or rate or unknown sessions</returns>
+__declspec(dllexport) int ULL_SessionSetInterestRegions(int sessionId, const ULL_InterestRegion* regions, int count, int outsideRateHz);
+
+/// <summary>
+/// Read interest-region counters (mock sends nothing: always 0)
+/// </summary>
+/// <returns>0 on success, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_GetInterestCounters(unsigned long long* outHeldFrames, unsigned long long* outOutsideFrames, int* outGridCells);
+
+//
+// Latency Probe API
+//
+
+/// <summary>
+/// Start the latency probe (mock: validates, writes the CSV header; nothing is probed)
+/// </summary>
+/// <returns>0 on success, -1 on invalid rate or port or if the CSV cannot be created, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_StartLatencyProbe(int rateHz, int echoPort, const char* csvPath);
+
+/// <summary>
+/// Stop the latency probe (safe when none runs)
+/// </summary>
+/// <returns>0 on success, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_StopLatencyProbe();
+
+/// <summary>
+/// Read latency probe statistics (mock probes nothing: always zeroed)
+/// </summary>
+/// <returns>0 on success, -1 if outStats is NULL, -3 if not initialized</returns>
+__declspec(dllexport) int ULL_GetLatencyStats(ULL_LatencyStats* outStats);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
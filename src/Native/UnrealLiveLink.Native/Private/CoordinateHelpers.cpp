@@ -0,0 +1,222 @@
+#include "CoordinateHelpers.h"
+#include <float.h>
+
+//=============================================================================
+// Simio → Unreal Batch Conversion
+//=============================================================================
+// Same conventions as CoordinateConverter.cs (docs/CoordinateSystems.md):
+//   position  Unreal (X, Y, Z) = Simio (X, -Z, Y) * 100
+//   rotation  Unreal Euler (X, Y, Z) = Simio (rotX, rotZ, -rotY), ZYX quaternion
+//   scale     Unreal (X, Y, Z) = Simio (X, Z, Y)
+//
+// The loops run over struct-of-arrays columns with no calls and no branches
+// (invalid values are replaced with selects; validity uses non-short-circuit &), so the compiler vectorizes them
+// for whatever instruction set the target is built for. Sine and cosine come
+// from a polynomial on the half angle reduced in degrees to [-45, 45], which is
+// exact to within a few ulps of Math.Sin / Math.Cos for the angles Simio produces.
+//=============================================================================
+
+namespace
+{
+    constexpr double MetersToCentimeters = 100.0;
+    constexpr double DegreesToRadians = 3.14159265358979323846 / 180.0;
+
+    /// <summary>
+    /// NaN/infinity test as a plain comparison (NaN compares false), which vectorizes
+    /// </summary>
+    FORCEINLINE bool IsFiniteValue(double Value)
+    {
+        return FMath::Abs(Value) <= DBL_MAX;
+    }
+
+    /// <summary>
+    /// Sine and cosine of an angle in degrees
+    /// </summary>
+    FORCEINLINE void SinCosDegrees(double Degrees, double& OutSin, double& OutCos)
+    {
+        // Degrees = 90 * Quadrant + Remainder, Remainder in [-45, 45]
+        const double Quadrant = FMath::FloorToDouble(Degrees * (1.0 / 90.0) + 0.5);
+        const double X = (Degrees - 90.0 * Quadrant) * DegreesToRadians;
+        const double X2 = X * X;
+
+        // Taylor series to x^17 / x^18: truncation error below 1e-18 on [-pi/4, pi/4]
+        const double Sin = X * (1.0 + X2 * (-1.0 / 6.0 + X2 * (1.0 / 120.0 + X2 * (-1.0 / 5040.0 + X2 * (1.0 / 362880.0 +
+                           X2 * (-1.0 / 39916800.0 + X2 * (1.0 / 6227020800.0 + X2 * (-1.0 / 1307674368000.0 +
+                           X2 * (1.0 / 355687428096000.0)))))))));
+        const double Cos = 1.0 + X2 * (-1.0 / 2.0 + X2 * (1.0 / 24.0 + X2 * (-1.0 / 720.0 + X2 * (1.0 / 40320.0 +
+                           X2 * (-1.0 / 3628800.0 + X2 * (1.0 / 479001600.0 + X2 * (-1.0 / 87178291200.0 +
+                           X2 * (1.0 / 20922789888000.0 + X2 * (-1.0 / 6402373705728000.0)))))))));
+
+        // Quadrant mod 4 (0..3, kept in double so the selects stay in vector registers) picks the swap and signs
+        const double Q = Quadrant - 4.0 * FMath::FloorToDouble(Quadrant * 0.25);
+        const bool bSwap = (Q == 1.0) | (Q == 3.0);
+        const double SinValue = bSwap ? Cos : Sin;
+        const double CosValue = bSwap ? Sin : Cos;
+        OutSin = Q >= 2.0 ? -SinValue : SinValue;
+        OutCos = (Q == 1.0) | (Q == 2.0) ? -CosValue : CosValue;
+    }
+}
+
+void ConvertSimioTransforms(const double* SimioValues, int32 ComponentCount, int32 Count, ULL_Transform* OutTransforms)
+{
+    const bool bHasScale = ComponentCount >= ULL_SIMIO_TRANSFORM_COMPONENTS;
+    const double* Columns[ULL_SIMIO_TRANSFORM_COMPONENTS];
+    for (int32 c = 0; c < ULL_SIMIO_TRANSFORM_COMPONENTS; c++)
+    {
+        Columns[c] = SimioValues + (SIZE_T)Count * (bHasScale || c < ULL_SIMIO_POSE_COMPONENTS ? c : 0);
+    }
+
+    // Converted into small local columns, then interleaved into ULL_Transform:
+    // strided stores straight into the 80-byte structs would keep the math scalar
+    constexpr int32 BlockSize = 16;
+    double Block[10][BlockSize];
+
+    for (int32 BlockStart = 0; BlockStart < Count; BlockStart += BlockSize)
+    {
+        const int32 N = FMath::Min(BlockSize, Count - BlockStart);
+        const double* RESTRICT PosX = Columns[0] + BlockStart;
+        const double* RESTRICT PosY = Columns[1] + BlockStart;
+        const double* RESTRICT PosZ = Columns[2] + BlockStart;
+        const double* RESTRICT RotX = Columns[3] + BlockStart;
+        const double* RESTRICT RotY = Columns[4] + BlockStart;
+        const double* RESTRICT RotZ = Columns[5] + BlockStart;
+
+        for (int32 i = 0; i < N; i++)
+        {
+            // Position: Simio (X, Y, Z) meters → Unreal (X, -Z, Y) centimeters, origin if not finite
+            const bool bPositionValid = IsFiniteValue(PosX[i]) & IsFiniteValue(PosY[i]) & IsFiniteValue(PosZ[i]);
+            Block[0][i] = bPositionValid ? PosX[i] * MetersToCentimeters : 0.0;
+            Block[1][i] = bPositionValid ? -PosZ[i] * MetersToCentimeters : 0.0;
+            Block[2][i] = bPositionValid ? PosY[i] * MetersToCentimeters : 0.0;
+
+            // Rotation: identity if not finite (zero angles give exactly the identity quaternion)
+            const bool bRotationValid = IsFiniteValue(RotX[i]) & IsFiniteValue(RotY[i]) & IsFiniteValue(RotZ[i]);
+            const double HalfX = bRotationValid ? RotX[i] * 0.5 : 0.0;
+            const double HalfY = bRotationValid ? RotZ[i] * 0.5 : 0.0;
+            const double HalfZ = bRotationValid ? -RotY[i] * 0.5 : 0.0;
+
+            double SinX, CosX, SinY, CosY, SinZ, CosZ;
+            SinCosDegrees(HalfX, SinX, CosX);
+            SinCosDegrees(HalfY, SinY, CosY);
+            SinCosDegrees(HalfZ, SinZ, CosZ);
+
+            const double QW = CosX * CosY * CosZ + SinX * SinY * SinZ;
+            const double QX = SinX * CosY * CosZ - CosX * SinY * SinZ;
+            const double QY = CosX * SinY * CosZ + SinX * CosY * SinZ;
+            const double QZ = CosX * CosY * SinZ - SinX * SinY * CosZ;
+            const double InvMagnitude = 1.0 / FMath::Sqrt(QX * QX + QY * QY + QZ * QZ + QW * QW);
+
+            Block[3][i] = QX * InvMagnitude;
+            Block[4][i] = QY * InvMagnitude;
+            Block[5][i] = QZ * InvMagnitude;
+            Block[6][i] = QW * InvMagnitude;
+        }
+
+        if (bHasScale)
+        {
+            const double* RESTRICT ScaleX = Columns[6] + BlockStart;
+            const double* RESTRICT ScaleY = Columns[7] + BlockStart;
+            const double* RESTRICT ScaleZ = Columns[8] + BlockStart;
+
+            for (int32 i = 0; i < N; i++)
+            {
+                // Scale: Simio (X, Y, Z) → Unreal (X, Z, Y), unit scale if not finite or not positive
+                const bool bScaleValid = IsFiniteValue(ScaleX[i]) & IsFiniteValue(ScaleY[i]) & IsFiniteValue(ScaleZ[i]) &
+                                         (ScaleX[i] > 0.0) & (ScaleY[i] > 0.0) & (ScaleZ[i] > 0.0);
+                Block[7][i] = bScaleValid ? ScaleX[i] : 1.0;
+                Block[8][i] = bScaleValid ? ScaleZ[i] : 1.0;
+                Block[9][i] = bScaleValid ? ScaleY[i] : 1.0;
+            }
+        }
+        else
+        {
+            for (int32 i = 0; i < N; i++)
+            {
+                Block[7][i] = 1.0;
+                Block[8][i] = 1.0;
+                Block[9][i] = 1.0;
+            }
+        }
+
+        for (int32 i = 0; i < N; i++)
+        {
+            double* Out = OutTransforms[BlockStart + i].position;
+            for (int32 c = 0; c < 10; c++)
+            {
+                Out[c] = Block[c][i];
+            }
+        }
+    }
+}
+
+//=============================================================================
+// Compact Transform Decoding
+//=============================================================================
+
+bool DecodeCompactTransforms(const ULL_CompactTransform* Compact, const float* Scales, int32 ScaleCount, int32 Count, ULL_Transform* OutTransforms)
+{
+    constexpr double InvSqrt2 = 0.70710678118654752440;
+    int32 NextScale = 0;
+    bool bScalesComplete = true;
+
+    for (int32 i = 0; i < Count; i++)
+    {
+        const ULL_CompactTransform& In = Compact[i];
+        ULL_Transform& Out = OutTransforms[i];
+
+        Out.position[0] = In.position[0];
+        Out.position[1] = In.position[1];
+        Out.position[2] = In.position[2];
+
+        // Smallest three in X, Y, Z, W order, skipping the dropped component
+        double Small[3];
+        if (In.flags & ULL_COMPACT_ROTATION_32)
+        {
+            const uint32 Packed = (uint32)In.rotation[0] | ((uint32)In.rotation[1] << 16);
+            for (int32 k = 0; k < 3; k++)
+            {
+                Small[k] = (((Packed >> (10 * k)) & 0x3FF) * (2.0 / 1023.0) - 1.0) * InvSqrt2;
+            }
+        }
+        else
+        {
+            for (int32 k = 0; k < 3; k++)
+            {
+                Small[k] = (In.rotation[k] * (2.0 / 65535.0) - 1.0) * InvSqrt2;
+            }
+        }
+
+        const int32 Largest = In.flags & ULL_COMPACT_LARGEST_MASK;
+        const double LargestValue = FMath::Sqrt(FMath::Max(0.0, 1.0 - (Small[0] * Small[0] + Small[1] * Small[1] + Small[2] * Small[2])));
+        double Quat[4];
+        for (int32 c = 0, k = 0; c < 4; c++)
+        {
+            Quat[c] = c == Largest ? LargestValue : Small[k++];
+        }
+
+        // Quantization leaves the quaternion slightly off unit length
+        const double InvMagnitude = 1.0 / FMath::Sqrt(Quat[0] * Quat[0] + Quat[1] * Quat[1] + Quat[2] * Quat[2] + Quat[3] * Quat[3]);
+        for (int32 c = 0; c < 4; c++)
+        {
+            Out.rotation[c] = Quat[c] * InvMagnitude;
+        }
+
+        if ((In.flags & ULL_COMPACT_HAS_SCALE) && NextScale < ScaleCount && Scales)
+        {
+            const float* Scale = Scales + (SIZE_T)NextScale * 3;
+            NextScale++;
+            Out.scale[0] = Scale[0];
+            Out.scale[1] = Scale[1];
+            Out.scale[2] = Scale[2];
+        }
+        else
+        {
+            bScalesComplete &= (In.flags & ULL_COMPACT_HAS_SCALE) == 0;
+            Out.scale[0] = 1.0;
+            Out.scale[1] = 1.0;
+            Out.scale[2] = 1.0;
+        }
+    }
+
+    return bScalesComplete;
+}
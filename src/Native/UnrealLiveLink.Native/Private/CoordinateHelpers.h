@@ -1,4 +1,94 @@
 #pragma once
 
-// Coordinate conversion helpers - will be implemented
-// For now, just a placeholder
\ No newline at end of file
+#include "CoreMinimal.h"
+#include "Math/Transform.h"
+#include "UnrealLiveLink.Types.h"
+
+//=============================================================================
+// Coordinate Helpers
+//=============================================================================
+// Conversion between C API structures and Unreal math types.
+// Managed layer (CoordinateConverter.cs) has already converted Simio → Unreal
+// coordinates, so these helpers are direct pass-through (no axis remapping).
+//
+// ConvertSimioTransforms is the exception: it does the Simio → Unreal
+// conversion itself for ULL_ConvertSimioTransforms / ULL_UpdateObjectsBatchSimioH.
+// DecodeCompactTransforms expands ULL_CompactTransform (already Unreal space).
+//=============================================================================
+
+/// <summary>
+/// Convert ULL_Transform to Unreal's FTransform
+/// </summary>
+static FORCEINLINE FTransform ConvertToFTransform(const ULL_Transform* transform)
+{
+    if (!transform)
+    {
+        return FTransform::Identity;
+    }
+
+    // Position: centimeters (ULL_Transform uses cm, FVector uses cm)
+    FVector Location(
+        transform->position[0],
+        transform->position[1],
+        transform->position[2]
+    );
+
+    // Rotation: quaternion (X, Y, Z, W)
+    FQuat Rotation(
+        transform->rotation[0],
+        transform->rotation[1],
+        transform->rotation[2],
+        transform->rotation[3]
+    );
+
+    // Scale: uniform or non-uniform
+    FVector Scale(
+        transform->scale[0],
+        transform->scale[1],
+        transform->scale[2]
+    );
+
+    return FTransform(Rotation, Location, Scale);
+}
+
+/// <summary>
+/// Convert Unreal's FTransform back to ULL_Transform
+/// </summary>
+static FORCEINLINE void ConvertFromFTransform(const FTransform& Transform, ULL_Transform* OutTransform)
+{
+    const FVector Location = Transform.GetLocation();
+    const FQuat Rotation = Transform.GetRotation();
+    const FVector Scale = Transform.GetScale3D();
+
+    OutTransform->position[0] = Location.X;
+    OutTransform->position[1] = Location.Y;
+    OutTransform->position[2] = Location.Z;
+    OutTransform->rotation[0] = Rotation.X;
+    OutTransform->rotation[1] = Rotation.Y;
+    OutTransform->rotation[2] = Rotation.Z;
+    OutTransform->rotation[3] = Rotation.W;
+    OutTransform->scale[0] = Scale.X;
+    OutTransform->scale[1] = Scale.Y;
+    OutTransform->scale[2] = Scale.Z;
+}
+
+/// <summary>
+/// Convert a Simio value block (see "Simio Value Blocks" in UnrealLiveLink.Types.h) to
+/// Unreal transforms, matching CoordinateConverter.SimioToUnrealTransform
+/// </summary>
+/// <param name="SimioValues">ComponentCount columns of Count doubles</param>
+/// <param name="ComponentCount">ULL_SIMIO_POSE_COMPONENTS or ULL_SIMIO_TRANSFORM_COMPONENTS</param>
+/// <param name="Count">Number of objects</param>
+/// <param name="OutTransforms">Receives Count transforms</param>
+void ConvertSimioTransforms(const double* SimioValues, int32 ComponentCount, int32 Count, ULL_Transform* OutTransforms);
+
+/// <summary>
+/// Expand compact transforms (see "Compact Transform Structure" in UnrealLiveLink.Types.h)
+/// </summary>
+/// <param name="Compact">Count compact transforms</param>
+/// <param name="Scales">Scale triples of the objects flagged ULL_COMPACT_HAS_SCALE, in order (may be NULL)</param>
+/// <param name="ScaleCount">Number of triples in Scales</param>
+/// <param name="Count">Number of objects</param>
+/// <param name="OutTransforms">Receives Count transforms</param>
+/// <returns>false if more objects were flagged than ScaleCount (those get unit scale)</returns>
+bool DecodeCompactTransforms(const ULL_CompactTransform* Compact, const float* Scales, int32 ScaleCount, int32 Count, ULL_Transform* OutTransforms);
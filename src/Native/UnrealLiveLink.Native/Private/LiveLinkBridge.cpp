@@ -1,4 +1,5 @@
 #include "LiveLinkBridge.h"
+#include "CoordinateHelpers.h"
 #include "UnrealLiveLink.Native.h"
 #include "Math/Transform.h"
 #include "Misc/ScopeLock.h"
@@ -40,19 +41,327 @@
 // Static member initialization
 // CRITICAL: GEngineLoop.PreInit() can only be called ONCE per process
 bool FLiveLinkBridge::bGEngineLoopInitialized = false;
+FCriticalSection FLiveLinkBridge::EngineLoopLock;
+FLiveLinkBridge::EEngineStage FLiveLinkBridge::EngineStage = FLiveLinkBridge::EEngineStage::NotStarted;
+TArray<TWeakPtr<FLiveLinkBridge>> FLiveLinkBridge::StagingSessions;
+std::mutex FLiveLinkBridge::StagingLock;
+std::condition_variable FLiveLinkBridge::StagingSignal;
+std::thread* FLiveLinkBridge::EngineThread = nullptr;
+bool FLiveLinkBridge::bEngineThreadBusy = false;
+
+TUniquePtr<FLiveLinkTickThread> FLiveLinkBridge::Pump;
+int32 FLiveLinkBridge::PumpSessionCount = 0;
+FCriticalSection FLiveLinkBridge::PumpLock;
+
+FRWLock FLiveLinkBridge::SessionLock;
+TMap<int32, FLiveLinkBridge::FSessionEntry> FLiveLinkBridge::Sessions;
+int32 FLiveLinkBridge::NextSessionId = ULL_DEFAULT_SESSION + 1;
+FString FLiveLinkBridge::DefaultProviderName;
 
 FLiveLinkBridge& FLiveLinkBridge::Get()
 {
-	static FLiveLinkBridge Instance;
+	return *GetDefaultSession();
+}
+
+const TSharedPtr<FLiveLinkBridge>& FLiveLinkBridge::GetDefaultSession()
+{
+	static const TSharedPtr<FLiveLinkBridge> Instance = MakeShared<FLiveLinkBridge>();
 	return Instance;
 }
 
+//=============================================================================
+// Sessions
+//=============================================================================
+
+int32 FLiveLinkBridge::CreateSession(const FString& InProviderName, const ULL_InitOptions* Options)
+{
+	{
+		FReadScopeLock ReadLock(SessionLock);
+		if (Sessions.Num() >= ULL_MAX_SESSIONS || IsProviderNameInUse(InProviderName))
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Error, 
+			       TEXT("CreateSession: ❌ Provider name '%s' is in use or %d sessions are open"), 
+			       *InProviderName, 
+			       Sessions.Num());
+			return ULL_ERROR;
+		}
+	}
+	
+	// Initialized outside the registry lock: it starts threads and may create the provider,
+	// and other sessions' API calls take the read lock
+	TSharedPtr<FLiveLinkBridge> Session = MakeShared<FLiveLinkBridge>();
+	if (!Session->Initialize(InProviderName, Options))
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("CreateSession: ❌ Initialize failed for '%s'"), 
+		       *InProviderName);
+		return ULL_ERROR;
+	}
+	
+	int32 SessionId = ULL_ERROR;
+	{
+		FWriteScopeLock WriteLock(SessionLock);
+		
+		// A concurrent CreateSession may have taken the name while this one initialized
+		if (Sessions.Num() < ULL_MAX_SESSIONS && !IsProviderNameInUse(InProviderName))
+		{
+			SessionId = NextSessionId++;
+			Sessions.Add(SessionId, FSessionEntry{Session, InProviderName});
+		}
+	}
+	
+	if (SessionId == ULL_ERROR)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("CreateSession: ❌ Provider name '%s' was taken during initialization"), 
+		       *InProviderName);
+		Session->Shutdown();
+		return ULL_ERROR;
+	}
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("CreateSession: ✅ Session %d created for provider '%s'"), 
+	       SessionId, 
+	       *InProviderName);
+	return SessionId;
+}
+
+int32 FLiveLinkBridge::DestroySession(int32 SessionId)
+{
+	TSharedPtr<FLiveLinkBridge> Session;
+	{
+		FWriteScopeLock WriteLock(SessionLock);
+		FSessionEntry Entry;
+		if (SessionId == ULL_DEFAULT_SESSION || !Sessions.RemoveAndCopyValue(SessionId, Entry))
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Warning, 
+			       TEXT("DestroySession: Unknown session %d"), 
+			       SessionId);
+			return ULL_ERROR;
+		}
+		Session = Entry.Session;
+	}
+	
+	// Calls that looked the session up earlier hold their own reference; Shutdown takes
+	// the session lock, so they finish first and later ones see it uninitialized
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("DestroySession: Shutting down session %d"), 
+	       SessionId);
+	Session->Shutdown();
+	return ULL_OK;
+}
+
+bool FLiveLinkBridge::IsProviderNameInUse(const FString& InProviderName)
+{
+	// Note: Caller must hold SessionLock
+	
+	// Provider names identify sources in Unreal and name the shared-memory region,
+	// so live sessions (the default one included) may not share one
+	if (DefaultProviderName == InProviderName)
+	{
+		return true;
+	}
+	for (const auto& Entry : Sessions)
+	{
+		if (Entry.Value.ProviderName == InProviderName)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FLiveLinkBridge::ReserveDefaultProviderName(const FString& InProviderName)
+{
+	FWriteScopeLock WriteLock(SessionLock);
+	
+	// Already reserved: the default session is initialized (Initialize is idempotent)
+	if (!DefaultProviderName.IsEmpty())
+	{
+		return true;
+	}
+	
+	if (IsProviderNameInUse(InProviderName))
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("Initialize: ❌ Provider name '%s' is in use by a session"), 
+		       *InProviderName);
+		return false;
+	}
+	
+	DefaultProviderName = InProviderName;
+	return true;
+}
+
+void FLiveLinkBridge::ReleaseDefaultProviderName()
+{
+	FWriteScopeLock WriteLock(SessionLock);
+	DefaultProviderName.Empty();
+}
+
+TSharedPtr<FLiveLinkBridge> FLiveLinkBridge::FindSession(int32 SessionId)
+{
+	if (SessionId == ULL_DEFAULT_SESSION)
+	{
+		return GetDefaultSession();
+	}
+	
+	FReadScopeLock ReadLock(SessionLock);
+	const FSessionEntry* Entry = Sessions.Find(SessionId);
+	return Entry ? Entry->Session : TSharedPtr<FLiveLinkBridge>();
+}
+
+bool FLiveLinkBridge::AcquirePump(int32 RateHz)
+{
+	FScopeLock PumpScope(&PumpLock);
+	
+	if (!Pump.IsValid())
+	{
+		Pump = MakeUnique<FLiveLinkTickThread>(TEXT("UnrealLiveLinkPump"), RateHz, &FLiveLinkBridge::PumpMessageBus);
+		if (!Pump->Start())
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Warning, 
+			       TEXT("Initialize: ⚠️ Pump thread unavailable, Message Bus relies on host ticking"));
+			Pump.Reset();
+			return false;
+		}
+	}
+	
+	PumpSessionCount++;
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("Initialize: Message Bus pump %d Hz (shared by %d sessions)"), 
+	       Pump->GetRateHz(), 
+	       PumpSessionCount);
+	return true;
+}
+
+void FLiveLinkBridge::ReleasePump()
+{
+	// The pump never takes a session lock or PumpLock, so joining here cannot deadlock
+	FScopeLock PumpScope(&PumpLock);
+	
+	if (--PumpSessionCount == 0 && Pump.IsValid())
+	{
+		Pump->StopAndJoin();
+		Pump.Reset();
+	}
+}
+
 //=============================================================================
 // Lifecycle Management
 //=============================================================================
 
-bool FLiveLinkBridge::Initialize(const FString& InProviderName)
+ULL_InitOptions FLiveLinkBridge::ResolveInitOptions(const ULL_InitOptions* Options)
+{
+	ULL_InitOptions Resolved;
+	Resolved.structSize = sizeof(ULL_InitOptions);
+	Resolved.sendMode = ULL_SEND_MODE_SYNC;
+	Resolved.queueDepth = ULL_DEFAULT_QUEUE_DEPTH;
+	Resolved.queuePolicy = ULL_QUEUE_POLICY_DROP_OLDEST;
+	Resolved.publishRateHz = ULL_PUBLISH_IMMEDIATE;
+	Resolved.deadbandEnabled = 0;
+	Resolved.positionDeadband = 0.0f;
+	Resolved.rotationDeadbandDegrees = 0.0f;
+	Resolved.propertyDeadband = 0.0f;
+	Resolved.keepAliveIntervalMs = ULL_DEFAULT_KEEPALIVE_MS;
+	Resolved.pumpRateHz = ULL_DEFAULT_PUMP_RATE_HZ;
+	Resolved.transport = ULL_TRANSPORT_MESSAGE_BUS;
+	Resolved.sharedMemoryCapacity = ULL_SHM_DEFAULT_CAPACITY;
+	Resolved.sharedMemoryMaxProperties = ULL_SHM_DEFAULT_MAX_PROPERTIES;
+	Resolved.simTimeScale = 1.0f;
+	Resolved.sceneFrameRate = ULL_DEFAULT_SCENE_FRAME_RATE;
+	Resolved.subjectPoolSize = ULL_POOL_DISABLED;
+	Resolved.publishFrameBudget = ULL_BUDGET_UNLIMITED;
+	Resolved.publishByteBudget = ULL_BUDGET_UNLIMITED;
+	Resolved.initMode = ULL_INIT_MODE_SYNC;
+	
+	if (!Options)
+	{
+		return Resolved;
+	}
+	
+	// Only read fields the caller's struct version actually contains
+	const int32 CallerSize = Options->structSize;
+	if (CallerSize >= (int32)(offsetof(ULL_InitOptions, sendMode) + sizeof(int)))
+	{
+		Resolved.sendMode = Options->sendMode == ULL_SEND_MODE_ASYNC ? ULL_SEND_MODE_ASYNC : ULL_SEND_MODE_SYNC;
+	}
+	if (CallerSize >= (int32)(offsetof(ULL_InitOptions, queueDepth) + sizeof(int)) && Options->queueDepth > 0)
+	{
+		Resolved.queueDepth = FMath::Clamp(Options->queueDepth, 16, 1 << 20);
+	}
+	if (CallerSize >= (int32)(offsetof(ULL_InitOptions, queuePolicy) + sizeof(int)))
+	{
+		Resolved.queuePolicy = Options->queuePolicy == ULL_QUEUE_POLICY_BLOCK ? ULL_QUEUE_POLICY_BLOCK : ULL_QUEUE_POLICY_DROP_OLDEST;
+	}
+	if (CallerSize >= (int32)(offsetof(ULL_InitOptions, publishRateHz) + sizeof(int)) && Options->publishRateHz > 0)
+	{
+		Resolved.publishRateHz = FMath::Min(Options->publishRateHz, ULL_MAX_PUBLISH_RATE_HZ);
+	}
+	if (CallerSize >= (int32)(offsetof(ULL_InitOptions, keepAliveIntervalMs) + sizeof(int)) && Options->deadbandEnabled != 0)
+	{
+		// Negative thresholds are treated as 0 (suppress exact repeats only)
+		Resolved.deadbandEnabled = 1;
+		Resolved.positionDeadband = FMath::Max(Options->positionDeadband, 0.0f);
+		Resolved.rotationDeadbandDegrees = FMath::Max(Options->rotationDeadbandDegrees, 0.0f);
+		Resolved.propertyDeadband = FMath::Max(Options->propertyDeadband, 0.0f);
+		Resolved.keepAliveIntervalMs = Options->keepAliveIntervalMs > 0 ? Options->keepAliveIntervalMs : ULL_DEFAULT_KEEPALIVE_MS;
+	}
+	if (CallerSize >= (int32)(offsetof(ULL_InitOptions, pumpRateHz) + sizeof(int)) && Options->pumpRateHz != 0)
+	{
+		Resolved.pumpRateHz = Options->pumpRateHz < 0 ? ULL_PUMP_DISABLED : FMath::Min(Options->pumpRateHz, 1000);
+	}
+	if (CallerSize >= (int32)(offsetof(ULL_InitOptions, sharedMemoryMaxProperties) + sizeof(int)) && Options->transport == ULL_TRANSPORT_SHARED_MEMORY)
+	{
+		Resolved.transport = ULL_TRANSPORT_SHARED_MEMORY;
+		if (Options->sharedMemoryCapacity > 0)
+		{
+			Resolved.sharedMemoryCapacity = FMath::Min(Options->sharedMemoryCapacity, ULL_SHM_MAX_CAPACITY);
+		}
+		if (Options->sharedMemoryMaxProperties > 0)
+		{
+			Resolved.sharedMemoryMaxProperties = FMath::Min(Options->sharedMemoryMaxProperties, ULL_SHM_MAX_PROPERTIES);
+		}
+	}
+	if (CallerSize >= (int32)(offsetof(ULL_InitOptions, sceneFrameRate) + sizeof(int)))
+	{
+		if (Options->simTimeScale > 0.0f)
+		{
+			Resolved.simTimeScale = Options->simTimeScale;
+		}
+		if (Options->sceneFrameRate > 0)
+		{
+			Resolved.sceneFrameRate = FMath::Min(Options->sceneFrameRate, 1000);
+		}
+	}
+	if (CallerSize >= (int32)(offsetof(ULL_InitOptions, subjectPoolSize) + sizeof(int)) && Options->subjectPoolSize > 0)
+	{
+		Resolved.subjectPoolSize = FMath::Min(Options->subjectPoolSize, ULL_MAX_POOL_SIZE);
+	}
+	if (CallerSize >= (int32)(offsetof(ULL_InitOptions, publishByteBudget) + sizeof(int)))
+	{
+		Resolved.publishFrameBudget = FMath::Max(Options->publishFrameBudget, 0);
+		Resolved.publishByteBudget = FMath::Max(Options->publishByteBudget, 0);
+	}
+	if (CallerSize >= (int32)(offsetof(ULL_InitOptions, initMode) + sizeof(int)))
+	{
+		Resolved.initMode = Options->initMode == ULL_INIT_MODE_ASYNC ? ULL_INIT_MODE_ASYNC : ULL_INIT_MODE_SYNC;
+	}
+	
+	return Resolved;
+}
+
+bool FLiveLinkBridge::Initialize(const FString& InProviderName, const ULL_InitOptions* Options)
 {
+	// The default session claims its provider name in the session registry first, so it cannot
+	// take a name CreateSession already gave out (before CriticalSection: lock order)
+	const bool bDefaultSession = this == GetDefaultSession().Get();
+	if (bDefaultSession && !ReserveDefaultProviderName(InProviderName))
+	{
+		return false;
+	}
+	
 	FScopeLock Lock(&CriticalSection);
 	
 	if (bInitialized)
@@ -65,6 +374,77 @@ bool FLiveLinkBridge::Initialize(const FString& InProviderName)
 		return true;
 	}
 	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("Initialize: UnrealLiveLinkNative %s build (hot-path logging %s)"), 
+	       ULL_BUILD_FLAVOR, 
+	       ULL_ENABLE_HOT_PATH_LOGGING ? TEXT("on") : TEXT("compiled out"));
+	
+	const ULL_InitOptions ResolvedOptions = ResolveInitOptions(Options);
+	
+	// Staged initialization: return now, the engine thread completes the session
+	if (ResolvedOptions.initMode == ULL_INIT_MODE_ASYNC && BeginStagedInitialize(InProviderName, ResolvedOptions))
+	{
+		return true;
+	}
+	
+	if (!BringUpEngineLoop())
+	{
+		if (bDefaultSession)
+		{
+			ReleaseDefaultProviderName();
+		}
+		return false;
+	}
+	
+	// Sessions can be initialized from different threads: serialize the session part too
+	FScopeLock EngineScope(&EngineLoopLock);
+	
+	ProviderName = InProviderName;
+	StartSession(ResolvedOptions);
+	return true;
+}
+
+bool FLiveLinkBridge::BringUpEngineLoop()
+{
+	// Note: Caller must hold CriticalSection lock (not EngineLoopLock, the engine thread takes it)
+	
+	{
+		std::unique_lock<std::mutex> StagingScope(StagingLock);
+		if (EngineThread)
+		{
+			// The runtime belongs to the engine thread: PreInit must not run on a second thread
+			if (EngineStage == EEngineStage::NotStarted)
+			{
+				EngineStage = EEngineStage::Staging;
+				StagingSignal.notify_all();
+			}
+			StagingSignal.wait(StagingScope, [] { return EngineStage != EEngineStage::Staging; });
+			return EngineStage == EEngineStage::Ready;
+		}
+	}
+	
+	// Sessions can be initialized from different threads: serialize initialization
+	// process-wide so the engine runtime is set up exactly once (this thread becomes the game thread)
+	FScopeLock EngineScope(&EngineLoopLock);
+	
+	if (!InitializeEngineLoop())
+	{
+		return false;
+	}
+	
+	// Later staged initializations find the runtime up and initialize synchronously
+	std::lock_guard<std::mutex> StagingScope(StagingLock);
+	if (EngineStage == EEngineStage::NotStarted)
+	{
+		EngineStage = EEngineStage::Ready;
+	}
+	return true;
+}
+
+bool FLiveLinkBridge::InitializeEngineLoop()
+{
+	// Note: Caller must hold EngineLoopLock
+	
 	// Initialize Unreal Engine runtime environment
 	// Based on reference: UnrealLiveLinkCInterface (github.com/jakedowns/UnrealLiveLinkCInterface)
 	// CRITICAL: GEngineLoop.PreInit() can only be called ONCE per process!
@@ -122,11 +502,127 @@ bool FLiveLinkBridge::Initialize(const FString& InProviderName)
 		       TEXT("Initialize: ✅ GEngineLoop already initialized (reusing existing runtime)"));
 	}
 	
-	// Store provider name and mark as initialized
-	ProviderName = InProviderName;
+	return true;
+}
+
+void FLiveLinkBridge::StartSession(const ULL_InitOptions& ResolvedOptions)
+{
+	// Note: Caller must hold CriticalSection and EngineLoopLock
+	
+	// Mark as initialized
 	bInitialized = true;
 	bLiveLinkReady = true;
 	
+	// Asynchronous send mode: start the sender thread before the provider exists,
+	// EnsureLiveLinkSource() hands the provider to it
+	if (ResolvedOptions.sendMode == ULL_SEND_MODE_ASYNC)
+	{
+		Sender = MakeUnique<FLiveLinkSender>(ResolvedOptions.queueDepth, ResolvedOptions.queuePolicy, Stats, Recorder, LatencyProbe);
+		if (!Sender->Start())
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Warning, 
+			       TEXT("Initialize: ⚠️ Sender thread unavailable, falling back to synchronous send mode"));
+			Sender.Reset();
+		}
+	}
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("Initialize: Send mode %s"), 
+	       Sender.IsValid() ? TEXT("ASYNC (sender thread)") : TEXT("SYNC (caller thread)"));
+	
+	// Coalescing mode: updates only overwrite each subject's latest-value slot,
+	// the publish thread sends dirty subjects at a fixed rate
+	if (ResolvedOptions.publishRateHz > 0)
+	{
+		PublishRateHz = ResolvedOptions.publishRateHz;
+		Publisher = MakeUnique<FLiveLinkTickThread>(TEXT("UnrealLiveLinkPublisher"), PublishRateHz, [this](double) { PublishPendingFrames(); });
+		if (!Publisher->Start())
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Warning, 
+			       TEXT("Initialize: ⚠️ Publish thread unavailable, sending every update immediately"));
+			Publisher.Reset();
+			PublishRateHz = 0;
+		}
+	}
+	
+	// Change detection: thresholds are stored in the form the filter compares against
+	bDeadbandEnabled = ResolvedOptions.deadbandEnabled != 0;
+	if (bDeadbandEnabled)
+	{
+		PositionDeadbandSquared = (double)ResolvedOptions.positionDeadband * (double)ResolvedOptions.positionDeadband;
+		RotationDeadbandRadians = FMath::DegreesToRadians((double)ResolvedOptions.rotationDeadbandDegrees);
+		PropertyDeadband = ResolvedOptions.propertyDeadband;
+		KeepAliveIntervalSeconds = ResolvedOptions.keepAliveIntervalMs / 1000.0;
+		
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("Initialize: Deadband enabled (position %.3f cm, rotation %.3f deg, property %.4f, keep-alive %d ms)"), 
+		       ResolvedOptions.positionDeadband, 
+		       ResolvedOptions.rotationDeadbandDegrees, 
+		       ResolvedOptions.propertyDeadband, 
+		       ResolvedOptions.keepAliveIntervalMs);
+	}
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("Initialize: Publish rate %s"), 
+	       PublishRateHz > 0 ? *FString::Printf(TEXT("%d Hz (latest value per subject)"), PublishRateHz) : TEXT("immediate"));
+	
+	// Publish budget: token buckets start full (one publish pass worth)
+	if (ResolvedOptions.publishFrameBudget > 0 || ResolvedOptions.publishByteBudget > 0)
+	{
+		if (PublishRateHz > 0)
+		{
+			PublishFrameBudget = ResolvedOptions.publishFrameBudget;
+			PublishByteBudget = ResolvedOptions.publishByteBudget;
+			FrameBudgetTokens = (double)PublishFrameBudget / PublishRateHz;
+			ByteBudgetTokens = (double)PublishByteBudget / PublishRateHz;
+			LastBudgetRefillTime = FPlatformTime::Seconds();
+			
+			UE_LOG(LogUnrealLiveLinkNative, Log, 
+			       TEXT("Initialize: Publish budget %d frames/s, %d bytes/s (0 = unlimited)"), 
+			       PublishFrameBudget, 
+			       PublishByteBudget);
+		}
+		else
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Warning, 
+			       TEXT("Initialize: ⚠️ Publish budget ignored, it requires publishRateHz > 0"));
+		}
+	}
+	
+	// Simulation-time frames: anchored on the first timed update
+	SimTimeScale = ResolvedOptions.simTimeScale;
+	SceneFrameRate = ResolvedOptions.sceneFrameRate;
+	bSimTimeAnchored = false;
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("Initialize: Simulation time scale %.3f, scene frame rate %d fps"), 
+	       SimTimeScale, 
+	       SceneFrameRate);
+	
+	// Pool mode: pools are created per property schema on first registration
+	SubjectPoolSize = ResolvedOptions.subjectPoolSize;
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("Initialize: Subject pool %s"), 
+	       SubjectPoolSize > 0 ? *FString::Printf(TEXT("%d subjects per property schema"), SubjectPoolSize) : TEXT("disabled"));
+	
+	// Shared-memory transport: transform frames are written straight into a mapped table
+	// the Unreal-side reader polls; the provider below still carries data subjects
+	if (ResolvedOptions.transport == ULL_TRANSPORT_SHARED_MEMORY)
+	{
+		SharedMemory = MakeUnique<FLiveLinkSharedMemoryWriter>();
+		if (!SharedMemory->Open(ProviderName, ResolvedOptions.sharedMemoryCapacity, ResolvedOptions.sharedMemoryMaxProperties))
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Warning, 
+			       TEXT("Initialize: ⚠️ Shared memory unavailable, transform subjects fall back to the Message Bus"));
+			SharedMemory.Reset();
+		}
+	}
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("Initialize: Transform transport %s"), 
+	       SharedMemory.IsValid() ? *FString::Printf(TEXT("SHARED MEMORY ('%s')"), *SharedMemory->GetRegionName()) : TEXT("MESSAGE BUS"));
+	
 	UE_LOG(LogUnrealLiveLinkNative, Log, 
 	       TEXT("Initialize: Ready for LiveLink integration with provider '%s'"), 
 	       *ProviderName);
@@ -150,596 +646,3571 @@ bool FLiveLinkBridge::Initialize(const FString& InProviderName)
 		       TEXT("Initialize: ⚠️ Provider creation deferred (will retry on first subject registration)"));
 	}
 	
-	return true;
+	// Message Bus pump: started after the provider's one-shot announcement tick so
+	// FTSTicker is only ever ticked from one thread at a time
+	if (ResolvedOptions.pumpRateHz > 0)
+	{
+		bPumpAcquired = AcquirePump(ResolvedOptions.pumpRateHz);
+	}
+	
+	if (!bPumpAcquired)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("Initialize: Message Bus pump disabled for this session"));
+	}
+	
+	PublishLifecycleStateLocked();
 }
 
-void FLiveLinkBridge::Shutdown()
+//=============================================================================
+// Staged Initialization (ULL_INIT_MODE_ASYNC)
+//=============================================================================
+// The engine runtime bring-up (seconds, mostly GEngineLoop.PreInit) runs on the
+// engine thread instead of the Simio thread. The session is marked initialized
+// at once: registrations are tracked locally and updates coalesce into each
+// subject's latest-value slot. When the runtime is up the engine thread runs
+// the session part of Initialize, registers the tracked subjects and publishes
+// the buffered values, so the first model run starts without waiting and the
+// scene shows each subject's latest state as soon as the provider exists.
+//
+// The engine thread runs the bring-up, so it becomes the engine's game thread.
+// It stays alive for the process, parked between bring-ups: GGameThreadId keeps
+// naming a live thread, and a retry after a failed bring-up (staged or not)
+// runs on the same thread. Nothing here relies on game-thread tasks (see
+// PumpMessageBus), and later runs reuse the runtime. Shutdown of a session that
+// is still staging waits for the engine thread to park, so the host can unload
+// the DLL once ULL_Shutdown returns.
+//=============================================================================
+
+bool FLiveLinkBridge::BeginStagedInitialize(const FString& InProviderName, const ULL_InitOptions& ResolvedOptions)
 {
-	FScopeLock Lock(&CriticalSection);
+	// Note: Caller must hold CriticalSection lock
 	
-	if (!bInitialized)
+	// Pooled subjects and shared-memory slots are created at registration, which needs the runtime
+	if (ResolvedOptions.subjectPoolSize > 0 || ResolvedOptions.transport == ULL_TRANSPORT_SHARED_MEMORY)
 	{
 		UE_LOG(LogUnrealLiveLinkNative, Warning, 
-		       TEXT("Shutdown: Not initialized, nothing to do"));
-		return;
+		       TEXT("Initialize: ⚠️ Staged initialization is not available with pool mode or the shared-memory transport, initializing synchronously"));
+		return false;
 	}
 	
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("Shutdown: Clearing %d transform subjects, %d data subjects, %d cached names"), 
-	       TransformSubjects.Num(), 
-	       DataSubjects.Num(), 
-	       NameCache.Num());
+	std::lock_guard<std::mutex> StagingScope(StagingLock);
 	
-	// Remove LiveLink provider if created
-	if (bLiveLinkSourceCreated && LiveLinkProvider.IsValid())
+	if (EngineStage == EEngineStage::Ready)
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("Shutdown: Removing LiveLink Message Bus Provider '%s'"), 
-		       *ProviderName);
-		
-		// Reset shared pointer (will trigger cleanup)
-		LiveLinkProvider.Reset();
-		bLiveLinkSourceCreated = false;
-		
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("Shutdown: ✅ LiveLink provider removed successfully"));
+		// Runtime already up (an earlier run): the synchronous path is fast
+		return false;
 	}
 	
-	// Clear all state
-	TransformSubjects.Empty();
-	DataSubjects.Empty();
-	NameCache.Empty();
-	ProviderName.Empty();
-	bInitialized = false;
-	bLiveLinkReady = false;
-	
-	// DO NOT shutdown GEngineLoop in DLL!
-	// WARNING: RequestEngineExit() and AppExit() terminate the HOST PROCESS (Simio.exe)!
-	// This is only safe in standalone programs, not DLLs loaded by other applications.
-	UE_LOG(LogUnrealLiveLinkNative, Log, TEXT("Shutdown: Skipping GEngineLoop shutdown (DLL loaded in host process)"));
+	StagingSessions.Add(AsShared());
+	if (EngineStage == EEngineStage::NotStarted)
+	{
+		EngineStage = EEngineStage::Staging;
+		
+		// std::thread because FRunnableThread needs the runtime being brought up. Never joined
+		// or destroyed: like the runtime it hosts, it lives as long as the process.
+		if (!EngineThread)
+		{
+			EngineThread = new std::thread(&FLiveLinkBridge::RunEngineThread);
+		}
+		StagingSignal.notify_all();
+	}
 	
-	// DON'T CALL THESE IN A DLL:
-	// RequestEngineExit(TEXT("UnrealLiveLinkNative shutting down"));  // ← Terminates Simio!
-	// FEngineLoop::AppPreExit();  // ← Unsafe in DLL
-	// FModuleManager::Get().UnloadModulesAtShutdown();  // ← May crash host
-	// FEngineLoop::AppExit();  // ← Terminates host process!
+	ProviderName = InProviderName;
+	StagedOptions = ResolvedOptions;
+	StagingStartCycles = FPlatformTime::Cycles64();
+	bInitialized = true;
+	bEngineStaging = true;
+	bStagingFailed = false;
+	PublishLifecycleStateLocked();
 	
-	UE_LOG(LogUnrealLiveLinkNative, Log, TEXT("Shutdown: Complete (resources released, modules remain loaded)"));
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("Initialize: Staging the engine runtime in the background, updates for '%s' are buffered until it is up"), 
+	       *ProviderName);
+	return true;
 }
 
-int FLiveLinkBridge::GetConnectionStatus() const
+void FLiveLinkBridge::RunEngineThread()
 {
-	FScopeLock Lock(&CriticalSection);
+	// Note: Runs on the engine thread for the life of the process
 	
-	if (!bInitialized)
+	for (;;)
 	{
-		return ULL_NOT_INITIALIZED;
+		{
+			std::unique_lock<std::mutex> StagingScope(StagingLock);
+			bEngineThreadBusy = false;
+			StagingSignal.notify_all();
+			StagingSignal.wait(StagingScope, [] { return EngineStage == EEngineStage::Staging; });
+			bEngineThreadBusy = true;
+		}
+		
+		StageEngineLoop();
 	}
+}
+
+void FLiveLinkBridge::StageEngineLoop()
+{
+	// Note: Runs on the engine thread
 	
-	// Check if LiveLink provider is created
-	if (bLiveLinkSourceCreated && LiveLinkProvider.IsValid())
+	bool bEngineReady = false;
 	{
-		return ULL_OK;
+		FScopeLock EngineScope(&EngineLoopLock);
+		bEngineReady = InitializeEngineLoop();
 	}
 	
-	// Check if LiveLink framework is ready
-	if (bLiveLinkReady)
+	// Synchronous initializations waiting for the outcome go on from here
+	TArray<TWeakPtr<FLiveLinkBridge>> WaitingSessions;
 	{
-		return ULL_OK;
+		std::lock_guard<std::mutex> StagingScope(StagingLock);
+		EngineStage = bEngineReady ? EEngineStage::Ready : EEngineStage::NotStarted;
+		WaitingSessions = MoveTemp(StagingSessions);
+		StagingSessions.Reset();
+		StagingSignal.notify_all();
 	}
 	
-	return ULL_NOT_CONNECTED;
+	// Sessions shut down (and released) while staging are skipped
+	for (const TWeakPtr<FLiveLinkBridge>& WeakSession : WaitingSessions)
+	{
+		if (const TSharedPtr<FLiveLinkBridge> Session = WeakSession.Pin())
+		{
+			Session->CompleteStagedInitialize(bEngineReady);
+		}
+	}
 }
 
-//=============================================================================
-// Helper Methods
-//=============================================================================
+void FLiveLinkBridge::WaitForEngineThreadIdle()
+{
+	// Note: Caller must not hold CriticalSection (the engine thread takes it to complete sessions)
+	
+	std::unique_lock<std::mutex> StagingScope(StagingLock);
+	StagingSignal.wait(StagingScope, [] { return !bEngineThreadBusy && EngineStage != EEngineStage::Staging; });
+}
 
-void FLiveLinkBridge::EnsureLiveLinkSource()
+void FLiveLinkBridge::CompleteStagedInitialize(bool bEngineReady)
 {
-	// Note: Caller must hold CriticalSection lock
+	FScopeLock Lock(&CriticalSection);
 	
-	if (bLiveLinkSourceCreated)
+	// Shutdown clears the flag, so a session shut down while staging stays shut down
+	if (!bEngineStaging)
 	{
-		ULL_VERBOSE_LOG(TEXT("EnsureLiveLinkSource: Provider already exists, skipping"));
 		return;
 	}
 	
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("EnsureLiveLinkSource: Creating LiveLink Message Bus Provider '%s'"), 
-	       *ProviderName);
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("EnsureLiveLinkSource: Using UDP Message Bus for cross-process communication"));
-	
-	// Create LiveLink Message Bus Provider
-	// This enables communication between Simio process → UE process via UDP multicast
-	// Default protocol: UDP 230.0.0.1:6666
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("EnsureLiveLinkSource: Calling ILiveLinkProvider::CreateLiveLinkProvider..."));
-	
-	LiveLinkProvider = ILiveLinkProvider::CreateLiveLinkProvider(ProviderName);
-	
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("EnsureLiveLinkSource: CreateLiveLinkProvider returned, checking validity..."));
+	// Updates ingested without the lock join the latest-value slots while the session still coalesces.
+	// Producers go back to the locked path first; the write lock waits out those still ingesting.
+	// StartSession republishes the flag for the session's own mode.
+	if (bEngineReady)
+	{
+		bShardedIngest.store(false, std::memory_order_release);
+		{
+			FWriteScopeLock TableLock(SubjectTableLock);
+		}
+		DrainIngestShardsLocked();
+	}
+	bEngineStaging = false;
 	
-	if (!LiveLinkProvider.IsValid())
+	const double StagingSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StagingStartCycles);
+	if (!bEngineReady)
 	{
+		bStagingFailed = true;
+		DirtyTransformSlots.Reset();
+		DirtyDataSubjects.Reset();
+		PublishLifecycleStateLocked();
 		UE_LOG(LogUnrealLiveLinkNative, Error, 
-		       TEXT("EnsureLiveLinkSource: ❌ Failed to create ILiveLinkProvider"));
-		UE_LOG(LogUnrealLiveLinkNative, Error, 
-		       TEXT("EnsureLiveLinkSource: Check that UdpMessaging module is available"));
-		UE_LOG(LogUnrealLiveLinkNative, Error, 
-		       TEXT("EnsureLiveLinkSource: Check that GEngineLoop.PreInit() succeeded"));
+		       TEXT("Initialize: ❌ Staged engine runtime bring-up failed after %.2f s, '%s' drops updates until shut down"), 
+		       StagingSeconds, 
+		       *ProviderName);
 		return;
 	}
 	
-	bLiveLinkSourceCreated = true;
+	{
+		FScopeLock EngineScope(&EngineLoopLock);
+		StartSession(StagedOptions);
+	}
 	
-	// CRITICAL: Tick the core ticker to trigger Message Bus announcement
-	// Reference: UnrealLiveLinkCInterface calls FTSTicker::GetCoreTicker().Tick(1.0f) after CreateLiveLinkProvider
-	// This processes the Message Bus queue and broadcasts the provider for auto-discovery
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("EnsureLiveLinkSource: Ticking core ticker to trigger Message Bus announcement..."));
-	FTSTicker::GetCoreTicker().Tick(1.0f);
+	// Subjects registered while staging were only tracked locally
+	int32 RegisteredCount = 0;
+	if (bLiveLinkSourceCreated)
+	{
+		for (const FSubjectInfo& SubjectInfo : TransformSubjectTable)
+		{
+			if (SubjectInfo.bInUse && SubmitTransformStaticData(SubjectInfo.SubjectName, SubjectInfo.SchemaId))
+			{
+				RegisteredCount++;
+			}
+		}
+		for (const auto& Pair : DataSubjects)
+		{
+			if (SubmitDataStaticData(Pair.Key, Pair.Value.SchemaId))
+			{
+				RegisteredCount++;
+			}
+		}
+	}
+	
+	// Buffered updates are each subject's latest state: they go out now, stamped now
+	// (FPlatformTime was not calibrated when they arrived)
+	const double Now = FPlatformTime::Seconds();
+	const int32 BufferedCount = DirtyTransformSlots.Num() + DirtyDataSubjects.Num();
+	for (const int32 Slot : DirtyTransformSlots)
+	{
+		TransformSubjectTable[Slot].PendingWorldTime = Now;
+	}
+	for (const FName& SubjectName : DirtyDataSubjects)
+	{
+		if (FSubjectInfo* SubjectInfo = DataSubjects.Find(SubjectName))
+		{
+			SubjectInfo->PendingWorldTime = Now;
+		}
+	}
+	bSimTimeAnchored = false;
+	PublishPendingFramesLocked();
 	
 	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("EnsureLiveLinkSource: ✅ SUCCESS! LiveLink Message Bus Provider created"));
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("EnsureLiveLinkSource: Broadcasting to UDP Message Bus (230.0.0.1:6666)"));
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("EnsureLiveLinkSource: Check Unreal Editor → Window → LiveLink for source '%s'"), 
-	       *ProviderName);
+	       TEXT("Initialize: ✅ Staged initialization of '%s' complete after %.2f s (%d subjects registered, %d buffered updates published)"), 
+	       *ProviderName, 
+	       StagingSeconds, 
+	       RegisteredCount, 
+	       BufferedCount);
 }
 
-//=============================================================================
-// Transform Subjects
-//=============================================================================
-
-void FLiveLinkBridge::RegisterTransformSubject(const FName& SubjectName)
+int FLiveLinkBridge::GetInitState() const
 {
 	FScopeLock Lock(&CriticalSection);
 	
 	if (!bInitialized)
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Warning, 
-		       TEXT("RegisterTransformSubject: Not initialized, ignoring '%s'"), 
-		       *SubjectName.ToString());
-		return;
+		return ULL_NOT_INITIALIZED;
+	}
+	if (bEngineStaging)
+	{
+		return ULL_INIT_STATE_STAGING;
+	}
+	return bStagingFailed ? ULL_INIT_STATE_FAILED : ULL_INIT_STATE_READY;
+}
+
+void FLiveLinkBridge::Shutdown()
+{
+	// A staged initialization may still complete on the engine thread, which starts the
+	// publisher: settle that under the lock first (it does nothing once the flag is clear)
+	// Producers go back to the locked path before the tables are torn down
+	bool bWasStaging = false;
+	{
+		FScopeLock Lock(&CriticalSection);
+		bWasStaging = bEngineStaging;
+		bEngineStaging = false;
+		bShardedIngest.store(false, std::memory_order_release);
 	}
 	
-	if (TransformSubjects.Contains(SubjectName))
+	// Join point for a shutdown while staging: the bring-up can take seconds, and the host
+	// may unload the DLL once this returns, so the engine thread must be parked by then
+	if (bWasStaging)
 	{
 		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("RegisterTransformSubject: '%s' already registered"), 
-		       *SubjectName.ToString());
-		return;
+		       TEXT("Shutdown: Waiting for the staged engine runtime bring-up to finish"));
+		WaitForEngineThreadIdle();
 	}
 	
-	// Ensure LiveLink source exists (create on first registration)
-	EnsureLiveLinkSource();
+	// Stop the publish thread before taking the lock - its pass takes the lock itself.
+	// Initialize/Shutdown are main-thread only and staging is settled, so Publisher cannot
+	// change underneath us.
+	if (Publisher.IsValid())
+	{
+		Publisher->StopAndJoin();
+	}
 	
-	if (!bLiveLinkSourceCreated)
+	// The probe thread sends through the update path, which takes the lock
+	if (LatencyProbeThread.IsValid())
+	{
+		LatencyProbeThread->StopAndJoin();
+	}
+	
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
 	{
 		UE_LOG(LogUnrealLiveLinkNative, Warning, 
-		       TEXT("RegisterTransformSubject: LiveLink source not available, cannot register '%s'"), 
-		       *SubjectName.ToString());
-		// Still track locally for later retry
-		TransformSubjects.Add(SubjectName, FSubjectInfo());
+		       TEXT("Shutdown: Not initialized, nothing to do"));
 		return;
 	}
 	
+	// The probe subject is removed with the others below
+	LatencyProbeThread.Reset();
+	LatencyProbe.Stop();
+	LatencyProbeHandle = ULL_ERROR;
+	
 	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("RegisterTransformSubject: Registering '%s' (no properties)"), 
-	       *SubjectName.ToString());
+	       TEXT("Shutdown: Clearing %d transform subjects, %d data subjects, %d cached names"), 
+	       TransformSubjects.Num(), 
+	       DataSubjects.Num(), 
+	       NameCache.Num());
 	
-	// Create static data (structure definition - sent once per subject)
-	FLiveLinkStaticDataStruct StaticData(FLiveLinkTransformStaticData::StaticStruct());
-	FLiveLinkTransformStaticData* TransformStaticData = StaticData.Cast<FLiveLinkTransformStaticData>();
+	// Coalescing mode: send the final positions before the queue is flushed.
+	// The final pass ignores rate tiers and the budget so every subject ends at its last value.
+	if (Publisher.IsValid())
+	{
+		if (bRateTiersUsed || PublishFrameBudget > 0 || PublishByteBudget > 0)
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Log, 
+			       TEXT("Shutdown: Rate tiers held back %llu frames for their interval, budget deferred %llu frames"), 
+			       RateDeferredCount, 
+			       BudgetDeferredCount);
+		}
+		bRateTiersUsed = false;
+		PublishFrameBudget = 0;
+		PublishByteBudget = 0;
+		
+		PublishPendingFramesLocked();
+		
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("Shutdown: Publish pass sent %llu frames, coalesced %llu updates"), 
+		       PublishedFrameCount, 
+		       CoalescedFrameCount);
+		
+		Publisher.Reset();
+	}
+	PublishRateHz = 0;
+	bSimTimeAnchored = false;
+	DirtyTransformSlots.Empty();
+	DirtyDataSubjects.Empty();
+	PublishedFrameCount = 0;
+	CoalescedFrameCount = 0;
+	bRateTiersUsed = false;
+	PublishFrameBudget = 0;
+	PublishByteBudget = 0;
+	FrameBudgetTokens = 0.0;
+	ByteBudgetTokens = 0.0;
+	BudgetDeferredCount = 0;
+	RateDeferredCount = 0;
+	PublishCandidates.Empty();
+	RetainedTransformSlots.Empty();
+	RetainedDataSubjects.Empty();
 	
-	if (!TransformStaticData)
+	if (bDeadbandEnabled)
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Error, 
-		       TEXT("RegisterTransformSubject: Failed to cast static data for '%s'"), 
-		       *SubjectName.ToString());
-		return;
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("Shutdown: Deadband sent %llu frames (%llu keep-alive), suppressed %llu"), 
+		       DeadbandSentCount, 
+		       DeadbandKeepAliveCount, 
+		       DeadbandSuppressedCount);
 	}
+	bDeadbandEnabled = false;
+	DeadbandSentCount = 0;
+	DeadbandSuppressedCount = 0;
+	DeadbandKeepAliveCount = 0;
 	
-	// No properties for basic transform subject
-	TransformStaticData->PropertyNames.Empty();
+	if (InterestRegions.Num() > 0 || InterestHeldCount > 0)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("Shutdown: Interest regions held %llu updates outside %d regions, sent %llu at the outside rate (%d grid cells)"), 
+		       InterestHeldCount, 
+		       InterestRegions.Num(), 
+		       InterestOutsideSentCount, 
+		       InterestGrid.Num());
+	}
+	InterestRegions.Empty();
+	InterestOutsideInterval = 0.0;
+	InterestGrid.Empty();
+	InterestHeldCount = 0;
+	InterestOutsideSentCount = 0;
+	
+	if (SubjectPoolSize > 0)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("Shutdown: Subject pool bound %llu entities to %d pooled subjects in %d pools"), 
+		       PoolAcquireCount, 
+		       TransformSubjectTable.Num(), 
+		       SubjectPools.Num());
+	}
+	SubjectPoolSize = 0;
+	SubjectPools.Empty();
+	PoolPropertyScratch.Empty();
+	PoolAcquireCount = 0;
 	
-	// Push static data to LiveLink via Message Bus Provider
 	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("RegisterTransformSubject: Broadcasting static data via Message Bus..."));
+	       TEXT("Shutdown: Clearing %d property schemas"), 
+	       PropertySchemas.Num());
+	PropertySchemas.Empty();
+	PropertySchemaBuckets.Empty();
 	
-	LiveLinkProvider->UpdateSubjectStaticData(
-		SubjectName,
-		ULiveLinkTransformRole::StaticClass(),
-		MoveTemp(StaticData));
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("Shutdown: Stats - transform updates %llu received / %llu sent, data updates %llu received / %llu sent, %llu contended locks"), 
+	       Stats.TransformUpdatesReceived.load(), 
+	       Stats.TransformUpdatesSent.load(), 
+	       Stats.DataUpdatesReceived.load(), 
+	       Stats.DataUpdatesSent.load(), 
+	       Stats.LockContentions.load());
 	
-	// Track locally
-	TransformSubjects.Add(SubjectName, FSubjectInfo());
+	// Readers see the closed state and remove the shared-memory subjects
+	if (SharedMemory.IsValid())
+	{
+		SharedMemory->Close();
+		SharedMemory.Reset();
+	}
 	
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("RegisterTransformSubject: ✅ Successfully registered '%s' via Message Bus"), 
-	       *SubjectName.ToString());
+	// Flush queued frames and stop the sender thread before the provider goes away
+	if (Sender.IsValid())
+	{
+		Sender->StopAndFlush();
+		Sender.Reset();
+	}
+	
+	// The capture is closed once the sender has recorded its last queued record
+	Recorder.Stop();
+	
+	// The replay thread sends through the provider (it never takes CriticalSection)
+	if (Replayer.IsValid())
+	{
+		Replayer->StopAndJoin();
+		Replayer.Reset();
+	}
+	
+	// Remove LiveLink provider if created
+	if (bLiveLinkSourceCreated && LiveLinkProvider.IsValid())
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("Shutdown: Removing LiveLink Message Bus Provider '%s'"), 
+		       *ProviderName);
+		
+		// Reset shared pointer (will trigger cleanup)
+		LiveLinkProvider.Reset();
+		bLiveLinkSourceCreated = false;
+		
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("Shutdown: ✅ LiveLink provider removed successfully"));
+	}
+	
+	// Leave the pump last so provider teardown messages are still pumped
+	// (the pump never takes CriticalSection, so joining here cannot deadlock)
+	if (bPumpAcquired)
+	{
+		ReleasePump();
+		bPumpAcquired = false;
+	}
+	
+	// Clear all state (outstanding handles become invalid)
+	{
+		FWriteScopeLock TableLock(SubjectTableLock);
+		TransformSubjects.Empty();
+		TransformSubjectTable.Empty();
+		for (FIngestShard& Shard : IngestShards)
+		{
+			FScopeLock ShardLock(&Shard.Lock);
+			Shard.DirtySlots.Empty();
+			Shard.CoalescedCount = 0;
+		}
+	}
+	FreeTransformSubjectSlots.Empty();
+	DataSubjects.Empty();
+	NameCache.Empty();
+	NameCache.ResetCounters();
+	Stats.Reset();
+	ProviderName.Empty();
+	bInitialized = false;
+	bLiveLinkReady = false;
+	bStagingFailed = false;
+	PublishLifecycleStateLocked();
+	
+	if (this == GetDefaultSession().Get())
+	{
+		ReleaseDefaultProviderName();
+	}
+	
+	// DO NOT shutdown GEngineLoop in DLL!
+	// WARNING: RequestEngineExit() and AppExit() terminate the HOST PROCESS (Simio.exe)!
+	// This is only safe in standalone programs, not DLLs loaded by other applications.
+	UE_LOG(LogUnrealLiveLinkNative, Log, TEXT("Shutdown: Skipping GEngineLoop shutdown (DLL loaded in host process)"));
+	
+	// DON'T CALL THESE IN A DLL:
+	// RequestEngineExit(TEXT("UnrealLiveLinkNative shutting down"));  // ← Terminates Simio!
+	// FEngineLoop::AppPreExit();  // ← Unsafe in DLL
+	// FModuleManager::Get().UnloadModulesAtShutdown();  // ← May crash host
+	// FEngineLoop::AppExit();  // ← Terminates host process!
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, TEXT("Shutdown: Complete (resources released, modules remain loaded)"));
 }
 
-void FLiveLinkBridge::RegisterTransformSubjectWithProperties(
-	const FName& SubjectName, 
-	const TArray<FName>& PropertyNames)
+int FLiveLinkBridge::GetPumpStats(ULL_PumpStats& OutStats) const
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	FMemory::Memzero(&OutStats, sizeof(OutStats));
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	// The pump is shared by every session that enabled it
+	FScopeLock PumpScope(&PumpLock);
+	if (Pump.IsValid())
+	{
+		OutStats.tickCount = Pump->GetTickCount();
+		OutStats.overrunCount = Pump->GetOverrunCount();
+		OutStats.lastTickMs = Pump->GetLastTickSeconds() * 1000.0;
+		OutStats.maxTickMs = Pump->GetMaxTickSeconds() * 1000.0;
+		OutStats.averageTickMs = Pump->GetAverageTickSeconds() * 1000.0;
+		OutStats.rateHz = Pump->GetRateHz();
+		OutStats.running = 1;
+	}
+	
+	return ULL_OK;
+}
+
+//=============================================================================
+// Capture and Replay
+//=============================================================================
+
+int FLiveLinkBridge::StartCapture(const FString& FilePath)
 {
 	FScopeLock Lock(&CriticalSection);
 	
 	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	// Shared-memory frames never reach the provider, so there is nothing to record
+	if (SharedMemory.IsValid())
 	{
 		UE_LOG(LogUnrealLiveLinkNative, Warning, 
-		       TEXT("RegisterTransformSubjectWithProperties: Not initialized, ignoring '%s'"), 
-		       *SubjectName.ToString());
-		return;
+		       TEXT("StartCapture: Not supported with the shared-memory transport"));
+		return ULL_ERROR;
+	}
+	
+	// Subjects the provider already has, so the capture replays without the registrations it missed
+	TArray<FLiveLinkCaptureSubject> ExistingSubjects;
+	if (bLiveLinkSourceCreated)
+	{
+		for (const FSubjectInfo& SubjectInfo : TransformSubjectTable)
+		{
+			// Hidden pooled subjects stay registered with LiveLink
+			if (!SubjectInfo.bInUse && SubjectInfo.PoolIndex == INDEX_NONE)
+			{
+				continue;
+			}
+			
+			FLiveLinkCaptureSubject& Subject = ExistingSubjects.AddDefaulted_GetRef();
+			Subject.SubjectName = SubjectInfo.SubjectName;
+			Subject.bTransformRole = true;
+			Subject.PropertyNames = PropertySchemas[SubjectInfo.SchemaId].PropertyNames;
+			if (SubjectInfo.PoolIndex != INDEX_NONE)
+			{
+				Subject.PropertyNames.Add(FName(ULL_POOL_VISIBLE_PROPERTY));
+			}
+		}
+		
+		for (const auto& Pair : DataSubjects)
+		{
+			FLiveLinkCaptureSubject& Subject = ExistingSubjects.AddDefaulted_GetRef();
+			Subject.SubjectName = Pair.Key;
+			Subject.bTransformRole = false;
+			Subject.PropertyNames = PropertySchemas[Pair.Value.SchemaId].PropertyNames;
+		}
+	}
+	
+	if (!Recorder.Start(FilePath, ExistingSubjects))
+	{
+		return ULL_ERROR;
+	}
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("StartCapture: ✅ Recording %s-mode frames to '%s'"), 
+	       Sender.IsValid() ? TEXT("async") : TEXT("sync"), 
+	       *FilePath);
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::StopCapture()
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	// Async mode: frames still queued in the sender when the capture stops are not recorded
+	Recorder.Stop();
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::StartReplay(const FString& FilePath, double Speed, bool bLoop)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	if (Replayer.IsValid())
+	{
+		Replayer->StopAndJoin();
+		Replayer.Reset();
+	}
+	
+	EnsureLiveLinkSource();
+	if (!bLiveLinkSourceCreated)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("StartReplay: LiveLink source not available, cannot replay '%s'"), 
+		       *FilePath);
+		return ULL_NOT_CONNECTED;
+	}
+	
+	TUniquePtr<FLiveLinkReplayer> NewReplayer = MakeUnique<FLiveLinkReplayer>(LiveLinkProvider);
+	if (!NewReplayer->Load(FilePath) || !NewReplayer->Start(Speed, bLoop))
+	{
+		return ULL_ERROR;
+	}
+	
+	Replayer = MoveTemp(NewReplayer);
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::SetReplaySpeed(double Speed)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	if (!Replayer.IsValid())
+	{
+		return ULL_ERROR;
+	}
+	
+	Replayer->SetSpeed(Speed);
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::SeekReplay(double Seconds)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	if (!Replayer.IsValid())
+	{
+		return ULL_ERROR;
+	}
+	
+	Replayer->Seek(Seconds);
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::StopReplay()
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	// The replay thread never takes CriticalSection, so joining here cannot deadlock
+	if (Replayer.IsValid())
+	{
+		Replayer->StopAndJoin();
+		Replayer.Reset();
+	}
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::GetReplayStatus(double& OutPositionSeconds, double& OutDurationSeconds) const
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	OutPositionSeconds = 0.0;
+	OutDurationSeconds = 0.0;
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	if (!Replayer.IsValid())
+	{
+		return ULL_ERROR;
+	}
+	
+	OutPositionSeconds = Replayer->GetPosition();
+	OutDurationSeconds = Replayer->GetDuration();
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::GetReplayFrame(const FName& SubjectName, FTransform& OutTransform, TArray<float>& OutPropertyValues) const
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	if (!Replayer.IsValid() || !Replayer->GetSentFrame(SubjectName, OutTransform, OutPropertyValues))
+	{
+		return ULL_ERROR;
+	}
+	return ULL_OK;
+}
+
+//=============================================================================
+// Latency Probe
+//=============================================================================
+// The probe subject goes through UpdateTransformSubjectByHandle like any model
+// subject, so its stages include the same lock waits, coalescing and queueing.
+// Its frames are counted in ULL_GetStats and it is listed with the other
+// subjects in Unreal's LiveLink panel while the probe runs.
+//=============================================================================
+
+int FLiveLinkBridge::StartLatencyProbe(int32 RateHz, int32 EchoPort, const FString& CsvPath)
+{
+	if (RateHz < 1 || RateHz > ULL_LATENCY_MAX_RATE_HZ || EchoPort < 0 || EchoPort > 65535)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("StartLatencyProbe: Invalid rate %d Hz (1-%d) or echo port %d"), 
+		       RateHz, 
+		       ULL_LATENCY_MAX_RATE_HZ, 
+		       EchoPort);
+		return ULL_ERROR;
+	}
+	
+	// A running probe is replaced: its thread calls into the bridge, so it is joined without the lock
+	int Status = StopLatencyProbe();
+	if (Status != ULL_OK)
+	{
+		return Status;
+	}
+	
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	// Pooled subjects are sent under the pool's names and shared-memory frames never reach the
+	// provider, so the Unreal side could not find the probe
+	if (SubjectPoolSize > 0 || SharedMemory.IsValid())
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("StartLatencyProbe: Not supported with subject pools or the shared-memory transport"));
+		return ULL_ERROR;
+	}
+	
+	if (!LatencyProbe.Start(EchoPort, CsvPath))
+	{
+		return ULL_ERROR;
+	}
+	
+	LatencyProbeHandle = RegisterTransformSubjectLocked(LatencyProbe.GetSubjectName(), FindOrAddPropertySchema(TArray<FName>()));
+	if (LatencyProbeHandle < 0)
+	{
+		LatencyProbe.Stop();
+		return ULL_ERROR;
+	}
+	
+	LatencyProbeThread = MakeUnique<FLiveLinkTickThread>(TEXT("UnrealLiveLinkLatencyProbe"), RateHz, [this](double) { SendLatencyProbe(); });
+	if (!LatencyProbeThread->Start())
+	{
+		LatencyProbeThread.Reset();
+		StopLatencyProbeLocked();
+		return ULL_ERROR;
+	}
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("StartLatencyProbe: ✅ %d probes per second (handle %d)"), 
+	       RateHz, 
+	       LatencyProbeHandle);
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::StopLatencyProbe()
+{
+	TUniquePtr<FLiveLinkTickThread> ProbeThread;
+	{
+		FScopeLock Lock(&CriticalSection);
+		
+		if (!bInitialized)
+		{
+			return ULL_NOT_INITIALIZED;
+		}
+		ProbeThread = MoveTemp(LatencyProbeThread);
+	}
+	
+	// The probe thread takes the lock for each probe
+	if (ProbeThread.IsValid())
+	{
+		ProbeThread->StopAndJoin();
+	}
+	
+	FScopeLock Lock(&CriticalSection);
+	StopLatencyProbeLocked();
+	return ULL_OK;
+}
+
+void FLiveLinkBridge::StopLatencyProbeLocked()
+{
+	// Note: Caller must hold CriticalSection lock and have joined LatencyProbeThread
+	
+	LatencyProbe.Stop();
+	if (LatencyProbeHandle >= 0)
+	{
+		RemoveTransformSubjectByHandle(LatencyProbeHandle);
+		LatencyProbeHandle = ULL_ERROR;
+	}
+}
+
+void FLiveLinkBridge::SendLatencyProbe()
+{
+	// Same entry point as ULL_UpdateObjectH
+	const FTransform ProbeTransform = LatencyProbe.BeginProbe();
+	UpdateTransformSubjectByHandle(LatencyProbeHandle, ProbeTransform);
+	LatencyProbe.Poll();
+}
+
+int FLiveLinkBridge::GetLatencyStats(ULL_LatencyStats& OutStats) const
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	FMemory::Memzero(&OutStats, sizeof(OutStats));
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	// Kept after the probe stops, until it is started again
+	LatencyProbe.GetStats(OutStats);
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::GetStats(ULL_Stats& OutStats) const
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	FMemory::Memzero(&OutStats, sizeof(OutStats));
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	Stats.Fill(OutStats);
+	
+	OutStats.coalescedUpdates = CoalescedFrameCount;
+	OutStats.deadbandSuppressed = DeadbandSuppressedCount;
+	OutStats.queueDropped = Sender.IsValid() ? Sender->GetDroppedCount() : 0;
+	
+	OutStats.nameCacheHits = NameCache.GetHitCount();
+	OutStats.nameCacheMisses = NameCache.GetMissCount();
+	OutStats.nameCacheEntries = NameCache.Num();
+	
+	OutStats.registeredTransformSubjects = TransformSubjects.Num();
+	OutStats.registeredDataSubjects = DataSubjects.Num();
+	
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::ResetStats()
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	Stats.Reset();
+	NameCache.ResetCounters();
+	if (Sender.IsValid())
+	{
+		Sender->ResetDroppedCount();
+	}
+	CoalescedFrameCount = 0;
+	PublishedFrameCount = 0;
+	DeadbandSentCount = 0;
+	DeadbandSuppressedCount = 0;
+	DeadbandKeepAliveCount = 0;
+	InterestHeldCount = 0;
+	InterestOutsideSentCount = 0;
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, TEXT("ResetStats: Counters cleared"));
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::GetConnectionStatus() const
+{
+	// Lock-free: mirrored from the lifecycle flags whenever they change
+	return ConnectionState.load(std::memory_order_acquire);
+}
+
+void FLiveLinkBridge::PublishLifecycleStateLocked()
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	int32 State = ULL_NOT_CONNECTED;
+	if (!bInitialized)
+	{
+		State = ULL_NOT_INITIALIZED;
+	}
+	else if ((bLiveLinkSourceCreated && LiveLinkProvider.IsValid()) || bLiveLinkReady)
+	{
+		// Provider created, or LiveLink framework ready
+		State = ULL_OK;
+	}
+	ConnectionState.store(State, std::memory_order_release);
+	
+	// Shared memory is already latest-value per slot and writes straight to the table
+	bShardedIngest.store(bInitialized && IsCoalescingMode() && !SharedMemory.IsValid(), std::memory_order_release);
+}
+
+//=============================================================================
+// Helper Methods
+//=============================================================================
+
+void FLiveLinkBridge::EnsureLiveLinkSource()
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	if (bLiveLinkSourceCreated)
+	{
+		ULL_VERBOSE_LOG(TEXT("EnsureLiveLinkSource: Provider already exists, skipping"));
+		return;
+	}
+	
+	// Staged initialization: the provider is created once the runtime is up
+	if (bEngineStaging)
+	{
+		return;
+	}
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("EnsureLiveLinkSource: Creating LiveLink Message Bus Provider '%s'"), 
+	       *ProviderName);
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("EnsureLiveLinkSource: Using UDP Message Bus for cross-process communication"));
+	
+	// Create LiveLink Message Bus Provider
+	// This enables communication between Simio process → UE process via UDP multicast
+	// Default protocol: UDP 230.0.0.1:6666
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("EnsureLiveLinkSource: Calling ILiveLinkProvider::CreateLiveLinkProvider..."));
+	
+	LiveLinkProvider = ILiveLinkProvider::CreateLiveLinkProvider(ProviderName);
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("EnsureLiveLinkSource: CreateLiveLinkProvider returned, checking validity..."));
+	
+	if (!LiveLinkProvider.IsValid())
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("EnsureLiveLinkSource: ❌ Failed to create ILiveLinkProvider"));
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("EnsureLiveLinkSource: Check that UdpMessaging module is available"));
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("EnsureLiveLinkSource: Check that GEngineLoop.PreInit() succeeded"));
+		return;
+	}
+	
+	bLiveLinkSourceCreated = true;
+	PublishLifecycleStateLocked();
+	
+	if (Sender.IsValid())
+	{
+		Sender->SetProvider(LiveLinkProvider);
+	}
+	
+	// CRITICAL: Tick the core ticker to trigger Message Bus announcement
+	// Reference: UnrealLiveLinkCInterface calls FTSTicker::GetCoreTicker().Tick(1.0f) after CreateLiveLinkProvider
+	// This processes the Message Bus queue and broadcasts the provider for auto-discovery
+	// With the pump thread running (provider re-created after a failed first attempt) the
+	// pump's next tick does this; ticking here too would tick FTSTicker from two threads
+	// (another session's pump counts; PumpLock also keeps two sessions' one-shot ticks apart)
+	{
+		FScopeLock PumpScope(&PumpLock);
+		if (!Pump.IsValid())
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Log, 
+			       TEXT("EnsureLiveLinkSource: Ticking core ticker to trigger Message Bus announcement..."));
+			FTSTicker::GetCoreTicker().Tick(1.0f);
+		}
+	}
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("EnsureLiveLinkSource: ✅ SUCCESS! LiveLink Message Bus Provider created"));
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("EnsureLiveLinkSource: Broadcasting to UDP Message Bus (230.0.0.1:6666)"));
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("EnsureLiveLinkSource: Check Unreal Editor → Window → LiveLink for source '%s'"), 
+	       *ProviderName);
+}
+
+void FLiveLinkBridge::PumpMessageBus(double DeltaSeconds)
+{
+	// Note: Runs on the pump thread. Must not take CriticalSection (Shutdown joins
+	// the pump while holding it).
+	//
+	// Only FTSTicker is pumped. The task graph's game-thread queue can only be
+	// processed by the thread that ran GEngineLoop.PreInit (the host's thread),
+	// and Message Bus/UdpMessaging do their transport work on their own threads
+	// plus core ticker delegates.
+	FTSTicker::GetCoreTicker().Tick((float)DeltaSeconds);
+}
+
+//=============================================================================
+// Transform Subjects
+//=============================================================================
+
+int32 FLiveLinkBridge::RegisterTransformSubject(const FName& SubjectName)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("RegisterTransformSubject: Not initialized, ignoring '%s'"), 
+		       *SubjectName.ToString());
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	return RegisterTransformSubjectLocked(SubjectName, FindOrAddPropertySchema(TArray<FName>()));
+}
+
+int32 FLiveLinkBridge::RegisterTransformSubjectWithProperties(
+	const FName& SubjectName, 
+	const TArray<FName>& PropertyNames)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("RegisterTransformSubjectWithProperties: Not initialized, ignoring '%s'"), 
+		       *SubjectName.ToString());
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	return RegisterTransformSubjectLocked(SubjectName, FindOrAddPropertySchema(PropertyNames));
+}
+
+int32 FLiveLinkBridge::RegisterTransformSubjectWithSchema(const FName& SubjectName, int32 SchemaId)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("RegisterTransformSubjectWithSchema: Not initialized, ignoring '%s'"), 
+		       *SubjectName.ToString());
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	if (!PropertySchemas.IsValidIndex(SchemaId))
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("RegisterTransformSubjectWithSchema: Unknown schema %d for '%s'"), 
+		       SchemaId, 
+		       *SubjectName.ToString());
+		return ULL_ERROR;
+	}
+	
+	return RegisterTransformSubjectLocked(SubjectName, SchemaId);
+}
+
+int32 FLiveLinkBridge::RegisterTransformSubjectsBatch(
+	const TArray<FName>& SubjectNames, 
+	const int32* SchemaIds, 
+	int32* OutHandles)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("RegisterTransformSubjectsBatch: Not initialized, ignoring %d subjects"), 
+		       SubjectNames.Num());
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	// One source check and one schema lookup for the whole batch; per-subject
+	// logging stays behind ULL_HOT_LOG inside RegisterTransformSubjectLocked.
+	// In async mode the static data is queued to the sender thread, so this
+	// pass is bookkeeping only.
+	EnsureLiveLinkSource();
+	const int32 EmptySchemaId = SchemaIds ? INDEX_NONE : FindOrAddPropertySchema(TArray<FName>());
+	
+	int32 RegisteredCount = 0;
+	int32 FailedCount = 0;
+	
+	for (int32 i = 0; i < SubjectNames.Num(); ++i)
+	{
+		const int32 SchemaId = SchemaIds ? SchemaIds[i] : EmptySchemaId;
+		
+		if (SubjectNames[i].IsNone() || !PropertySchemas.IsValidIndex(SchemaId))
+		{
+			OutHandles[i] = ULL_ERROR;
+			++FailedCount;
+			continue;
+		}
+		
+		OutHandles[i] = RegisterTransformSubjectLocked(SubjectNames[i], SchemaId);
+		if (OutHandles[i] >= 0)
+		{
+			++RegisteredCount;
+		}
+		else
+		{
+			++FailedCount;
+		}
+	}
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("RegisterTransformSubjectsBatch: Registered %d of %d subjects (%d failed, %s)"), 
+	       RegisteredCount, 
+	       SubjectNames.Num(), 
+	       FailedCount, 
+	       Sender.IsValid() ? TEXT("static data queued to sender") : TEXT("static data sent inline"));
+	
+	return RegisteredCount;
+}
+
+int32 FLiveLinkBridge::RegisterTransformSubjectLocked(const FName& SubjectName, int32 SchemaId)
+{
+	// Note: Caller must hold CriticalSection lock and have checked bInitialized and SchemaId
+	
+	if (const int32* ExistingHandle = TransformSubjects.Find(SubjectName))
+	{
+		ULL_HOT_LOG(Log,
+		            TEXT("RegisterTransformSubject: '%s' already registered"),
+		            *SubjectName.ToString());
+		return *ExistingHandle;
+	}
+	
+	// Ensure LiveLink source exists (create on first registration)
+	EnsureLiveLinkSource();
+	
+	// Pool mode: bind to a pre-registered subject of this schema, no static data for this entity
+	if (SubjectPoolSize > 0 && CanSendTransforms())
+	{
+		return AcquirePooledSubject(SubjectName, SchemaId);
+	}
+	
+	// Shared-memory transport: the slot is the registration, no static data goes over the Message Bus
+	if (SharedMemory.IsValid())
+	{
+		const int32 Handle = AddTransformSubjectSlot(SubjectName, SchemaId);
+		ULL_HOT_LOG(Log,
+		            TEXT("RegisterTransformSubject: ✅ Registered '%s' in shared memory (schema %d, handle %d)"),
+		            *SubjectName.ToString(),
+		            SchemaId,
+		            Handle);
+		return Handle;
+	}
+	
+	// Staged initialization: static data goes out once the runtime is up
+	if (bEngineStaging)
+	{
+		return AddTransformSubjectSlot(SubjectName, SchemaId);
+	}
+	
+	if (!bLiveLinkSourceCreated)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("RegisterTransformSubject: LiveLink source not available, cannot register '%s'"), 
+		       *SubjectName.ToString());
+		// Still track locally for later retry
+		return AddTransformSubjectSlot(SubjectName, SchemaId);
+	}
+	
+	// Push static data to LiveLink via Message Bus Provider
+	if (!SubmitTransformStaticData(SubjectName, SchemaId))
+	{
+		return ULL_ERROR;
+	}
+	
+	// Track locally
+	const int32 Handle = AddTransformSubjectSlot(SubjectName, SchemaId);
+	
+	ULL_HOT_LOG(Log,
+	            TEXT("RegisterTransformSubject: ✅ Registered '%s' via Message Bus (schema %d, %d properties, handle %d)"),
+	            *SubjectName.ToString(),
+	            SchemaId,
+	            PropertySchemas[SchemaId].PropertyNames.Num(),
+	            Handle);
+	
+	return Handle;
+}
+
+//=============================================================================
+// Property Schemas
+//=============================================================================
+// Interned property name lists shared by every subject registered with the same
+// names. Subjects store the schema ID and its property count, so registration
+// and the update-time count check never touch the names themselves.
+//=============================================================================
+
+static uint32 GetPropertySchemaHash(const TArray<FName>& PropertyNames)
+{
+	uint32 Hash = GetTypeHash(PropertyNames.Num());
+	for (const FName& PropertyName : PropertyNames)
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(PropertyName));
+	}
+	return Hash;
+}
+
+int32 FLiveLinkBridge::RegisterPropertySchema(const TArray<FName>& PropertyNames)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("RegisterPropertySchema: Not initialized, ignoring %d properties"), 
+		       PropertyNames.Num());
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	return FindOrAddPropertySchema(PropertyNames);
+}
+
+int32 FLiveLinkBridge::FindOrAddPropertySchema(const TArray<FName>& PropertyNames)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	const uint32 Hash = GetPropertySchemaHash(PropertyNames);
+	const int32* FirstSchemaId = PropertySchemaBuckets.Find(Hash);
+	for (int32 SchemaId = FirstSchemaId ? *FirstSchemaId : INDEX_NONE; SchemaId != INDEX_NONE; SchemaId = PropertySchemas[SchemaId].NextInBucket)
+	{
+		if (PropertySchemas[SchemaId].PropertyNames == PropertyNames)
+		{
+			return SchemaId;
+		}
+	}
+	
+	const int32 SchemaId = PropertySchemas.AddDefaulted();
+	FPropertySchema& Schema = PropertySchemas[SchemaId];
+	Schema.PropertyNames = PropertyNames;
+	Schema.NextInBucket = FirstSchemaId ? *FirstSchemaId : INDEX_NONE;
+	PropertySchemaBuckets.Add(Hash, SchemaId);
+	
+	// Logged once per distinct layout instead of once per subject
+	TArray<FString> NameStrings;
+	NameStrings.Reserve(PropertyNames.Num());
+	for (const FName& PropertyName : PropertyNames)
+	{
+		NameStrings.Add(PropertyName.ToString());
+	}
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("FindOrAddPropertySchema: Schema %d = [%s]"), 
+	       SchemaId, 
+	       *FString::Join(NameStrings, TEXT(", ")));
+	
+	return SchemaId;
+}
+
+void FLiveLinkBridge::UpdateTransformSubject(
+	const FName& SubjectName, 
+	const FTransform& Transform)
+{
+	if (TryIngestTransformByName(SubjectName, Transform, nullptr, 0))
+	{
+		return;
+	}
+	
+	FLiveLinkTimedScopeLock Lock(CriticalSection, Stats);
+	FLiveLinkStats::Add(Stats.TransformUpdatesReceived, 1);
+	
+	if (!bInitialized)
+	{
+		// Throttle logging for high-frequency updates
+		ULL_HOT_LOG_THROTTLED(NotInitializedCount, Warning,
+		                      TEXT("UpdateTransformSubject: Not initialized (count: %d)"),
+		                      NotInitializedCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, 1);
+		return;
+	}
+	
+	// Auto-register if not already registered (matches mock behavior)
+	if (!FindTransformSubject(SubjectName))
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("UpdateTransformSubject: Auto-registering '%s'"), 
+		       *SubjectName.ToString());
+		
+		RegisterTransformSubject(SubjectName);
+	}
+	
+	// Check if LiveLink source available
+	if (!CanSendTransforms())
+	{
+		// Throttle warning
+		ULL_HOT_LOG_THROTTLED(NoSourceCount, Warning,
+		                      TEXT("UpdateTransformSubject: LiveLink source not available (count: %d)"),
+		                      NoSourceCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, 1);
+		return;
+	}
+	
+	// Push frame data to LiveLink via Message Bus Provider
+	if (!SubmitTransformFrame(FindTransformSubject(SubjectName), SubjectName, Transform, nullptr, 0, FPlatformTime::Seconds()))
+	{
+		return;
+	}
+	
+	// Throttle success logging for high-frequency updates
+	ULL_HOT_LOG_THROTTLED(UpdateCount, Log,
+	                      TEXT("UpdateTransformSubject: '%s' (count: %d) - Location: (%.2f, %.2f, %.2f) [Message Bus]"),
+	                      *SubjectName.ToString(),
+	                      UpdateCount,
+	                      Transform.GetLocation().X, Transform.GetLocation().Y, Transform.GetLocation().Z);
+}
+
+void FLiveLinkBridge::UpdateTransformSubjectWithProperties(
+	const FName& SubjectName, 
+	const FTransform& Transform, 
+	const float* PropertyValues, 
+	int32 PropertyCount)
+{
+	if (TryIngestTransformByName(SubjectName, Transform, PropertyValues, PropertyCount))
+	{
+		return;
+	}
+	
+	FLiveLinkTimedScopeLock Lock(CriticalSection, Stats);
+	FLiveLinkStats::Add(Stats.TransformUpdatesReceived, 1);
+	
+	if (!bInitialized)
+	{
+		ULL_HOT_LOG_THROTTLED(NotInitializedCount, Warning,
+		                      TEXT("UpdateTransformSubjectWithProperties: Not initialized (count: %d)"),
+		                      NotInitializedCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, 1);
+		return;
+	}
+	
+	// Validate property count
+	FSubjectInfo* SubjectInfo = FindTransformSubject(SubjectName);
+	if (SubjectInfo)
+	{
+		if (SubjectInfo->ExpectedPropertyCount != PropertyCount)
+		{
+			ULL_HOT_LOG(Error,
+			            TEXT("UpdateTransformSubjectWithProperties: Property count mismatch for '%s' - expected %d, got %d"),
+			            *SubjectName.ToString(),
+			            SubjectInfo->ExpectedPropertyCount,
+			            PropertyCount);
+			FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+			return;
+		}
+	}
+	else
+	{
+		ULL_HOT_LOG(Warning,
+		            TEXT("UpdateTransformSubjectWithProperties: '%s' not registered, cannot validate property count"),
+		            *SubjectName.ToString());
+	}
+	
+	// Check if LiveLink source available
+	if (!CanSendTransforms())
+	{
+		ULL_HOT_LOG_THROTTLED(NoSourceCount, Warning,
+		                      TEXT("UpdateTransformSubjectWithProperties: LiveLink source not available (count: %d)"),
+		                      NoSourceCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, 1);
+		return;
+	}
+	
+	// Push frame data (transform + properties) to LiveLink via Message Bus Provider
+	if (!SubmitTransformFrame(SubjectInfo, SubjectName, Transform, PropertyValues, PropertyCount, FPlatformTime::Seconds()))
+	{
+		return;
+	}
+	
+	// Throttle success logging
+	ULL_HOT_LOG_THROTTLED(UpdateCount, Log,
+	                      TEXT("UpdateTransformSubjectWithProperties: '%s' (count: %d) with %d properties [Message Bus]"),
+	                      *SubjectName.ToString(),
+	                      UpdateCount,
+	                      PropertyCount);
+}
+
+void FLiveLinkBridge::UpdateTransformSubjectsBatch(
+	const TArray<FName>& SubjectNames, 
+	const ULL_Transform* Transforms)
+{
+	FLiveLinkTimedScopeLock Lock(CriticalSection, Stats);
+	FLiveLinkStats::Add(Stats.TransformUpdatesReceived, SubjectNames.Num());
+	FLiveLinkStats::Add(Stats.BatchCalls);
+	
+	if (!bInitialized)
+	{
+		ULL_HOT_LOG_THROTTLED(NotInitializedCount, Warning,
+		                      TEXT("UpdateTransformSubjectsBatch: Not initialized (count: %d)"),
+		                      NotInitializedCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, SubjectNames.Num());
+		return;
+	}
+	
+	// Auto-register new subjects first (same behavior as UpdateTransformSubject)
+	for (const FName& SubjectName : SubjectNames)
+	{
+		if (!SubjectName.IsNone() && !FindTransformSubject(SubjectName))
+		{
+			RegisterTransformSubject(SubjectName);
+		}
+	}
+	
+	if (!CanSendTransforms())
+	{
+		ULL_HOT_LOG_THROTTLED(NoSourceCount, Warning,
+		                      TEXT("UpdateTransformSubjectsBatch: LiveLink source not available (count: %d)"),
+		                      NoSourceCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, SubjectNames.Num());
+		return;
+	}
+	
+	// One timestamp for the whole batch - all subjects belong to the same simulation tick
+	const double WorldTime = FPlatformTime::Seconds();
+	int32 SentCount = 0;
+	
+	for (int32 i = 0; i < SubjectNames.Num(); i++)
+	{
+		if (SubjectNames[i].IsNone())
+		{
+			FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+			continue;
+		}
+		
+		if (SubmitTransformFrame(FindTransformSubject(SubjectNames[i]), SubjectNames[i], ConvertToFTransform(&Transforms[i]), nullptr, 0, WorldTime))
+		{
+			SentCount++;
+		}
+	}
+	
+	// Throttle success logging
+	ULL_HOT_LOG_THROTTLED(BatchCount, Log,
+	                      TEXT("UpdateTransformSubjectsBatch: (count: %d) sent %d of %d subjects [Message Bus]"),
+	                      BatchCount,
+	                      SentCount,
+	                      SubjectNames.Num());
+}
+
+void FLiveLinkBridge::UpdateTransformSubjectsBatchWithProperties(
+	const TArray<FName>& SubjectNames, 
+	const ULL_Transform* Transforms, 
+	const float* PropertyValues, 
+	int32 PropertyCount)
+{
+	FLiveLinkTimedScopeLock Lock(CriticalSection, Stats);
+	FLiveLinkStats::Add(Stats.TransformUpdatesReceived, SubjectNames.Num());
+	FLiveLinkStats::Add(Stats.BatchCalls);
+	
+	if (!bInitialized)
+	{
+		ULL_HOT_LOG_THROTTLED(NotInitializedCount, Warning,
+		                      TEXT("UpdateTransformSubjectsBatchWithProperties: Not initialized (count: %d)"),
+		                      NotInitializedCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, SubjectNames.Num());
+		return;
+	}
+	
+	// Without properties the batch is ULL_UpdateObjectsBatch: auto-register new subjects.
+	// With properties the names are unknown here, so new subjects are not registered
+	// (same as UpdateTransformSubjectWithProperties)
+	if (PropertyCount == 0)
+	{
+		for (const FName& SubjectName : SubjectNames)
+		{
+			if (!SubjectName.IsNone() && !FindTransformSubject(SubjectName))
+			{
+				RegisterTransformSubject(SubjectName);
+			}
+		}
+	}
+	
+	if (!CanSendTransforms())
+	{
+		ULL_HOT_LOG_THROTTLED(NoSourceCount, Warning,
+		                      TEXT("UpdateTransformSubjectsBatchWithProperties: LiveLink source not available (count: %d)"),
+		                      NoSourceCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, SubjectNames.Num());
+		return;
+	}
+	
+	const double WorldTime = FPlatformTime::Seconds();
+	int32 SentCount = 0;
+	
+	for (int32 i = 0; i < SubjectNames.Num(); i++)
+	{
+		const FName& SubjectName = SubjectNames[i];
+		if (SubjectName.IsNone())
+		{
+			FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+			continue;
+		}
+		
+		// Validate property count (same rule as UpdateTransformSubjectWithProperties)
+		FSubjectInfo* SubjectInfo = FindTransformSubject(SubjectName);
+		if (SubjectInfo && SubjectInfo->ExpectedPropertyCount != PropertyCount)
+		{
+			ULL_HOT_LOG_THROTTLED(MismatchCount, Error,
+			                      TEXT("UpdateTransformSubjectsBatchWithProperties: Property count mismatch for '%s' - expected %d, got %d (count: %d)"),
+			                      *SubjectName.ToString(),
+			                      SubjectInfo->ExpectedPropertyCount,
+			                      PropertyCount,
+			                      MismatchCount);
+			FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+			continue;
+		}
+		
+		const float* SubjectValues = PropertyCount > 0 ? PropertyValues + (int64)i * PropertyCount : nullptr;
+		if (SubmitTransformFrame(SubjectInfo, SubjectName, ConvertToFTransform(&Transforms[i]), SubjectValues, PropertyCount, WorldTime))
+		{
+			SentCount++;
+		}
+	}
+	
+	ULL_HOT_LOG_THROTTLED(BatchCount, Log,
+	                      TEXT("UpdateTransformSubjectsBatchWithProperties: (count: %d) sent %d of %d subjects with %d properties [Message Bus]"),
+	                      BatchCount,
+	                      SentCount,
+	                      SubjectNames.Num(),
+	                      PropertyCount);
+}
+
+void FLiveLinkBridge::UpdateTransformSubjectByHandle(
+	int32 Handle, 
+	const FTransform& Transform)
+{
+	if (TryIngestTransformByHandle(Handle, Transform, nullptr, 0))
+	{
+		return;
+	}
+	
+	FLiveLinkTimedScopeLock Lock(CriticalSection, Stats);
+	FLiveLinkStats::Add(Stats.TransformUpdatesReceived, 1);
+	
+	if (!bInitialized)
+	{
+		ULL_HOT_LOG_THROTTLED(NotInitializedCount, Warning,
+		                      TEXT("UpdateTransformSubjectByHandle: Not initialized (count: %d)"),
+		                      NotInitializedCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, 1);
+		return;
+	}
+	
+	// Handles are never auto-registered - the caller must have registered first
+	FSubjectInfo* SubjectInfo = ResolveTransformHandle(Handle);
+	if (!SubjectInfo)
+	{
+		ULL_HOT_LOG_THROTTLED(InvalidHandleCount, Warning,
+		                      TEXT("UpdateTransformSubjectByHandle: Invalid or stale handle %d (count: %d)"),
+		                      Handle,
+		                      InvalidHandleCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+		return;
+	}
+	
+	if (!CanSendTransforms())
+	{
+		ULL_HOT_LOG_THROTTLED(NoSourceCount, Warning,
+		                      TEXT("UpdateTransformSubjectByHandle: LiveLink source not available (count: %d)"),
+		                      NoSourceCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, 1);
+		return;
+	}
+	
+	SubmitTransformFrame(SubjectInfo, SubjectInfo->SubjectName, Transform, nullptr, 0, FPlatformTime::Seconds());
+}
+
+void FLiveLinkBridge::UpdateTransformSubjectWithPropertiesByHandle(
+	int32 Handle, 
+	const FTransform& Transform, 
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	const TOptional<double>& SimTime)
+{
+	if (!SimTime.IsSet() && TryIngestTransformByHandle(Handle, Transform, PropertyValues, PropertyCount))
+	{
+		return;
+	}
+	
+	FLiveLinkTimedScopeLock Lock(CriticalSection, Stats);
+	FLiveLinkStats::Add(Stats.TransformUpdatesReceived, 1);
+	
+	if (!bInitialized)
+	{
+		ULL_HOT_LOG_THROTTLED(NotInitializedCount, Warning,
+		                      TEXT("UpdateTransformSubjectWithPropertiesByHandle: Not initialized (count: %d)"),
+		                      NotInitializedCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, 1);
+		return;
+	}
+	
+	FSubjectInfo* SubjectInfo = ResolveTransformHandle(Handle);
+	if (!SubjectInfo)
+	{
+		ULL_HOT_LOG_THROTTLED(InvalidHandleCount, Warning,
+		                      TEXT("UpdateTransformSubjectWithPropertiesByHandle: Invalid or stale handle %d (count: %d)"),
+		                      Handle,
+		                      InvalidHandleCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+		return;
+	}
+	
+	if (SubjectInfo->ExpectedPropertyCount != PropertyCount)
+	{
+		ULL_HOT_LOG(Error,
+		            TEXT("UpdateTransformSubjectWithPropertiesByHandle: Property count mismatch for '%s' - expected %d, got %d"),
+		            *SubjectInfo->SubjectName.ToString(),
+		            SubjectInfo->ExpectedPropertyCount,
+		            PropertyCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+		return;
+	}
+	
+	if (!CanSendTransforms())
+	{
+		ULL_HOT_LOG_THROTTLED(NoSourceCount, Warning,
+		                      TEXT("UpdateTransformSubjectWithPropertiesByHandle: LiveLink source not available (count: %d)"),
+		                      NoSourceCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, 1);
+		return;
+	}
+	
+	TOptional<FQualifiedFrameTime> SceneTime;
+	const double WorldTime = SimTime.IsSet() ? MapSimulationTime(SimTime.GetValue(), SceneTime) : FPlatformTime::Seconds();
+	SubmitTransformFrame(SubjectInfo, SubjectInfo->SubjectName, Transform, PropertyValues, PropertyCount, WorldTime, SceneTime);
+}
+
+void FLiveLinkBridge::UpdateTransformSubjectsBatchByHandle(
+	const int32* Handles, 
+	const ULL_Transform* Transforms, 
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	int32 Count, 
+	const TOptional<double>& SimTime)
+{
+	if (!SimTime.IsSet() && IngestTransformBatchByHandle(Handles, Transforms, PropertyValues, PropertyCount, Count))
+	{
+		return;
+	}
+	
+	FLiveLinkTimedScopeLock Lock(CriticalSection, Stats);
+	FLiveLinkStats::Add(Stats.TransformUpdatesReceived, Count);
+	FLiveLinkStats::Add(Stats.BatchCalls);
+	
+	if (!bInitialized)
+	{
+		ULL_HOT_LOG_THROTTLED(NotInitializedCount, Warning,
+		                      TEXT("UpdateTransformSubjectsBatchByHandle: Not initialized (count: %d)"),
+		                      NotInitializedCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, Count);
+		return;
+	}
+	
+	if (!CanSendTransforms())
+	{
+		ULL_HOT_LOG_THROTTLED(NoSourceCount, Warning,
+		                      TEXT("UpdateTransformSubjectsBatchByHandle: LiveLink source not available (count: %d)"),
+		                      NoSourceCount);
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped, Count);
+		return;
+	}
+	
+	// One timestamp for the whole batch (simulation time when the caller supplied one)
+	TOptional<FQualifiedFrameTime> SceneTime;
+	const double WorldTime = SimTime.IsSet() ? MapSimulationTime(SimTime.GetValue(), SceneTime) : FPlatformTime::Seconds();
+	int32 SentCount = 0;
+	int32 SkippedCount = 0;
+	
+	for (int32 i = 0; i < Count; i++)
+	{
+		FSubjectInfo* SubjectInfo = ResolveTransformHandle(Handles[i]);
+		if (!SubjectInfo || SubjectInfo->ExpectedPropertyCount != PropertyCount)
+		{
+			SkippedCount++;
+			FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+			continue;
+		}
+		
+		const float* SubjectValues = PropertyCount > 0 ? PropertyValues + (int64)i * PropertyCount : nullptr;
+		if (SubmitTransformFrame(SubjectInfo, SubjectInfo->SubjectName, ConvertToFTransform(&Transforms[i]), SubjectValues, PropertyCount, WorldTime, SceneTime))
+		{
+			SentCount++;
+		}
+	}
+	
+	// Throttle success logging (skips are reported here rather than per subject)
+#if ULL_ENABLE_HOT_PATH_LOGGING
+	static int32 BatchCount = 0;
+	if (++BatchCount % 60 == 1 || SkippedCount > 0)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("UpdateTransformSubjectsBatchByHandle: (count: %d) sent %d of %d subjects, skipped %d (invalid handle or property count mismatch)"), 
+		       BatchCount, 
+		       SentCount, 
+		       Count, 
+		       SkippedCount);
+	}
+#endif
+}
+
+bool FLiveLinkBridge::PushTransformFrame(
+	const FName& SubjectName, 
+	const FTransform& Transform, 
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	double WorldTime, 
+	const TOptional<FQualifiedFrameTime>& SceneTime)
+{
+	// Note: Caller must hold CriticalSection lock and have checked bLiveLinkSourceCreated
+	
+	// Async mode: hand the frame to the sender thread (frame struct is built there)
+	if (Sender.IsValid())
+	{
+		if (!Sender->EnqueueFrame(SubjectName, Transform, PropertyValues, PropertyCount, WorldTime, SceneTime))
+		{
+			FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+			return false;
+		}
+		FLiveLinkStats::Add(Stats.TransformUpdatesSent);
+		return true;
+	}
+	
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkTransformFrameData::StaticStruct());
+	FLiveLinkTransformFrameData* TransformFrameData = FrameData.Cast<FLiveLinkTransformFrameData>();
+	
+	if (!TransformFrameData)
+	{
+		ULL_HOT_LOG(Error,
+		            TEXT("PushTransformFrame: Failed to cast frame data for '%s'"),
+		            *SubjectName.ToString());
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+		return false;
+	}
+	
+	// Set transform, timestamp, and properties
+	// (one sized allocation + bulk copy from the caller's buffer; the frame is moved into the provider)
+	TransformFrameData->Transform = Transform;
+	TransformFrameData->WorldTime = FLiveLinkWorldTime(WorldTime);
+	if (SceneTime.IsSet())
+	{
+		TransformFrameData->MetaData.SceneTime = SceneTime.GetValue();
+	}
+	if (PropertyCount > 0)
+	{
+		TransformFrameData->PropertyValues.SetNumUninitialized(PropertyCount);
+		FMemory::Memcpy(TransformFrameData->PropertyValues.GetData(), PropertyValues, PropertyCount * sizeof(float));
+	}
+	
+	Recorder.RecordFrame(SubjectName, Transform, PropertyValues, PropertyCount, WorldTime);
+	LatencyProbe.RecordSend(SubjectName, Transform);
+	
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	LiveLinkProvider->UpdateSubjectFrameData(
+		SubjectName,
+		MoveTemp(FrameData));
+	Stats.RecordFrameData(FPlatformTime::Cycles64() - StartCycles);
+	FLiveLinkStats::Add(Stats.TransformUpdatesSent);
+	
+	return true;
+}
+
+bool FLiveLinkBridge::SubmitTransformFrame(
+	FSubjectInfo* SubjectInfo, 
+	const FName& SubjectName, 
+	const FTransform& Transform, 
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	double WorldTime, 
+	const TOptional<FQualifiedFrameTime>& SceneTime)
+{
+	// Note: Caller must hold CriticalSection lock and have checked CanSendTransforms()
+	
+	// Staging: unregistered subjects have no slot to wait in
+	if (bEngineStaging && !SubjectInfo)
+	{
+		FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+		return false;
+	}
+	
+	// Pool mode: the frame goes out under the pooled subject's name, with the visibility property appended
+	const FName* FrameSubjectName = &SubjectName;
+	if (SubjectInfo && SubjectInfo->PoolIndex != INDEX_NONE)
+	{
+		PoolPropertyScratch.SetNumUninitialized(PropertyCount + 1, EAllowShrinking::No);
+		if (PropertyCount > 0)
+		{
+			FMemory::Memcpy(PoolPropertyScratch.GetData(), PropertyValues, PropertyCount * sizeof(float));
+		}
+		PoolPropertyScratch[PropertyCount] = 1.0f;
+		PropertyValues = PoolPropertyScratch.GetData();
+		PropertyCount++;
+		FrameSubjectName = &SubjectInfo->SubjectName;
+	}
+	
+	// Shared-memory transport: the table is already latest-value, so there is nothing to
+	// coalesce or filter - every update overwrites the subject's slot
+	if (SharedMemory.IsValid())
+	{
+		if (!SubjectInfo || !SharedMemory->WriteFrame((int32)(SubjectInfo - TransformSubjectTable.GetData()), Transform, PropertyValues, PropertyCount, WorldTime))
+		{
+			// Unregistered, beyond capacity or names too long for the table
+			FLiveLinkStats::Add(Stats.TransformUpdatesDropped);
+			return false;
+		}
+		FLiveLinkStats::Add(Stats.TransformUpdatesSent);
+		return true;
+	}
+	
+	// Latency probe: stamped as it enters the bridge's queues, and never held back by interest regions
+	const bool bLatencyProbe = LatencyProbe.IsProbeSubject(SubjectName);
+	if (bLatencyProbe)
+	{
+		LatencyProbe.RecordEnqueue(Transform);
+	}
+	
+	// Interest regions: outside every region the frame is held in the pending slot
+	if (SubjectInfo && InterestRegions.Num() > 0 && !bLatencyProbe && !PassesInterestFilter(*SubjectInfo, Transform, PropertyValues, PropertyCount, WorldTime, SceneTime))
+	{
+		return false;
+	}
+	
+	if (!IsCoalescingMode() || !SubjectInfo)
+	{
+		// Unchanged frames are dropped here; in coalescing mode the publish pass filters instead,
+		// so the pending slot always holds the newest value
+		bool bKeepAlive = false;
+		const bool bTrackLastSent = bDeadbandEnabled && SubjectInfo;
+		if (bTrackLastSent && !PassesDeadband(*SubjectInfo, Transform, PropertyValues, PropertyCount, bKeepAlive))
+		{
+			return false;
+		}
+		if (!PushTransformFrame(*FrameSubjectName, Transform, PropertyValues, PropertyCount, WorldTime, SceneTime))
+		{
+			return false;
+		}
+		if (bTrackLastSent)
+		{
+			RecordDeadbandSent(*SubjectInfo, Transform, PropertyValues, PropertyCount, bKeepAlive);
+		}
+		return true;
+	}
+	
+	// Coalescing mode: overwrite the latest-value slot, the publish pass sends it
+	if (SubjectInfo->bPendingFrame)
+	{
+		CoalescedFrameCount++;
+	}
+	else
+	{
+		SubjectInfo->bPendingFrame = true;
+		DirtyTransformSlots.Add((int32)(SubjectInfo - TransformSubjectTable.GetData()));
+	}
+	
+	StorePendingFrame(*SubjectInfo, Transform, PropertyValues, PropertyCount, WorldTime, SceneTime);
+	
+	return true;
+}
+
+void FLiveLinkBridge::StorePendingFrame(
+	FSubjectInfo& SubjectInfo, 
+	const FTransform& Transform, 
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	double WorldTime, 
+	const TOptional<FQualifiedFrameTime>& SceneTime)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	SubjectInfo.PendingTransform = Transform;
+	SubjectInfo.PendingWorldTime = WorldTime;
+	SubjectInfo.PendingSceneTime = SceneTime;
+	// Pending buffer is recycled per subject: capacity is kept, so steady state does not allocate
+	SubjectInfo.PendingPropertyValues.SetNumUninitialized(PropertyCount, EAllowShrinking::No);
+	if (PropertyCount > 0)
+	{
+		FMemory::Memcpy(SubjectInfo.PendingPropertyValues.GetData(), PropertyValues, PropertyCount * sizeof(float));
+	}
+}
+
+double FLiveLinkBridge::MapSimulationTime(double SimTime, TOptional<FQualifiedFrameTime>& OutSceneTime)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	// A new run (or a reset model) starts its timeline at the current platform time
+	if (!bSimTimeAnchored || SimTime < LastSimTime)
+	{
+		bSimTimeAnchored = true;
+		SimTimeAnchor = SimTime;
+		WorldTimeAnchor = FPlatformTime::Seconds();
+		
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("MapSimulationTime: Anchored simulation time %.3f s to world time %.3f s"), 
+		       SimTimeAnchor, 
+		       WorldTimeAnchor);
+	}
+	LastSimTime = SimTime;
+	
+	// Frames are spaced by simulation time, so Unreal's buffered evaluation interpolates
+	// between them instead of seeing the arrival jitter of batched or queued sends
+	const double ScaledSeconds = SimTime * (double)SimTimeScale;
+	OutSceneTime = FQualifiedFrameTime(FFrameTime::FromDecimal(ScaledSeconds * SceneFrameRate), FFrameRate(SceneFrameRate, 1));
+	return WorldTimeAnchor + (SimTime - SimTimeAnchor) * (double)SimTimeScale;
+}
+
+void FLiveLinkBridge::PublishPendingFrames()
+{
+	FLiveLinkTimedScopeLock Lock(CriticalSection, Stats);
+	
+	if (!bInitialized)
+	{
+		return;
+	}
+	
+	PublishPendingFramesLocked();
+}
+
+void FLiveLinkBridge::PublishPendingFramesLocked()
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	if (bLiveLinkSourceCreated)
+	{
+		DrainIngestShardsLocked();
+	}
+	
+	if ((DirtyTransformSlots.Num() == 0 && DirtyDataSubjects.Num() == 0) || !bLiveLinkSourceCreated)
+	{
+		return;
+	}
+	
+	if (bRateTiersUsed || PublishFrameBudget > 0 || PublishByteBudget > 0)
+	{
+		const int32 ScheduledCount = PublishScheduledFramesLocked();
+		PublishedFrameCount += ScheduledCount;
+		
+		ULL_HOT_LOG_THROTTLED(PublishCount, Log,
+		                      TEXT("PublishPendingFrames: (count: %d) sent %d subjects, %d still dirty, %llu deferred by budget so far"),
+		                      PublishCount,
+		                      ScheduledCount,
+		                      DirtyTransformSlots.Num() + DirtyDataSubjects.Num(),
+		                      BudgetDeferredCount);
+		return;
+	}
+	
+	int32 SentCount = 0;
+	for (const int32 Slot : DirtyTransformSlots)
+	{
+		// Slot may have been released (or released and reused) since it was marked dirty
+		FSubjectInfo& SubjectInfo = TransformSubjectTable[Slot];
+		if (!SubjectInfo.bInUse || !SubjectInfo.bPendingFrame)
+		{
+			continue;
+		}
+		
+		SubjectInfo.bPendingFrame = false;
+		if (PublishPendingSubject(SubjectInfo, NAME_None))
+		{
+			SentCount++;
+		}
+	}
+	
+	DirtyTransformSlots.Reset();
+	
+	for (const FName& SubjectName : DirtyDataSubjects)
+	{
+		// Subject may have been removed (or re-registered with a new layout) since it was marked dirty
+		FSubjectInfo* SubjectInfo = DataSubjects.Find(SubjectName);
+		if (!SubjectInfo || !SubjectInfo->bPendingFrame)
+		{
+			continue;
+		}
+		
+		SubjectInfo->bPendingFrame = false;
+		if (PublishPendingSubject(*SubjectInfo, SubjectName))
+		{
+			SentCount++;
+		}
+	}
+	
+	DirtyDataSubjects.Reset();
+	PublishedFrameCount += SentCount;
+	
+	// Throttle logging (one line per ~60 publish passes)
+	ULL_HOT_LOG_THROTTLED(PublishCount, Log,
+	                      TEXT("PublishPendingFrames: (count: %d) sent %d subjects, %llu updates coalesced so far"),
+	                      PublishCount,
+	                      SentCount,
+	                      CoalescedFrameCount);
+}
+
+int32 FLiveLinkBridge::PublishScheduledFramesLocked()
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	const double Now = FPlatformTime::Seconds();
+	
+	// Refill the token buckets; at most one publish pass worth carries over, so an idle
+	// period cannot turn into a burst over the budget. Without a publish rate (a pass while
+	// staging, or the publish thread failed to start) there is no pass size to cap at, so
+	// the buckets are left as they are rather than refilled without bound.
+	const double Elapsed = FMath::Max(Now - LastBudgetRefillTime, 0.0);
+	LastBudgetRefillTime = Now;
+	if (PublishRateHz > 0)
+	{
+		if (PublishFrameBudget > 0)
+		{
+			FrameBudgetTokens = FMath::Min(FrameBudgetTokens + PublishFrameBudget * Elapsed, (double)PublishFrameBudget / PublishRateHz);
+		}
+		if (PublishByteBudget > 0)
+		{
+			ByteBudgetTokens = FMath::Min(ByteBudgetTokens + PublishByteBudget * Elapsed, (double)PublishByteBudget / PublishRateHz);
+		}
+	}
+	
+	// Collect the subjects whose tier interval has elapsed. Candidates take over the pending
+	// flag, so a slot listed twice (released and reused since it was marked dirty) is seen once.
+	PublishCandidates.Reset();
+	RetainedTransformSlots.Reset();
+	RetainedDataSubjects.Reset();
+	
+	for (const int32 Slot : DirtyTransformSlots)
+	{
+		FSubjectInfo& SubjectInfo = TransformSubjectTable[Slot];
+		if (!SubjectInfo.bInUse || !SubjectInfo.bPendingFrame)
+		{
+			continue;
+		}
+		
+		if (Now - SubjectInfo.LastPublishTime < SubjectInfo.MinPublishInterval)
+		{
+			RetainedTransformSlots.Add(Slot);
+			RateDeferredCount++;
+			continue;
+		}
+		
+		SubjectInfo.bPendingFrame = false;
+		PublishCandidates.Add({ &SubjectInfo, NAME_None, Slot });
+	}
+	
+	for (const FName& SubjectName : DirtyDataSubjects)
+	{
+		FSubjectInfo* SubjectInfo = DataSubjects.Find(SubjectName);
+		if (!SubjectInfo || !SubjectInfo->bPendingFrame)
+		{
+			continue;
+		}
+		
+		if (Now - SubjectInfo->LastPublishTime < SubjectInfo->MinPublishInterval)
+		{
+			RetainedDataSubjects.Add(SubjectName);
+			RateDeferredCount++;
+			continue;
+		}
+		
+		SubjectInfo->bPendingFrame = false;
+		PublishCandidates.Add({ SubjectInfo, SubjectName, INDEX_NONE });
+	}
+	
+	// Highest priority first; within a priority the least recently published subject goes
+	// first, so subjects cut by the budget are next in line on the following pass
+	PublishCandidates.Sort([](const FPublishCandidate& A, const FPublishCandidate& B)
+	{
+		if (A.SubjectInfo->Priority != B.SubjectInfo->Priority)
+		{
+			return A.SubjectInfo->Priority < B.SubjectInfo->Priority;
+		}
+		return A.SubjectInfo->LastPublishTime < B.SubjectInfo->LastPublishTime;
+	});
+	
+	int32 SentCount = 0;
+	for (const FPublishCandidate& Candidate : PublishCandidates)
+	{
+		FSubjectInfo& SubjectInfo = *Candidate.SubjectInfo;
+		
+		// A frame may overdraw the buckets (the debt is paid by the next refills), so budgets
+		// smaller than one frame per pass still publish at their average rate
+		const bool bOverBudget = 
+			(PublishFrameBudget > 0 && FrameBudgetTokens <= 0.0) || 
+			(PublishByteBudget > 0 && ByteBudgetTokens <= 0.0);
+		if (bOverBudget)
+		{
+			SubjectInfo.bPendingFrame = true;
+			if (Candidate.Slot != INDEX_NONE)
+			{
+				RetainedTransformSlots.Add(Candidate.Slot);
+			}
+			else
+			{
+				RetainedDataSubjects.Add(Candidate.DataSubjectName);
+			}
+			BudgetDeferredCount++;
+			continue;
+		}
+		
+		// Only a frame actually sent counts as published: one the deadband suppressed leaves
+		// the subject first in line and not rate-limited
+		if (PublishPendingSubject(SubjectInfo, Candidate.DataSubjectName))
+		{
+			SubjectInfo.LastPublishTime = Now;
+			FrameBudgetTokens -= 1.0;
+			ByteBudgetTokens -= ULL_PUBLISH_FRAME_OVERHEAD_BYTES
+				+ (Candidate.Slot != INDEX_NONE ? (int32)sizeof(ULL_Transform) : 0)
+				+ SubjectInfo.PendingPropertyValues.Num() * (int32)sizeof(float);
+			SentCount++;
+		}
+	}
+	
+	// Subjects held back stay dirty with their latest value
+	Swap(DirtyTransformSlots, RetainedTransformSlots);
+	Swap(DirtyDataSubjects, RetainedDataSubjects);
+	
+	return SentCount;
+}
+
+bool FLiveLinkBridge::PublishPendingSubject(FSubjectInfo& SubjectInfo, const FName& DataSubjectName)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	const bool bIsDataSubject = !DataSubjectName.IsNone();
+	const FTransform& Transform = bIsDataSubject ? FTransform::Identity : SubjectInfo.PendingTransform;
+	const float* PropertyValues = SubjectInfo.PendingPropertyValues.GetData();
+	const int32 PropertyCount = SubjectInfo.PendingPropertyValues.Num();
+	
+	bool bKeepAlive = false;
+	if (bDeadbandEnabled && !PassesDeadband(SubjectInfo, Transform, PropertyValues, PropertyCount, bKeepAlive))
+	{
+		return false;
+	}
+	
+	const bool bPushed = bIsDataSubject
+		? PushDataFrame(DataSubjectName, PropertyValues, PropertyCount, SubjectInfo.PendingWorldTime)
+		: PushTransformFrame(SubjectInfo.SubjectName, Transform, PropertyValues, PropertyCount, SubjectInfo.PendingWorldTime, SubjectInfo.PendingSceneTime);
+	
+	// A dropped frame is not the last sent one: the next update is compared against the older frame
+	if (bPushed && bDeadbandEnabled)
+	{
+		RecordDeadbandSent(SubjectInfo, Transform, PropertyValues, PropertyCount, bKeepAlive);
+	}
+	return bPushed;
+}
+
+//=============================================================================
+// Update-Rate Tiers
+//=============================================================================
+
+int32 FLiveLinkBridge::SetTransformSubjectScheduleByHandle(int32 Handle, int32 Priority, int32 MaxRateHz)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	FSubjectInfo* SubjectInfo = ResolveTransformHandle(Handle);
+	if (!SubjectInfo)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("SetTransformSubjectScheduleByHandle: Invalid or stale handle %d"), 
+		       Handle);
+		return ULL_ERROR;
+	}
+	
+	return ApplySubjectSchedule(*SubjectInfo, Priority, MaxRateHz);
+}
+
+int32 FLiveLinkBridge::SetSubjectSchedule(const FName& SubjectName, int32 Priority, int32 MaxRateHz)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	FSubjectInfo* SubjectInfo = nullptr;
+	if (const int32* Handle = TransformSubjects.Find(SubjectName))
+	{
+		SubjectInfo = ResolveTransformHandle(*Handle);
+	}
+	else
+	{
+		SubjectInfo = DataSubjects.Find(SubjectName);
+	}
+	
+	if (!SubjectInfo)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("SetSubjectSchedule: Subject '%s' is not registered"), 
+		       *SubjectName.ToString());
+		return ULL_ERROR;
+	}
+	
+	return ApplySubjectSchedule(*SubjectInfo, Priority, MaxRateHz);
+}
+
+int32 FLiveLinkBridge::ApplySubjectSchedule(FSubjectInfo& SubjectInfo, int32 Priority, int32 MaxRateHz)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	if (Priority < ULL_PRIORITY_HIGH || Priority > ULL_PRIORITY_LOW || MaxRateHz < 0)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("SetSubjectSchedule: Invalid priority %d or rate %d Hz for '%s'"), 
+		       Priority, 
+		       MaxRateHz, 
+		       *SubjectInfo.SubjectName.ToString());
+		return ULL_ERROR;
+	}
+	
+	if (!IsCoalescingMode() && !bRateTiersUsed)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("SetSubjectSchedule: ⚠️ Rate tiers only apply with publishRateHz > 0, updates are sent immediately"));
+	}
+	
+	SubjectInfo.Priority = (uint8)Priority;
+	SubjectInfo.MinPublishInterval = MaxRateHz > 0 ? 1.0f / MaxRateHz : 0.0f;
+	bRateTiersUsed = true;
+	
+	ULL_HOT_LOG(Log,
+	            TEXT("SetSubjectSchedule: '%s' priority %d, max rate %d Hz"),
+	            *SubjectInfo.SubjectName.ToString(),
+	            Priority,
+	            MaxRateHz);
+	
+	return ULL_OK;
+}
+
+bool FLiveLinkBridge::PassesDeadband(
+	const FSubjectInfo& SubjectInfo, 
+	const FTransform& Transform, 
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	bool& bOutKeepAlive)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	bool bChanged = !SubjectInfo.bHasLastSent || SubjectInfo.LastSentPropertyValues.Num() != PropertyCount;
+	
+	if (!bChanged)
+	{
+		const FTransform& Last = SubjectInfo.LastSentTransform;
+		bChanged = 
+			FVector::DistSquared(Transform.GetLocation(), Last.GetLocation()) > PositionDeadbandSquared || 
+			Transform.GetRotation().AngularDistance(Last.GetRotation()) > RotationDeadbandRadians || 
+			FVector::DistSquared(Transform.GetScale3D(), Last.GetScale3D()) > UE_KINDA_SMALL_NUMBER;
+	}
+	
+	if (!bChanged)
+	{
+		const float* LastValues = SubjectInfo.LastSentPropertyValues.GetData();
+		for (int32 i = 0; i < PropertyCount; i++)
+		{
+			if (FMath::Abs(PropertyValues[i] - LastValues[i]) > PropertyDeadband)
+			{
+				bChanged = true;
+				break;
+			}
+		}
+	}
+	
+	bOutKeepAlive = false;
+	if (!bChanged)
+	{
+		// Unchanged: resend only when Unreal would otherwise consider the subject stale
+		if (FPlatformTime::Seconds() - SubjectInfo.LastSentTime < KeepAliveIntervalSeconds)
+		{
+			DeadbandSuppressedCount++;
+			return false;
+		}
+		bOutKeepAlive = true;
+	}
+	
+	return true;
+}
+
+void FLiveLinkBridge::RecordDeadbandSent(
+	FSubjectInfo& SubjectInfo, 
+	const FTransform& Transform, 
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	bool bKeepAlive)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	if (bKeepAlive)
+	{
+		DeadbandKeepAliveCount++;
+	}
+	
+	SubjectInfo.bHasLastSent = true;
+	SubjectInfo.LastSentTime = FPlatformTime::Seconds();
+	SubjectInfo.LastSentTransform = Transform;
+	SubjectInfo.LastSentPropertyValues.Reset();
+	if (PropertyCount > 0)
+	{
+		SubjectInfo.LastSentPropertyValues.Append(PropertyValues, PropertyCount);
+	}
+	
+	DeadbandSentCount++;
+}
+
+int FLiveLinkBridge::GetDeadbandCounters(uint64& OutSentFrames, uint64& OutSuppressedFrames, uint64& OutKeepAliveFrames) const
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		OutSentFrames = 0;
+		OutSuppressedFrames = 0;
+		OutKeepAliveFrames = 0;
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	OutSentFrames = DeadbandSentCount;
+	OutSuppressedFrames = DeadbandSuppressedCount;
+	OutKeepAliveFrames = DeadbandKeepAliveCount;
+	return ULL_OK;
+}
+
+//=============================================================================
+// Interest Regions
+//=============================================================================
+
+// Grid cell edge. Large enough that a subject crosses cells rarely, small enough that a
+// viewer region fully covers most of the cells it touches.
+static constexpr double InterestCellSize = 5000.0;    // cm (50 m)
+static constexpr int32 InterestCellLimit = 1 << 20;   // Cell coordinates are packed into 21 bits each
+
+static FORCEINLINE int32 ToInterestCellCoordinate(double Centimeters)
+{
+	// Out-of-range (and NaN) positions share the border cells
+	const double Cell = FMath::FloorToDouble(Centimeters / InterestCellSize);
+	if (Cell >= InterestCellLimit)
+	{
+		return InterestCellLimit - 1;
+	}
+	return Cell >= -InterestCellLimit ? (int32)Cell : -InterestCellLimit;
+}
+
+static FORCEINLINE uint64 MakeInterestCellKey(const FIntVector& Cell)
+{
+	return ((uint64)(Cell.X & 0x1FFFFF) << 42) | ((uint64)(Cell.Y & 0x1FFFFF) << 21) | (uint64)(Cell.Z & 0x1FFFFF);
+}
+
+int32 FLiveLinkBridge::SetInterestRegions(const ULL_InterestRegion* Regions, int32 Count, int32 OutsideRateHz)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	if (Count < 0 || Count > ULL_MAX_INTEREST_REGIONS || (Count > 0 && !Regions) || 
+		OutsideRateHz < 0 || OutsideRateHz > ULL_MAX_PUBLISH_RATE_HZ)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("SetInterestRegions: Invalid region count %d or outside rate %d Hz"), 
+		       Count, 
+		       OutsideRateHz);
+		return ULL_ERROR;
+	}
+	
+	TArray<FBox> NewRegions;
+	NewRegions.Reserve(Count);
+	for (int32 i = 0; i < Count; i++)
+	{
+		const ULL_InterestRegion& Region = Regions[i];
+		const FVector Min(Region.min[0], Region.min[1], Region.min[2]);
+		const FVector Max(Region.max[0], Region.max[1], Region.max[2]);
+		
+		// Written so NaN corners fail as well
+		if (!(Min.X <= Max.X && Min.Y <= Max.Y && Min.Z <= Max.Z))
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Error, 
+			       TEXT("SetInterestRegions: ❌ Region %d has a corner that is NaN or min above max"), 
+			       i);
+			return ULL_ERROR;
+		}
+		NewRegions.Add(FBox(Min, Max));
+	}
+	
+	InterestRegions = MoveTemp(NewRegions);
+	InterestOutsideInterval = OutsideRateHz > 0 ? 1.0 / OutsideRateHz : 0.0;
+	
+	// Re-evaluate the occupied cells. Held frames are only looked at in cells the regions
+	// reach; clearing the regions releases every held frame and drops the grid.
+	const bool bCleared = InterestRegions.Num() == 0;
+	int32 ReleasedCount = 0;
+	for (auto& Entry : InterestGrid)
+	{
+		FInterestCell& Cell = Entry.Value;
+		const uint8 Coverage = bCleared ? (uint8)InterestInside : ComputeInterestCoverage(Cell.Coordinates);
+		
+		// Subjects moving into the cell later take its coverage from here
+		Cell.Coverage = Coverage;
+		
+		for (const int32 Slot : Cell.Slots)
+		{
+			FSubjectInfo& SubjectInfo = TransformSubjectTable[Slot];
+			SubjectInfo.InterestCoverage = Coverage;
+			SubjectInfo.bInInterestGrid = !bCleared;
+			
+			if (SubjectInfo.bInterestHeld && Coverage != InterestOutside && 
+				(Coverage == InterestInside || IsInInterestRegion(SubjectInfo.PendingTransform.GetLocation())))
+			{
+				ReleaseInterestHeldFrame(SubjectInfo, Slot);
+				ReleasedCount++;
+			}
+		}
+	}
+	
+	if (bCleared)
+	{
+		InterestGrid.Empty();
+	}
+	
+	ULL_HOT_LOG(Log,
+	            TEXT("SetInterestRegions: %d regions, outside rate %d Hz, %d grid cells, released %d held frames"),
+	            Count,
+	            OutsideRateHz,
+	            InterestGrid.Num(),
+	            ReleasedCount);
+	
+	return ULL_OK;
+}
+
+int FLiveLinkBridge::GetInterestCounters(uint64& OutHeldFrames, uint64& OutOutsideFrames, int32& OutGridCells) const
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		OutHeldFrames = 0;
+		OutOutsideFrames = 0;
+		OutGridCells = 0;
+		return ULL_NOT_INITIALIZED;
+	}
+	
+	OutHeldFrames = InterestHeldCount;
+	OutOutsideFrames = InterestOutsideSentCount;
+	OutGridCells = InterestGrid.Num();
+	return ULL_OK;
+}
+
+bool FLiveLinkBridge::PassesInterestFilter(
+	FSubjectInfo& SubjectInfo, 
+	const FTransform& Transform, 
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	double WorldTime, 
+	const TOptional<FQualifiedFrameTime>& SceneTime)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	const FVector Location = Transform.GetLocation();
+	const FIntVector CellCoordinates(
+		ToInterestCellCoordinate(Location.X), 
+		ToInterestCellCoordinate(Location.Y), 
+		ToInterestCellCoordinate(Location.Z));
+	const uint64 CellKey = MakeInterestCellKey(CellCoordinates);
+	
+	// Staying in the same cell (the common case) costs one compare; the coverage is cached per subject
+	if (!SubjectInfo.bInInterestGrid || SubjectInfo.InterestCell != CellKey)
+	{
+		const int32 Slot = (int32)(&SubjectInfo - TransformSubjectTable.GetData());
+		if (SubjectInfo.bInInterestGrid)
+		{
+			RemoveFromInterestGrid(SubjectInfo, Slot);
+		}
+		
+		FInterestCell* Cell = InterestGrid.Find(CellKey);
+		if (!Cell)
+		{
+			Cell = &InterestGrid.Add(CellKey);
+			Cell->Coordinates = CellCoordinates;
+			Cell->Coverage = ComputeInterestCoverage(CellCoordinates);
+		}
+		Cell->Slots.Add(Slot);
+		
+		SubjectInfo.bInInterestGrid = true;
+		SubjectInfo.InterestCell = CellKey;
+		SubjectInfo.InterestCoverage = Cell->Coverage;
+	}
+	
+	const bool bInside = 
+		SubjectInfo.InterestCoverage == InterestInside || 
+		(SubjectInfo.InterestCoverage == InterestPartial && IsInInterestRegion(Location));
+	if (bInside)
+	{
+		SubjectInfo.bInterestHeld = false;    // This frame supersedes the held one
+		return true;
+	}
+	
+	// Already dirty (it left a region since the last publish pass): the pass sends this frame instead
+	if (SubjectInfo.bPendingFrame)
+	{
+		return true;
+	}
+	
+	const double Now = FPlatformTime::Seconds();
+	if (InterestOutsideInterval > 0.0 && Now - SubjectInfo.LastOutsideSendTime >= InterestOutsideInterval)
+	{
+		SubjectInfo.LastOutsideSendTime = Now;
+		SubjectInfo.bInterestHeld = false;
+		InterestOutsideSentCount++;
+		return true;
+	}
+	
+	StorePendingFrame(SubjectInfo, Transform, PropertyValues, PropertyCount, WorldTime, SceneTime);
+	SubjectInfo.bInterestHeld = true;
+	InterestHeldCount++;
+	return false;
+}
+
+uint8 FLiveLinkBridge::ComputeInterestCoverage(const FIntVector& Cell) const
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	const FVector CellMin(Cell.X * InterestCellSize, Cell.Y * InterestCellSize, Cell.Z * InterestCellSize);
+	const FBox CellBox(CellMin, CellMin + FVector(InterestCellSize));
+	
+	uint8 Coverage = InterestOutside;
+	for (const FBox& Region : InterestRegions)
+	{
+		if (Region.IsInsideOrOn(CellBox.Min) && Region.IsInsideOrOn(CellBox.Max))
+		{
+			return InterestInside;
+		}
+		if (Region.Intersect(CellBox))
+		{
+			Coverage = InterestPartial;
+		}
+	}
+	return Coverage;
+}
+
+bool FLiveLinkBridge::IsInInterestRegion(const FVector& Location) const
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	for (const FBox& Region : InterestRegions)
+	{
+		if (Region.IsInsideOrOn(Location))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FLiveLinkBridge::RemoveFromInterestGrid(FSubjectInfo& SubjectInfo, int32 Slot)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	if (FInterestCell* Cell = InterestGrid.Find(SubjectInfo.InterestCell))
+	{
+		Cell->Slots.RemoveSingleSwap(Slot, EAllowShrinking::No);
+		if (Cell->Slots.Num() == 0)
+		{
+			InterestGrid.Remove(SubjectInfo.InterestCell);
+		}
+	}
+	SubjectInfo.bInInterestGrid = false;
+}
+
+void FLiveLinkBridge::ReleaseInterestHeldFrame(FSubjectInfo& SubjectInfo, int32 Slot)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	SubjectInfo.bInterestHeld = false;
+	
+	if (IsCoalescingMode())
+	{
+		SubjectInfo.bPendingFrame = true;
+		DirtyTransformSlots.Add(Slot);
+		return;
+	}
+	
+	PublishPendingSubject(SubjectInfo, NAME_None);
+}
+
+bool FLiveLinkBridge::SubmitTransformStaticData(const FName& SubjectName, int32 SchemaId)
+{
+	// Note: Caller must hold CriticalSection lock and have checked bLiveLinkSourceCreated
+	
+	// Create static data (structure definition - sent once per subject).
+	// The property names come from the shared schema; only the array copy is per subject.
+	FLiveLinkStaticDataStruct StaticData(FLiveLinkTransformStaticData::StaticStruct());
+	FLiveLinkTransformStaticData* TransformStaticData = StaticData.Cast<FLiveLinkTransformStaticData>();
+	
+	if (!TransformStaticData)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("RegisterTransformSubject: Failed to cast static data for '%s'"), 
+		       *SubjectName.ToString());
+		return false;
+	}
+	
+	TransformStaticData->PropertyNames = PropertySchemas[SchemaId].PropertyNames;
+	SubmitStaticData(SubjectName, ULiveLinkTransformRole::StaticClass(), MoveTemp(StaticData));
+	return true;
+}
+
+bool FLiveLinkBridge::SubmitDataStaticData(const FName& SubjectName, int32 SchemaId)
+{
+	// Note: Caller must hold CriticalSection lock and have checked bLiveLinkSourceCreated
+	
+	// Basic role: property names only, no transform
+	FLiveLinkStaticDataStruct StaticData(FLiveLinkBaseStaticData::StaticStruct());
+	FLiveLinkBaseStaticData* BaseStaticData = StaticData.Cast<FLiveLinkBaseStaticData>();
+	
+	if (!BaseStaticData)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("RegisterDataSubject: Failed to cast static data for '%s'"), 
+		       *SubjectName.ToString());
+		return false;
+	}
+	
+	BaseStaticData->PropertyNames = PropertySchemas[SchemaId].PropertyNames;
+	SubmitStaticData(SubjectName, ULiveLinkBasicRole::StaticClass(), MoveTemp(StaticData));
+	return true;
+}
+
+void FLiveLinkBridge::SubmitStaticData(
+	const FName& SubjectName, 
+	TSubclassOf<ULiveLinkRole> RoleClass, 
+	FLiveLinkStaticDataStruct&& StaticData)
+{
+	// Note: Caller must hold CriticalSection lock and have checked bLiveLinkSourceCreated
+	
+	// Async mode keeps registration ordered with the frames queued around it
+	if (Sender.IsValid())
+	{
+		Sender->EnqueueStaticData(SubjectName, RoleClass, MoveTemp(StaticData));
+		return;
+	}
+	
+	Recorder.RecordStaticData(SubjectName, RoleClass, StaticData);
+	LiveLinkProvider->UpdateSubjectStaticData(SubjectName, RoleClass, MoveTemp(StaticData));
+}
+
+void FLiveLinkBridge::SubmitRemoveSubject(const FName& SubjectName)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	// Async mode: frames still queued for this subject must be sent before it is removed
+	if (Sender.IsValid())
+	{
+		Sender->EnqueueRemove(SubjectName);
+		return;
+	}
+	
+	Recorder.RecordRemove(SubjectName);
+	LiveLinkProvider->RemoveSubject(SubjectName);
+}
+
+void FLiveLinkBridge::RemoveTransformSubject(const FName& SubjectName)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	if (!bInitialized)
+	{
+		ULL_HOT_LOG(Warning,
+		            TEXT("RemoveTransformSubject: Not initialized, ignoring '%s'"),
+		            *SubjectName.ToString());
+		return;
+	}
+	
+	if (const int32* Handle = TransformSubjects.Find(SubjectName))
+	{
+		const FSubjectInfo* SubjectInfo = ResolveTransformHandle(*Handle);
+		const bool bPooled = SubjectInfo && SubjectInfo->PoolIndex != INDEX_NONE;
+		
+		ReleaseTransformSubjectSlot(*Handle);
+		
+		ULL_HOT_LOG(Log,
+		            TEXT("RemoveTransformSubject: Removed '%s' from local tracking%s"),
+		            *SubjectName.ToString(),
+		            bPooled ? TEXT(" (pooled subject hidden)") : TEXT(""));
+		
+		// Remove from LiveLink if provider exists (shared-memory subjects were removed with their slot,
+		// pooled subjects stay registered)
+		if (!bPooled && bLiveLinkSourceCreated && LiveLinkProvider.IsValid() && !SharedMemory.IsValid())
+		{
+			SubmitRemoveSubject(SubjectName);
+			ULL_HOT_LOG(Log,
+			            TEXT("RemoveTransformSubject: ✅ Removed '%s' from LiveLink via Message Bus"),
+			            *SubjectName.ToString());
+		}
+	}
+	else
+	{
+		ULL_HOT_LOG(Log,
+		            TEXT("RemoveTransformSubject: '%s' not found (safe to call on non-existent subjects)"),
+		            *SubjectName.ToString());
+	}
+}
+
+void FLiveLinkBridge::RemoveTransformSubjectByHandle(int32 Handle)
+{
+	FScopeLock Lock(&CriticalSection);
+	
+	const FSubjectInfo* SubjectInfo = ResolveTransformHandle(Handle);
+	if (!SubjectInfo)
+	{
+		ULL_HOT_LOG(Log,
+		            TEXT("RemoveTransformSubjectByHandle: Handle %d not found (safe to call on removed subjects)"),
+		            Handle);
+		return;
+	}
+	
+	// Copy name - the slot is released during removal (pooled subjects are indexed by entity)
+	const FName SubjectName = SubjectInfo->PoolIndex != INDEX_NONE ? SubjectInfo->EntityName : SubjectInfo->SubjectName;
+	RemoveTransformSubject(SubjectName);
+}
+
+//=============================================================================
+// Transform Subject Table (Handle Management)
+//=============================================================================
+// Handle layout: [generation:11][slot:20]. The generation is bumped each time a
+// slot is released, so a handle kept after ULL_RemoveObjectH cannot address the
+// subject that later reuses the slot.
+//=============================================================================
+
+static constexpr int32 HandleSlotBits = 20;
+static constexpr int32 HandleSlotMask = (1 << HandleSlotBits) - 1;
+static constexpr int32 HandleGenerationMask = 0x7FF;
+
+static FORCEINLINE int32 MakeSubjectHandle(int32 Slot, uint16 Generation)
+{
+	return ((int32)(Generation & HandleGenerationMask) << HandleSlotBits) | Slot;
+}
+
+int32 FLiveLinkBridge::AllocateTransformSubjectSlot(const FName& SubjectName)
+{
+	// Note: Caller must hold CriticalSection lock and SubjectTableLock (write)
+	
+	if (FreeTransformSubjectSlots.Num() > 0)
+	{
+		return FreeTransformSubjectSlots.Pop(EAllowShrinking::No);
+	}
+	
+	if (TransformSubjectTable.Num() > HandleSlotMask)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error, 
+		       TEXT("AllocateTransformSubjectSlot: Subject table full (%d subjects), cannot add '%s'"), 
+		       TransformSubjectTable.Num(), 
+		       *SubjectName.ToString());
+		return INDEX_NONE;
+	}
+	return TransformSubjectTable.AddDefaulted();
+}
+
+int32 FLiveLinkBridge::AddTransformSubjectSlot(const FName& SubjectName, int32 SchemaId)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	FWriteScopeLock TableLock(SubjectTableLock);
+	
+	const int32 Slot = AllocateTransformSubjectSlot(SubjectName);
+	if (Slot == INDEX_NONE)
+	{
+		return ULL_ERROR;
+	}
+	
+	FSubjectInfo& SubjectInfo = TransformSubjectTable[Slot];
+	SubjectInfo.SubjectName = SubjectName;
+	SubjectInfo.SchemaId = SchemaId;
+	SubjectInfo.ExpectedPropertyCount = PropertySchemas[SchemaId].PropertyNames.Num();
+	SubjectInfo.bInUse = true;
+	
+	const int32 Handle = MakeSubjectHandle(Slot, SubjectInfo.Generation);
+	TransformSubjects.Add(SubjectName, Handle);
+	
+	if (SharedMemory.IsValid())
+	{
+		SharedMemory->RegisterSlot(Slot, SubjectName, PropertySchemas[SchemaId].PropertyNames);
+	}
+	
+	return Handle;
+}
+
+void FLiveLinkBridge::ReleaseTransformSubjectSlot(int32 Handle)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	FSubjectInfo* SubjectInfo = ResolveTransformHandle(Handle);
+	if (!SubjectInfo)
+	{
+		return;
+	}
+	
+	if (SubjectInfo->PoolIndex != INDEX_NONE)
+	{
+		ReleasePooledSubject(*SubjectInfo, Handle & HandleSlotMask);
+		return;
+	}
+	
+	FWriteScopeLock TableLock(SubjectTableLock);
+	
+	TransformSubjects.Remove(SubjectInfo->SubjectName);
+	
+	if (SubjectInfo->bInInterestGrid)
+	{
+		RemoveFromInterestGrid(*SubjectInfo, Handle & HandleSlotMask);
+	}
+	SubjectInfo->bInterestHeld = false;    // A held frame of a removed subject is never sent
+	SubjectInfo->LastOutsideSendTime = 0.0;
+	
+	SubjectInfo->SubjectName = NAME_None;
+	SubjectInfo->SchemaId = INDEX_NONE;
+	SubjectInfo->ExpectedPropertyCount = 0;
+	SubjectInfo->bInUse = false;
+	SubjectInfo->bPendingFrame = false;    // Pending frame of a removed subject is never published
+	SubjectInfo->bIngestPending = false;   // ...nor an ingested one (the drain skips the slot)
+	SubjectInfo->PendingPropertyValues.Reset();
+	SubjectInfo->PendingSceneTime.Reset();
+	SubjectInfo->bHasLastSent = false;     // A subject reusing the slot always sends its first frame
+	SubjectInfo->LastSentPropertyValues.Reset();
+	SubjectInfo->Priority = ULL_PRIORITY_NORMAL;    // ...at the default tier
+	SubjectInfo->MinPublishInterval = 0.0f;
+	SubjectInfo->LastPublishTime = 0.0;
+	SubjectInfo->Generation = (SubjectInfo->Generation + 1) & HandleGenerationMask;
+	
+	if (SharedMemory.IsValid())
+	{
+		SharedMemory->ReleaseSlot(Handle & HandleSlotMask);
+	}
+	
+	FreeTransformSubjectSlots.Add(Handle & HandleSlotMask);
+}
+
+//=============================================================================
+// Subject Pools (Pool Mode)
+//=============================================================================
+// Pooled subjects live in the same table as individually registered ones, but
+// their slots never return to FreeTransformSubjectSlots: releasing an entity
+// bumps the generation (its handle goes stale), sends one hidden frame and puts
+// the slot back on its pool's free list. The LiveLink subject and its static
+// data stay in Unreal for the rest of the session.
+//=============================================================================
+
+int32 FLiveLinkBridge::AcquirePooledSubject(const FName& EntityName, int32 SchemaId)
+{
+	// Note: Caller must hold CriticalSection lock and have checked CanSendTransforms()
+	
+	int32 PoolIndex = PropertySchemas[SchemaId].PoolIndex;
+	if (PoolIndex == INDEX_NONE)
+	{
+		PoolIndex = SubjectPools.AddDefaulted();
+		SubjectPools[PoolIndex].SchemaId = SchemaId;
+		PropertySchemas[SchemaId].PoolIndex = PoolIndex;
+	}
+	
+	if (SubjectPools[PoolIndex].FreeSlots.Num() == 0 && !GrowSubjectPool(PoolIndex))
+	{
+		return ULL_ERROR;
+	}
+	
+	const int32 Slot = SubjectPools[PoolIndex].FreeSlots.Pop(EAllowShrinking::No);
+	FSubjectInfo& SubjectInfo = TransformSubjectTable[Slot];
+	int32 Handle;
+	{
+		FWriteScopeLock TableLock(SubjectTableLock);
+		SubjectInfo.EntityName = EntityName;
+		SubjectInfo.bInUse = true;
+		
+		Handle = MakeSubjectHandle(Slot, SubjectInfo.Generation);
+		TransformSubjects.Add(EntityName, Handle);
+	}
+	PoolAcquireCount++;
+	
+	ULL_HOT_LOG(Log,
+	            TEXT("AcquirePooledSubject: '%s' bound to pooled subject '%s' (handle %d)"),
+	            *EntityName.ToString(),
+	            *SubjectInfo.SubjectName.ToString(),
+	            Handle);
+	
+	return Handle;
+}
+
+bool FLiveLinkBridge::GrowSubjectPool(int32 PoolIndex)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	FSubjectPool& Pool = SubjectPools[PoolIndex];
+	const TArray<FName>& PropertyNames = PropertySchemas[Pool.SchemaId].PropertyNames;
+	
+	TArray<FName> PooledPropertyNames = PropertyNames;
+	PooledPropertyNames.Add(FName(ULL_POOL_VISIBLE_PROPERTY));
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("GrowSubjectPool: Registering %d pooled subjects for pool %d (%d properties, %d existing)"), 
+	       SubjectPoolSize, 
+	       PoolIndex, 
+	       PropertyNames.Num(), 
+	       Pool.SubjectCount);
+	
+	for (int32 i = 0; i < SubjectPoolSize; i++)
+	{
+		const FName PooledName(*FString::Printf(TEXT("%s%d_%04d"), ANSI_TO_TCHAR(ULL_POOL_SUBJECT_PREFIX), PoolIndex, Pool.SubjectCount));
+		int32 Slot;
+		{
+			FWriteScopeLock TableLock(SubjectTableLock);
+			Slot = AllocateTransformSubjectSlot(PooledName);
+			if (Slot == INDEX_NONE)
+			{
+				break;
+			}
+			
+			FSubjectInfo& SubjectInfo = TransformSubjectTable[Slot];
+			SubjectInfo.SubjectName = PooledName;
+			SubjectInfo.SchemaId = Pool.SchemaId;
+			SubjectInfo.ExpectedPropertyCount = PropertyNames.Num();
+			SubjectInfo.PoolIndex = PoolIndex;
+			SubjectInfo.EntityName = NAME_None;
+			SubjectInfo.bInUse = false;
+		}
+		
+		if (SharedMemory.IsValid())
+		{
+			SharedMemory->RegisterSlot(Slot, PooledName, PooledPropertyNames);
+		}
+		else if (bLiveLinkSourceCreated)
+		{
+			FLiveLinkStaticDataStruct StaticData(FLiveLinkTransformStaticData::StaticStruct());
+			StaticData.Cast<FLiveLinkTransformStaticData>()->PropertyNames = PooledPropertyNames;
+			SubmitStaticData(PooledName, ULiveLinkTransformRole::StaticClass(), MoveTemp(StaticData));
+		}
+		
+		Pool.FreeSlots.Add(Slot);
+		Pool.SubjectCount++;
+	}
+	
+	return Pool.FreeSlots.Num() > 0;
+}
+
+void FLiveLinkBridge::ReleasePooledSubject(FSubjectInfo& SubjectInfo, int32 Slot)
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	if (SubjectInfo.bInInterestGrid)
+	{
+		RemoveFromInterestGrid(SubjectInfo, Slot);
+	}
+	SubjectInfo.bInterestHeld = false;
+	SubjectInfo.LastOutsideSendTime = 0.0;
+	
+	{
+		FWriteScopeLock TableLock(SubjectTableLock);
+		TransformSubjects.Remove(SubjectInfo.EntityName);
+		SubjectInfo.EntityName = NAME_None;
+		SubjectInfo.bInUse = false;
+		SubjectInfo.bIngestPending = false;
+		SubjectInfo.Generation = (SubjectInfo.Generation + 1) & HandleGenerationMask;
+	}
+	SubjectInfo.bPendingFrame = false;    // The hidden frame below replaces any pending frame
+	SubjectInfo.PendingPropertyValues.Reset();
+	SubjectInfo.PendingSceneTime.Reset();
+	SubjectInfo.bHasLastSent = false;     // The next entity always sends its first frame
+	SubjectInfo.LastSentPropertyValues.Reset();
+	SubjectInfo.Priority = ULL_PRIORITY_NORMAL;    // ...at the default tier
+	SubjectInfo.MinPublishInterval = 0.0f;
+	SubjectInfo.LastPublishTime = 0.0;
+	
+	// Hide instead of remove: zero scale for actors that only follow the transform,
+	// and the visibility property at 0 (the schema's own values are zeroed as well)
+	if (CanSendTransforms())
+	{
+		const FTransform HiddenTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+		const int32 PropertyCount = SubjectInfo.ExpectedPropertyCount + 1;
+		PoolPropertyScratch.SetNumUninitialized(PropertyCount, EAllowShrinking::No);
+		FMemory::Memzero(PoolPropertyScratch.GetData(), PropertyCount * sizeof(float));
+		
+		if (SharedMemory.IsValid())
+		{
+			SharedMemory->WriteFrame(Slot, HiddenTransform, PoolPropertyScratch.GetData(), PropertyCount, FPlatformTime::Seconds());
+		}
+		else
+		{
+			PushTransformFrame(SubjectInfo.SubjectName, HiddenTransform, PoolPropertyScratch.GetData(), PropertyCount, FPlatformTime::Seconds());
+		}
+	}
+	
+	SubjectPools[SubjectInfo.PoolIndex].FreeSlots.Add(Slot);
+}
+
+FSubjectInfo* FLiveLinkBridge::ResolveTransformHandle(int32 Handle)
+{
+	// Note: Caller must hold CriticalSection lock or SubjectTableLock (read)
+	
+	if (Handle < 0)
+	{
+		return nullptr;
+	}
+	
+	const int32 Slot = Handle & HandleSlotMask;
+	if (!TransformSubjectTable.IsValidIndex(Slot))
+	{
+		return nullptr;
+	}
+	
+	FSubjectInfo& SubjectInfo = TransformSubjectTable[Slot];
+	if (!SubjectInfo.bInUse || MakeSubjectHandle(Slot, SubjectInfo.Generation) != Handle)
+	{
+		return nullptr;
+	}
+	
+	return &SubjectInfo;
+}
+
+FSubjectInfo* FLiveLinkBridge::FindTransformSubject(const FName& SubjectName)
+{
+	// Note: Caller must hold CriticalSection lock or SubjectTableLock (read)
+	
+	const int32* Handle = TransformSubjects.Find(SubjectName);
+	return Handle ? ResolveTransformHandle(*Handle) : nullptr;
+}
+
+//=============================================================================
+// Sharded Ingestion
+//=============================================================================
+// In coalescing mode an update only replaces the subject's latest value, so it
+// does not need the bridge lock: producers resolve the handle (or name) under
+// SubjectTableLock's read lock and write the value into the subject's Ingest*
+// fields under the lock of its shard, a block of 64 consecutive table slots.
+// Threads updating different subjects - parallel replications or add-ons with
+// their own objects - then share only the read lock and rarely a shard.
+//
+// The publish pass drains the shards under CriticalSection and feeds each
+// ingested value through SubmitTransformFrame, so pools, interest regions,
+// deadband and rate tiers see exactly what the locked path would have given
+// them. Simulation-time updates (anchor state) and unregistered names still
+// take the locked path.
+//=============================================================================
+
+void FLiveLinkBridge::IngestTransformFrame(
+	FIngestShard& Shard, 
+	FSubjectInfo& SubjectInfo, 
+	int32 Slot, 
+	const FTransform& Transform, 
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	double WorldTime)
+{
+	// Note: Caller must hold SubjectTableLock (read) and Shard.Lock
+	
+	if (SubjectInfo.bIngestPending)
+	{
+		Shard.CoalescedCount++;
+	}
+	else
+	{
+		SubjectInfo.bIngestPending = true;
+		Shard.DirtySlots.Add(Slot);
+	}
+	
+	SubjectInfo.IngestTransform = Transform;
+	SubjectInfo.IngestWorldTime = WorldTime;
+	// Capacity is kept per subject, so steady state does not allocate
+	SubjectInfo.IngestPropertyValues.SetNumUninitialized(PropertyCount, EAllowShrinking::No);
+	if (PropertyCount > 0)
+	{
+		FMemory::Memcpy(SubjectInfo.IngestPropertyValues.GetData(), PropertyValues, PropertyCount * sizeof(float));
+	}
+}
+
+bool FLiveLinkBridge::TryIngestTransformByHandle(
+	int32 Handle, 
+	const FTransform& Transform, 
+	const float* PropertyValues, 
+	int32 PropertyCount)
+{
+	if (!bShardedIngest.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+	
+	FReadScopeLock TableLock(SubjectTableLock);
+	
+	FSubjectInfo* SubjectInfo = ResolveTransformHandle(Handle);
+	if (!SubjectInfo || SubjectInfo->ExpectedPropertyCount != PropertyCount)
+	{
+		// The locked path reports it
+		return false;
+	}
+	
+	const int32 Slot = Handle & HandleSlotMask;
+	FIngestShard& Shard = GetIngestShard(Slot);
+	{
+		FScopeLock ShardLock(&Shard.Lock);
+		IngestTransformFrame(Shard, *SubjectInfo, Slot, Transform, PropertyValues, PropertyCount, FPlatformTime::Seconds());
+	}
+	if (LatencyProbe.IsProbeSubject(SubjectInfo->SubjectName))
+	{
+		LatencyProbe.RecordEnqueue(Transform);
+	}
+	
+	FLiveLinkStats::Add(Stats.TransformUpdatesReceived);
+	return true;
+}
+
+bool FLiveLinkBridge::TryIngestTransformByName(
+	const FName& SubjectName, 
+	const FTransform& Transform, 
+	const float* PropertyValues, 
+	int32 PropertyCount)
+{
+	if (!bShardedIngest.load(std::memory_order_acquire))
+	{
+		return false;
 	}
 	
-	if (TransformSubjects.Contains(SubjectName))
+	int32 Handle = ULL_ERROR;
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("RegisterTransformSubjectWithProperties: '%s' already registered"), 
-		       *SubjectName.ToString());
-		return;
+		FReadScopeLock TableLock(SubjectTableLock);
+		if (const int32* FoundHandle = TransformSubjects.Find(SubjectName))
+		{
+			Handle = *FoundHandle;
+		}
 	}
 	
-	// Ensure LiveLink source exists
-	EnsureLiveLinkSource();
-	
-	if (!bLiveLinkSourceCreated)
+	// Unregistered names are auto-registered by the locked path. The handle is checked again
+	// (the subject may be removed in between, which makes it stale).
+	return Handle >= 0 && TryIngestTransformByHandle(Handle, Transform, PropertyValues, PropertyCount);
+}
+
+bool FLiveLinkBridge::IngestTransformBatchByHandle(
+	const int32* Handles, 
+	const ULL_Transform* Transforms, 
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	int32 Count)
+{
+	if (!bShardedIngest.load(std::memory_order_acquire))
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Warning, 
-		       TEXT("RegisterTransformSubjectWithProperties: LiveLink source not available, cannot register '%s'"), 
-		       *SubjectName.ToString());
-		// Still track locally
-		TransformSubjects.Add(SubjectName, FSubjectInfo(PropertyNames));
-		return;
+		return false;
 	}
 	
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("RegisterTransformSubjectWithProperties: Registering '%s' with %d properties"), 
-	       *SubjectName.ToString(), 
-	       PropertyNames.Num());
-	
-	// Log property names
-	for (int32 i = 0; i < PropertyNames.Num(); i++)
+	// One timestamp for the whole batch; a shard lock is kept across consecutive slots of its block
+	const double WorldTime = FPlatformTime::Seconds();
+	int32 SkippedCount = 0;
+	FIngestShard* HeldShard = nullptr;
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("  Property[%d]: '%s'"), 
-		       i, 
-		       *PropertyNames[i].ToString());
+		FReadScopeLock TableLock(SubjectTableLock);
+		
+		for (int32 i = 0; i < Count; i++)
+		{
+			FSubjectInfo* SubjectInfo = ResolveTransformHandle(Handles[i]);
+			if (!SubjectInfo || SubjectInfo->ExpectedPropertyCount != PropertyCount)
+			{
+				SkippedCount++;
+				continue;
+			}
+			
+			const int32 Slot = Handles[i] & HandleSlotMask;
+			FIngestShard& Shard = GetIngestShard(Slot);
+			if (HeldShard != &Shard)
+			{
+				if (HeldShard)
+				{
+					HeldShard->Lock.Unlock();
+				}
+				Shard.Lock.Lock();
+				HeldShard = &Shard;
+			}
+			
+			const float* SubjectValues = PropertyCount > 0 ? PropertyValues + (int64)i * PropertyCount : nullptr;
+			IngestTransformFrame(Shard, *SubjectInfo, Slot, ConvertToFTransform(&Transforms[i]), SubjectValues, PropertyCount, WorldTime);
+		}
+		
+		if (HeldShard)
+		{
+			HeldShard->Lock.Unlock();
+		}
 	}
 	
-	// Create static data with property names
-	FLiveLinkStaticDataStruct StaticData(FLiveLinkTransformStaticData::StaticStruct());
-	FLiveLinkTransformStaticData* TransformStaticData = StaticData.Cast<FLiveLinkTransformStaticData>();
+	FLiveLinkStats::Add(Stats.TransformUpdatesReceived, Count);
+	FLiveLinkStats::Add(Stats.BatchCalls);
+	FLiveLinkStats::Add(Stats.TransformUpdatesDropped, SkippedCount);
 	
-	if (!TransformStaticData)
+	ULL_HOT_LOG_THROTTLED(IngestBatchCount, Log,
+	                      TEXT("IngestTransformBatchByHandle: (count: %d) ingested %d of %d subjects, skipped %d (invalid handle or property count mismatch)"),
+	                      IngestBatchCount,
+	                      Count - SkippedCount,
+	                      Count,
+	                      SkippedCount);
+	return true;
+}
+
+void FLiveLinkBridge::DrainIngestShardsLocked()
+{
+	// Note: Caller must hold CriticalSection lock
+	
+	if (!CanSendTransforms())
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Error, 
-		       TEXT("RegisterTransformSubjectWithProperties: Failed to cast static data for '%s'"), 
-		       *SubjectName.ToString());
 		return;
 	}
 	
-	// Set property names
-	TransformStaticData->PropertyNames = PropertyNames;
-	
-	// Push static data to LiveLink via Message Bus Provider
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("RegisterTransformSubjectWithProperties: Broadcasting static data with properties via Message Bus..."));
-	
-	LiveLinkProvider->UpdateSubjectStaticData(
-		SubjectName,
-		ULiveLinkTransformRole::StaticClass(),
-		MoveTemp(StaticData));
-	
-	// Track locally with properties
-	TransformSubjects.Add(SubjectName, FSubjectInfo(PropertyNames));
-	
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("RegisterTransformSubjectWithProperties: ✅ Successfully registered '%s' with %d properties via Message Bus"), 
-	       *SubjectName.ToString(), 
-	       PropertyNames.Num());
+	// The table itself only changes under CriticalSection, so only the shard locks are needed here
+	for (FIngestShard& Shard : IngestShards)
+	{
+		FScopeLock ShardLock(&Shard.Lock);
+		
+		CoalescedFrameCount += Shard.CoalescedCount;
+		Shard.CoalescedCount = 0;
+		
+		for (const int32 Slot : Shard.DirtySlots)
+		{
+			// Slot may have been released (or released and reused) since it was ingested
+			FSubjectInfo& SubjectInfo = TransformSubjectTable[Slot];
+			if (!SubjectInfo.bInUse || !SubjectInfo.bIngestPending)
+			{
+				continue;
+			}
+			
+			SubjectInfo.bIngestPending = false;
+			SubmitTransformFrame(
+				&SubjectInfo, 
+				SubjectInfo.SubjectName, 
+				SubjectInfo.IngestTransform, 
+				SubjectInfo.IngestPropertyValues.GetData(), 
+				SubjectInfo.IngestPropertyValues.Num(), 
+				SubjectInfo.IngestWorldTime);
+		}
+		
+		Shard.DirtySlots.Reset();
+	}
 }
 
-void FLiveLinkBridge::UpdateTransformSubject(
+//=============================================================================
+// Data Subjects
+//=============================================================================
+
+void FLiveLinkBridge::RegisterDataSubject(
 	const FName& SubjectName, 
-	const FTransform& Transform)
+	const TArray<FName>& PropertyNames)
 {
 	FScopeLock Lock(&CriticalSection);
 	
 	if (!bInitialized)
 	{
-		// Throttle logging for high-frequency updates
-		static int32 NotInitializedCount = 0;
-		if (++NotInitializedCount % 60 == 1)
-		{
-			UE_LOG(LogUnrealLiveLinkNative, Warning, 
-			       TEXT("UpdateTransformSubject: Not initialized (count: %d)"), 
-			       NotInitializedCount);
-		}
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("RegisterDataSubject: Not initialized, ignoring '%s'"), 
+		       *SubjectName.ToString());
 		return;
 	}
 	
-	// Auto-register if not already registered (matches mock behavior)
-	if (!TransformSubjects.Contains(SubjectName))
+	const int32 SchemaId = FindOrAddPropertySchema(PropertyNames);
+	
+	if (FSubjectInfo* ExistingInfo = DataSubjects.Find(SubjectName))
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("UpdateTransformSubject: Auto-registering '%s'"), 
-		       *SubjectName.ToString());
+		if (ExistingInfo->SchemaId == SchemaId)
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Log, 
+			       TEXT("RegisterDataSubject: '%s' already registered"), 
+			       *SubjectName.ToString());
+			return;
+		}
 		
-		RegisterTransformSubject(SubjectName);
+		UE_LOG(LogUnrealLiveLinkNative, Log, 
+		       TEXT("RegisterDataSubject: '%s' property layout changed (%d -> %d), re-registering"), 
+		       *SubjectName.ToString(), 
+		       ExistingInfo->ExpectedPropertyCount, 
+		       PropertyNames.Num());
 	}
 	
-	// Check if LiveLink source available
-	if (!bLiveLinkSourceCreated)
+	// Register with properties (replaces a previous layout; pending/last-sent state is reset)
+	DataSubjects.Add(SubjectName, FSubjectInfo(SchemaId, PropertyNames.Num()));
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("RegisterDataSubject: Registered '%s' with %d properties (schema %d)"), 
+	       *SubjectName.ToString(), 
+	       PropertyNames.Num(), 
+	       SchemaId);
+	
+	// Ensure LiveLink source exists
+	EnsureLiveLinkSource();
+	
+	// Staged initialization: static data goes out once the runtime is up
+	if (bEngineStaging)
 	{
-		// Throttle warning
-		static int32 NoSourceCount = 0;
-		if (++NoSourceCount % 60 == 1)
-		{
-			UE_LOG(LogUnrealLiveLinkNative, Warning, 
-			       TEXT("UpdateTransformSubject: LiveLink source not available (count: %d)"), 
-			       NoSourceCount);
-		}
 		return;
 	}
 	
-	// Create frame data
-	FLiveLinkFrameDataStruct FrameData(FLiveLinkTransformFrameData::StaticStruct());
-	FLiveLinkTransformFrameData* TransformFrameData = FrameData.Cast<FLiveLinkTransformFrameData>();
-	
-	if (!TransformFrameData)
+	if (!bLiveLinkSourceCreated)
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Error, 
-		       TEXT("UpdateTransformSubject: Failed to cast frame data for '%s'"), 
+		UE_LOG(LogUnrealLiveLinkNative, Warning, 
+		       TEXT("RegisterDataSubject: LiveLink source not available, '%s' tracked locally only"), 
 		       *SubjectName.ToString());
 		return;
 	}
 	
-	// Set transform and timestamp
-	TransformFrameData->Transform = Transform;
-	TransformFrameData->WorldTime = FLiveLinkWorldTime(FPlatformTime::Seconds());
-	
-	// Push frame data to LiveLink via Message Bus Provider
-	LiveLinkProvider->UpdateSubjectFrameData(
-		SubjectName,
-		MoveTemp(FrameData));
-	
-	// Throttle success logging for high-frequency updates
-	static int32 UpdateCount = 0;
-	if (++UpdateCount % 60 == 1)
+	if (!SubmitDataStaticData(SubjectName, SchemaId))
 	{
-		FVector Location = Transform.GetLocation();
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("UpdateTransformSubject: '%s' (count: %d) - Location: (%.2f, %.2f, %.2f) [Message Bus]"), 
-		       *SubjectName.ToString(), 
-		       UpdateCount, 
-		       Location.X, Location.Y, Location.Z);
+		return;
 	}
+	
+	UE_LOG(LogUnrealLiveLinkNative, Log, 
+	       TEXT("RegisterDataSubject: ✅ Registered '%s' as BasicRole via Message Bus"), 
+	       *SubjectName.ToString());
 }
 
-void FLiveLinkBridge::UpdateTransformSubjectWithProperties(
-	const FName& SubjectName, 
-	const FTransform& Transform, 
-	const TArray<float>& PropertyValues)
+bool FLiveLinkBridge::IsDataSubjectRegistered(const FName& SubjectName) const
 {
 	FScopeLock Lock(&CriticalSection);
+	return DataSubjects.Contains(SubjectName);
+}
+
+void FLiveLinkBridge::UpdateDataSubject(
+	const FName& SubjectName, 
+	const float* PropertyValues, 
+	int32 PropertyCount)
+{
+	FLiveLinkTimedScopeLock Lock(CriticalSection, Stats);
+	FLiveLinkStats::Add(Stats.DataUpdatesReceived, 1);
 	
 	if (!bInitialized)
 	{
-		static int32 NotInitializedCount = 0;
-		if (++NotInitializedCount % 60 == 1)
-		{
-			UE_LOG(LogUnrealLiveLinkNative, Warning, 
-			       TEXT("UpdateTransformSubjectWithProperties: Not initialized (count: %d)"), 
-			       NotInitializedCount);
-		}
+		ULL_HOT_LOG_THROTTLED(NotInitializedCount, Warning,
+		                      TEXT("UpdateDataSubject: Not initialized (count: %d)"),
+		                      NotInitializedCount);
+		FLiveLinkStats::Add(Stats.DataUpdatesDropped, 1);
 		return;
 	}
 	
 	// Validate property count
-	if (const FSubjectInfo* SubjectInfo = TransformSubjects.Find(SubjectName))
+	FSubjectInfo* SubjectInfo = DataSubjects.Find(SubjectName);
+	if (SubjectInfo)
 	{
-		if (SubjectInfo->ExpectedPropertyCount != PropertyValues.Num())
+		if (SubjectInfo->ExpectedPropertyCount != PropertyCount)
 		{
-			UE_LOG(LogUnrealLiveLinkNative, Error, 
-			       TEXT("UpdateTransformSubjectWithProperties: Property count mismatch for '%s' - expected %d, got %d"), 
-			       *SubjectName.ToString(), 
-			       SubjectInfo->ExpectedPropertyCount, 
-			       PropertyValues.Num());
+			ULL_HOT_LOG(Error,
+			            TEXT("UpdateDataSubject: Property count mismatch for '%s' - expected %d, got %d"),
+			            *SubjectName.ToString(),
+			            SubjectInfo->ExpectedPropertyCount,
+			            PropertyCount);
+			FLiveLinkStats::Add(Stats.DataUpdatesDropped);
 			return;
 		}
 	}
 	else
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Warning, 
-		       TEXT("UpdateTransformSubjectWithProperties: '%s' not registered, cannot validate property count"), 
-		       *SubjectName.ToString());
+		ULL_HOT_LOG(Warning,
+		            TEXT("UpdateDataSubject: '%s' not registered, cannot validate property count"),
+		            *SubjectName.ToString());
 	}
 	
 	// Check if LiveLink source available
-	if (!bLiveLinkSourceCreated)
+	if (!CanSendData())
 	{
-		static int32 NoSourceCount = 0;
-		if (++NoSourceCount % 60 == 1)
-		{
-			UE_LOG(LogUnrealLiveLinkNative, Warning, 
-			       TEXT("UpdateTransformSubjectWithProperties: LiveLink source not available (count: %d)"), 
-			       NoSourceCount);
-		}
+		ULL_HOT_LOG_THROTTLED(NoSourceCount, Warning,
+		                      TEXT("UpdateDataSubject: LiveLink source not available (count: %d)"),
+		                      NoSourceCount);
+		FLiveLinkStats::Add(Stats.DataUpdatesDropped, 1);
 		return;
 	}
 	
-	// Create frame data
-	FLiveLinkFrameDataStruct FrameData(FLiveLinkTransformFrameData::StaticStruct());
-	FLiveLinkTransformFrameData* TransformFrameData = FrameData.Cast<FLiveLinkTransformFrameData>();
-	
-	if (!TransformFrameData)
+	// Push basic-role frame (properties only) to LiveLink via Message Bus Provider
+	if (!SubmitDataFrame(SubjectInfo, SubjectName, PropertyValues, PropertyCount, FPlatformTime::Seconds()))
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Error, 
-		       TEXT("UpdateTransformSubjectWithProperties: Failed to cast frame data for '%s'"), 
-		       *SubjectName.ToString());
 		return;
 	}
 	
-	// Set transform, timestamp, and properties
-	TransformFrameData->Transform = Transform;
-	TransformFrameData->WorldTime = FLiveLinkWorldTime(FPlatformTime::Seconds());
-	TransformFrameData->PropertyValues = PropertyValues;
-	
-	// Push frame data to LiveLink via Message Bus Provider
-	LiveLinkProvider->UpdateSubjectFrameData(
-		SubjectName,
-		MoveTemp(FrameData));
-	
-	// Throttle success logging
-	static int32 UpdateCount = 0;
-	if (++UpdateCount % 60 == 1)
-	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("UpdateTransformSubjectWithProperties: '%s' (count: %d) with %d properties [Message Bus]"), 
-		       *SubjectName.ToString(), 
-		       UpdateCount, 
-		       PropertyValues.Num());
-	}
+	// Throttle logging
+	ULL_HOT_LOG_THROTTLED(UpdateCount, Log,
+	                      TEXT("UpdateDataSubject: '%s' (count: %d) with %d properties [Message Bus]"),
+	                      *SubjectName.ToString(),
+	                      UpdateCount,
+	                      PropertyCount);
 }
 
-void FLiveLinkBridge::RemoveTransformSubject(const FName& SubjectName)
+void FLiveLinkBridge::UpdateDataSubjectsBatch(
+	const TArray<FName>& SubjectNames, 
+	const float* PropertyValues, 
+	int32 PropertyCount)
 {
-	FScopeLock Lock(&CriticalSection);
+	FLiveLinkTimedScopeLock Lock(CriticalSection, Stats);
+	FLiveLinkStats::Add(Stats.DataUpdatesReceived, SubjectNames.Num());
+	FLiveLinkStats::Add(Stats.BatchCalls);
 	
 	if (!bInitialized)
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Warning, 
-		       TEXT("RemoveTransformSubject: Not initialized, ignoring '%s'"), 
-		       *SubjectName.ToString());
+		ULL_HOT_LOG_THROTTLED(NotInitializedCount, Warning,
+		                      TEXT("UpdateDataSubjectsBatch: Not initialized (count: %d)"),
+		                      NotInitializedCount);
+		FLiveLinkStats::Add(Stats.DataUpdatesDropped, SubjectNames.Num());
 		return;
 	}
 	
-	if (TransformSubjects.Remove(SubjectName) > 0)
+	if (!CanSendData())
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("RemoveTransformSubject: Removed '%s' from local tracking"), 
-		       *SubjectName.ToString());
+		ULL_HOT_LOG_THROTTLED(NoSourceCount, Warning,
+		                      TEXT("UpdateDataSubjectsBatch: LiveLink source not available (count: %d)"),
+		                      NoSourceCount);
+		FLiveLinkStats::Add(Stats.DataUpdatesDropped, SubjectNames.Num());
+		return;
+	}
+	
+	const double WorldTime = FPlatformTime::Seconds();
+	int32 SentCount = 0;
+	
+	for (int32 i = 0; i < SubjectNames.Num(); i++)
+	{
+		const FName& SubjectName = SubjectNames[i];
+		if (SubjectName.IsNone())
+		{
+			FLiveLinkStats::Add(Stats.DataUpdatesDropped);
+			continue;
+		}
 		
-		// Remove from LiveLink if provider exists
-		if (bLiveLinkSourceCreated && LiveLinkProvider.IsValid())
+		// Validate property count (same rule as UpdateDataSubject)
+		FSubjectInfo* SubjectInfo = DataSubjects.Find(SubjectName);
+		if (SubjectInfo && SubjectInfo->ExpectedPropertyCount != PropertyCount)
 		{
-			LiveLinkProvider->RemoveSubject(SubjectName);
-			UE_LOG(LogUnrealLiveLinkNative, Log, 
-			       TEXT("RemoveTransformSubject: ✅ Removed '%s' from LiveLink via Message Bus"), 
-			       *SubjectName.ToString());
+			ULL_HOT_LOG_THROTTLED(MismatchCount, Error,
+			                      TEXT("UpdateDataSubjectsBatch: Property count mismatch for '%s' - expected %d, got %d (count: %d)"),
+			                      *SubjectName.ToString(),
+			                      SubjectInfo->ExpectedPropertyCount,
+			                      PropertyCount,
+			                      MismatchCount);
+			FLiveLinkStats::Add(Stats.DataUpdatesDropped);
+			continue;
+		}
+		
+		const float* SubjectValues = PropertyCount > 0 ? PropertyValues + (int64)i * PropertyCount : nullptr;
+		if (SubmitDataFrame(SubjectInfo, SubjectName, SubjectValues, PropertyCount, WorldTime))
+		{
+			SentCount++;
 		}
 	}
-	else
-	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("RemoveTransformSubject: '%s' not found (safe to call on non-existent subjects)"), 
-		       *SubjectName.ToString());
-	}
+	
+	ULL_HOT_LOG_THROTTLED(BatchCount, Log,
+	                      TEXT("UpdateDataSubjectsBatch: (count: %d) sent %d of %d subjects with %d properties [Message Bus]"),
+	                      BatchCount,
+	                      SentCount,
+	                      SubjectNames.Num(),
+	                      PropertyCount);
 }
 
-//=============================================================================
-// Data Subjects
-//=============================================================================
-
-void FLiveLinkBridge::RegisterDataSubject(
+bool FLiveLinkBridge::PushDataFrame(
 	const FName& SubjectName, 
-	const TArray<FName>& PropertyNames)
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	double WorldTime)
 {
-	FScopeLock Lock(&CriticalSection);
+	// Note: Caller must hold CriticalSection lock and have checked bLiveLinkSourceCreated
 	
-	if (!bInitialized)
+	// Async mode: hand the frame to the sender thread (frame struct is built there)
+	if (Sender.IsValid())
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Warning, 
-		       TEXT("RegisterDataSubject: Not initialized, ignoring '%s'"), 
-		       *SubjectName.ToString());
-		return;
+		if (!Sender->EnqueueDataFrame(SubjectName, PropertyValues, PropertyCount, WorldTime))
+		{
+			FLiveLinkStats::Add(Stats.DataUpdatesDropped);
+			return false;
+		}
+		FLiveLinkStats::Add(Stats.DataUpdatesSent);
+		return true;
 	}
 	
-	if (DataSubjects.Contains(SubjectName))
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkBaseFrameData::StaticStruct());
+	FLiveLinkBaseFrameData* BaseFrameData = FrameData.Cast<FLiveLinkBaseFrameData>();
+	
+	if (!BaseFrameData)
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("RegisterDataSubject: '%s' already registered"), 
-		       *SubjectName.ToString());
-		return;
+		ULL_HOT_LOG(Error,
+		            TEXT("PushDataFrame: Failed to cast frame data for '%s'"),
+		            *SubjectName.ToString());
+		FLiveLinkStats::Add(Stats.DataUpdatesDropped);
+		return false;
 	}
 	
-	// Register with properties
-	DataSubjects.Add(SubjectName, FSubjectInfo(PropertyNames));
-	
-	UE_LOG(LogUnrealLiveLinkNative, Log, 
-	       TEXT("RegisterDataSubject: Registered '%s' with %d properties"), 
-	       *SubjectName.ToString(), 
-	       PropertyNames.Num());
-	
-	// Log property names
-	for (int32 i = 0; i < PropertyNames.Num(); i++)
+	BaseFrameData->WorldTime = FLiveLinkWorldTime(WorldTime);
+	if (PropertyCount > 0)
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("  Property[%d]: '%s'"), 
-		       i, 
-		       *PropertyNames[i].ToString());
+		BaseFrameData->PropertyValues.SetNumUninitialized(PropertyCount);
+		FMemory::Memcpy(BaseFrameData->PropertyValues.GetData(), PropertyValues, PropertyCount * sizeof(float));
 	}
 	
-	// TODO: Register with LiveLink as BasicRole
+	Recorder.RecordDataFrame(SubjectName, PropertyValues, PropertyCount, WorldTime);
+	
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	LiveLinkProvider->UpdateSubjectFrameData(
+		SubjectName,
+		MoveTemp(FrameData));
+	Stats.RecordFrameData(FPlatformTime::Cycles64() - StartCycles);
+	FLiveLinkStats::Add(Stats.DataUpdatesSent);
+	
+	return true;
 }
 
-void FLiveLinkBridge::UpdateDataSubject(
+bool FLiveLinkBridge::SubmitDataFrame(
+	FSubjectInfo* SubjectInfo, 
 	const FName& SubjectName, 
-	const TArray<float>& PropertyValues)
+	const float* PropertyValues, 
+	int32 PropertyCount, 
+	double WorldTime)
 {
-	FScopeLock Lock(&CriticalSection);
+	// Note: Caller must hold CriticalSection lock and have checked CanSendData()
 	
-	if (!bInitialized)
+	// Staging: unregistered subjects have no slot to wait in
+	if (bEngineStaging && !SubjectInfo)
 	{
-		static int32 NotInitializedCount = 0;
-		if (++NotInitializedCount % 60 == 1)
-		{
-			UE_LOG(LogUnrealLiveLinkNative, Warning, 
-			       TEXT("UpdateDataSubject: Not initialized (count: %d)"), 
-			       NotInitializedCount);
-		}
-		return;
+		FLiveLinkStats::Add(Stats.DataUpdatesDropped);
+		return false;
 	}
 	
-	// Validate property count
-	if (const FSubjectInfo* SubjectInfo = DataSubjects.Find(SubjectName))
+	if (!IsCoalescingMode() || !SubjectInfo)
 	{
-		if (SubjectInfo->ExpectedPropertyCount != PropertyValues.Num())
+		// Data subjects have no transform; identity makes the deadband compare values only
+		bool bKeepAlive = false;
+		const bool bTrackLastSent = bDeadbandEnabled && SubjectInfo;
+		if (bTrackLastSent && !PassesDeadband(*SubjectInfo, FTransform::Identity, PropertyValues, PropertyCount, bKeepAlive))
 		{
-			UE_LOG(LogUnrealLiveLinkNative, Error, 
-			       TEXT("UpdateDataSubject: Property count mismatch for '%s' - expected %d, got %d"), 
-			       *SubjectName.ToString(), 
-			       SubjectInfo->ExpectedPropertyCount, 
-			       PropertyValues.Num());
-			return;
+			return false;
+		}
+		if (!PushDataFrame(SubjectName, PropertyValues, PropertyCount, WorldTime))
+		{
+			return false;
 		}
+		if (bTrackLastSent)
+		{
+			RecordDeadbandSent(*SubjectInfo, FTransform::Identity, PropertyValues, PropertyCount, bKeepAlive);
+		}
+		return true;
+	}
+	
+	// Coalescing mode: overwrite the latest-value slot, the publish pass sends it
+	if (SubjectInfo->bPendingFrame)
+	{
+		CoalescedFrameCount++;
 	}
 	else
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Warning, 
-		       TEXT("UpdateDataSubject: '%s' not registered, cannot validate property count"), 
-		       *SubjectName.ToString());
+		SubjectInfo->bPendingFrame = true;
+		DirtyDataSubjects.Add(SubjectName);
 	}
 	
-	// Throttle logging
-	static int32 UpdateCount = 0;
-	if (++UpdateCount % 60 == 1)
+	SubjectInfo->PendingWorldTime = WorldTime;
+	SubjectInfo->PendingPropertyValues.SetNumUninitialized(PropertyCount, EAllowShrinking::No);
+	if (PropertyCount > 0)
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("UpdateDataSubject: '%s' (count: %d) with %d properties"), 
-		       *SubjectName.ToString(), 
-		       UpdateCount, 
-		       PropertyValues.Num());
+		FMemory::Memcpy(SubjectInfo->PendingPropertyValues.GetData(), PropertyValues, PropertyCount * sizeof(float));
 	}
 	
-	// TODO: Push data frame to LiveLink
+	return true;
 }
 
 void FLiveLinkBridge::RemoveDataSubject(const FName& SubjectName)
@@ -748,25 +4219,33 @@ void FLiveLinkBridge::RemoveDataSubject(const FName& SubjectName)
 	
 	if (!bInitialized)
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Warning, 
-		       TEXT("RemoveDataSubject: Not initialized, ignoring '%s'"), 
-		       *SubjectName.ToString());
+		ULL_HOT_LOG(Warning,
+		            TEXT("RemoveDataSubject: Not initialized, ignoring '%s'"),
+		            *SubjectName.ToString());
 		return;
 	}
 	
+	// A pending coalesced frame is dropped with the entry (the publish pass skips missing names)
 	if (DataSubjects.Remove(SubjectName) > 0)
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("RemoveDataSubject: Removed '%s'"), 
-		       *SubjectName.ToString());
+		ULL_HOT_LOG(Log,
+		            TEXT("RemoveDataSubject: Removed '%s' from local tracking"),
+		            *SubjectName.ToString());
 		
-		// TODO: Mark subject as removed in LiveLink
+		// Remove from LiveLink if provider exists
+		if (bLiveLinkSourceCreated && LiveLinkProvider.IsValid())
+		{
+			SubmitRemoveSubject(SubjectName);
+			ULL_HOT_LOG(Log,
+			            TEXT("RemoveDataSubject: ✅ Removed '%s' from LiveLink via Message Bus"),
+			            *SubjectName.ToString());
+		}
 	}
 	else
 	{
-		UE_LOG(LogUnrealLiveLinkNative, Log, 
-		       TEXT("RemoveDataSubject: '%s' not found (safe to call on non-existent subjects)"), 
-		       *SubjectName.ToString());
+		ULL_HOT_LOG(Log,
+		            TEXT("RemoveDataSubject: '%s' not found (safe to call on non-existent subjects)"),
+		            *SubjectName.ToString());
 	}
 }
 
@@ -776,25 +4255,6 @@ void FLiveLinkBridge::RemoveDataSubject(const FName& SubjectName)
 
 FName FLiveLinkBridge::GetCachedName(const char* cString)
 {
-	FScopeLock Lock(&CriticalSection);
-	
-	if (!cString || cString[0] == '\0')
-	{
-		return NAME_None;
-	}
-	
-	FString StringKey = UTF8_TO_TCHAR(cString);
-	
-	// Check cache first
-	if (FName* CachedName = NameCache.Find(StringKey))
-	{
-		// Cache hit - fast path
-		return *CachedName;
-	}
-	
-	// Cache miss - create and store
-	FName NewName(*StringKey);
-	NameCache.Add(StringKey, NewName);
-	
-	return NewName;
+	// No CriticalSection: the cache is internally synchronized per shard
+	return NameCache.FindOrAdd(cString);
 }
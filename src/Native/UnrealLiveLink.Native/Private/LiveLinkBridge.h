@@ -2,8 +2,20 @@
 
 #include "CoreMinimal.h"
 #include "HAL/CriticalSection.h"
+#include "Misc/ScopeRWLock.h"
 #include "Math/Transform.h"
 #include "UnrealLiveLink.Types.h"
+#include "LiveLinkSender.h"
+#include "LiveLinkTickThread.h"
+#include "LiveLinkNameCache.h"
+#include "LiveLinkStats.h"
+#include "LiveLinkSharedMemory.h"
+#include "LiveLinkRecorder.h"
+#include "LiveLinkReplayer.h"
+#include "LiveLinkLatencyProbe.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 // LiveLink includes Message Bus Provider API
 // Disable C4099 warning: UE has inconsistent class/struct forward declarations
@@ -13,6 +25,7 @@
 #include "LiveLinkTypes.h"
 #include "Roles/LiveLinkTransformRole.h"
 #include "Roles/LiveLinkTransformTypes.h"
+#include "Roles/LiveLinkBasicRole.h"
 #pragma warning(pop)
 
 //=============================================================================
@@ -24,39 +37,168 @@
 // - (Complete): State tracking, thread safety, FName caching
 // - (Complete): LiveLink framework dependencies integrated
 // - (Current): Transform subject registration and frame updates
-// - (Pending): Property streaming with subjects
+// - (Complete): Data subjects streamed as ULiveLinkBasicRole (properties only)
 //=============================================================================
 
 /// <summary>
 /// Subject information with property metadata
+/// Stored in a dense table so integer handles index directly into it
 /// </summary>
 struct FSubjectInfo
 {
-	TArray<FName> PropertyNames;
-	int32 ExpectedPropertyCount;
+	FName SubjectName;
+	int32 SchemaId;                 // Property schema (FLiveLinkBridge::PropertySchemas index)
+	int32 ExpectedPropertyCount;    // Cached schema property count (update-time check)
+	uint16 Generation;    // Bumped when the slot is released (stale handle detection)
+	bool bInUse;
+	
+	// Pool mode: pooled subjects keep SubjectName (their LiveLink name) for life and are bound to entities
+	int32 PoolIndex;      // Index into FLiveLinkBridge::SubjectPools (INDEX_NONE = not pooled)
+	FName EntityName;     // Entity currently bound to the pooled subject (NAME_None = hidden)
+	
+	// Last frame that passed the change-detection filter (deadband mode)
+	bool bHasLastSent;
+	double LastSentTime;    // FPlatformTime::Seconds() of the last send (keep-alive)
+	FTransform LastSentTransform;
+	TArray<float> LastSentPropertyValues;
+	
+	// Latest-value slot (coalescing mode): overwritten by each update, sent by the publish pass
+	bool bPendingFrame;
+	double PendingWorldTime;
+	TOptional<FQualifiedFrameTime> PendingSceneTime;    // Set for simulation-time frames
+	FTransform PendingTransform;
+	TArray<float> PendingPropertyValues;
+	
+	// Update-rate tier (coalescing mode): publish order under the budget and minimum frame interval
+	uint8 Priority;               // ULL_PRIORITY_*
+	float MinPublishInterval;     // Seconds between published frames (0 = ULL_RATE_UNLIMITED)
+	double LastPublishTime;       // FPlatformTime::Seconds() of the pass that last published this subject
+	
+	// Interest regions: grid cell of the latest position; outside every region the latest frame
+	// waits in the pending slot (bInterestHeld) until a region covers it or the outside rate is due
+	bool bInInterestGrid;
+	bool bInterestHeld;
+	uint8 InterestCoverage;       // EInterestCoverage of InterestCell for the current regions
+	uint64 InterestCell;          // FLiveLinkBridge::InterestGrid key (valid with bInInterestGrid)
+	double LastOutsideSendTime;   // FPlatformTime::Seconds() of the last frame sent from outside every region
+	
+	// Sharded ingestion (coalescing mode): latest update written under the slot's ingest shard
+	// lock instead of CriticalSection; the publish pass folds it into the latest-value slot
+	bool bIngestPending;
+	double IngestWorldTime;
+	FTransform IngestTransform;
+	TArray<float> IngestPropertyValues;
 	
 	FSubjectInfo() 
-		: ExpectedPropertyCount(0) 
+		: SchemaId(INDEX_NONE) 
+		, ExpectedPropertyCount(0) 
+		, Generation(0)
+		, bInUse(false)
+		, PoolIndex(INDEX_NONE)
+		, bHasLastSent(false)
+		, LastSentTime(0.0)
+		, bPendingFrame(false)
+		, PendingWorldTime(0.0)
+		, Priority(ULL_PRIORITY_NORMAL)
+		, MinPublishInterval(0.0f)
+		, LastPublishTime(0.0)
+		, bInInterestGrid(false)
+		, bInterestHeld(false)
+		, InterestCoverage(0)
+		, InterestCell(0)
+		, LastOutsideSendTime(0.0)
+		, bIngestPending(false)
+		, IngestWorldTime(0.0)
 	{}
 	
-	FSubjectInfo(const TArray<FName>& InPropertyNames) 
-		: PropertyNames(InPropertyNames)
-		, ExpectedPropertyCount(InPropertyNames.Num()) 
+	FSubjectInfo(int32 InSchemaId, int32 InPropertyCount) 
+		: SchemaId(InSchemaId)
+		, ExpectedPropertyCount(InPropertyCount) 
+		, Generation(0)
+		, bInUse(false)
+		, PoolIndex(INDEX_NONE)
+		, bHasLastSent(false)
+		, LastSentTime(0.0)
+		, bPendingFrame(false)
+		, PendingWorldTime(0.0)
+		, Priority(ULL_PRIORITY_NORMAL)
+		, MinPublishInterval(0.0f)
+		, LastPublishTime(0.0)
+		, bInInterestGrid(false)
+		, bInterestHeld(false)
+		, InterestCoverage(0)
+		, InterestCell(0)
+		, LastOutsideSendTime(0.0)
+		, bIngestPending(false)
+		, IngestWorldTime(0.0)
 	{}
 };
 
 /// <summary>
-/// Singleton managing LiveLink state and connections
-/// Thread-safe implementation with FCriticalSection
+/// Interned property name list shared by all subjects registered with the same names
+/// </summary>
+struct FPropertySchema
+{
+	TArray<FName> PropertyNames;
+	int32 NextInBucket = INDEX_NONE;    // Next schema with the same hash (FLiveLinkBridge::PropertySchemaBuckets)
+	int32 PoolIndex = INDEX_NONE;       // Pool mode: this schema's FSubjectPool
+};
+
+/// <summary>
+/// Pool mode: pooled transform subjects sharing one property schema
 /// </summary>
-class FLiveLinkBridge
+struct FSubjectPool
+{
+	int32 SchemaId = INDEX_NONE;    // Schema (pooled subjects append the visibility property)
+	TArray<int32> FreeSlots;        // Hidden pooled subjects (table slots)
+	int32 SubjectCount = 0;         // Pooled subjects created so far
+};
+
+/// <summary>
+/// One LiveLink session: provider, subject tables, lock and worker threads
+/// Get() is the process-wide default session (ULL_Initialize); CreateSession adds independent ones
+/// Thread-safe implementation with FCriticalSection (one per session)
+/// </summary>
+class FLiveLinkBridge : public TSharedFromThis<FLiveLinkBridge>
 {
 public:
 	/// <summary>
-	/// Get singleton instance
+	/// Get the default session instance
 	/// </summary>
 	static FLiveLinkBridge& Get();
 	
+	/// <summary>
+	/// Sessions are created through Get() and CreateSession (public for MakeShared)
+	/// </summary>
+	FLiveLinkBridge() = default;
+	~FLiveLinkBridge() = default;
+	
+	//=============================================================================
+	// Sessions
+	//=============================================================================
+	
+	/// <summary>
+	/// Create and initialize an independent session (ULL_CreateSession)
+	/// </summary>
+	/// <param name="InProviderName">Provider name, unique among live sessions</param>
+	/// <param name="Options">Optional init options (nullptr = synchronous defaults)</param>
+	/// <returns>Session ID (> ULL_DEFAULT_SESSION), or ULL_ERROR</returns>
+	static int32 CreateSession(const FString& InProviderName, const ULL_InitOptions* Options);
+	
+	/// <summary>
+	/// Shut down and release a session created by CreateSession (ULL_DestroySession)
+	/// Calls already running on the session finish first.
+	/// </summary>
+	/// <returns>ULL_OK, or ULL_ERROR for unknown IDs and ULL_DEFAULT_SESSION</returns>
+	static int32 DestroySession(int32 SessionId);
+	
+	/// <summary>
+	/// Look up a session (ULL_DEFAULT_SESSION = Get()). The returned pointer keeps the
+	/// session alive for the caller even if it is destroyed concurrently.
+	/// </summary>
+	/// <returns>Session, or null for unknown IDs</returns>
+	static TSharedPtr<FLiveLinkBridge> FindSession(int32 SessionId);
+	
 	//=============================================================================
 	// Lifecycle Management
 	//=============================================================================
@@ -65,8 +207,56 @@ public:
 	/// Initialize the LiveLink bridge
 	/// </summary>
 	/// <param name="InProviderName">Provider name displayed in Unreal's LiveLink window</param>
-	/// <returns>true if initialized successfully, false if already initialized</returns>
-	bool Initialize(const FString& InProviderName);
+	/// <param name="Options">Optional init options (nullptr = synchronous defaults)</param>
+	/// <returns>true if initialized successfully (or staging with ULL_INIT_MODE_ASYNC), false if already initialized</returns>
+	bool Initialize(const FString& InProviderName, const ULL_InitOptions* Options = nullptr);
+	
+	/// <summary>
+	/// Initialization progress for ULL_GetInitState
+	/// </summary>
+	/// <returns>ULL_INIT_STATE_*, or ULL_NOT_INITIALIZED</returns>
+	int GetInitState() const;
+	
+	/// <summary>
+	/// Whether update calls are queued to the sender thread (ULL_SEND_MODE_ASYNC)
+	/// </summary>
+	bool IsAsyncSendMode() const { return Sender.IsValid(); }
+	
+	/// <summary>
+	/// Whether updates only overwrite each subject's latest-value slot: publishRateHz > 0, or
+	/// while a staged initialization brings the engine runtime up
+	/// </summary>
+	bool IsCoalescingMode() const { return PublishRateHz > 0 || bEngineStaging; }
+	
+	/// <summary>
+	/// Send the latest pending frame of every dirty transform and data subject
+	/// Called by the publish thread at publishRateHz, and once more at Shutdown
+	/// </summary>
+	void PublishPendingFrames();
+	
+	/// <summary>
+	/// Fill hot-path statistics (counters, subject counts, name cache, lock wait, frame data histogram)
+	/// </summary>
+	/// <returns>ULL_OK, or ULL_NOT_INITIALIZED (OutStats zeroed)</returns>
+	int GetStats(ULL_Stats& OutStats) const;
+	
+	/// <summary>
+	/// Zero the statistics counters (including the deadband counters)
+	/// </summary>
+	/// <returns>ULL_OK or ULL_NOT_INITIALIZED</returns>
+	int ResetStats();
+	
+	/// <summary>
+	/// Change-detection counters for ULL_GetDeadbandCounters
+	/// </summary>
+	/// <returns>ULL_OK, or ULL_NOT_INITIALIZED (outputs set to 0)</returns>
+	int GetDeadbandCounters(uint64& OutSentFrames, uint64& OutSuppressedFrames, uint64& OutKeepAliveFrames) const;
+	
+	/// <summary>
+	/// Message Bus pump statistics for ULL_GetPumpStats
+	/// </summary>
+	/// <returns>ULL_OK, or ULL_NOT_INITIALIZED (OutStats zeroed)</returns>
+	int GetPumpStats(ULL_PumpStats& OutStats) const;
 	
 	/// <summary>
 	/// Shutdown the LiveLink bridge and clear all state
@@ -92,12 +282,59 @@ public:
 	/// <summary>
 	/// Register a transform subject without properties
 	/// </summary>
-	void RegisterTransformSubject(const FName& SubjectName);
+	/// <returns>Subject handle (>= 0), or a negative ULL_* error code</returns>
+	int32 RegisterTransformSubject(const FName& SubjectName);
 	
 	/// <summary>
 	/// Register a transform subject with custom properties
 	/// </summary>
-	void RegisterTransformSubjectWithProperties(const FName& SubjectName, const TArray<FName>& PropertyNames);
+	/// <returns>Subject handle (>= 0), or a negative ULL_* error code</returns>
+	int32 RegisterTransformSubjectWithProperties(const FName& SubjectName, const TArray<FName>& PropertyNames);
+	
+	/// <summary>
+	/// Register a transform subject with a schema from RegisterPropertySchema
+	/// </summary>
+	/// <returns>Subject handle (>= 0), or a negative ULL_* error code</returns>
+	int32 RegisterTransformSubjectWithSchema(const FName& SubjectName, int32 SchemaId);
+	
+	/// <summary>
+	/// Register many transform subjects under one lock (startup warm-up)
+	/// SchemaIds may be null (no properties); OutHandles receives a handle or ULL_* code per subject
+	/// </summary>
+	/// <returns>Number of subjects registered, or a negative ULL_* error code</returns>
+	int32 RegisterTransformSubjectsBatch(const TArray<FName>& SubjectNames, const int32* SchemaIds, int32* OutHandles);
+	
+	/// <summary>
+	/// Intern a property name list; identical lists return the same schema ID until Shutdown
+	/// </summary>
+	/// <returns>Schema ID (>= 0), or ULL_NOT_INITIALIZED</returns>
+	int32 RegisterPropertySchema(const TArray<FName>& PropertyNames);
+	
+	/// <summary>
+	/// Set the update-rate tier of a transform subject (coalescing mode)
+	/// </summary>
+	/// <returns>ULL_OK, ULL_ERROR (stale handle, invalid priority or rate) or ULL_NOT_INITIALIZED</returns>
+	int32 SetTransformSubjectScheduleByHandle(int32 Handle, int32 Priority, int32 MaxRateHz);
+	
+	/// <summary>
+	/// Set the update-rate tier of a transform or data subject by name (coalescing mode)
+	/// </summary>
+	/// <returns>ULL_OK, ULL_ERROR (unknown subject, invalid priority or rate) or ULL_NOT_INITIALIZED</returns>
+	int32 SetSubjectSchedule(const FName& SubjectName, int32 Priority, int32 MaxRateHz);
+	
+	/// <summary>
+	/// Replace the regions of interest (Count 0 clears them) and send the held frames of
+	/// subjects the new regions cover
+	/// </summary>
+	/// <param name="OutsideRateHz">Frame rate outside every region (ULL_INTEREST_SUPPRESS = none)</param>
+	/// <returns>ULL_OK, ULL_ERROR (invalid regions or rate) or ULL_NOT_INITIALIZED</returns>
+	int32 SetInterestRegions(const ULL_InterestRegion* Regions, int32 Count, int32 OutsideRateHz);
+	
+	/// <summary>
+	/// Interest-region counters for ULL_GetInterestCounters
+	/// </summary>
+	/// <returns>ULL_OK, or ULL_NOT_INITIALIZED (outputs set to 0)</returns>
+	int GetInterestCounters(uint64& OutHeldFrames, uint64& OutOutsideFrames, int32& OutGridCells) const;
 	
 	/// <summary>
 	/// Update transform for a subject (auto-registers if needed)
@@ -105,40 +342,169 @@ public:
 	void UpdateTransformSubject(const FName& SubjectName, const FTransform& Transform);
 	
 	/// <summary>
-	/// Update transform and properties for a subject
+	/// Update transform and properties for a subject.
+	/// PropertyValues is the caller's buffer; it is copied once, straight into the frame.
+	/// </summary>
+	void UpdateTransformSubjectWithProperties(const FName& SubjectName, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount);
+	
+	/// <summary>
+	/// Update transforms for many subjects under a single lock acquisition (auto-registers if needed)
+	/// </summary>
+	/// <param name="SubjectNames">Subject names (NAME_None entries are skipped)</param>
+	/// <param name="Transforms">Transforms, one per subject name</param>
+	void UpdateTransformSubjectsBatch(const TArray<FName>& SubjectNames, const ULL_Transform* Transforms);
+	
+	/// <summary>
+	/// Update transforms and properties for many subjects under a single lock acquisition
 	/// </summary>
-	void UpdateTransformSubjectWithProperties(const FName& SubjectName, const FTransform& Transform, const TArray<float>& PropertyValues);
+	/// <param name="PropertyValues">Contiguous values, PropertyCount per subject</param>
+	/// <param name="PropertyCount">Property count shared by every subject in the batch</param>
+	void UpdateTransformSubjectsBatchWithProperties(const TArray<FName>& SubjectNames, const ULL_Transform* Transforms, const float* PropertyValues, int32 PropertyCount);
 	
 	/// <summary>
 	/// Remove a transform subject
 	/// </summary>
 	void RemoveTransformSubject(const FName& SubjectName);
 	
+	//=============================================================================
+	// Transform Subjects by Handle (no string conversion or name lookup)
+	//=============================================================================
+	
+	/// <summary>
+	/// Update transform for a registered subject handle
+	/// Invalid or stale handles are ignored (throttled warning)
+	/// </summary>
+	void UpdateTransformSubjectByHandle(int32 Handle, const FTransform& Transform);
+	
+	/// <summary>
+	/// Update transform and properties for a registered subject handle
+	/// </summary>
+	/// <param name="SimTime">Simulation time in seconds (unset = stamp with FPlatformTime::Seconds())</param>
+	void UpdateTransformSubjectWithPropertiesByHandle(int32 Handle, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, const TOptional<double>& SimTime = TOptional<double>());
+	
+	/// <summary>
+	/// Update many subject handles under a single lock acquisition
+	/// </summary>
+	/// <param name="PropertyValues">Contiguous values, PropertyCount per subject (nullptr when PropertyCount is 0)</param>
+	/// <param name="SimTime">Simulation time in seconds shared by the batch (unset = stamp with FPlatformTime::Seconds())</param>
+	void UpdateTransformSubjectsBatchByHandle(const int32* Handles, const ULL_Transform* Transforms, const float* PropertyValues, int32 PropertyCount, int32 Count, const TOptional<double>& SimTime = TOptional<double>());
+	
+	/// <summary>
+	/// Remove a transform subject by handle (the handle becomes invalid)
+	/// </summary>
+	void RemoveTransformSubjectByHandle(int32 Handle);
+	
 	//=============================================================================
 	// Data Subjects (Properties only, no 3D representation)
 	//=============================================================================
 	
 	/// <summary>
-	/// Register a data-only subject
+	/// Register a data-only subject with LiveLink as ULiveLinkBasicRole.
+	/// Registering again with different property names re-sends the static data.
 	/// </summary>
 	void RegisterDataSubject(const FName& SubjectName, const TArray<FName>& PropertyNames);
 	
 	/// <summary>
-	/// Update data subject property values
+	/// Check whether a data subject is registered
+	/// </summary>
+	bool IsDataSubjectRegistered(const FName& SubjectName) const;
+	
+	/// <summary>
+	/// Update data subject property values (caller's buffer, not retained)
+	/// </summary>
+	void UpdateDataSubject(const FName& SubjectName, const float* PropertyValues, int32 PropertyCount);
+	
+	/// <summary>
+	/// Update many data subjects under a single lock acquisition
 	/// </summary>
-	void UpdateDataSubject(const FName& SubjectName, const TArray<float>& PropertyValues);
+	/// <param name="SubjectNames">Subject names (NAME_None entries are skipped)</param>
+	/// <param name="PropertyValues">Contiguous values, PropertyCount per subject</param>
+	/// <param name="PropertyCount">Property count shared by every subject in the batch</param>
+	void UpdateDataSubjectsBatch(const TArray<FName>& SubjectNames, const float* PropertyValues, int32 PropertyCount);
 	
 	/// <summary>
 	/// Remove a data subject
 	/// </summary>
 	void RemoveDataSubject(const FName& SubjectName);
 	
+	//=============================================================================
+	// Capture and Replay
+	//=============================================================================
+	
+	/// <summary>
+	/// Start recording every frame sent to the provider to a capture file.
+	/// Subjects registered earlier are written first so the capture is self-contained.
+	/// </summary>
+	/// <returns>ULL_OK, ULL_NOT_INITIALIZED, or ULL_ERROR (file not created, or shared-memory transport)</returns>
+	int StartCapture(const FString& FilePath);
+	
+	/// <summary>
+	/// Finalize and close the capture file
+	/// </summary>
+	/// <returns>ULL_OK (also when no capture is running) or ULL_NOT_INITIALIZED</returns>
+	int StopCapture();
+	
+	/// <summary>
+	/// Stream a capture file through the provider on the replay thread (replaces a running replay)
+	/// </summary>
+	/// <param name="Speed">Playback speed multiplier (ULL_REPLAY_PAUSED = start paused)</param>
+	/// <param name="bLoop">Restart at the end of the capture</param>
+	/// <returns>ULL_OK, ULL_NOT_INITIALIZED, ULL_NOT_CONNECTED (no provider), or ULL_ERROR (unreadable file)</returns>
+	int StartReplay(const FString& FilePath, double Speed, bool bLoop);
+	
+	/// <returns>ULL_OK, ULL_NOT_INITIALIZED, or ULL_ERROR (no replay running)</returns>
+	int SetReplaySpeed(double Speed);
+	
+	/// <returns>ULL_OK, ULL_NOT_INITIALIZED, or ULL_ERROR (no replay running)</returns>
+	int SeekReplay(double Seconds);
+	
+	/// <summary>
+	/// Stop the replay and remove the replayed subjects
+	/// </summary>
+	/// <returns>ULL_OK (also when no replay is running) or ULL_NOT_INITIALIZED</returns>
+	int StopReplay();
+	
+	/// <summary>
+	/// Replay position and capture length
+	/// </summary>
+	/// <returns>ULL_OK, ULL_NOT_INITIALIZED, or ULL_ERROR (no replay running, outputs 0)</returns>
+	int GetReplayStatus(double& OutPositionSeconds, double& OutDurationSeconds) const;
+	
+	/// <summary>
+	/// Last frame the replay sent for a subject (see FLiveLinkReplayer::GetSentFrame)
+	/// </summary>
+	/// <returns>ULL_OK, ULL_NOT_INITIALIZED, or ULL_ERROR (no replay running or no frame of the subject)</returns>
+	int GetReplayFrame(const FName& SubjectName, FTransform& OutTransform, TArray<float>& OutPropertyValues) const;
+	
+	//=============================================================================
+	// Latency Probe
+	//=============================================================================
+	
+	/// <summary>
+	/// Register the probe subject and send a probe through the update path RateHz times
+	/// per second (replaces a running probe)
+	/// </summary>
+	/// <param name="EchoPort">UDP port for the Unreal-side echo (0 = in-process stages only)</param>
+	/// <param name="CsvPath">CSV file written every ULL_LATENCY_CSV_INTERVAL_SECONDS (empty = none)</param>
+	/// <returns>ULL_OK, ULL_NOT_INITIALIZED, or ULL_ERROR (invalid rate, socket or file, subject pools or shared-memory transport)</returns>
+	int StartLatencyProbe(int32 RateHz, int32 EchoPort, const FString& CsvPath);
+	
+	/// <summary>
+	/// Stop the probe thread, write the last CSV row and remove the probe subject
+	/// </summary>
+	/// <returns>ULL_OK (also when no probe is running) or ULL_NOT_INITIALIZED</returns>
+	int StopLatencyProbe();
+	
+	/// <returns>ULL_OK, or ULL_NOT_INITIALIZED (zeroed; also zero while no probe has run)</returns>
+	int GetLatencyStats(ULL_LatencyStats& OutStats) const;
+	
 	//=============================================================================
 	// FName Caching (Performance Optimization)
 	//=============================================================================
 	
 	/// <summary>
-	/// Get cached FName for C string (optimizes repeated conversions)
+	/// Get cached FName for C string (optimizes repeated conversions).
+	/// Does not take CriticalSection; hits are lock-free of the bridge and allocation-free.
 	/// </summary>
 	/// <param name="cString">UTF-8 C string</param>
 	/// <returns>Cached FName or newly created and cached FName</returns>
@@ -155,14 +521,93 @@ public:
 	
 private:
 	/// <summary>
-	/// Private constructor for singleton
+	/// Default session storage (FindSession(ULL_DEFAULT_SESSION) shares it)
 	/// </summary>
-	FLiveLinkBridge() = default;
+	static const TSharedPtr<FLiveLinkBridge>& GetDefaultSession();
 	
 	/// <summary>
-	/// Private destructor
+	/// True if the default session or a registered session uses the provider name.
+	/// Caller must hold SessionLock
 	/// </summary>
-	~FLiveLinkBridge() = default;
+	static bool IsProviderNameInUse(const FString& InProviderName);
+	
+	/// <summary>
+	/// Claim the default session's provider name in the session registry (Initialize of the
+	/// default session). Caller must not hold CriticalSection.
+	/// </summary>
+	/// <returns>false if a registered session uses the name</returns>
+	static bool ReserveDefaultProviderName(const FString& InProviderName);
+	
+	/// <summary>
+	/// Give the default session's provider name back (failed Initialize, Shutdown)
+	/// </summary>
+	static void ReleaseDefaultProviderName();
+	
+	/// <summary>
+	/// Join the process-wide Message Bus pump, starting it at RateHz if no session runs it yet
+	/// </summary>
+	/// <returns>true if the pump is running (ReleasePump must be called at Shutdown)</returns>
+	static bool AcquirePump(int32 RateHz);
+	
+	/// <summary>
+	/// Leave the pump; the last session stops it
+	/// </summary>
+	static void ReleasePump();
+	
+	//=============================================================================
+	// Engine Runtime and Staged Initialization
+	//=============================================================================
+	
+	/// <summary>
+	/// Bring up the process-wide engine runtime (GEngineLoop.PreInit, UObjects, UdpMessaging,
+	/// plugins) unless it is already up
+	/// Caller must hold EngineLoopLock
+	/// </summary>
+	/// <returns>false if GEngineLoop.PreInit failed</returns>
+	static bool InitializeEngineLoop();
+	
+	/// <summary>
+	/// Start (or join) the background bring-up for ULL_INIT_MODE_ASYNC and mark the session
+	/// initialized with updates buffered. Caller must hold CriticalSection.
+	/// </summary>
+	/// <returns>false if the runtime is already up or the options need it now (initialize synchronously)</returns>
+	bool BeginStagedInitialize(const FString& InProviderName, const ULL_InitOptions& ResolvedOptions);
+	
+	/// <summary>
+	/// Bring the runtime up for a synchronous Initialize. Once the engine thread owns the runtime
+	/// the bring-up (a retry after a failure) runs there and this only waits for it.
+	/// Caller must hold CriticalSection, not EngineLoopLock.
+	/// </summary>
+	/// <returns>false if GEngineLoop.PreInit failed</returns>
+	static bool BringUpEngineLoop();
+	
+	/// <summary>
+	/// Engine thread body: run each requested bring-up, then park. Never returns.
+	/// </summary>
+	static void RunEngineThread();
+	
+	/// <summary>
+	/// Bring the runtime up on the engine thread, then complete every waiting session
+	/// </summary>
+	static void StageEngineLoop();
+	
+	/// <summary>
+	/// Block until no bring-up is requested or running on the engine thread (the join point
+	/// for a session shut down while staging). Caller must not hold CriticalSection.
+	/// </summary>
+	static void WaitForEngineThreadIdle();
+	
+	/// <summary>
+	/// Finish a staged session once the runtime is up: start its threads and provider, register
+	/// the subjects tracked so far and publish their buffered updates. Takes CriticalSection.
+	/// </summary>
+	void CompleteStagedInitialize(bool bEngineReady);
+	
+	/// <summary>
+	/// Session part of Initialize (threads, filters, transport, provider, pump); the runtime must be up
+	/// Caller must hold CriticalSection and EngineLoopLock
+	/// </summary>
+	void StartSession(const ULL_InitOptions& ResolvedOptions);
 	
 	//=============================================================================
 	// Helper Methods
@@ -174,6 +619,295 @@ private:
 	/// </summary>
 	void EnsureLiveLinkSource();
 	
+	/// <summary>
+	/// One Message Bus pump tick (runs on the pump thread, never takes CriticalSection)
+	/// </summary>
+	static void PumpMessageBus(double DeltaSeconds);
+	
+	/// <summary>
+	/// Build and push one transform frame to the provider
+	/// Caller must hold CriticalSection and have verified bLiveLinkSourceCreated
+	/// </summary>
+	/// <returns>true if the frame was handed to the provider (or queued in async mode)</returns>
+	bool PushTransformFrame(const FName& SubjectName, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, double WorldTime, const TOptional<FQualifiedFrameTime>& SceneTime = TOptional<FQualifiedFrameTime>());
+	
+	/// <summary>
+	/// Route one transform update: write it to shared memory (shared-memory transport),
+	/// store it in the subject's latest-value slot in coalescing mode, otherwise push it immediately
+	/// Caller must hold CriticalSection and have verified CanSendTransforms()
+	/// </summary>
+	/// <param name="SubjectInfo">Table entry for the subject (nullptr = unregistered, always pushed)</param>
+	/// <param name="SceneTime">Scene time of a simulation-time frame (unset for send-time frames)</param>
+	bool SubmitTransformFrame(FSubjectInfo* SubjectInfo, const FName& SubjectName, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, double WorldTime, const TOptional<FQualifiedFrameTime>& SceneTime = TOptional<FQualifiedFrameTime>());
+	
+	/// <summary>
+	/// Map a simulation time to the frame's world time (anchored to FPlatformTime::Seconds() at the
+	/// first timed frame, re-anchored when simulation time goes backwards) and scene time
+	/// Caller must hold CriticalSection
+	/// </summary>
+	double MapSimulationTime(double SimTime, TOptional<FQualifiedFrameTime>& OutSceneTime);
+	
+	/// <summary>
+	/// True if transform frames have somewhere to go (provider, shared-memory table, or the
+	/// latest-value slots while staging)
+	/// Caller must hold CriticalSection
+	/// </summary>
+	bool CanSendTransforms() const { return bLiveLinkSourceCreated || SharedMemory.IsValid() || bEngineStaging; }
+	
+	/// <summary>
+	/// True if data subject frames have somewhere to go (provider, or the latest-value slots while staging)
+	/// Caller must hold CriticalSection
+	/// </summary>
+	bool CanSendData() const { return bLiveLinkSourceCreated || bEngineStaging; }
+	
+	/// <summary>
+	/// Send a transform subject's static data (schema property names) to the provider
+	/// Caller must hold CriticalSection and have verified bLiveLinkSourceCreated
+	/// </summary>
+	bool SubmitTransformStaticData(const FName& SubjectName, int32 SchemaId);
+	
+	/// <summary>
+	/// Send a data subject's static data (basic role, schema property names) to the provider
+	/// Caller must hold CriticalSection and have verified bLiveLinkSourceCreated
+	/// </summary>
+	bool SubmitDataStaticData(const FName& SubjectName, int32 SchemaId);
+	
+	/// <summary>
+	/// Build and push one basic-role (properties only) frame to the provider
+	/// Caller must hold CriticalSection and have verified bLiveLinkSourceCreated
+	/// </summary>
+	bool PushDataFrame(const FName& SubjectName, const float* PropertyValues, int32 PropertyCount, double WorldTime);
+	
+	/// <summary>
+	/// Route one data subject update (coalesced or pushed immediately, same rules as SubmitTransformFrame)
+	/// Caller must hold CriticalSection and have verified CanSendData()
+	/// </summary>
+	/// <param name="SubjectInfo">DataSubjects entry (nullptr = unregistered, always pushed)</param>
+	bool SubmitDataFrame(FSubjectInfo* SubjectInfo, const FName& SubjectName, const float* PropertyValues, int32 PropertyCount, double WorldTime);
+	
+	/// <summary>
+	/// Change-detection filter: true if the frame differs from the subject's last sent frame
+	/// beyond the deadband (or the keep-alive interval elapsed). Does not record it: the caller
+	/// calls RecordDeadbandSent once the frame was actually pushed.
+	/// Caller must hold CriticalSection and have checked bDeadbandEnabled
+	/// </summary>
+	/// <param name="bOutKeepAlive">true if it only passes as a keep-alive resend</param>
+	bool PassesDeadband(const FSubjectInfo& SubjectInfo, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, bool& bOutKeepAlive);
+	
+	/// <summary>
+	/// Record a pushed frame as the subject's last sent frame (deadband reference, keep-alive timer).
+	/// Caller must hold CriticalSection
+	/// </summary>
+	void RecordDeadbandSent(FSubjectInfo& SubjectInfo, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, bool bKeepAlive);
+	
+	/// <summary>
+	/// Interest filter: true if the frame should go out (inside a region, outside rate due, or
+	/// already scheduled by the publish pass), otherwise keeps it as the subject's held frame.
+	/// Moves the subject to the grid cell of its new position.
+	/// Caller must hold CriticalSection and have checked InterestRegions
+	/// </summary>
+	bool PassesInterestFilter(FSubjectInfo& SubjectInfo, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, double WorldTime, const TOptional<FQualifiedFrameTime>& SceneTime);
+	
+	/// <summary>
+	/// Coverage of one grid cell by the current regions (EInterestCoverage)
+	/// Caller must hold CriticalSection
+	/// </summary>
+	uint8 ComputeInterestCoverage(const FIntVector& Cell) const;
+	
+	/// <summary>
+	/// True if a position is inside or on any region
+	/// Caller must hold CriticalSection
+	/// </summary>
+	bool IsInInterestRegion(const FVector& Location) const;
+	
+	/// <summary>
+	/// Remove a transform subject from the interest grid and drop its held frame
+	/// Caller must hold CriticalSection
+	/// </summary>
+	void RemoveFromInterestGrid(FSubjectInfo& SubjectInfo, int32 Slot);
+	
+	/// <summary>
+	/// Send a held frame (mark it dirty in coalescing mode, push it otherwise)
+	/// Caller must hold CriticalSection and have verified CanSendTransforms()
+	/// </summary>
+	void ReleaseInterestHeldFrame(FSubjectInfo& SubjectInfo, int32 Slot);
+	
+	/// <summary>
+	/// Store a frame in the subject's latest-value slot (capacity is kept, steady state does not allocate)
+	/// Caller must hold CriticalSection
+	/// </summary>
+	static void StorePendingFrame(FSubjectInfo& SubjectInfo, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, double WorldTime, const TOptional<FQualifiedFrameTime>& SceneTime);
+	
+	/// <summary>
+	/// Publish pass body
+	/// Caller must hold CriticalSection
+	/// </summary>
+	void PublishPendingFramesLocked();
+	
+	//=============================================================================
+	// Sharded Ingestion
+	//=============================================================================
+	
+	/// <summary>
+	/// Ingest shard of a table slot (blocks of 2^IngestShardSlotBits consecutive slots)
+	/// </summary>
+	struct FIngestShard;
+	FIngestShard& GetIngestShard(int32 Slot) { return IngestShards[(Slot >> IngestShardSlotBits) & (IngestShardCount - 1)]; }
+	
+	/// <summary>
+	/// Store an update in the subject's ingest slot and mark it for the next publish pass
+	/// Caller must hold SubjectTableLock (read) and Shard.Lock
+	/// </summary>
+	static void IngestTransformFrame(FIngestShard& Shard, FSubjectInfo& SubjectInfo, int32 Slot, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, double WorldTime);
+	
+	/// <summary>
+	/// Sharded ingestion of one update by handle, without CriticalSection
+	/// </summary>
+	/// <returns>false if sharded ingestion is off or the handle/property count is not valid (take the locked path)</returns>
+	bool TryIngestTransformByHandle(int32 Handle, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount);
+	
+	/// <summary>
+	/// Sharded ingestion of one update of a registered subject by name, without CriticalSection
+	/// </summary>
+	/// <returns>false if sharded ingestion is off or the subject is not registered with PropertyCount values (take the locked path)</returns>
+	bool TryIngestTransformByName(const FName& SubjectName, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount);
+	
+	/// <summary>
+	/// Sharded ingestion of a handle batch, without CriticalSection (invalid entries are counted as dropped)
+	/// </summary>
+	/// <returns>false if sharded ingestion is off (take the locked path)</returns>
+	bool IngestTransformBatchByHandle(const int32* Handles, const ULL_Transform* Transforms, const float* PropertyValues, int32 PropertyCount, int32 Count);
+	
+	/// <summary>
+	/// Move every ingested update into the latest-value slots (through SubmitTransformFrame)
+	/// Caller must hold CriticalSection
+	/// </summary>
+	void DrainIngestShardsLocked();
+	
+	/// <summary>
+	/// Mirror the lifecycle flags into the atomics read without CriticalSection
+	/// (ConnectionState, bShardedIngest). Caller must hold CriticalSection.
+	/// </summary>
+	void PublishLifecycleStateLocked();
+	
+	//=============================================================================
+	// Latency Probe
+	//=============================================================================
+	
+	/// <summary>
+	/// One probe tick: stamp the entry, send the probe like ULL_UpdateObjectH does, read echoes
+	/// (probe thread, without CriticalSection)
+	/// </summary>
+	void SendLatencyProbe();
+	
+	/// <summary>
+	/// Stop the stamps and remove the probe subject (caller joined LatencyProbeThread and holds CriticalSection)
+	/// </summary>
+	void StopLatencyProbeLocked();
+	
+	/// <summary>
+	/// Publish pass with rate tiers and the publish budget (highest priority first, the rest stays dirty)
+	/// Caller must hold CriticalSection
+	/// </summary>
+	/// <returns>Number of frames sent</returns>
+	int32 PublishScheduledFramesLocked();
+	
+	/// <summary>
+	/// Send one subject's pending frame through the deadband filter
+	/// Caller must hold CriticalSection and have cleared bPendingFrame
+	/// </summary>
+	/// <param name="DataSubjectName">Data subject name, or NAME_None for a transform subject</param>
+	bool PublishPendingSubject(FSubjectInfo& SubjectInfo, const FName& DataSubjectName);
+	
+	/// <summary>
+	/// Validate and store a subject's update-rate tier
+	/// Caller must hold CriticalSection
+	/// </summary>
+	int32 ApplySubjectSchedule(FSubjectInfo& SubjectInfo, int32 Priority, int32 MaxRateHz);
+	
+	/// <summary>
+	/// Send subject static data (direct, or queued behind pending frames in async mode)
+	/// Caller must hold CriticalSection and have verified bLiveLinkSourceCreated
+	/// </summary>
+	void SubmitStaticData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> RoleClass, FLiveLinkStaticDataStruct&& StaticData);
+	
+	/// <summary>
+	/// Remove a subject from LiveLink (direct, or queued behind pending frames in async mode)
+	/// Caller must hold CriticalSection and have verified the provider exists
+	/// </summary>
+	void SubmitRemoveSubject(const FName& SubjectName);
+	
+	/// <summary>
+	/// Fill defaults for a NULL or older/shorter ULL_InitOptions and clamp values
+	/// </summary>
+	static ULL_InitOptions ResolveInitOptions(const ULL_InitOptions* Options);
+	
+	/// <summary>
+	/// Allocate a subject table slot (reusing released slots) and index it by name
+	/// Caller must hold CriticalSection (takes SubjectTableLock for writing)
+	/// </summary>
+	/// <returns>New subject handle, or ULL_ERROR if the table is full</returns>
+	int32 AddTransformSubjectSlot(const FName& SubjectName, int32 SchemaId);
+	
+	/// <summary>
+	/// Release a subject table slot and invalidate its handle
+	/// Caller must hold CriticalSection (takes SubjectTableLock for writing)
+	/// </summary>
+	void ReleaseTransformSubjectSlot(int32 Handle);
+	
+	/// <summary>
+	/// Registration body shared by the RegisterTransformSubject* entry points
+	/// Caller must hold CriticalSection and have checked bInitialized and SchemaId
+	/// </summary>
+	/// <returns>Subject handle (>= 0), or a negative ULL_* error code</returns>
+	int32 RegisterTransformSubjectLocked(const FName& SubjectName, int32 SchemaId);
+	
+	/// <summary>
+	/// Find the schema ID of a property name list, interning it if new
+	/// Caller must hold CriticalSection
+	/// </summary>
+	int32 FindOrAddPropertySchema(const TArray<FName>& PropertyNames);
+	
+	/// <summary>
+	/// Take a subject table slot (reusing released slots)
+	/// Caller must hold CriticalSection and SubjectTableLock (write)
+	/// </summary>
+	/// <returns>Slot index, or INDEX_NONE if the table is full</returns>
+	int32 AllocateTransformSubjectSlot(const FName& SubjectName);
+	
+	/// <summary>
+	/// Pool mode: bind an entity to a hidden pooled subject of its schema (pre-registering
+	/// another SubjectPoolSize subjects first if none is free) and index it by entity name
+	/// Caller must hold CriticalSection and have verified CanSendTransforms()
+	/// </summary>
+	/// <returns>New subject handle, or ULL_ERROR if the table is full</returns>
+	int32 AcquirePooledSubject(const FName& EntityName, int32 SchemaId);
+	
+	/// <summary>
+	/// Pool mode: register SubjectPoolSize more hidden subjects for a pool (static data sent once each)
+	/// Caller must hold CriticalSection
+	/// </summary>
+	/// <returns>false if the table filled up before any subject was added</returns>
+	bool GrowSubjectPool(int32 PoolIndex);
+	
+	/// <summary>
+	/// Pool mode: unbind a pooled subject, hide it and return it to its pool
+	/// Caller must hold CriticalSection
+	/// </summary>
+	void ReleasePooledSubject(FSubjectInfo& SubjectInfo, int32 Slot);
+	
+	/// <summary>
+	/// Resolve a handle to its table entry (nullptr if invalid or stale)
+	/// Caller must hold CriticalSection or SubjectTableLock (read)
+	/// </summary>
+	FSubjectInfo* ResolveTransformHandle(int32 Handle);
+	
+	/// <summary>
+	/// Find a transform subject by name (nullptr if not registered)
+	/// Caller must hold CriticalSection or SubjectTableLock (read)
+	/// </summary>
+	FSubjectInfo* FindTransformSubject(const FName& SubjectName);
+	
 	//=============================================================================
 	// Member Variables
 	//=============================================================================
@@ -186,17 +920,187 @@ private:
 	TSharedPtr<ILiveLinkProvider> LiveLinkProvider;
 	bool bLiveLinkSourceCreated = false;
 	
+	// Staged initialization (ULL_INIT_MODE_ASYNC): set from Initialize until the engine thread
+	// completes the session; updates wait in the latest-value slots meanwhile
+	bool bEngineStaging = false;
+	bool bStagingFailed = false;
+	ULL_InitOptions StagedOptions = {};
+	uint64 StagingStartCycles = 0;      // FPlatformTime::Seconds() is not calibrated before PreInit
+	
+	// Capture file writer (fed by the sender thread in async mode, by the push paths otherwise).
+	// Declared before Sender, which holds a reference to it.
+	FLiveLinkRecorder Recorder;
+	
+	// Latency probe stamps (ULL_StartLatencyProbe). Declared before Sender, which stamps the sends.
+	// The probe thread sends one probe per tick through UpdateTransformSubjectByHandle.
+	FLiveLinkLatencyProbe LatencyProbe;
+	TUniquePtr<FLiveLinkTickThread> LatencyProbeThread;
+	int32 LatencyProbeHandle = ULL_ERROR;
+	
+	// Asynchronous send mode (null in synchronous mode)
+	TUniquePtr<FLiveLinkSender> Sender;
+	
+	// Shared-memory transport for transform subjects (null with ULL_TRANSPORT_MESSAGE_BUS)
+	TUniquePtr<FLiveLinkSharedMemoryWriter> SharedMemory;
+	
+	// Capture file player (null when no replay is running)
+	TUniquePtr<FLiveLinkReplayer> Replayer;
+	
+	// Message Bus pump thread, shared by every session because FTSTicker may only be ticked
+	// from one thread. Started by the first session that enables it (its pumpRateHz applies),
+	// stopped when the last of them shuts down. Null when no session uses it.
+	static TUniquePtr<FLiveLinkTickThread> Pump;
+	static int32 PumpSessionCount;
+	static FCriticalSection PumpLock;
+	bool bPumpAcquired = false;
+	
+	// Coalescing mode (PublishRateHz == 0: disabled, Publisher is null)
+	int32 PublishRateHz = 0;
+	TUniquePtr<FLiveLinkTickThread> Publisher;
+	TArray<int32> DirtyTransformSlots;
+	TArray<FName> DirtyDataSubjects;    // Data subjects live in a map, so they are tracked by name
+	uint64 CoalescedFrameCount = 0;     // Updates overwritten before they were published
+	uint64 PublishedFrameCount = 0;     // Frames sent by the publish pass
+	
+	// Rate tiers and publish budget (scheduled publish pass once a tier or budget is set)
+	struct FPublishCandidate
+	{
+		FSubjectInfo* SubjectInfo;
+		FName DataSubjectName;          // NAME_None for transform subjects
+		int32 Slot;                     // Transform table slot (INDEX_NONE for data subjects)
+	};
+	bool bRateTiersUsed = false;
+	int32 PublishFrameBudget = 0;       // Frames per second (0 = unlimited)
+	int32 PublishByteBudget = 0;        // Estimated bytes per second (0 = unlimited)
+	double FrameBudgetTokens = 0.0;
+	double ByteBudgetTokens = 0.0;
+	double LastBudgetRefillTime = 0.0;
+	uint64 BudgetDeferredCount = 0;     // Due frames held back because the budget was spent
+	uint64 RateDeferredCount = 0;       // Dirty frames held back until their tier interval elapsed
+	TArray<FPublishCandidate> PublishCandidates;
+	TArray<int32> RetainedTransformSlots;
+	TArray<FName> RetainedDataSubjects;
+	
+	// Change detection (deadband) settings and counters
+	bool bDeadbandEnabled = false;
+	double PositionDeadbandSquared = 0.0;   // cm²
+	double RotationDeadbandRadians = 0.0;
+	float PropertyDeadband = 0.0f;
+	double KeepAliveIntervalSeconds = 0.0;
+	uint64 DeadbandSentCount = 0;
+	uint64 DeadbandSuppressedCount = 0;
+	uint64 DeadbandKeepAliveCount = 0;
+	
+	// Interest regions (empty = every subject streams). Transform subjects are bucketed in a
+	// uniform grid as their frames arrive; each occupied cell caches whether the regions cover
+	// it fully, partly or not at all, so only subjects in partly covered cells test the boxes.
+	enum EInterestCoverage : uint8
+	{
+		InterestOutside = 0,
+		InterestPartial = 1,
+		InterestInside = 2,
+	};
+	struct FInterestCell
+	{
+		FIntVector Coordinates;
+		uint8 Coverage = InterestOutside;   // For the current regions
+		TArray<int32> Slots;            // Transform table slots whose latest position is in the cell
+	};
+	TArray<FBox> InterestRegions;
+	double InterestOutsideInterval = 0.0;   // Seconds between frames outside every region (0 = suppressed)
+	TMap<uint64, FInterestCell> InterestGrid;
+	uint64 InterestHeldCount = 0;
+	uint64 InterestOutsideSentCount = 0;
+	
+	// Simulation-time mapping (frames sent through the *AtTime API)
+	float SimTimeScale = 1.0f;
+	int32 SceneFrameRate = ULL_DEFAULT_SCENE_FRAME_RATE;
+	bool bSimTimeAnchored = false;
+	double SimTimeAnchor = 0.0;         // Simulation seconds at the anchor
+	double WorldTimeAnchor = 0.0;       // FPlatformTime::Seconds() at the anchor
+	double LastSimTime = 0.0;
+	
 	// GEngineLoop initialization tracking
 	// CRITICAL: GEngineLoop.PreInit() can only be called ONCE per process!
 	// This static flag prevents crashes when simulation is restarted in Simio
 	static bool bGEngineLoopInitialized;
+	static FCriticalSection EngineLoopLock;    // Serializes Initialize across sessions
+	
+	// Background bring-up: sessions initialized with ULL_INIT_MODE_ASYNC while it runs wait in
+	// StagingSessions. Lock order: CriticalSection, then EngineLoopLock, then StagingLock; the
+	// engine thread completes sessions holding none of them.
+	//
+	// The engine thread runs GEngineLoop.PreInit, so it is the engine's game thread (GGameThreadId).
+	// It stays alive for the process, parked on StagingSignal, and runs every later bring-up
+	// (retries after a failure). std:: primitives because the runtime is not up when it starts.
+	enum class EEngineStage : uint8
+	{
+		NotStarted,                     // Also after a failed bring-up (the next Initialize retries)
+		Staging,
+		Ready,
+	};
+	static EEngineStage EngineStage;
+	static TArray<TWeakPtr<FLiveLinkBridge>> StagingSessions;
+	static std::mutex StagingLock;
+	static std::condition_variable StagingSignal;    // EngineStage or bEngineThreadBusy changed
+	static std::thread* EngineThread;                // Created by the first staged bring-up, never destroyed
+	static bool bEngineThreadBusy;                   // Running StageEngineLoop
+	
+	// Session registry (ULL_CreateSession). Lookups take the read lock once per API call.
+	struct FSessionEntry
+	{
+		TSharedPtr<FLiveLinkBridge> Session;
+		FString ProviderName;
+	};
+	static FRWLock SessionLock;
+	static TMap<int32, FSessionEntry> Sessions;
+	static int32 NextSessionId;
+	static FString DefaultProviderName;    // Default session's provider name while initialized
+	
+	// Transform subjects: dense table indexed by handle slot, plus name → handle index.
+	// Changes to the table, a slot's identity (bInUse, Generation, SchemaId) or the name index
+	// hold CriticalSection and SubjectTableLock for writing, so the sharded ingestion path can
+	// resolve handles and names under the read lock alone.
+	TArray<FSubjectInfo> TransformSubjectTable;
+	TArray<int32> FreeTransformSubjectSlots;
+	TMap<FName, int32> TransformSubjects;
+	mutable FRWLock SubjectTableLock;
 	
-	// Subject tracking with property metadata
-	TMap<FName, FSubjectInfo> TransformSubjects;
+	// Sharded ingestion (coalescing mode): producers write a subject's Ingest* fields under its
+	// shard's lock; the publish pass (under CriticalSection) drains the shards. Lock order:
+	// CriticalSection, then SubjectTableLock, then a shard lock.
+	static constexpr int32 IngestShardCount = 64;       // Power of two
+	static constexpr int32 IngestShardSlotBits = 6;     // 64 consecutive slots per block
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FIngestShard
+	{
+		FCriticalSection Lock;
+		TArray<int32> DirtySlots;     // Slots with bIngestPending (released slots are skipped by the drain)
+		uint64 CoalescedCount = 0;    // Updates that overwrote an ingested update not yet drained
+	};
+	FIngestShard IngestShards[IngestShardCount];
+	
+	// Lifecycle state readable without CriticalSection (see PublishLifecycleStateLocked)
+	std::atomic<int32> ConnectionState{ULL_NOT_INITIALIZED};    // GetConnectionStatus result
+	std::atomic<bool> bShardedIngest{false};    // Initialized, coalescing and not shared memory
+	
+	// Property schemas: index = schema ID, buckets map a name-list hash to the first schema with it
+	TArray<FPropertySchema> PropertySchemas;
+	TMap<uint32, int32> PropertySchemaBuckets;
+	
+	// Pool mode (SubjectPoolSize == 0: disabled): pooled table slots per property schema
+	int32 SubjectPoolSize = 0;
+	TArray<FSubjectPool> SubjectPools;
+	TArray<float> PoolPropertyScratch;    // Frame values plus the visibility property
+	uint64 PoolAcquireCount = 0;
+	
+	// Data subjects with property metadata
 	TMap<FName, FSubjectInfo> DataSubjects;
 	
-	// FName cache for performance
-	TMap<FString, FName> NameCache;
+	// FName cache for performance (own sharded locks, independent of CriticalSection)
+	FLiveLinkNameCache NameCache;
+	
+	// Hot-path statistics (atomics, no lock needed to update)
+	mutable FLiveLinkStats Stats;
 	
 	// Thread safety
 	mutable FCriticalSection CriticalSection;
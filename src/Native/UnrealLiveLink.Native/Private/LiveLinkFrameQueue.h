@@ -0,0 +1,261 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/Transform.h"
+#include <atomic>
+
+// LiveLink includes (FLiveLinkStaticDataStruct, ULiveLinkRole)
+// Disable C4099 warning: UE has inconsistent class/struct forward declarations
+#pragma warning(push)
+#pragma warning(disable: 4099)
+#include "LiveLinkTypes.h"
+#pragma warning(pop)
+
+//=============================================================================
+// LiveLink Frame Queue
+//=============================================================================
+// Bounded ring buffer of fixed-size send records between the Simio threads
+// calling the C API (producers) and FLiveLinkSender's worker thread (consumer).
+//
+// Design: per-cell sequence numbers (D. Vyukov's bounded MPMC queue).
+// - No locks, no allocation after construction
+// - Producers and consumers only contend on one atomic position each
+// - Multi-consumer safe, so a producer may dequeue the oldest record itself
+//   to implement the drop-oldest policy (TryDequeueUpdate: frames only)
+//=============================================================================
+
+/// <summary>
+/// Property values carried inline in a frame record (sized for typical Simio KPI
+/// counts so the async path does not allocate per frame).
+/// Frames with more properties carry a heap-allocated overflow array.
+/// </summary>
+#define ULL_INLINE_PROPERTY_CAPACITY 48
+
+/// <summary>
+/// Kind of work carried by a send record
+/// </summary>
+enum class ELiveLinkSendRecordKind : uint8
+{
+	Frame,          // UpdateSubjectFrameData (transform role)
+	DataFrame,      // UpdateSubjectFrameData (basic role, properties only - Transform unused)
+	StaticData,     // UpdateSubjectStaticData (subject registration)
+	Remove          // RemoveSubject
+};
+
+/// <summary>
+/// One unit of provider work, fixed size so it can live in the ring buffer.
+/// Control records (StaticData, Remove) go through the same queue as frames so
+/// the worker applies them in submission order.
+/// </summary>
+struct FLiveLinkSendRecord
+{
+	ELiveLinkSendRecordKind Kind = ELiveLinkSendRecordKind::Frame;
+	int32 PropertyCount = 0;
+	FName SubjectName;
+	double WorldTime = 0.0;
+	TOptional<FQualifiedFrameTime> SceneTime;              // Frame record of a simulation-time update
+	FTransform Transform;
+	float InlineProperties[ULL_INLINE_PROPERTY_CAPACITY];
+
+	// Owned heap payloads (released by whoever consumes or drops the record)
+	TArray<float>* OverflowProperties = nullptr;         // Frame with PropertyCount > inline capacity
+	FLiveLinkStaticDataStruct* StaticData = nullptr;     // StaticData record
+	TSubclassOf<ULiveLinkRole> RoleClass;                // StaticData record
+
+	/// <summary>
+	/// Property values for a Frame/DataFrame record (inline or overflow)
+	/// </summary>
+	const float* GetPropertyValues() const
+	{
+		return OverflowProperties ? OverflowProperties->GetData() : InlineProperties;
+	}
+
+	/// <summary>
+	/// Free heap payloads. Safe to call more than once.
+	/// </summary>
+	void ReleasePayload()
+	{
+		delete OverflowProperties;
+		OverflowProperties = nullptr;
+		delete StaticData;
+		StaticData = nullptr;
+	}
+};
+
+/// <summary>
+/// Bounded lock-free queue of FLiveLinkSendRecord
+/// </summary>
+class FLiveLinkFrameQueue
+{
+public:
+	/// <summary>
+	/// Create a queue with at least the requested capacity (rounded up to a power of two)
+	/// </summary>
+	explicit FLiveLinkFrameQueue(int32 RequestedCapacity)
+	{
+		Capacity = (uint64)FMath::RoundUpToPowerOfTwo((uint32)FMath::Max(RequestedCapacity, 2));
+		Mask = Capacity - 1;
+		Cells = new FCell[Capacity];
+		for (uint64 i = 0; i < Capacity; i++)
+		{
+			Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+		EnqueuePos.store(0, std::memory_order_relaxed);
+		DequeuePos.store(0, std::memory_order_relaxed);
+	}
+
+	~FLiveLinkFrameQueue()
+	{
+		// Release payloads of anything still queued
+		FLiveLinkSendRecord Record;
+		while (TryDequeue(Record))
+		{
+			Record.ReleasePayload();
+		}
+		delete[] Cells;
+	}
+
+	FLiveLinkFrameQueue(const FLiveLinkFrameQueue&) = delete;
+	FLiveLinkFrameQueue& operator=(const FLiveLinkFrameQueue&) = delete;
+
+	/// <summary>
+	/// Enqueue a copy of Record. Ownership of its payloads moves to the queue on success.
+	/// </summary>
+	/// <returns>false if the queue is full (Record is untouched)</returns>
+	bool TryEnqueue(const FLiveLinkSendRecord& Record)
+	{
+		uint64 Pos = EnqueuePos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FCell& Cell = Cells[Pos & Mask];
+			const uint64 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+			const int64 Diff = (int64)Sequence - (int64)Pos;
+
+			if (Diff == 0)
+			{
+				if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+				{
+					Cell.Record = Record;
+					Cell.Kind.store(Record.Kind, std::memory_order_relaxed);
+					Cell.Sequence.store(Pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false;  // Full
+			}
+			else
+			{
+				Pos = EnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Dequeue the oldest record. Ownership of its payloads moves to the caller.
+	/// </summary>
+	/// <returns>false if the queue is empty</returns>
+	bool TryDequeue(FLiveLinkSendRecord& OutRecord)
+	{
+		uint64 Pos = DequeuePos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FCell& Cell = Cells[Pos & Mask];
+			const uint64 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+			const int64 Diff = (int64)Sequence - (int64)(Pos + 1);
+
+			if (Diff == 0)
+			{
+				if (DequeuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+				{
+					OutRecord = Cell.Record;
+					Cell.Record.OverflowProperties = nullptr;
+					Cell.Record.StaticData = nullptr;
+					Cell.Sequence.store(Pos + Mask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false;  // Empty
+			}
+			else
+			{
+				Pos = DequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Dequeue the oldest record only if it is a Frame or DataFrame (drop-oldest eviction).
+	/// Ownership of its payloads moves to the caller.
+	/// </summary>
+	/// <returns>false if the queue is empty or the oldest record is a control record</returns>
+	bool TryDequeueUpdate(FLiveLinkSendRecord& OutRecord)
+	{
+		uint64 Pos = DequeuePos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FCell& Cell = Cells[Pos & Mask];
+			const uint64 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+			const int64 Diff = (int64)Sequence - (int64)(Pos + 1);
+
+			if (Diff == 0)
+			{
+				// Kind is published with the sequence; if another consumer takes the cell
+				// first, the compare-exchange below fails and the next head is checked
+				const ELiveLinkSendRecordKind Kind = Cell.Kind.load(std::memory_order_relaxed);
+				if (Kind != ELiveLinkSendRecordKind::Frame && Kind != ELiveLinkSendRecordKind::DataFrame)
+				{
+					return false;  // Control record at the head: only the worker may take it
+				}
+
+				if (DequeuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+				{
+					OutRecord = Cell.Record;
+					Cell.Record.OverflowProperties = nullptr;
+					Cell.Record.StaticData = nullptr;
+					Cell.Sequence.store(Pos + Mask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false;  // Empty
+			}
+			else
+			{
+				Pos = DequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Approximate number of queued records (exact only when no thread is enqueuing/dequeuing)
+	/// </summary>
+	int32 GetApproximateCount() const
+	{
+		const uint64 Enqueued = EnqueuePos.load(std::memory_order_relaxed);
+		const uint64 Dequeued = DequeuePos.load(std::memory_order_relaxed);
+		return Enqueued > Dequeued ? (int32)(Enqueued - Dequeued) : 0;
+	}
+
+	int32 GetCapacity() const { return (int32)Capacity; }
+
+private:
+	struct FCell
+	{
+		std::atomic<uint64> Sequence;
+		std::atomic<ELiveLinkSendRecordKind> Kind{ELiveLinkSendRecordKind::Frame};  // Record.Kind, readable before owning the cell
+		FLiveLinkSendRecord Record;
+	};
+
+	FCell* Cells = nullptr;
+	uint64 Capacity = 0;
+	uint64 Mask = 0;
+
+	// Separate cache lines: producers touch EnqueuePos, the worker touches DequeuePos
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePos;
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> DequeuePos;
+};
@@ -0,0 +1,337 @@
+#include "LiveLinkLatencyProbe.h"
+#include "UnrealLiveLink.Native.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Common/UdpSocketBuilder.h"
+
+//=============================================================================
+// LiveLinkLatencyProbe Implementation
+//=============================================================================
+
+static const TCHAR* const StageNames[ULL_LATENCY_STAGES] = { TEXT("enqueue"), TEXT("send"), TEXT("receipt"), TEXT("total") };
+
+FLiveLinkLatencyProbe::FLiveLinkLatencyProbe()
+	: ProbeSubjectName(ULL_LATENCY_PROBE_SUBJECT)
+{
+}
+
+FLiveLinkLatencyProbe::~FLiveLinkLatencyProbe()
+{
+	Stop();
+}
+
+bool FLiveLinkLatencyProbe::Start(int32 InEchoPort, const FString& InCsvPath)
+{
+	// Starting again replaces the running probe
+	Stop();
+
+	FScopeLock Lock(&CriticalSection);
+
+	if (InEchoPort > 0)
+	{
+		// Any address: the echo may come from an Unreal instance on another machine
+		EchoSocket = FUdpSocketBuilder(TEXT("SimioLatencyProbeEcho"))
+			.AsNonBlocking()
+			.AsReusable()
+			.BoundToPort(InEchoPort)
+			.Build();
+		if (!EchoSocket)
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Error,
+			       TEXT("LiveLinkLatencyProbe: ❌ Failed to bind echo port %d"),
+			       InEchoPort);
+			return false;
+		}
+	}
+
+	if (!InCsvPath.IsEmpty())
+	{
+		CsvFile = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*InCsvPath);
+		if (!CsvFile)
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Error,
+			       TEXT("LiveLinkLatencyProbe: ❌ Failed to create CSV file '%s'"),
+			       *InCsvPath);
+			CloseResources();
+			return false;
+		}
+
+		FString Header = TEXT("seconds,probesSent,probesEchoed");
+		for (const TCHAR* StageName : StageNames)
+		{
+			Header += FString::Printf(TEXT(",%sSamples,%sP50Ms,%sP90Ms,%sP99Ms,%sMaxMs"), StageName, StageName, StageName, StageName, StageName);
+		}
+		Header += TEXT("\n");
+		const FTCHARToUTF8 Utf8(*Header);
+		CsvFile->Write(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	}
+
+	EchoPort = InEchoPort;
+	CsvPath = InCsvPath;
+	NextSequence = 1;
+	ProbesSent = 0;
+	ProbesEchoed = 0;
+	for (FProbeStamps& Probe : Probes)
+	{
+		Probe = FProbeStamps();
+	}
+	for (FStageWindow& Stage : Stages)
+	{
+		Stage.Count = 0;
+	}
+	StartSeconds = FPlatformTime::Seconds();
+	NextCsvSeconds = StartSeconds + ULL_LATENCY_CSV_INTERVAL_SECONDS;
+
+	bRunning.store(true, std::memory_order_release);
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkLatencyProbe: Probing '%s' (echo port %d, CSV '%s')"),
+	       *ProbeSubjectName.ToString(),
+	       EchoPort,
+	       CsvPath.IsEmpty() ? TEXT("none") : *CsvPath);
+	return true;
+}
+
+void FLiveLinkLatencyProbe::Stop()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	if (!bRunning.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+	bRunning.store(false, std::memory_order_release);
+
+	if (CsvFile)
+	{
+		WriteCsvRow();
+	}
+	CloseResources();
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkLatencyProbe: Stopped (%llu probes sent, %llu echoed, %.1f s)"),
+	       ProbesSent,
+	       ProbesEchoed,
+	       FPlatformTime::Seconds() - StartSeconds);
+}
+
+void FLiveLinkLatencyProbe::CloseResources()
+{
+	// Note: Caller must hold CriticalSection lock
+
+	if (EchoSocket)
+	{
+		EchoSocket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(EchoSocket);
+		EchoSocket = nullptr;
+	}
+
+	if (CsvFile)
+	{
+		CsvFile->Flush();
+		delete CsvFile;
+		CsvFile = nullptr;
+	}
+}
+
+//=============================================================================
+// Stamps
+//=============================================================================
+
+FTransform FLiveLinkLatencyProbe::BeginProbe()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	const uint64 Sequence = NextSequence++;
+	FProbeStamps& Probe = Probes[Sequence & (ProbeHistory - 1)];
+	Probe = FProbeStamps();
+	Probe.Sequence = Sequence;
+	Probe.EntrySeconds = FPlatformTime::Seconds();
+	ProbesSent++;
+
+	// Doubles hold the sequence number exactly; LiveLink sends it unchanged
+	return FTransform(FQuat::Identity, FVector((double)Sequence, 0.0, 0.0), FVector::OneVector);
+}
+
+FLiveLinkLatencyProbe::FProbeStamps* FLiveLinkLatencyProbe::FindProbe(const FTransform& Transform)
+{
+	// Note: Caller must hold CriticalSection lock
+
+	const double Encoded = Transform.GetTranslation().X;
+	if (!(Encoded >= 1.0))
+	{
+		return nullptr;
+	}
+
+	const uint64 Sequence = (uint64)(Encoded + 0.5);
+	FProbeStamps& Probe = Probes[Sequence & (ProbeHistory - 1)];
+	return Probe.Sequence == Sequence ? &Probe : nullptr;
+}
+
+void FLiveLinkLatencyProbe::RecordEnqueue(const FTransform& Transform)
+{
+	const double Now = FPlatformTime::Seconds();
+	FScopeLock Lock(&CriticalSection);
+
+	// Sharded ingestion stamps the probe once when it is ingested and again when it is drained:
+	// the first stamp is the enqueue
+	FProbeStamps* Probe = FindProbe(Transform);
+	if (!Probe || Probe->EnqueueSeconds > 0.0)
+	{
+		return;
+	}
+
+	Probe->EnqueueSeconds = Now;
+	AddSample(ULL_LATENCY_STAGE_ENQUEUE, Now - Probe->EntrySeconds);
+}
+
+void FLiveLinkLatencyProbe::RecordSendStamp(const FTransform& Transform)
+{
+	const double Now = FPlatformTime::Seconds();
+	FScopeLock Lock(&CriticalSection);
+
+	FProbeStamps* Probe = FindProbe(Transform);
+	if (!Probe || Probe->SendSeconds > 0.0)
+	{
+		return;
+	}
+
+	Probe->SendSeconds = Now;
+	AddSample(ULL_LATENCY_STAGE_SEND, Now - (Probe->EnqueueSeconds > 0.0 ? Probe->EnqueueSeconds : Probe->EntrySeconds));
+}
+
+void FLiveLinkLatencyProbe::AddSample(int32 Stage, double Seconds)
+{
+	// Note: Caller must hold CriticalSection lock
+
+	FStageWindow& Window = Stages[Stage];
+	Window.SamplesMs[Window.Count % ULL_LATENCY_WINDOW] = FMath::Max(Seconds, 0.0) * 1000.0;
+	Window.Count++;
+}
+
+//=============================================================================
+// Echo and CSV
+//=============================================================================
+
+void FLiveLinkLatencyProbe::Poll()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	if (!bRunning.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	if (EchoSocket)
+	{
+		uint32 PendingBytes = 0;
+		while (EchoSocket->HasPendingData(PendingBytes))
+		{
+			ULL_LatencyEcho Echo;
+			int32 BytesRead = 0;
+			if (!EchoSocket->Recv(reinterpret_cast<uint8*>(&Echo), sizeof(Echo), BytesRead))
+			{
+				break;
+			}
+
+			// Datagrams of another size or version are not ours
+			if (BytesRead == sizeof(Echo) && Echo.magic == ULL_LATENCY_ECHO_MAGIC && Echo.version == ULL_LATENCY_ECHO_VERSION)
+			{
+				HandleEcho(Echo);
+			}
+		}
+	}
+
+	if (CsvFile && FPlatformTime::Seconds() >= NextCsvSeconds)
+	{
+		WriteCsvRow();
+		NextCsvSeconds += ULL_LATENCY_CSV_INTERVAL_SECONDS;
+	}
+}
+
+void FLiveLinkLatencyProbe::HandleEcho(const ULL_LatencyEcho& Echo)
+{
+	// Note: Caller must hold CriticalSection lock
+
+	FProbeStamps& Probe = Probes[Echo.sequence & (ProbeHistory - 1)];
+	if (Probe.Sequence != Echo.sequence || Probe.SendSeconds <= 0.0 || Probe.bEchoed)
+	{
+		// Too old, never sent (coalesced away) or already echoed
+		return;
+	}
+
+	Probe.bEchoed = true;
+	ProbesEchoed++;
+	AddSample(ULL_LATENCY_STAGE_RECEIPT, Echo.receiptSeconds - Probe.SendSeconds);
+	AddSample(ULL_LATENCY_STAGE_TOTAL, Echo.receiptSeconds - Probe.EntrySeconds);
+}
+
+void FLiveLinkLatencyProbe::WriteCsvRow()
+{
+	// Note: Caller must hold CriticalSection lock
+
+	ULL_LatencyStats CurrentStats;
+	FillStats(CurrentStats);
+
+	FString Row = FString::Printf(TEXT("%.3f,%llu,%llu"), FPlatformTime::Seconds() - StartSeconds, CurrentStats.probesSent, CurrentStats.probesEchoed);
+	for (const ULL_LatencyStage& Stage : CurrentStats.stages)
+	{
+		Row += FString::Printf(TEXT(",%llu,%.4f,%.4f,%.4f,%.4f"), Stage.samples, Stage.p50Ms, Stage.p90Ms, Stage.p99Ms, Stage.maxMs);
+	}
+	Row += TEXT("\n");
+
+	// Flushed per row, so a crashed run still leaves its history
+	const FTCHARToUTF8 Utf8(*Row);
+	CsvFile->Write(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	CsvFile->Flush();
+}
+
+//=============================================================================
+// Statistics
+//=============================================================================
+
+void FLiveLinkLatencyProbe::GetStats(ULL_LatencyStats& OutStats) const
+{
+	FScopeLock Lock(&CriticalSection);
+	FillStats(OutStats);
+}
+
+void FLiveLinkLatencyProbe::FillStats(ULL_LatencyStats& OutStats) const
+{
+	// Note: Caller must hold CriticalSection lock
+
+	FMemory::Memzero(&OutStats, sizeof(OutStats));
+	OutStats.probesSent = ProbesSent;
+	OutStats.probesEchoed = ProbesEchoed;
+
+	// Sorted copy of each window (a few probes per second; never on the update path)
+	TArray<double> Sorted;
+	Sorted.Reserve(ULL_LATENCY_WINDOW);
+	for (int32 Stage = 0; Stage < ULL_LATENCY_STAGES; Stage++)
+	{
+		const FStageWindow& Window = Stages[Stage];
+		ULL_LatencyStage& OutStage = OutStats.stages[Stage];
+		OutStage.samples = Window.Count;
+
+		const int32 Num = (int32)FMath::Min<uint64>(Window.Count, ULL_LATENCY_WINDOW);
+		if (Num == 0)
+		{
+			continue;
+		}
+
+		Sorted.Reset();
+		Sorted.Append(Window.SamplesMs, Num);
+		Sorted.Sort();
+
+		auto Percentile = [&Sorted, Num](double Fraction)
+		{
+			return Sorted[FMath::Min(Num - 1, (int32)(Fraction * Num))];
+		};
+		OutStage.p50Ms = Percentile(0.50);
+		OutStage.p90Ms = Percentile(0.90);
+		OutStage.p99Ms = Percentile(0.99);
+		OutStage.maxMs = Sorted[Num - 1];
+	}
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+#include "Math/Transform.h"
+#include "UnrealLiveLink.Types.h"
+#include "UnrealLiveLink.LatencyProbe.h"
+#include <atomic>
+
+class FSocket;
+class IFileHandle;
+
+//=============================================================================
+// LiveLink Latency Probe (ULL_StartLatencyProbe / ULL_GetLatencyStats)
+//=============================================================================
+// Per-stage latency of a reserved probe subject (wire format:
+// UnrealLiveLink.LatencyProbe.h). The bridge sends one probe per tick of its
+// probe thread through the normal update path and stamps it here:
+//
+//   BeginProbe      ULL_* entry (probe thread, before the bridge call)
+//   RecordEnqueue   the bridge accepted the frame (pending slot, sender queue, push)
+//   RecordSend      just before ILiveLinkProvider::UpdateSubjectFrameData
+//   Poll            ULL_LatencyEcho datagrams from the Unreal side (receipt)
+//
+// Stamps are matched to their probe by the sequence number in the transform, so
+// a probe coalesced away in the pending slot simply never gets its later stamps.
+// Poll also appends a row to the CSV file every ULL_LATENCY_CSV_INTERVAL_SECONDS.
+//
+// Threading:
+// - Record* may be called from any thread (bridge under its CriticalSection,
+//   or the sender worker); BeginProbe and Poll run on the bridge's probe thread
+// - The probe has its own lock and never calls back into the bridge
+// - IsProbeSubject() is one atomic load while no probe runs, so the hot paths
+//   pay nothing else
+//=============================================================================
+
+/// <summary>
+/// Probe stamps, echo socket and latency windows
+/// </summary>
+class FLiveLinkLatencyProbe
+{
+public:
+	FLiveLinkLatencyProbe();
+	~FLiveLinkLatencyProbe();
+
+	/// <summary>
+	/// Reset the samples, bind the echo socket and create the CSV file.
+	/// Starting again replaces the running probe.
+	/// </summary>
+	/// <param name="EchoPort">UDP port for ULL_LatencyEcho datagrams (0 = no echo, in-process stages only)</param>
+	/// <param name="CsvPath">CSV file (overwritten; empty = no CSV)</param>
+	/// <returns>false if the socket could not be bound or the file not created</returns>
+	bool Start(int32 EchoPort, const FString& CsvPath);
+
+	/// <summary>
+	/// Write the last CSV row and close the socket and the file. Safe to call when not running.
+	/// </summary>
+	void Stop();
+
+	bool IsRunning() const { return bRunning.load(std::memory_order_acquire); }
+
+	/// <summary>
+	/// True for the probe subject while the probe runs
+	/// </summary>
+	FORCEINLINE bool IsProbeSubject(const FName& SubjectName) const
+	{
+		return IsRunning() && SubjectName == ProbeSubjectName;
+	}
+
+	const FName& GetSubjectName() const { return ProbeSubjectName; }
+
+	//=============================================================================
+	// Stamps
+	//=============================================================================
+
+	/// <summary>
+	/// Start the next probe: stamps its entry time
+	/// </summary>
+	/// <returns>Probe transform carrying the sequence number</returns>
+	FTransform BeginProbe();
+
+	/// <summary>
+	/// The bridge accepted a probe frame (caller checked IsProbeSubject)
+	/// </summary>
+	void RecordEnqueue(const FTransform& Transform);
+
+	/// <summary>
+	/// A frame is about to be handed to the provider (no-op unless it is the probe)
+	/// </summary>
+	FORCEINLINE void RecordSend(const FName& SubjectName, const FTransform& Transform)
+	{
+		if (IsProbeSubject(SubjectName))
+		{
+			RecordSendStamp(Transform);
+		}
+	}
+
+	/// <summary>
+	/// Read pending echo datagrams and write the CSV row when it is due (probe thread)
+	/// </summary>
+	void Poll();
+
+	/// <summary>
+	/// Copy the counters and the window percentiles of every stage
+	/// </summary>
+	void GetStats(ULL_LatencyStats& OutStats) const;
+
+private:
+	/// <summary>
+	/// Stamps of one probe (ring entry by sequence number)
+	/// </summary>
+	struct FProbeStamps
+	{
+		uint64 Sequence = 0;          // 0 = unused
+		double EntrySeconds = 0.0;
+		double EnqueueSeconds = 0.0;  // 0 = not stamped yet
+		double SendSeconds = 0.0;
+		bool bEchoed = false;
+	};
+
+	/// <summary>
+	/// Latest ULL_LATENCY_WINDOW samples of one stage
+	/// </summary>
+	struct FStageWindow
+	{
+		uint64 Count = 0;
+		double SamplesMs[ULL_LATENCY_WINDOW];
+	};
+
+	// Probes in flight that can still be stamped (sequence & (ProbeHistory - 1))
+	static constexpr int32 ProbeHistory = 256;
+
+	void RecordSendStamp(const FTransform& Transform);
+
+	// Note: Caller must hold CriticalSection lock
+	FProbeStamps* FindProbe(const FTransform& Transform);
+
+	// Note: Caller must hold CriticalSection lock
+	void AddSample(int32 Stage, double Seconds);
+
+	// Note: Caller must hold CriticalSection lock
+	void HandleEcho(const ULL_LatencyEcho& Echo);
+
+	// Note: Caller must hold CriticalSection lock
+	void FillStats(ULL_LatencyStats& OutStats) const;
+
+	// Note: Caller must hold CriticalSection lock
+	void WriteCsvRow();
+
+	// Note: Caller must hold CriticalSection lock
+	void CloseResources();
+
+	const FName ProbeSubjectName;
+
+	mutable FCriticalSection CriticalSection;
+	std::atomic<bool> bRunning{false};
+
+	uint64 NextSequence = 1;
+	uint64 ProbesSent = 0;
+	uint64 ProbesEchoed = 0;
+	FProbeStamps Probes[ProbeHistory];
+	FStageWindow Stages[ULL_LATENCY_STAGES];
+
+	FSocket* EchoSocket = nullptr;
+	int32 EchoPort = 0;
+
+	IFileHandle* CsvFile = nullptr;
+	FString CsvPath;
+	double StartSeconds = 0.0;
+	double NextCsvSeconds = 0.0;
+};
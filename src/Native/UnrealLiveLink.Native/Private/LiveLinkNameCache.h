@@ -0,0 +1,184 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeRWLock.h"
+#include "Misc/CString.h"
+#include "Hash/CityHash.h"
+#include <atomic>
+
+//=============================================================================
+// LiveLink Name Cache
+//=============================================================================
+// UTF-8 subject/property name -> FName cache used by every C API call.
+//
+// Design: read-mostly, sharded by a precomputed CityHash64 of the UTF-8 bytes.
+// - Cache hits take one shard's shared (read) lock and compare raw bytes;
+//   no FString is built and nothing is allocated
+// - Misses build the FName outside any lock, then insert under the shard's
+//   write lock (re-checking in case another thread inserted it first)
+// - Independent of FLiveLinkBridge::CriticalSection, so name lookups never
+//   contend with subject updates
+//
+// Entries are chained per hash so a 64-bit collision can never return the
+// wrong FName.
+//=============================================================================
+
+/// <summary>
+/// Sharded UTF-8 keyed FName cache (thread-safe)
+/// </summary>
+class FLiveLinkNameCache
+{
+public:
+	/// <summary>
+	/// Return the FName for a UTF-8 string, creating and caching it on first use
+	/// </summary>
+	/// <param name="Utf8">Null-terminated UTF-8 string (null or empty returns NAME_None)</param>
+	FName FindOrAdd(const char* Utf8)
+	{
+		if (!Utf8 || Utf8[0] == '\0')
+		{
+			return NAME_None;
+		}
+
+		const int32 Length = FCStringAnsi::Strlen(Utf8);
+		const uint64 Hash = CityHash64(Utf8, (uint32)Length);
+		FShard& Shard = Shards[Hash & (ShardCount - 1)];
+
+		// Fast path: shared lock, byte compare, no allocation
+		{
+			FReadScopeLock ReadLock(Shard.Lock);
+			if (const FEntry* Entry = FindLocked(Shard, Hash, Utf8, Length))
+			{
+				Shard.HitCount.fetch_add(1, std::memory_order_relaxed);
+				return Entry->Name;
+			}
+		}
+
+		// Slow path: create the FName before taking the write lock
+		const FName NewName(UTF8_TO_TCHAR(Utf8));
+
+		FWriteScopeLock WriteLock(Shard.Lock);
+		if (const FEntry* Entry = FindLocked(Shard, Hash, Utf8, Length))
+		{
+			// Another thread inserted it while we were unlocked
+			Shard.HitCount.fetch_add(1, std::memory_order_relaxed);
+			return Entry->Name;
+		}
+
+		FEntry& NewEntry = Shard.Entries.AddDefaulted_GetRef();
+		NewEntry.Bytes.Append(Utf8, Length);
+		NewEntry.Name = NewName;
+
+		const int32 NewIndex = Shard.Entries.Num() - 1;
+		if (int32* Head = Shard.Heads.Find(Hash))
+		{
+			NewEntry.Next = *Head;
+			*Head = NewIndex;
+		}
+		else
+		{
+			Shard.Heads.Add(Hash, NewIndex);
+		}
+
+		Shard.MissCount.fetch_add(1, std::memory_order_relaxed);
+		return NewName;
+	}
+
+	/// <summary>
+	/// Remove all cached names (counters are kept)
+	/// </summary>
+	void Empty()
+	{
+		for (FShard& Shard : Shards)
+		{
+			FWriteScopeLock WriteLock(Shard.Lock);
+			Shard.Heads.Empty();
+			Shard.Entries.Empty();
+		}
+	}
+
+	/// <summary>
+	/// Number of cached names
+	/// </summary>
+	int32 Num() const
+	{
+		int32 Total = 0;
+		for (const FShard& Shard : Shards)
+		{
+			FReadScopeLock ReadLock(Shard.Lock);
+			Total += Shard.Entries.Num();
+		}
+		return Total;
+	}
+
+	uint64 GetHitCount() const
+	{
+		uint64 Total = 0;
+		for (const FShard& Shard : Shards)
+		{
+			Total += Shard.HitCount.load(std::memory_order_relaxed);
+		}
+		return Total;
+	}
+
+	uint64 GetMissCount() const
+	{
+		uint64 Total = 0;
+		for (const FShard& Shard : Shards)
+		{
+			Total += Shard.MissCount.load(std::memory_order_relaxed);
+		}
+		return Total;
+	}
+
+	/// <summary>
+	/// Zero the hit/miss counters (entries are kept)
+	/// </summary>
+	void ResetCounters()
+	{
+		for (FShard& Shard : Shards)
+		{
+			Shard.HitCount.store(0, std::memory_order_relaxed);
+			Shard.MissCount.store(0, std::memory_order_relaxed);
+		}
+	}
+
+private:
+	// Power of two so the shard index is a mask of the hash
+	static constexpr int32 ShardCount = 16;
+
+	struct FEntry
+	{
+		TArray<ANSICHAR> Bytes;       // UTF-8 key, not null-terminated
+		FName Name;
+		int32 Next = INDEX_NONE;      // Next entry with the same hash
+	};
+
+	// Cache-line aligned so hit counters and locks of neighbouring shards don't false-share
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+	{
+		mutable FRWLock Lock;
+		TMap<uint64, int32> Heads;    // Hash -> first entry index in Entries
+		TArray<FEntry> Entries;
+		std::atomic<uint64> HitCount{0};
+		std::atomic<uint64> MissCount{0};
+	};
+
+	// Note: Caller must hold Shard.Lock (read or write)
+	static const FEntry* FindLocked(const FShard& Shard, uint64 Hash, const char* Utf8, int32 Length)
+	{
+		const int32* Head = Shard.Heads.Find(Hash);
+		for (int32 Index = Head ? *Head : INDEX_NONE; Index != INDEX_NONE; Index = Shard.Entries[Index].Next)
+		{
+			const FEntry& Entry = Shard.Entries[Index];
+			if (Entry.Bytes.Num() == Length && FMemory::Memcmp(Entry.Bytes.GetData(), Utf8, Length) == 0)
+			{
+				return &Entry;
+			}
+		}
+		return nullptr;
+	}
+
+	FShard Shards[ShardCount];
+};
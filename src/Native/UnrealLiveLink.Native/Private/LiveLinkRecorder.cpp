@@ -0,0 +1,535 @@
+#include "LiveLinkRecorder.h"
+#include "UnrealLiveLink.Native.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+// LiveLink role classes
+#pragma warning(push)
+#pragma warning(disable: 4099)
+#include "Roles/LiveLinkTransformRole.h"
+#pragma warning(pop)
+
+//=============================================================================
+// LiveLinkRecorder Implementation
+//=============================================================================
+
+// A frame further than this from its subject's key position starts a new key
+// frame, so float offsets keep sub-millimetre precision (cm)
+static constexpr double MaxKeyOffset = 100000.0;
+
+// A property section with more changed values than this stays full: past it the
+// mask and scattered writes cost more on decode than the bytes they save
+static constexpr int32 SparseMaxDirtyPercent = 50;
+
+static constexpr uint32 ChunkHeaderBytes = sizeof(ULL_CaptureChunkHeader);
+static constexpr uint32 ChunkRecordBytes = ULL_CAPTURE_CHUNK_BYTES - ChunkHeaderBytes;
+
+FLiveLinkRecorder::FLiveLinkRecorder()
+{
+}
+
+FLiveLinkRecorder::~FLiveLinkRecorder()
+{
+	Stop();
+}
+
+bool FLiveLinkRecorder::Start(const FString& FilePath, const TArray<FLiveLinkCaptureSubject>& ExistingSubjects)
+{
+	// Starting again replaces the running capture
+	Stop();
+
+	FScopeLock Lock(&CriticalSection);
+
+	FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath);
+	if (!FileHandle)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error,
+		       TEXT("LiveLinkRecorder: ❌ Failed to create capture file '%s'"),
+		       *FilePath);
+		return false;
+	}
+
+	CapturePath = FilePath;
+	StartWorldTime = FPlatformTime::Seconds();
+	ChunkBuffer.SetNumZeroed(ULL_CAPTURE_CHUNK_BYTES);
+	ChunkIndex = 0;
+	ChunkUsedBytes = 0;
+	ChunkRecordCount = 0;
+	ChunkBaseTime = 0.0;
+	ChunkEndTime = 0.0;
+	Subjects.Empty();
+	NextSubjectId = 0;
+	SubjectRecordCount = 0;
+	FrameCount = 0;
+	SparseCount = 0;
+	LastRecordTime = 0.0;
+	RecordCount.store(0, std::memory_order_relaxed);
+	DroppedCount.store(0, std::memory_order_relaxed);
+
+	// Placeholder header (chunkCount 0 marks a capture that was not closed)
+	WriteFileHeader();
+
+	for (const FLiveLinkCaptureSubject& Subject : ExistingSubjects)
+	{
+		WriteSubjectRecord(Subject.SubjectName, Subject.bTransformRole, Subject.PropertyNames);
+	}
+
+	bRecording.store(true, std::memory_order_release);
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkRecorder: Capturing to '%s' (%d existing subjects)"),
+	       *CapturePath,
+	       ExistingSubjects.Num());
+	return true;
+}
+
+void FLiveLinkRecorder::Stop()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	bRecording.store(false, std::memory_order_release);
+
+	if (!FileHandle)
+	{
+		return;
+	}
+
+	if (ChunkRecordCount > 0)
+	{
+		FlushChunk();
+	}
+
+	if (FileHandle)
+	{
+		WriteFileHeader();
+		FileHandle->Flush();
+		delete FileHandle;
+		FileHandle = nullptr;
+	}
+
+	ChunkBuffer.Empty();
+	Subjects.Empty();
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkRecorder: Capture '%s' closed (%llu records, %llu frames (%llu sparse), %u chunks, %.1f s, %llu dropped)"),
+	       *CapturePath,
+	       GetRecordCount(),
+	       FrameCount,
+	       SparseCount,
+	       ChunkIndex,
+	       LastRecordTime,
+	       GetDroppedCount());
+}
+
+//=============================================================================
+// Recording
+//=============================================================================
+
+void FLiveLinkRecorder::RecordStaticData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> RoleClass, const FLiveLinkStaticDataStruct& StaticData)
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	const FLiveLinkBaseStaticData* BaseData = StaticData.GetBaseData();
+	const bool bTransformRole = RoleClass.Get() == ULiveLinkTransformRole::StaticClass();
+
+	FScopeLock Lock(&CriticalSection);
+	if (FileHandle)
+	{
+		WriteSubjectRecord(SubjectName, bTransformRole, BaseData ? BaseData->PropertyNames : TArray<FName>());
+	}
+}
+
+void FLiveLinkRecorder::RecordFrame(const FName& SubjectName, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, double WorldTime)
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	const double Time = ToCaptureTime(WorldTime);
+	const FVector Position = Transform.GetLocation();
+	const FQuat Rotation = Transform.GetRotation();
+	const FVector Scale = Transform.GetScale3D();
+	const bool bScale = !Scale.Equals(FVector::OneVector, UE_SMALL_NUMBER);
+
+	FScopeLock Lock(&CriticalSection);
+
+	FRecordedSubject* Subject = Subjects.Find(SubjectName);
+	if (!FileHandle || !Subject || !Subject->bTransformRole)
+	{
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	auto NeedsKey = [&]()
+	{
+		const FVector Offset = Position - Subject->KeyPosition;
+		return Subject->KeyChunkIndex != ChunkIndex
+			|| FMath::Abs(Offset.X) > MaxKeyOffset
+			|| FMath::Abs(Offset.Y) > MaxKeyOffset
+			|| FMath::Abs(Offset.Z) > MaxKeyOffset;
+	};
+	bool bSparse = false;
+	int32 PropertyBytes = GetPropertyBytes(*Subject, PropertyValues, PropertyCount, bSparse);
+	auto FrameBytes = [&](bool bKey)
+	{
+		return (int32)sizeof(ULL_CaptureFrameRecord)
+			+ (bKey ? 3 * (int32)sizeof(double) : 0)
+			+ (bScale ? 3 * (int32)sizeof(float) : 0)
+			+ PropertyBytes;
+	};
+
+	bool bKey = NeedsKey();
+	uint32 TimeOffsetUs = 0;
+	uint8* Record = BeginRecord(FrameBytes(bKey), Time, TimeOffsetUs);
+	if (Record && ((!bKey && NeedsKey()) || (bSparse && Subject->PropertyChunkIndex != ChunkIndex)))
+	{
+		// BeginRecord started a new chunk: the first frame in it must be a key frame with full properties
+		bKey = true;
+		PropertyBytes = GetPropertyBytes(*Subject, PropertyValues, PropertyCount, bSparse);
+		Record = BeginRecord(FrameBytes(bKey), Time, TimeOffsetUs);
+	}
+	if (!Record)
+	{
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	if (bKey)
+	{
+		Subject->KeyChunkIndex = ChunkIndex;
+		Subject->KeyPosition = Position;
+	}
+
+	ULL_CaptureFrameRecord* Frame = reinterpret_cast<ULL_CaptureFrameRecord*>(Record);
+	Frame->timeOffsetUs = TimeOffsetUs;
+	Frame->position[0] = (float)(Position.X - Subject->KeyPosition.X);
+	Frame->position[1] = (float)(Position.Y - Subject->KeyPosition.Y);
+	Frame->position[2] = (float)(Position.Z - Subject->KeyPosition.Z);
+	Frame->rotation[0] = (float)Rotation.X;
+	Frame->rotation[1] = (float)Rotation.Y;
+	Frame->rotation[2] = (float)Rotation.Z;
+	Frame->rotation[3] = (float)Rotation.W;
+
+	uint8* Cursor = Record + sizeof(ULL_CaptureFrameRecord);
+	if (bKey)
+	{
+		const double Key[3] = { Position.X, Position.Y, Position.Z };
+		FMemory::Memcpy(Cursor, Key, sizeof(Key));
+		Cursor += sizeof(Key);
+	}
+	if (bScale)
+	{
+		const float ScaleValues[3] = { (float)Scale.X, (float)Scale.Y, (float)Scale.Z };
+		FMemory::Memcpy(Cursor, ScaleValues, sizeof(ScaleValues));
+		Cursor += sizeof(ScaleValues);
+	}
+	WriteProperties(Cursor, *Subject, PropertyValues, PropertyCount, bSparse);
+
+	const uint8 Flags = (bKey ? ULL_CAPTURE_FLAG_KEY : 0) | (bScale ? ULL_CAPTURE_FLAG_SCALE : 0) | (bSparse ? ULL_CAPTURE_FLAG_SPARSE : 0);
+	EndRecord(Record, ULL_CAPTURE_RECORD_FRAME, Flags, FrameBytes(bKey), Subject->SubjectId, Time);
+	FrameCount++;
+	SparseCount += bSparse ? 1 : 0;
+}
+
+void FLiveLinkRecorder::RecordDataFrame(const FName& SubjectName, const float* PropertyValues, int32 PropertyCount, double WorldTime)
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	const double Time = ToCaptureTime(WorldTime);
+
+	FScopeLock Lock(&CriticalSection);
+
+	FRecordedSubject* Subject = Subjects.Find(SubjectName);
+	if (!FileHandle || !Subject || Subject->bTransformRole)
+	{
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	bool bSparse = false;
+	int32 RecordBytes = (int32)sizeof(ULL_CaptureDataRecord) + GetPropertyBytes(*Subject, PropertyValues, PropertyCount, bSparse);
+	uint32 TimeOffsetUs = 0;
+	uint8* Record = BeginRecord(RecordBytes, Time, TimeOffsetUs);
+	if (Record && bSparse && Subject->PropertyChunkIndex != ChunkIndex)
+	{
+		// BeginRecord started a new chunk: the first section in it must be full
+		RecordBytes = (int32)sizeof(ULL_CaptureDataRecord) + GetPropertyBytes(*Subject, PropertyValues, PropertyCount, bSparse);
+		Record = BeginRecord(RecordBytes, Time, TimeOffsetUs);
+	}
+	if (!Record)
+	{
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	reinterpret_cast<ULL_CaptureDataRecord*>(Record)->timeOffsetUs = TimeOffsetUs;
+	WriteProperties(Record + sizeof(ULL_CaptureDataRecord), *Subject, PropertyValues, PropertyCount, bSparse);
+
+	EndRecord(Record, ULL_CAPTURE_RECORD_DATA, bSparse ? ULL_CAPTURE_FLAG_SPARSE : 0, RecordBytes, Subject->SubjectId, Time);
+	FrameCount++;
+	SparseCount += bSparse ? 1 : 0;
+}
+
+void FLiveLinkRecorder::RecordRemove(const FName& SubjectName)
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	const double Time = ToCaptureTime(FPlatformTime::Seconds());
+
+	FScopeLock Lock(&CriticalSection);
+
+	const FRecordedSubject* Subject = Subjects.Find(SubjectName);
+	if (!FileHandle || !Subject)
+	{
+		return;
+	}
+
+	uint32 TimeOffsetUs = 0;
+	uint8* Record = BeginRecord(sizeof(ULL_CaptureRecordHeader), Time, TimeOffsetUs);
+	if (!Record)
+	{
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	EndRecord(Record, ULL_CAPTURE_RECORD_REMOVE, 0, sizeof(ULL_CaptureRecordHeader), Subject->SubjectId, Time);
+}
+
+//=============================================================================
+// Encoding
+//=============================================================================
+
+void FLiveLinkRecorder::WriteSubjectRecord(const FName& SubjectName, bool bTransformRole, const TArray<FName>& PropertyNames)
+{
+	// Strings first, so the record size is known before reserving it
+	TArray<uint8> Strings;
+	auto AppendString = [&Strings](const FName& Name)
+	{
+		FTCHARToUTF8 Utf8(*Name.ToString());
+		Strings.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		Strings.Add(0);
+	};
+
+	AppendString(SubjectName);
+	for (const FName& PropertyName : PropertyNames)
+	{
+		AppendString(PropertyName);
+	}
+
+	const int32 RecordBytes = (int32)Align(sizeof(ULL_CaptureSubjectRecord) + Strings.Num(), (uint64)4);
+	const double Time = ToCaptureTime(FPlatformTime::Seconds());
+
+	uint32 TimeOffsetUs = 0;
+	uint8* Record = (PropertyNames.Num() <= MAX_uint16) ? BeginRecord(RecordBytes, Time, TimeOffsetUs) : nullptr;
+	if (!Record)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning,
+		       TEXT("LiveLinkRecorder: Subject '%s' not captured (%d properties do not fit a record)"),
+		       *SubjectName.ToString(),
+		       PropertyNames.Num());
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	FRecordedSubject* Subject = Subjects.Find(SubjectName);
+	if (!Subject)
+	{
+		Subject = &Subjects.Add(SubjectName, FRecordedSubject());
+		Subject->SubjectId = NextSubjectId++;
+	}
+	Subject->bTransformRole = bTransformRole;
+	Subject->KeyChunkIndex = MAX_uint32;
+	Subject->PropertyChunkIndex = MAX_uint32;
+
+	ULL_CaptureSubjectRecord* SubjectRecord = reinterpret_cast<ULL_CaptureSubjectRecord*>(Record);
+	SubjectRecord->timeOffsetUs = TimeOffsetUs;
+	SubjectRecord->role = bTransformRole ? ULL_CAPTURE_ROLE_TRANSFORM : ULL_CAPTURE_ROLE_BASIC;
+	SubjectRecord->propertyCount = (uint16)PropertyNames.Num();
+	FMemory::Memcpy(Record + sizeof(ULL_CaptureSubjectRecord), Strings.GetData(), Strings.Num());
+
+	EndRecord(Record, ULL_CAPTURE_RECORD_SUBJECT, 0, RecordBytes, Subject->SubjectId, Time);
+	SubjectRecordCount++;
+}
+
+// Bitwise comparison: lossless for NaN and signed zero
+static bool IsSameValue(float A, float B)
+{
+	uint32 BitsA;
+	uint32 BitsB;
+	FMemory::Memcpy(&BitsA, &A, sizeof(float));
+	FMemory::Memcpy(&BitsB, &B, sizeof(float));
+	return BitsA == BitsB;
+}
+
+int32 FLiveLinkRecorder::GetPropertyBytes(const FRecordedSubject& Subject, const float* PropertyValues, int32 PropertyCount, bool& bOutSparse) const
+{
+	bOutSparse = false;
+	const int32 FullBytes = PropertyCount * (int32)sizeof(float);
+	if (PropertyCount <= 0 || Subject.PropertyChunkIndex != ChunkIndex || Subject.LastProperties.Num() != PropertyCount)
+	{
+		return FullBytes;
+	}
+
+	int32 ChangedCount = 0;
+	for (int32 Index = 0; Index < PropertyCount; Index++)
+	{
+		ChangedCount += IsSameValue(PropertyValues[Index], Subject.LastProperties[Index]) ? 0 : 1;
+	}
+
+	const int32 MaskWords = (PropertyCount + 31) / 32;
+	const int32 SparseBytes = (MaskWords + ChangedCount) * (int32)sizeof(uint32);
+	if (ChangedCount * 100 > PropertyCount * SparseMaxDirtyPercent || SparseBytes >= FullBytes)
+	{
+		return FullBytes;
+	}
+
+	bOutSparse = true;
+	return SparseBytes;
+}
+
+void FLiveLinkRecorder::WriteProperties(uint8* Section, FRecordedSubject& Subject, const float* PropertyValues, int32 PropertyCount, bool bSparse)
+{
+	if (PropertyCount <= 0)
+	{
+		return;
+	}
+
+	if (bSparse)
+	{
+		const int32 MaskWords = (PropertyCount + 31) / 32;
+		uint32* Mask = reinterpret_cast<uint32*>(Section);
+		float* Values = reinterpret_cast<float*>(Section + MaskWords * sizeof(uint32));
+		FMemory::Memzero(Mask, MaskWords * sizeof(uint32));
+		for (int32 Index = 0; Index < PropertyCount; Index++)
+		{
+			if (!IsSameValue(PropertyValues[Index], Subject.LastProperties[Index]))
+			{
+				Mask[Index / 32] |= 1u << (Index % 32);
+				*Values++ = PropertyValues[Index];
+			}
+		}
+	}
+	else
+	{
+		FMemory::Memcpy(Section, PropertyValues, PropertyCount * sizeof(float));
+		Subject.PropertyChunkIndex = ChunkIndex;
+		if (Subject.LastProperties.Num() != PropertyCount)
+		{
+			Subject.LastProperties.SetNumUninitialized(PropertyCount);
+		}
+	}
+
+	FMemory::Memcpy(Subject.LastProperties.GetData(), PropertyValues, PropertyCount * sizeof(float));
+}
+
+uint8* FLiveLinkRecorder::BeginRecord(int32 RecordBytes, double Time, uint32& OutTimeOffsetUs)
+{
+	if (RecordBytes > ULL_CAPTURE_MAX_RECORD_BYTES)
+	{
+		return nullptr;
+	}
+
+	if (ChunkRecordCount > 0)
+	{
+		const bool bFull = ChunkUsedBytes + (uint32)RecordBytes > ChunkRecordBytes;
+		const bool bOffsetOverflow = (Time - ChunkBaseTime) * 1000000.0 >= (double)MAX_uint32;
+		if (bFull || bOffsetOverflow)
+		{
+			FlushChunk();
+		}
+	}
+
+	if (!FileHandle)
+	{
+		return nullptr;
+	}
+
+	if (ChunkRecordCount == 0)
+	{
+		ChunkBaseTime = Time;
+		ChunkEndTime = Time;
+	}
+
+	OutTimeOffsetUs = Time > ChunkBaseTime ? (uint32)((Time - ChunkBaseTime) * 1000000.0 + 0.5) : 0;
+	return ChunkBuffer.GetData() + ChunkHeaderBytes + ChunkUsedBytes;
+}
+
+void FLiveLinkRecorder::EndRecord(uint8* Record, uint8 Type, uint8 Flags, int32 RecordBytes, uint32 SubjectId, double Time)
+{
+	ULL_CaptureRecordHeader* Header = reinterpret_cast<ULL_CaptureRecordHeader*>(Record);
+	Header->type = Type;
+	Header->flags = Flags;
+	Header->size = (uint16)RecordBytes;
+	Header->subjectId = SubjectId;
+
+	ChunkUsedBytes += (uint32)RecordBytes;
+	ChunkRecordCount++;
+	ChunkEndTime = FMath::Max(ChunkEndTime, Time);
+	LastRecordTime = FMath::Max(LastRecordTime, Time);
+	RecordCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FLiveLinkRecorder::FlushChunk()
+{
+	ULL_CaptureChunkHeader Header = {};
+	Header.magic = ULL_CAPTURE_CHUNK_MAGIC;
+	Header.chunkIndex = ChunkIndex;
+	Header.usedBytes = ChunkUsedBytes;
+	Header.recordCount = ChunkRecordCount;
+	Header.baseTime = ChunkBaseTime;
+	Header.endTime = ChunkEndTime;
+	FMemory::Memcpy(ChunkBuffer.GetData(), &Header, sizeof(Header));
+
+	if (!FileHandle->Write(ChunkBuffer.GetData(), ULL_CAPTURE_CHUNK_BYTES))
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error,
+		       TEXT("LiveLinkRecorder: ❌ Write to '%s' failed - capture stopped after %u chunks"),
+		       *CapturePath,
+		       ChunkIndex);
+		DroppedCount.fetch_add(ChunkRecordCount, std::memory_order_relaxed);
+		bRecording.store(false, std::memory_order_release);
+		delete FileHandle;
+		FileHandle = nullptr;
+		return;
+	}
+
+	// Zero padding for the next chunk
+	FMemory::Memzero(ChunkBuffer.GetData(), ChunkHeaderBytes + ChunkUsedBytes);
+	ChunkIndex++;
+	ChunkUsedBytes = 0;
+	ChunkRecordCount = 0;
+}
+
+void FLiveLinkRecorder::WriteFileHeader()
+{
+	ULL_CaptureFileHeader Header = {};
+	Header.magic = ULL_CAPTURE_MAGIC;
+	Header.version = ULL_CAPTURE_VERSION;
+	Header.headerSize = sizeof(ULL_CaptureFileHeader);
+	Header.chunkBytes = ULL_CAPTURE_CHUNK_BYTES;
+	Header.chunkCount = ChunkIndex;
+	Header.recordCount = GetRecordCount();
+	Header.frameCount = FrameCount;
+	Header.startWorldTime = StartWorldTime;
+	Header.durationSeconds = LastRecordTime;
+	Header.subjectCount = SubjectRecordCount;
+
+	FileHandle->Seek(0);
+	FileHandle->Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+	FileHandle->Seek(sizeof(ULL_CaptureFileHeader) + (int64)ChunkIndex * ULL_CAPTURE_CHUNK_BYTES);
+}
+
+double FLiveLinkRecorder::ToCaptureTime(double WorldTime) const
+{
+	return FMath::Max(WorldTime - StartWorldTime, 0.0);
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+#include "Math/Transform.h"
+#include "UnrealLiveLink.Capture.h"
+#include <atomic>
+
+// LiveLink includes (FLiveLinkStaticDataStruct, ULiveLinkRole)
+// Disable C4099 warning: UE has inconsistent class/struct forward declarations
+#pragma warning(push)
+#pragma warning(disable: 4099)
+#include "LiveLinkTypes.h"
+#pragma warning(pop)
+
+class IFileHandle;
+
+//=============================================================================
+// LiveLink Recorder (ULL_StartCapture / ULL_StopCapture)
+//=============================================================================
+// Appends every static-data, frame and removal the bridge hands to
+// ILiveLinkProvider to a capture file (format: UnrealLiveLink.Capture.h).
+//
+// Records are packed into a fixed-size chunk buffer that is written to the
+// file in one call when it fills, so the per-frame cost is a memcpy into
+// memory that is already resident. Nothing is allocated per frame.
+//
+// Threading:
+// - Record* may be called from any thread; callers are the sender worker in
+//   async mode and the bridge (holding its CriticalSection) in sync mode
+// - The recorder has its own lock and never calls back into the bridge
+// - IsRecording() is a lock-free check so the hot paths pay one atomic load
+//   while no capture is running
+//=============================================================================
+
+/// <summary>
+/// Subject registration captured when recording starts (subjects registered earlier)
+/// </summary>
+struct FLiveLinkCaptureSubject
+{
+	FName SubjectName;
+	bool bTransformRole = true;
+	TArray<FName> PropertyNames;
+};
+
+/// <summary>
+/// Chunked binary writer for the frames sent to the provider
+/// </summary>
+class FLiveLinkRecorder
+{
+public:
+	FLiveLinkRecorder();
+	~FLiveLinkRecorder();
+
+	/// <summary>
+	/// Create the capture file and write a SUBJECT record for every existing subject.
+	/// Both happen under the recorder lock, so a frame recorded concurrently is
+	/// never written before its subject.
+	/// </summary>
+	/// <param name="FilePath">Capture file (overwritten)</param>
+	/// <param name="ExistingSubjects">Subjects registered before the capture started</param>
+	/// <returns>true if the file was created</returns>
+	bool Start(const FString& FilePath, const TArray<FLiveLinkCaptureSubject>& ExistingSubjects);
+
+	/// <summary>
+	/// Write the last chunk, finalize the file header and close the file.
+	/// Safe to call when no capture is running.
+	/// </summary>
+	void Stop();
+
+	bool IsRecording() const { return bRecording.load(std::memory_order_acquire); }
+
+	//=============================================================================
+	// Recording (no-ops while not recording)
+	//=============================================================================
+
+	void RecordStaticData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> RoleClass, const FLiveLinkStaticDataStruct& StaticData);
+	void RecordFrame(const FName& SubjectName, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, double WorldTime);
+	void RecordDataFrame(const FName& SubjectName, const float* PropertyValues, int32 PropertyCount, double WorldTime);
+	void RecordRemove(const FName& SubjectName);
+
+	//=============================================================================
+	// Counters (current or last capture)
+	//=============================================================================
+
+	uint64 GetRecordCount() const { return RecordCount.load(std::memory_order_relaxed); }
+	uint64 GetDroppedCount() const { return DroppedCount.load(std::memory_order_relaxed); }
+
+private:
+	/// <summary>
+	/// Per-subject encoder state
+	/// </summary>
+	struct FRecordedSubject
+	{
+		uint32 SubjectId = 0;
+		bool bTransformRole = true;
+		uint32 KeyChunkIndex = MAX_uint32;   // Chunk holding this subject's current key frame
+		FVector KeyPosition = FVector::ZeroVector;
+		uint32 PropertyChunkIndex = MAX_uint32;  // Chunk holding this subject's last full property section
+		TArray<float> LastProperties;        // Values as a decoder of this chunk will have them
+	};
+
+	/// <summary>
+	/// Size of a subject's property section in the current chunk. Sparse (changed mask and
+	/// changed values) only after a full section in this chunk, when at most SparseMaxDirtyPercent
+	/// of the values changed and it is smaller than the full section.
+	/// </summary>
+	// Note: Caller must hold CriticalSection lock
+	int32 GetPropertyBytes(const FRecordedSubject& Subject, const float* PropertyValues, int32 PropertyCount, bool& bOutSparse) const;
+
+	/// <summary>
+	/// Write a property section sized by GetPropertyBytes and update the subject's values
+	/// </summary>
+	// Note: Caller must hold CriticalSection lock
+	void WriteProperties(uint8* Section, FRecordedSubject& Subject, const float* PropertyValues, int32 PropertyCount, bool bSparse);
+
+	// Note: Caller must hold CriticalSection lock
+	void WriteSubjectRecord(const FName& SubjectName, bool bTransformRole, const TArray<FName>& PropertyNames);
+
+	/// <summary>
+	/// Reserve RecordBytes in the current chunk for a record at Time, starting a new chunk
+	/// when it does not fit (or the time offset would overflow). Returns the record
+	/// memory and its time offset, or nullptr when the record is too large.
+	/// </summary>
+	// Note: Caller must hold CriticalSection lock
+	uint8* BeginRecord(int32 RecordBytes, double Time, uint32& OutTimeOffsetUs);
+
+	// Note: Caller must hold CriticalSection lock
+	void EndRecord(uint8* Record, uint8 Type, uint8 Flags, int32 RecordBytes, uint32 SubjectId, double Time);
+
+	// Note: Caller must hold CriticalSection lock
+	void FlushChunk();
+
+	// Note: Caller must hold CriticalSection lock
+	void WriteFileHeader();
+
+	/// <summary>
+	/// Seconds since the capture started for a frame's WorldTime (clamped to >= 0)
+	/// </summary>
+	double ToCaptureTime(double WorldTime) const;
+
+	FCriticalSection CriticalSection;
+	std::atomic<bool> bRecording{false};
+
+	IFileHandle* FileHandle = nullptr;
+	FString CapturePath;
+	double StartWorldTime = 0.0;
+
+	TArray<uint8> ChunkBuffer;            // ULL_CAPTURE_CHUNK_BYTES, header at the front
+	uint32 ChunkIndex = 0;
+	uint32 ChunkUsedBytes = 0;            // Record bytes after the chunk header
+	uint32 ChunkRecordCount = 0;
+	double ChunkBaseTime = 0.0;
+	double ChunkEndTime = 0.0;
+
+	TMap<FName, FRecordedSubject> Subjects;
+	uint32 NextSubjectId = 0;
+	uint32 SubjectRecordCount = 0;
+	uint64 FrameCount = 0;
+	uint64 SparseCount = 0;               // Frames written with a sparse property section
+	double LastRecordTime = 0.0;
+
+	std::atomic<uint64> RecordCount{0};
+	std::atomic<uint64> DroppedCount{0};  // Too large, unknown subject or failed write
+};
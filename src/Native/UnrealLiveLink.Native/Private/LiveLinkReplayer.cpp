@@ -0,0 +1,758 @@
+#include "LiveLinkReplayer.h"
+#include "UnrealLiveLink.Native.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Async/MappedFileHandle.h"
+
+// LiveLink role and data types
+#pragma warning(push)
+#pragma warning(disable: 4099)
+#include "LiveLinkTypes.h"
+#include "Roles/LiveLinkBasicRole.h"
+#include "Roles/LiveLinkTransformRole.h"
+#include "Roles/LiveLinkTransformTypes.h"
+#pragma warning(pop)
+
+//=============================================================================
+// LiveLinkReplayer Implementation
+//=============================================================================
+
+// Worker wait between passes while playing, and while paused or finished (ms)
+static constexpr uint32 ReplayPlayingWaitMs = 1;
+static constexpr uint32 ReplayIdleWaitMs = 20;
+
+FLiveLinkReplayer::FLiveLinkReplayer(const TSharedPtr<ILiveLinkProvider>& InProvider)
+	: Provider(InProvider)
+{
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FLiveLinkReplayer::~FLiveLinkReplayer()
+{
+	StopAndJoin();
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	// Region before the file handle it was mapped from
+	delete MappedRegion;
+	MappedRegion = nullptr;
+	delete MappedFile;
+	MappedFile = nullptr;
+}
+
+bool FLiveLinkReplayer::Load(const FString& FilePath)
+{
+	CapturePath = FilePath;
+
+	MappedFile = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath);
+	if (!MappedFile)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error,
+		       TEXT("LiveLinkReplayer: ❌ Failed to open capture file '%s'"),
+		       *FilePath);
+		return false;
+	}
+
+	const int64 FileSize = MappedFile->GetFileSize();
+	if (FileSize < (int64)sizeof(ULL_CaptureFileHeader))
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error,
+		       TEXT("LiveLinkReplayer: ❌ '%s' is too small to be a capture (%lld bytes)"),
+		       *FilePath,
+		       FileSize);
+		return false;
+	}
+
+	MappedRegion = MappedFile->MapRegion(0, FileSize);
+	if (!MappedRegion)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error,
+		       TEXT("LiveLinkReplayer: ❌ Failed to map '%s'"),
+		       *FilePath);
+		return false;
+	}
+
+	const uint8* Base = MappedRegion->GetMappedPtr();
+	ULL_CaptureFileHeader Header;
+	FMemory::Memcpy(&Header, Base, sizeof(Header));
+
+	if (Header.magic != ULL_CAPTURE_MAGIC
+		|| Header.version < 1
+		|| Header.version > ULL_CAPTURE_VERSION
+		|| Header.headerSize != sizeof(ULL_CaptureFileHeader)
+		|| Header.chunkBytes <= sizeof(ULL_CaptureChunkHeader))
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error,
+		       TEXT("LiveLinkReplayer: ❌ '%s' is not a version 1-%d capture file"),
+		       *FilePath,
+		       ULL_CAPTURE_VERSION);
+		return false;
+	}
+
+	// A capture that was not closed has chunkCount 0: use every complete chunk on disk
+	const uint64 ChunksOnDisk = (uint64)(FileSize - Header.headerSize) / Header.chunkBytes;
+	const uint64 ChunkCount = (Header.chunkCount > 0) ? FMath::Min((uint64)Header.chunkCount, ChunksOnDisk) : ChunksOnDisk;
+
+	// Index the chunks and size the subject table
+	uint32 SubjectIdCount = 0;
+	double LastTime = 0.0;
+	for (uint64 Index = 0; Index < ChunkCount; Index++)
+	{
+		const uint8* ChunkBase = Base + Header.headerSize + Index * Header.chunkBytes;
+		ULL_CaptureChunkHeader ChunkHeader;
+		FMemory::Memcpy(&ChunkHeader, ChunkBase, sizeof(ChunkHeader));
+
+		if (ChunkHeader.magic != ULL_CAPTURE_CHUNK_MAGIC
+			|| ChunkHeader.usedBytes > Header.chunkBytes - sizeof(ULL_CaptureChunkHeader))
+		{
+			UE_LOG(LogUnrealLiveLinkNative, Warning,
+			       TEXT("LiveLinkReplayer: Chunk %llu of '%s' is damaged - replaying the first %llu chunks"),
+			       Index,
+			       *FilePath,
+			       Index);
+			break;
+		}
+
+		FChunkInfo& Chunk = Chunks.AddDefaulted_GetRef();
+		Chunk.Records = ChunkBase + sizeof(ULL_CaptureChunkHeader);
+		Chunk.UsedBytes = ChunkHeader.usedBytes;
+		Chunk.BaseTime = ChunkHeader.baseTime;
+		LastTime = FMath::Max(LastTime, ChunkHeader.endTime);
+
+		for (uint32 Offset = 0; Offset + sizeof(ULL_CaptureRecordHeader) <= Chunk.UsedBytes;)
+		{
+			ULL_CaptureRecordHeader RecordHeader;
+			FMemory::Memcpy(&RecordHeader, Chunk.Records + Offset, sizeof(RecordHeader));
+			if (RecordHeader.size < sizeof(ULL_CaptureRecordHeader))
+			{
+				break;
+			}
+			if (RecordHeader.type == ULL_CAPTURE_RECORD_SUBJECT)
+			{
+				SubjectIdCount = FMath::Max(SubjectIdCount, RecordHeader.subjectId + 1);
+			}
+			Offset += RecordHeader.size;
+		}
+	}
+
+	Subjects.SetNum(SubjectIdCount);
+	Duration = (Header.durationSeconds > 0.0) ? Header.durationSeconds : LastTime;
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkReplayer: Loaded '%s' (%d chunks, %u subjects, %.1f s)"),
+	       *FilePath,
+	       Chunks.Num(),
+	       SubjectIdCount,
+	       Duration);
+	return true;
+}
+
+bool FLiveLinkReplayer::Start(double InSpeed, bool bInLoop)
+{
+	if (Thread)
+	{
+		return true;
+	}
+
+	bLoop = bInLoop;
+	SetSpeed(InSpeed);
+	CursorChunk = 0;
+	CursorOffset = 0;
+	Position.store(0.0);
+	PendingSeek.store(-1.0);
+	bFinished.store(false);
+	bStopRequested.store(false);
+
+	Thread = FRunnableThread::Create(this, TEXT("UnrealLiveLinkReplay"), 0, TPri_AboveNormal);
+	if (!Thread)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error,
+		       TEXT("LiveLinkReplayer: ❌ Failed to create replay thread"));
+		return false;
+	}
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkReplayer: Replaying '%s' at %.2fx%s"),
+	       *CapturePath,
+	       Speed.load(),
+	       bLoop ? TEXT(" (loop)") : TEXT(""));
+	return true;
+}
+
+void FLiveLinkReplayer::StopAndJoin()
+{
+	if (!Thread)
+	{
+		return;
+	}
+
+	Stop();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+
+	RemoveSentSubjects();
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkReplayer: Replay of '%s' stopped at %.1f / %.1f s (%llu frames sent)"),
+	       *CapturePath,
+	       GetPosition(),
+	       Duration,
+	       FramesSent.load());
+}
+
+void FLiveLinkReplayer::Stop()
+{
+	bStopRequested.store(true);
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FLiveLinkReplayer::SetSpeed(double InSpeed)
+{
+	Speed.store(FMath::Clamp(InSpeed, 0.0, ULL_REPLAY_MAX_SPEED));
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FLiveLinkReplayer::Seek(double Seconds)
+{
+	PendingSeek.store(FMath::Clamp(Seconds, 0.0, Duration));
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+//=============================================================================
+// Worker
+//=============================================================================
+
+uint32 FLiveLinkReplayer::Run()
+{
+	double LastWallTime = FPlatformTime::Seconds();
+
+	while (!bStopRequested.load())
+	{
+		const double Target = PendingSeek.exchange(-1.0);
+		if (Target >= 0.0)
+		{
+			SeekTo(Target);
+		}
+
+		const double Now = FPlatformTime::Seconds();
+		const double CurrentSpeed = Speed.load();
+		double NewPosition = GetPosition() + (Now - LastWallTime) * CurrentSpeed;
+		LastWallTime = Now;
+
+		bool bAtEnd = PlayUntil(NewPosition);
+		if (bAtEnd)
+		{
+			if (bLoop && Chunks.Num() > 0 && CurrentSpeed > 0.0)
+			{
+				SeekTo(0.0);
+				NewPosition = 0.0;
+				bAtEnd = false;
+			}
+			else
+			{
+				NewPosition = FMath::Min(NewPosition, Duration);
+			}
+		}
+
+		Position.store(NewPosition);
+		bFinished.store(bAtEnd);
+
+		const bool bPlaying = CurrentSpeed > 0.0 && !bAtEnd;
+		WakeEvent->Wait(bPlaying ? ReplayPlayingWaitMs : ReplayIdleWaitMs);
+	}
+
+	return 0;
+}
+
+bool FLiveLinkReplayer::PlayUntil(double Target)
+{
+	while (CursorChunk < Chunks.Num())
+	{
+		const FChunkInfo& Chunk = Chunks[CursorChunk];
+		if (CursorOffset + sizeof(ULL_CaptureRecordHeader) > Chunk.UsedBytes)
+		{
+			CursorChunk++;
+			CursorOffset = 0;
+			continue;
+		}
+
+		const uint8* Record = Chunk.Records + CursorOffset;
+		const ULL_CaptureRecordHeader* Header = reinterpret_cast<const ULL_CaptureRecordHeader*>(Record);
+		if (Header->size < sizeof(ULL_CaptureRecordHeader) || CursorOffset + Header->size > Chunk.UsedBytes)
+		{
+			// Damaged record: skip the rest of the chunk
+			CursorChunk++;
+			CursorOffset = 0;
+			continue;
+		}
+
+		if (RecordTime(Record, Chunk) > Target)
+		{
+			return false;
+		}
+
+		ApplyRecord(Record, (uint32)CursorChunk, true);
+		CursorOffset += Header->size;
+	}
+
+	return true;
+}
+
+void FLiveLinkReplayer::SeekTo(double Target)
+{
+	// Chunk containing Target: the last one starting at or before it
+	int32 TargetChunk = 0;
+	while (TargetChunk + 1 < Chunks.Num() && Chunks[TargetChunk + 1].BaseTime <= Target)
+	{
+		TargetChunk++;
+	}
+
+	for (FReplaySubject& Subject : Subjects)
+	{
+		Subject.bAlive = false;
+		Subject.bHasScrubFrame = false;
+		Subject.KeyChunkIndex = MAX_uint32;
+		Subject.PropertyChunkIndex = MAX_uint32;
+	}
+
+	// Registrations and removals before the target chunk, frames skipped
+	for (int32 ChunkIndex = 0; ChunkIndex < TargetChunk; ChunkIndex++)
+	{
+		const FChunkInfo& Chunk = Chunks[ChunkIndex];
+		for (uint32 Offset = 0; Offset + sizeof(ULL_CaptureRecordHeader) <= Chunk.UsedBytes;)
+		{
+			const ULL_CaptureRecordHeader* Header = reinterpret_cast<const ULL_CaptureRecordHeader*>(Chunk.Records + Offset);
+			if (Header->size < sizeof(ULL_CaptureRecordHeader) || Offset + Header->size > Chunk.UsedBytes)
+			{
+				break;
+			}
+			if (Header->type == ULL_CAPTURE_RECORD_SUBJECT || Header->type == ULL_CAPTURE_RECORD_REMOVE)
+			{
+				ApplyRecord(Chunk.Records + Offset, (uint32)ChunkIndex, false);
+			}
+			Offset += Header->size;
+		}
+	}
+
+	// Everything in the target chunk up to Target, keeping the latest frame per subject
+	CursorChunk = TargetChunk;
+	CursorOffset = 0;
+	if (Chunks.Num() > 0)
+	{
+		const FChunkInfo& Chunk = Chunks[TargetChunk];
+		while (CursorOffset + sizeof(ULL_CaptureRecordHeader) <= Chunk.UsedBytes)
+		{
+			const uint8* Record = Chunk.Records + CursorOffset;
+			const ULL_CaptureRecordHeader* Header = reinterpret_cast<const ULL_CaptureRecordHeader*>(Record);
+			if (Header->size < sizeof(ULL_CaptureRecordHeader)
+				|| CursorOffset + Header->size > Chunk.UsedBytes
+				|| RecordTime(Record, Chunk) > Target)
+			{
+				break;
+			}
+			ApplyRecord(Record, (uint32)TargetChunk, false);
+			CursorOffset += Header->size;
+		}
+	}
+
+	// Bring the provider to the state at Target
+	for (FReplaySubject& Subject : Subjects)
+	{
+		if (Subject.bAlive)
+		{
+			if (Subject.SentVersion != Subject.DefinitionVersion)
+			{
+				SendStaticData(Subject);
+			}
+			if (Subject.bHasScrubFrame)
+			{
+				if (Subject.bTransformRole)
+				{
+					SendFrame(Subject, Subject.ScrubTransform, Subject.Properties.GetData(), Subject.Properties.Num());
+				}
+				else
+				{
+					SendDataFrame(Subject, Subject.Properties.GetData(), Subject.Properties.Num());
+				}
+				Subject.bHasScrubFrame = false;
+			}
+		}
+		else if (Subject.SentVersion != INDEX_NONE)
+		{
+			RemoveSentSubject(Subject);
+		}
+	}
+
+	Position.store(Target);
+}
+
+//=============================================================================
+// Decoding
+//=============================================================================
+
+double FLiveLinkReplayer::RecordTime(const uint8* Record, const FChunkInfo& Chunk) const
+{
+	// REMOVE records carry no time: they apply as soon as the cursor reaches them
+	const ULL_CaptureRecordHeader* Header = reinterpret_cast<const ULL_CaptureRecordHeader*>(Record);
+	if (Header->type == ULL_CAPTURE_RECORD_REMOVE || Header->size < sizeof(ULL_CaptureDataRecord))
+	{
+		return 0.0;
+	}
+
+	const uint32 TimeOffsetUs = reinterpret_cast<const ULL_CaptureDataRecord*>(Record)->timeOffsetUs;
+	return Chunk.BaseTime + TimeOffsetUs * 0.000001;
+}
+
+void FLiveLinkReplayer::ApplyRecord(const uint8* Record, uint32 ChunkIndex, bool bSend)
+{
+	const ULL_CaptureRecordHeader* Header = reinterpret_cast<const ULL_CaptureRecordHeader*>(Record);
+
+	if (Header->type == ULL_CAPTURE_RECORD_SUBJECT)
+	{
+		ApplySubjectRecord(Record, bSend);
+		return;
+	}
+
+	if (!Subjects.IsValidIndex((int32)Header->subjectId))
+	{
+		return;
+	}
+	FReplaySubject& Subject = Subjects[Header->subjectId];
+
+	switch (Header->type)
+	{
+	case ULL_CAPTURE_RECORD_REMOVE:
+		Subject.bAlive = false;
+		Subject.bHasScrubFrame = false;
+		if (bSend && Subject.SentVersion != INDEX_NONE)
+		{
+			RemoveSentSubject(Subject);
+		}
+		break;
+
+	case ULL_CAPTURE_RECORD_FRAME:
+	{
+		FTransform Transform;
+		if (!Subject.bAlive || !Subject.bTransformRole
+			|| !DecodeTransform(Record, ChunkIndex, Subject, Transform))
+		{
+			break;
+		}
+
+		if (bSend)
+		{
+			SendFrame(Subject, Transform, Subject.Properties.GetData(), Subject.Properties.Num());
+		}
+		else
+		{
+			Subject.bHasScrubFrame = true;
+			Subject.ScrubTransform = Transform;
+		}
+		break;
+	}
+
+	case ULL_CAPTURE_RECORD_DATA:
+	{
+		if (!Subject.bAlive || Subject.bTransformRole || Header->size < sizeof(ULL_CaptureDataRecord)
+			|| !DecodeProperties(Record + sizeof(ULL_CaptureDataRecord), Header->size - (int32)sizeof(ULL_CaptureDataRecord),
+			                     (Header->flags & ULL_CAPTURE_FLAG_SPARSE) != 0, ChunkIndex, Subject))
+		{
+			break;
+		}
+
+		if (bSend)
+		{
+			SendDataFrame(Subject, Subject.Properties.GetData(), Subject.Properties.Num());
+		}
+		else
+		{
+			Subject.bHasScrubFrame = true;
+		}
+		break;
+	}
+
+	default:
+		break;
+	}
+}
+
+void FLiveLinkReplayer::ApplySubjectRecord(const uint8* Record, bool bSend)
+{
+	const ULL_CaptureSubjectRecord* SubjectRecord = reinterpret_cast<const ULL_CaptureSubjectRecord*>(Record);
+	const uint32 RecordBytes = SubjectRecord->header.size;
+	if (RecordBytes < sizeof(ULL_CaptureSubjectRecord) || !Subjects.IsValidIndex((int32)SubjectRecord->header.subjectId))
+	{
+		return;
+	}
+
+	// NUL-terminated UTF-8 strings: subject name, then the property names
+	const ANSICHAR* Strings = reinterpret_cast<const ANSICHAR*>(Record + sizeof(ULL_CaptureSubjectRecord));
+	const ANSICHAR* StringsEnd = reinterpret_cast<const ANSICHAR*>(Record + RecordBytes);
+	auto NextString = [&Strings, StringsEnd](FName& OutName)
+	{
+		const ANSICHAR* End = Strings;
+		while (End < StringsEnd && *End != '\0')
+		{
+			End++;
+		}
+		if (End >= StringsEnd)
+		{
+			return false;
+		}
+		OutName = FName(UTF8_TO_TCHAR(Strings));
+		Strings = End + 1;
+		return true;
+	};
+
+	FReplaySubject& Subject = Subjects[SubjectRecord->header.subjectId];
+	if (!NextString(Subject.SubjectName))
+	{
+		return;
+	}
+
+	Subject.PropertyNames.Reset();
+	for (int32 Index = 0; Index < SubjectRecord->propertyCount; Index++)
+	{
+		FName PropertyName;
+		if (!NextString(PropertyName))
+		{
+			break;
+		}
+		Subject.PropertyNames.Add(PropertyName);
+	}
+
+	Subject.bTransformRole = SubjectRecord->role == ULL_CAPTURE_ROLE_TRANSFORM;
+	Subject.bAlive = true;
+	Subject.DefinitionVersion++;
+	Subject.KeyChunkIndex = MAX_uint32;
+	Subject.PropertyChunkIndex = MAX_uint32;
+
+	if (bSend)
+	{
+		SendStaticData(Subject);
+	}
+}
+
+bool FLiveLinkReplayer::DecodeTransform(const uint8* Record, uint32 ChunkIndex, FReplaySubject& Subject, FTransform& OutTransform)
+{
+	const ULL_CaptureFrameRecord* Frame = reinterpret_cast<const ULL_CaptureFrameRecord*>(Record);
+	const bool bKey = (Frame->header.flags & ULL_CAPTURE_FLAG_KEY) != 0;
+	const bool bScale = (Frame->header.flags & ULL_CAPTURE_FLAG_SCALE) != 0;
+	const int32 FixedBytes = (int32)sizeof(ULL_CaptureFrameRecord)
+		+ (bKey ? 3 * (int32)sizeof(double) : 0)
+		+ (bScale ? 3 * (int32)sizeof(float) : 0);
+
+	if (Frame->header.size < FixedBytes)
+	{
+		return false;
+	}
+
+	const uint8* Cursor = Record + sizeof(ULL_CaptureFrameRecord);
+	if (bKey)
+	{
+		double Key[3];
+		FMemory::Memcpy(Key, Cursor, sizeof(Key));
+		Cursor += sizeof(Key);
+		Subject.KeyChunkIndex = ChunkIndex;
+		Subject.KeyPosition = FVector(Key[0], Key[1], Key[2]);
+	}
+	else if (Subject.KeyChunkIndex != ChunkIndex)
+	{
+		// Offset from a key frame this decode has not seen
+		return false;
+	}
+
+	FVector Scale = FVector::OneVector;
+	if (bScale)
+	{
+		float ScaleValues[3];
+		FMemory::Memcpy(ScaleValues, Cursor, sizeof(ScaleValues));
+		Cursor += sizeof(ScaleValues);
+		Scale = FVector(ScaleValues[0], ScaleValues[1], ScaleValues[2]);
+	}
+
+	const FVector Location(
+		Subject.KeyPosition.X + Frame->position[0],
+		Subject.KeyPosition.Y + Frame->position[1],
+		Subject.KeyPosition.Z + Frame->position[2]);
+	const FQuat Rotation(Frame->rotation[0], Frame->rotation[1], Frame->rotation[2], Frame->rotation[3]);
+
+	OutTransform = FTransform(Rotation, Location, Scale);
+	return DecodeProperties(Cursor, Frame->header.size - FixedBytes, (Frame->header.flags & ULL_CAPTURE_FLAG_SPARSE) != 0, ChunkIndex, Subject);
+}
+
+bool FLiveLinkReplayer::DecodeProperties(const uint8* Section, int32 SectionBytes, bool bSparse, uint32 ChunkIndex, FReplaySubject& Subject)
+{
+	const int32 WordCount = SectionBytes / (int32)sizeof(float);
+	if (!bSparse)
+	{
+		Subject.Properties.Reset();
+		Subject.Properties.Append(reinterpret_cast<const float*>(Section), WordCount);
+		Subject.PropertyChunkIndex = ChunkIndex;
+		return true;
+	}
+
+	// Changes to a full section this decode has not seen
+	const int32 PropertyCount = Subject.Properties.Num();
+	const int32 MaskWords = (PropertyCount + 31) / 32;
+	if (Subject.PropertyChunkIndex != ChunkIndex || PropertyCount == 0 || WordCount < MaskWords)
+	{
+		return false;
+	}
+
+	const uint32* Mask = reinterpret_cast<const uint32*>(Section);
+	const float* Values = reinterpret_cast<const float*>(Section + MaskWords * sizeof(uint32));
+	const float* ValuesEnd = reinterpret_cast<const float*>(Section) + WordCount;
+	for (int32 Index = 0; Index < PropertyCount; Index++)
+	{
+		if ((Mask[Index / 32] & (1u << (Index % 32))) != 0)
+		{
+			if (Values >= ValuesEnd)
+			{
+				return false;
+			}
+			Subject.Properties[Index] = *Values++;
+		}
+	}
+	return true;
+}
+
+//=============================================================================
+// Provider
+//=============================================================================
+
+void FLiveLinkReplayer::SendStaticData(FReplaySubject& Subject)
+{
+	if (Subject.bTransformRole)
+	{
+		FLiveLinkStaticDataStruct StaticData(FLiveLinkTransformStaticData::StaticStruct());
+		if (FLiveLinkTransformStaticData* TransformStaticData = StaticData.Cast<FLiveLinkTransformStaticData>())
+		{
+			TransformStaticData->PropertyNames = Subject.PropertyNames;
+			Provider->UpdateSubjectStaticData(Subject.SubjectName, ULiveLinkTransformRole::StaticClass(), MoveTemp(StaticData));
+		}
+	}
+	else
+	{
+		FLiveLinkStaticDataStruct StaticData(FLiveLinkBaseStaticData::StaticStruct());
+		if (FLiveLinkBaseStaticData* BaseStaticData = StaticData.Cast<FLiveLinkBaseStaticData>())
+		{
+			BaseStaticData->PropertyNames = Subject.PropertyNames;
+			Provider->UpdateSubjectStaticData(Subject.SubjectName, ULiveLinkBasicRole::StaticClass(), MoveTemp(StaticData));
+		}
+	}
+
+	Subject.SentVersion = Subject.DefinitionVersion;
+}
+
+void FLiveLinkReplayer::SendFrame(const FReplaySubject& Subject, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount)
+{
+	if (Subject.SentVersion == INDEX_NONE)
+	{
+		return;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkTransformFrameData::StaticStruct());
+	FLiveLinkTransformFrameData* TransformFrameData = FrameData.Cast<FLiveLinkTransformFrameData>();
+	if (!TransformFrameData)
+	{
+		return;
+	}
+
+	TransformFrameData->Transform = Transform;
+	TransformFrameData->WorldTime = FLiveLinkWorldTime(FPlatformTime::Seconds());
+	if (PropertyCount > 0)
+	{
+		TransformFrameData->PropertyValues.Append(PropertyValues, PropertyCount);
+	}
+
+	Provider->UpdateSubjectFrameData(Subject.SubjectName, MoveTemp(FrameData));
+	FramesSent.fetch_add(1, std::memory_order_relaxed);
+	StoreSentFrame(Subject.SubjectName, Transform, PropertyValues, PropertyCount);
+}
+
+void FLiveLinkReplayer::SendDataFrame(const FReplaySubject& Subject, const float* PropertyValues, int32 PropertyCount)
+{
+	if (Subject.SentVersion == INDEX_NONE)
+	{
+		return;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkBaseFrameData::StaticStruct());
+	FLiveLinkBaseFrameData* BaseFrameData = FrameData.Cast<FLiveLinkBaseFrameData>();
+	if (!BaseFrameData)
+	{
+		return;
+	}
+
+	BaseFrameData->WorldTime = FLiveLinkWorldTime(FPlatformTime::Seconds());
+	if (PropertyCount > 0)
+	{
+		BaseFrameData->PropertyValues.Append(PropertyValues, PropertyCount);
+	}
+
+	Provider->UpdateSubjectFrameData(Subject.SubjectName, MoveTemp(FrameData));
+	FramesSent.fetch_add(1, std::memory_order_relaxed);
+	StoreSentFrame(Subject.SubjectName, FTransform::Identity, PropertyValues, PropertyCount);
+}
+
+void FLiveLinkReplayer::RemoveSentSubjects()
+{
+	for (FReplaySubject& Subject : Subjects)
+	{
+		if (Subject.SentVersion != INDEX_NONE)
+		{
+			RemoveSentSubject(Subject);
+		}
+		Subject.bAlive = false;
+	}
+}
+
+void FLiveLinkReplayer::RemoveSentSubject(FReplaySubject& Subject)
+{
+	Provider->RemoveSubject(Subject.SubjectName);
+	Subject.SentVersion = INDEX_NONE;
+
+	FScopeLock Lock(&SentFramesLock);
+	SentFrames.Remove(Subject.SubjectName);
+}
+
+void FLiveLinkReplayer::StoreSentFrame(FName SubjectName, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount)
+{
+	FScopeLock Lock(&SentFramesLock);
+	FSentFrame& Sent = SentFrames.FindOrAdd(SubjectName);
+	Sent.Transform = Transform;
+	Sent.PropertyValues.Reset();
+	if (PropertyCount > 0)
+	{
+		Sent.PropertyValues.Append(PropertyValues, PropertyCount);
+	}
+}
+
+bool FLiveLinkReplayer::GetSentFrame(FName SubjectName, FTransform& OutTransform, TArray<float>& OutPropertyValues) const
+{
+	FScopeLock Lock(&SentFramesLock);
+	const FSentFrame* Sent = SentFrames.Find(SubjectName);
+	if (!Sent)
+	{
+		return false;
+	}
+
+	OutTransform = Sent->Transform;
+	OutPropertyValues = Sent->PropertyValues;
+	return true;
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+#include "Math/Transform.h"
+#include "UnrealLiveLink.Capture.h"
+#include <atomic>
+
+// LiveLink includes Message Bus Provider API
+// Disable C4099 warning: UE has inconsistent class/struct forward declarations
+#pragma warning(push)
+#pragma warning(disable: 4099)
+#include "LiveLinkProvider.h"
+#pragma warning(pop)
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+//=============================================================================
+// LiveLink Replayer (ULL_StartReplay)
+//=============================================================================
+// Streams a capture file (format: UnrealLiveLink.Capture.h) back through the
+// bridge's ILiveLinkProvider on a worker thread, so a run can be reviewed in
+// Unreal without Simio.
+//
+// - The file is memory-mapped read-only; records are decoded in place
+// - Frames are restamped with the current FPlatformTime::Seconds() so
+//   LiveLink's buffering treats them as live
+// - Speed is a multiplier on capture time (1 = real time, 0 = paused)
+// - Seek decodes from the start of the chunk containing the target time and
+//   sends each subject's latest frame at that time (scrubbing)
+//
+// Threading: SetSpeed/Seek/GetPosition/GetSentFrame may be called from any
+// thread; only the worker touches the decode cursor and calls the provider.
+//=============================================================================
+
+/// <summary>
+/// Capture file player driving an ILiveLinkProvider
+/// </summary>
+class FLiveLinkReplayer : public FRunnable
+{
+public:
+	/// <param name="InProvider">Provider that replayed subjects are published through</param>
+	explicit FLiveLinkReplayer(const TSharedPtr<ILiveLinkProvider>& InProvider);
+	virtual ~FLiveLinkReplayer();
+
+	/// <summary>
+	/// Map the capture file and index its chunks
+	/// </summary>
+	/// <returns>true if the file is a readable capture</returns>
+	bool Load(const FString& FilePath);
+
+	/// <summary>
+	/// Start playback from the beginning
+	/// </summary>
+	/// <param name="Speed">Playback speed multiplier (0 = start paused)</param>
+	/// <param name="bInLoop">Restart from the beginning at the end of the capture</param>
+	/// <returns>true if the worker thread was created</returns>
+	bool Start(double Speed, bool bInLoop);
+
+	/// <summary>
+	/// Stop the worker, join it and remove every replayed subject from the provider.
+	/// Safe to call multiple times.
+	/// </summary>
+	void StopAndJoin();
+
+	/// <summary>
+	/// Change playback speed (clamped to 0..ULL_REPLAY_MAX_SPEED, 0 = paused)
+	/// </summary>
+	void SetSpeed(double Speed);
+
+	/// <summary>
+	/// Jump to a capture time (clamped to the capture); applied by the worker
+	/// </summary>
+	void Seek(double Seconds);
+
+	double GetPosition() const { return Position.load(std::memory_order_relaxed); }
+	double GetDuration() const { return Duration; }
+	bool IsFinished() const { return bFinished.load(std::memory_order_relaxed); }
+
+	/// <summary>
+	/// Copy the last frame handed to the provider for a replayed subject (scrub previews, tests)
+	/// </summary>
+	/// <returns>false if no frame of the subject is live in the provider</returns>
+	bool GetSentFrame(FName SubjectName, FTransform& OutTransform, TArray<float>& OutPropertyValues) const;
+
+	//=============================================================================
+	// FRunnable
+	//=============================================================================
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	struct FChunkInfo
+	{
+		const uint8* Records = nullptr;   // First record (after the chunk header)
+		uint32 UsedBytes = 0;
+		double BaseTime = 0.0;
+	};
+
+	struct FReplaySubject
+	{
+		FName SubjectName;
+		bool bTransformRole = true;
+		TArray<FName> PropertyNames;
+		bool bAlive = false;              // Registered and not removed at the cursor
+		int32 DefinitionVersion = 0;      // Bumped by every SUBJECT record
+		int32 SentVersion = INDEX_NONE;   // Definition the provider has (INDEX_NONE = not registered)
+		uint32 KeyChunkIndex = MAX_uint32;
+		FVector KeyPosition = FVector::ZeroVector;
+		uint32 PropertyChunkIndex = MAX_uint32;  // Chunk of the last full property section
+		TArray<float> Properties;         // Current values (sparse sections apply to these)
+
+		// Latest frame while seeking (properties are the current values)
+		bool bHasScrubFrame = false;
+		FTransform ScrubTransform;
+	};
+
+	struct FSentFrame
+	{
+		FTransform Transform;             // Identity for data subjects
+		TArray<float> PropertyValues;
+	};
+
+	/// <summary>
+	/// Apply records up to capture time Target. Returns true at the end of the capture.
+	/// </summary>
+	bool PlayUntil(double Target);
+
+	/// <summary>
+	/// Restart decoding at the chunk containing Target and publish the state at Target
+	/// </summary>
+	void SeekTo(double Target);
+
+	/// <summary>
+	/// Apply one record. Frames are sent when bSend, otherwise kept as the subject's scrub frame.
+	/// </summary>
+	void ApplyRecord(const uint8* Record, uint32 ChunkIndex, bool bSend);
+
+	void ApplySubjectRecord(const uint8* Record, bool bSend);
+
+	/// <summary>
+	/// Decode a FRAME record's transform and properties, updating the subject's key position
+	/// </summary>
+	bool DecodeTransform(const uint8* Record, uint32 ChunkIndex, FReplaySubject& Subject, FTransform& OutTransform);
+
+	/// <summary>
+	/// Decode a full or sparse (ULL_CAPTURE_FLAG_SPARSE) property section into the subject's values
+	/// </summary>
+	bool DecodeProperties(const uint8* Section, int32 SectionBytes, bool bSparse, uint32 ChunkIndex, FReplaySubject& Subject);
+
+	void SendStaticData(FReplaySubject& Subject);
+	void SendFrame(const FReplaySubject& Subject, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount);
+	void SendDataFrame(const FReplaySubject& Subject, const float* PropertyValues, int32 PropertyCount);
+
+	/// <summary>
+	/// Remove one subject from the provider (and its sent frame)
+	/// </summary>
+	void RemoveSentSubject(FReplaySubject& Subject);
+
+	void StoreSentFrame(FName SubjectName, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount);
+
+	/// <summary>
+	/// Remove every subject the provider currently has from this replay
+	/// </summary>
+	void RemoveSentSubjects();
+
+	double RecordTime(const uint8* Record, const FChunkInfo& Chunk) const;
+
+	TSharedPtr<ILiveLinkProvider> Provider;
+	FString CapturePath;
+
+	IMappedFileHandle* MappedFile = nullptr;
+	IMappedFileRegion* MappedRegion = nullptr;
+
+	TArray<FChunkInfo> Chunks;
+	TArray<FReplaySubject> Subjects;      // Indexed by capture subject ID
+	double Duration = 0.0;
+	bool bLoop = false;
+
+	// Decode cursor (worker thread only)
+	int32 CursorChunk = 0;
+	uint32 CursorOffset = 0;
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	std::atomic<bool> bStopRequested{false};
+	std::atomic<bool> bFinished{false};
+	std::atomic<double> Speed{1.0};
+	std::atomic<double> PendingSeek{-1.0};       // < 0 = none
+	std::atomic<double> Position{0.0};
+	std::atomic<uint64> FramesSent{0};
+
+	// Last frame per subject in the provider, for GetSentFrame
+	mutable FCriticalSection SentFramesLock;
+	TMap<FName, FSentFrame> SentFrames;
+};
@@ -0,0 +1,339 @@
+#include "LiveLinkSender.h"
+#include "UnrealLiveLink.Native.h"
+#include "UnrealLiveLink.Types.h"
+#include "HAL/PlatformProcess.h"
+
+#pragma warning(push)
+#pragma warning(disable: 4099)
+#include "Roles/LiveLinkTransformTypes.h"
+#pragma warning(pop)
+
+//=============================================================================
+// LiveLinkSender Implementation
+//=============================================================================
+
+// Worker wait timeout when the queue is empty (covers any missed wake-up)
+static constexpr uint32 SenderIdleWaitMs = 5;
+
+FLiveLinkSender::FLiveLinkSender(int32 QueueDepth, int32 QueuePolicy, FLiveLinkStats& InStats, FLiveLinkRecorder& InRecorder, FLiveLinkLatencyProbe& InLatencyProbe)
+	: Queue(QueueDepth > 0 ? QueueDepth : ULL_DEFAULT_QUEUE_DEPTH)
+	, Policy(QueuePolicy)
+	, Stats(InStats)
+	, Recorder(InRecorder)
+	, LatencyProbe(InLatencyProbe)
+{
+	WorkEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FLiveLinkSender::~FLiveLinkSender()
+{
+	StopAndFlush();
+
+	if (WorkEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+		WorkEvent = nullptr;
+	}
+}
+
+bool FLiveLinkSender::Start()
+{
+	if (Thread)
+	{
+		return true;
+	}
+
+	bStopRequested.store(false);
+	bWorkerRunning.store(true);
+	Thread = FRunnableThread::Create(this, TEXT("UnrealLiveLinkSender"), 0, TPri_AboveNormal);
+
+	if (!Thread)
+	{
+		bWorkerRunning.store(false);
+		UE_LOG(LogUnrealLiveLinkNative, Error,
+		       TEXT("LiveLinkSender: ❌ Failed to create worker thread"));
+		return false;
+	}
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkSender: Worker started (queue depth %d, policy %s)"),
+	       Queue.GetCapacity(),
+	       Policy == ULL_QUEUE_POLICY_BLOCK ? TEXT("block") : TEXT("drop-oldest"));
+	return true;
+}
+
+void FLiveLinkSender::StopAndFlush()
+{
+	if (!Thread)
+	{
+		return;
+	}
+
+	// Worker drains the queue before exiting Run()
+	Stop();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkSender: Worker stopped (enqueued %llu, sent %llu, dropped %llu)"),
+	       GetEnqueuedCount(),
+	       GetSentCount(),
+	       GetDroppedCount());
+}
+
+void FLiveLinkSender::Stop()
+{
+	bStopRequested.store(true);
+	if (WorkEvent)
+	{
+		WorkEvent->Trigger();
+	}
+}
+
+//=============================================================================
+// Producer API
+//=============================================================================
+
+bool FLiveLinkSender::EnqueueFrame(
+	const FName& SubjectName,
+	const FTransform& Transform,
+	const float* PropertyValues,
+	int32 PropertyCount,
+	double WorldTime,
+	const TOptional<FQualifiedFrameTime>& SceneTime)
+{
+	FLiveLinkSendRecord Record;
+	Record.Kind = ELiveLinkSendRecordKind::Frame;
+	Record.SubjectName = SubjectName;
+	Record.Transform = Transform;
+	Record.WorldTime = WorldTime;
+	Record.SceneTime = SceneTime;
+	SetRecordProperties(Record, PropertyValues, PropertyCount);
+
+	return Enqueue(Record);
+}
+
+bool FLiveLinkSender::EnqueueDataFrame(
+	const FName& SubjectName,
+	const float* PropertyValues,
+	int32 PropertyCount,
+	double WorldTime)
+{
+	FLiveLinkSendRecord Record;
+	Record.Kind = ELiveLinkSendRecordKind::DataFrame;
+	Record.SubjectName = SubjectName;
+	Record.WorldTime = WorldTime;
+	SetRecordProperties(Record, PropertyValues, PropertyCount);
+
+	return Enqueue(Record);
+}
+
+void FLiveLinkSender::SetRecordProperties(FLiveLinkSendRecord& Record, const float* PropertyValues, int32 PropertyCount)
+{
+	Record.PropertyCount = PropertyCount;
+
+	if (PropertyCount > ULL_INLINE_PROPERTY_CAPACITY)
+	{
+		Record.OverflowProperties = new TArray<float>(PropertyValues, PropertyCount);
+	}
+	else if (PropertyCount > 0)
+	{
+		FMemory::Memcpy(Record.InlineProperties, PropertyValues, PropertyCount * sizeof(float));
+	}
+}
+
+void FLiveLinkSender::EnqueueStaticData(
+	const FName& SubjectName,
+	TSubclassOf<ULiveLinkRole> RoleClass,
+	FLiveLinkStaticDataStruct&& StaticData)
+{
+	FLiveLinkSendRecord Record;
+	Record.Kind = ELiveLinkSendRecordKind::StaticData;
+	Record.SubjectName = SubjectName;
+	Record.RoleClass = RoleClass;
+	Record.StaticData = new FLiveLinkStaticDataStruct(MoveTemp(StaticData));
+
+	Enqueue(Record);
+}
+
+void FLiveLinkSender::EnqueueRemove(const FName& SubjectName)
+{
+	FLiveLinkSendRecord Record;
+	Record.Kind = ELiveLinkSendRecordKind::Remove;
+	Record.SubjectName = SubjectName;
+
+	Enqueue(Record);
+}
+
+bool FLiveLinkSender::Enqueue(FLiveLinkSendRecord& Record)
+{
+	while (!Queue.TryEnqueue(Record))
+	{
+		if (Policy == ULL_QUEUE_POLICY_BLOCK && Thread && !bStopRequested.load(std::memory_order_relaxed))
+		{
+			// Wait for the worker to free a cell
+			WakeWorker();
+			FPlatformProcess::YieldThread();
+			continue;
+		}
+
+		// Drop-oldest: evict the head record to make room, if it is a frame
+		FLiveLinkSendRecord Oldest;
+		if (Queue.TryDequeueUpdate(Oldest))
+		{
+			Oldest.ReleasePayload();
+
+			const uint64 Dropped = DroppedCount.fetch_add(1, std::memory_order_relaxed) + 1;
+			if (Dropped % 1000 == 1)
+			{
+				ULL_HOT_LOG(Warning,
+				            TEXT("LiveLinkSender: Queue full, dropped oldest frame (total dropped: %llu)"),
+				            Dropped);
+			}
+			continue;
+		}
+
+		// A control record is at the head: applying it here would race the worker and could
+		// reorder it against frames of the same subject, so wait for the worker to take it
+		if (bWorkerRunning.load(std::memory_order_acquire))
+		{
+			WakeWorker();
+			FPlatformProcess::YieldThread();
+			continue;
+		}
+
+		// No worker left to drain the queue: nothing queued will be sent
+		Record.ReleasePayload();
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	EnqueuedCount.fetch_add(1, std::memory_order_relaxed);
+	WakeWorker();
+	return true;
+}
+
+void FLiveLinkSender::WakeWorker()
+{
+	if (bWorkerWaiting.load(std::memory_order_acquire) && WorkEvent)
+	{
+		WorkEvent->Trigger();
+	}
+}
+
+//=============================================================================
+// Worker Thread
+//=============================================================================
+
+uint32 FLiveLinkSender::Run()
+{
+	FLiveLinkSendRecord Record;
+
+	for (;;)
+	{
+		while (Queue.TryDequeue(Record))
+		{
+			Process(Record);
+		}
+
+		if (bStopRequested.load(std::memory_order_acquire))
+		{
+			// Final drain: producers may have enqueued between the loop and the stop check
+			while (Queue.TryDequeue(Record))
+			{
+				Process(Record);
+			}
+			bWorkerRunning.store(false, std::memory_order_release);
+			break;
+		}
+
+		// Announce we are about to sleep, then re-check to avoid a lost wake-up
+		bWorkerWaiting.store(true, std::memory_order_release);
+		if (Queue.GetApproximateCount() == 0 && !bStopRequested.load(std::memory_order_acquire))
+		{
+			WorkEvent->Wait(SenderIdleWaitMs);
+		}
+		bWorkerWaiting.store(false, std::memory_order_release);
+	}
+
+	return 0;
+}
+
+void FLiveLinkSender::Process(FLiveLinkSendRecord& Record)
+{
+	if (!Provider.IsValid())
+	{
+		Record.ReleasePayload();
+		return;
+	}
+
+	switch (Record.Kind)
+	{
+	case ELiveLinkSendRecordKind::Frame:
+	{
+		FLiveLinkFrameDataStruct FrameData(FLiveLinkTransformFrameData::StaticStruct());
+		FLiveLinkTransformFrameData* TransformFrameData = FrameData.Cast<FLiveLinkTransformFrameData>();
+		if (TransformFrameData)
+		{
+			TransformFrameData->Transform = Record.Transform;
+			TransformFrameData->WorldTime = FLiveLinkWorldTime(Record.WorldTime);
+			if (Record.SceneTime.IsSet())
+			{
+				TransformFrameData->MetaData.SceneTime = Record.SceneTime.GetValue();
+			}
+			if (Record.PropertyCount > 0)
+			{
+				TransformFrameData->PropertyValues.Append(Record.GetPropertyValues(), Record.PropertyCount);
+			}
+
+			Recorder.RecordFrame(Record.SubjectName, Record.Transform, Record.GetPropertyValues(), Record.PropertyCount, Record.WorldTime);
+			LatencyProbe.RecordSend(Record.SubjectName, Record.Transform);
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Provider->UpdateSubjectFrameData(Record.SubjectName, MoveTemp(FrameData));
+			Stats.RecordFrameData(FPlatformTime::Cycles64() - StartCycles);
+			SentCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		break;
+	}
+
+	case ELiveLinkSendRecordKind::DataFrame:
+	{
+		FLiveLinkFrameDataStruct FrameData(FLiveLinkBaseFrameData::StaticStruct());
+		FLiveLinkBaseFrameData* BaseFrameData = FrameData.Cast<FLiveLinkBaseFrameData>();
+		if (BaseFrameData)
+		{
+			BaseFrameData->WorldTime = FLiveLinkWorldTime(Record.WorldTime);
+			if (Record.PropertyCount > 0)
+			{
+				BaseFrameData->PropertyValues.Append(Record.GetPropertyValues(), Record.PropertyCount);
+			}
+
+			Recorder.RecordDataFrame(Record.SubjectName, Record.GetPropertyValues(), Record.PropertyCount, Record.WorldTime);
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Provider->UpdateSubjectFrameData(Record.SubjectName, MoveTemp(FrameData));
+			Stats.RecordFrameData(FPlatformTime::Cycles64() - StartCycles);
+			SentCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		break;
+	}
+
+	case ELiveLinkSendRecordKind::StaticData:
+		if (Record.StaticData)
+		{
+			// Recorded before the static data is moved into the provider
+			Recorder.RecordStaticData(Record.SubjectName, Record.RoleClass, *Record.StaticData);
+			Provider->UpdateSubjectStaticData(Record.SubjectName, Record.RoleClass, MoveTemp(*Record.StaticData));
+		}
+		break;
+
+	case ELiveLinkSendRecordKind::Remove:
+		Recorder.RecordRemove(Record.SubjectName);
+		Provider->RemoveSubject(Record.SubjectName);
+		break;
+	}
+
+	Record.ReleasePayload();
+}
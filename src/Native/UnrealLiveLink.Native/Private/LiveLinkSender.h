@@ -0,0 +1,135 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "LiveLinkFrameQueue.h"
+#include "LiveLinkStats.h"
+#include "LiveLinkRecorder.h"
+#include "LiveLinkLatencyProbe.h"
+#include <atomic>
+
+// LiveLink includes Message Bus Provider API
+// Disable C4099 warning: UE has inconsistent class/struct forward declarations
+#pragma warning(push)
+#pragma warning(disable: 4099)
+#include "LiveLinkProvider.h"
+#pragma warning(pop)
+
+//=============================================================================
+// LiveLink Sender (Asynchronous Send Mode)
+//=============================================================================
+// Owns the frame queue and a worker thread that drains it into the
+// ILiveLinkProvider. Selected with ULL_SEND_MODE_ASYNC at ULL_InitializeEx.
+//
+// Threading:
+// - Enqueue* may be called from any thread (FLiveLinkBridge calls them while
+//   holding its CriticalSection, which the worker never takes)
+// - Only the worker thread calls the provider. Drop-oldest only evicts frames;
+//   while a control record is at the head of a full queue the producer waits
+//   for the worker, so registration and removal are never lost or reordered
+//=============================================================================
+
+/// <summary>
+/// Queue + worker thread that moves LiveLink provider calls off the caller's thread
+/// </summary>
+class FLiveLinkSender : public FRunnable
+{
+public:
+	/// <summary>
+	/// Create the sender (thread is not started until Start())
+	/// </summary>
+	/// <param name="QueueDepth">Queue capacity in records (0 = ULL_DEFAULT_QUEUE_DEPTH)</param>
+	/// <param name="QueuePolicy">ULL_QUEUE_POLICY_DROP_OLDEST or ULL_QUEUE_POLICY_BLOCK</param>
+	/// <param name="InStats">Bridge stats; the worker records UpdateSubjectFrameData timings (must outlive the sender)</param>
+	/// <param name="InRecorder">Bridge capture writer; the worker records what it sends while a capture runs (must outlive the sender)</param>
+	/// <param name="InLatencyProbe">Bridge latency probe; the worker stamps the probe's send (must outlive the sender)</param>
+	FLiveLinkSender(int32 QueueDepth, int32 QueuePolicy, FLiveLinkStats& InStats, FLiveLinkRecorder& InRecorder, FLiveLinkLatencyProbe& InLatencyProbe);
+	virtual ~FLiveLinkSender();
+
+	/// <summary>
+	/// Start the worker thread
+	/// </summary>
+	/// <returns>true if the thread was created</returns>
+	bool Start();
+
+	/// <summary>
+	/// Stop the worker after it has drained every queued record, then join it.
+	/// Safe to call multiple times.
+	/// </summary>
+	void StopAndFlush();
+
+	/// <summary>
+	/// Provider used by the worker. Must be set before the first record is enqueued;
+	/// the queue's release/acquire ordering publishes it to the worker.
+	/// </summary>
+	void SetProvider(const TSharedPtr<ILiveLinkProvider>& InProvider) { Provider = InProvider; }
+
+	//=============================================================================
+	// Producer API
+	//=============================================================================
+
+	// Frames return false when the queue could not take them (nothing left to drain it)
+	bool EnqueueFrame(const FName& SubjectName, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, double WorldTime, const TOptional<FQualifiedFrameTime>& SceneTime = TOptional<FQualifiedFrameTime>());
+	bool EnqueueDataFrame(const FName& SubjectName, const float* PropertyValues, int32 PropertyCount, double WorldTime);
+	void EnqueueStaticData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> RoleClass, FLiveLinkStaticDataStruct&& StaticData);
+	void EnqueueRemove(const FName& SubjectName);
+
+	//=============================================================================
+	// Counters
+	//=============================================================================
+
+	uint64 GetEnqueuedCount() const { return EnqueuedCount.load(std::memory_order_relaxed); }
+	uint64 GetSentCount() const { return SentCount.load(std::memory_order_relaxed); }
+	uint64 GetDroppedCount() const { return DroppedCount.load(std::memory_order_relaxed); }
+	void ResetDroppedCount() { DroppedCount.store(0, std::memory_order_relaxed); }
+	int32 GetQueueDepth() const { return Queue.GetCapacity(); }
+
+	//=============================================================================
+	// FRunnable
+	//=============================================================================
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	/// <summary>
+	/// Insert a record, applying the configured full-queue policy
+	/// </summary>
+	/// <returns>false if the record was dropped instead</returns>
+	bool Enqueue(FLiveLinkSendRecord& Record);
+
+	/// <summary>
+	/// Copy property values into a record (inline, or an overflow array when they don't fit)
+	/// </summary>
+	static void SetRecordProperties(FLiveLinkSendRecord& Record, const float* PropertyValues, int32 PropertyCount);
+
+	/// <summary>
+	/// Apply a record to the provider and release its payload
+	/// </summary>
+	void Process(FLiveLinkSendRecord& Record);
+
+	/// <summary>
+	/// Wake the worker if it is waiting for work
+	/// </summary>
+	void WakeWorker();
+
+	FLiveLinkFrameQueue Queue;
+	int32 Policy;
+	FLiveLinkStats& Stats;
+	FLiveLinkRecorder& Recorder;
+	FLiveLinkLatencyProbe& LatencyProbe;
+
+	TSharedPtr<ILiveLinkProvider> Provider;
+	FRunnableThread* Thread = nullptr;
+	FEvent* WorkEvent = nullptr;
+
+	std::atomic<bool> bStopRequested{false};
+	std::atomic<bool> bWorkerWaiting{false};
+	std::atomic<bool> bWorkerRunning{false};    // Until Run() returns: someone still drains the queue
+
+	std::atomic<uint64> EnqueuedCount{0};
+	std::atomic<uint64> SentCount{0};
+	std::atomic<uint64> DroppedCount{0};
+};
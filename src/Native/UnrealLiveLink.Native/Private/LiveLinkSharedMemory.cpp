@@ -0,0 +1,327 @@
+#include "LiveLinkSharedMemory.h"
+#include "UnrealLiveLink.Native.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/CString.h"
+
+// A write that changes more values than this marks every property dirty: past it
+// readers are better off with one full copy than with scattered reads
+static constexpr int32 SparseMaxDirtyPercent = 50;
+
+//=============================================================================
+// LiveLinkSharedMemory Implementation
+//=============================================================================
+
+FLiveLinkSharedMemoryWriter::~FLiveLinkSharedMemoryWriter()
+{
+	Close();
+}
+
+bool FLiveLinkSharedMemoryWriter::Open(const FString& ProviderName, int32 InCapacity, int32 InMaxProperties)
+{
+	Close();
+
+	Capacity = FMath::Clamp(InCapacity, 1, ULL_SHM_MAX_CAPACITY);
+	MaxProperties = FMath::Clamp(InMaxProperties, 0, ULL_SHM_MAX_PROPERTIES);
+	MaskWords = ULL_SHM_PROPERTY_MASK_WORDS(MaxProperties);
+	RegionName = FString(ANSI_TO_TCHAR(ULL_SHM_NAME_PREFIX)) + ProviderName;
+
+	// Struct-of-arrays layout, every array on its own cache line boundary
+	const uint64 Slots64 = (uint64)Capacity;
+	const uint64 Props64 = Slots64 * (uint64)MaxProperties;
+	uint64 Offset = sizeof(ULL_SharedMemoryHeader);
+	auto Reserve = [&Offset](uint64 Bytes)
+	{
+		const uint64 Start = Align(Offset, (uint64)64);
+		Offset = Start + Bytes;
+		return Start;
+	};
+
+	ULL_SharedMemoryHeader Layout = {};
+	Layout.sequenceOffset = Reserve(Slots64 * sizeof(uint64));
+	Layout.slotOffset = Reserve(Slots64 * sizeof(ULL_SharedMemorySlot));
+	Layout.positionOffset = Reserve(Slots64 * 3 * sizeof(double));
+	Layout.rotationOffset = Reserve(Slots64 * 4 * sizeof(double));
+	Layout.scaleOffset = Reserve(Slots64 * 3 * sizeof(double));
+	Layout.worldTimeOffset = Reserve(Slots64 * sizeof(double));
+	Layout.propertyOffset = Reserve(Props64 * sizeof(float));
+	Layout.propertyNameOffset = Reserve(Props64 * ULL_SHM_PROPERTY_NAME_BYTES);
+	Layout.propertyDirtyOffset = Reserve(Slots64 * (uint64)MaskWords * sizeof(uint64));
+	Layout.totalSize = Align(Offset, (uint64)64);
+
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(
+		RegionName,
+		true,
+		FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write,
+		(SIZE_T)Layout.totalSize);
+
+	if (!Region)
+	{
+		// Also happens when a reader still holds a smaller mapping from an earlier run
+		UE_LOG(LogUnrealLiveLinkNative, Error,
+		       TEXT("LiveLinkSharedMemory: ❌ Failed to map '%s' (%llu bytes)"),
+		       *RegionName,
+		       Layout.totalSize);
+		return false;
+	}
+
+	Base = static_cast<uint8*>(Region->GetAddress());
+	Header = reinterpret_cast<ULL_SharedMemoryHeader*>(Base);
+
+	// Invalidate first so a reader attached to a reused mapping never sees a half-written table
+	Header->magic = 0;
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	FMemory::Memzero(Base + sizeof(ULL_SharedMemoryHeader), (SIZE_T)(Layout.totalSize - sizeof(ULL_SharedMemoryHeader)));
+
+	Sequences = At<std::atomic<uint64>>(Layout.sequenceOffset);
+	Slots = At<ULL_SharedMemorySlot>(Layout.slotOffset);
+	Positions = At<double>(Layout.positionOffset);
+	Rotations = At<double>(Layout.rotationOffset);
+	Scales = At<double>(Layout.scaleOffset);
+	WorldTimes = At<double>(Layout.worldTimeOffset);
+	Properties = At<float>(Layout.propertyOffset);
+	PropertyNames = At<ANSICHAR>(Layout.propertyNameOffset);
+	PropertyDirty = At<uint64>(Layout.propertyDirtyOffset);
+
+	for (int32 Slot = 0; Slot < Capacity; Slot++)
+	{
+		Slots[Slot].propertyCount = ULL_SHM_SLOT_FREE;
+	}
+
+	Layout.version = ULL_SHM_VERSION;
+	Layout.headerSize = sizeof(ULL_SharedMemoryHeader);
+	Layout.capacity = (uint32)Capacity;
+	Layout.maxProperties = (uint32)MaxProperties;
+	Layout.writerProcessId = (int32)FPlatformProcess::GetCurrentProcessId();
+	Layout.writerState = ULL_SHM_WRITER_ACTIVE;
+	Layout.sessionId = ((uint64)(uint32)Layout.writerProcessId << 32) ^ FPlatformTime::Cycles64();
+	Layout.lastWriteTime = FPlatformTime::Seconds();
+	FMemory::Memcpy(Header, &Layout, sizeof(ULL_SharedMemoryHeader));
+
+	// Magic last: readers only trust the header once it is complete
+	std::atomic_thread_fence(std::memory_order_release);
+	Header->magic = ULL_SHM_MAGIC;
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkSharedMemory: Mapped '%s' (%d subjects, %d properties each, %.1f MB)"),
+	       *RegionName,
+	       Capacity,
+	       MaxProperties,
+	       Layout.totalSize / (1024.0 * 1024.0));
+	return true;
+}
+
+void FLiveLinkSharedMemoryWriter::Close()
+{
+	if (!Region)
+	{
+		return;
+	}
+
+	// Readers remove every subject once they see the closed state
+	Header->writerState = ULL_SHM_WRITER_CLOSED;
+	std::atomic_thread_fence(std::memory_order_release);
+	Header->frameCounter++;
+
+	FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+	Region = nullptr;
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkSharedMemory: Unmapped '%s'"),
+	       *RegionName);
+
+	Base = nullptr;
+	Header = nullptr;
+	Sequences = nullptr;
+	Slots = nullptr;
+	Positions = nullptr;
+	Rotations = nullptr;
+	Scales = nullptr;
+	WorldTimes = nullptr;
+	Properties = nullptr;
+	PropertyNames = nullptr;
+	PropertyDirty = nullptr;
+}
+
+bool FLiveLinkSharedMemoryWriter::RegisterSlot(int32 Slot, const FName& SubjectName, const TArray<FName>& InPropertyNames)
+{
+	if (!Region || Slot < 0)
+	{
+		return false;
+	}
+
+	if (Slot >= Capacity)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning,
+		       TEXT("LiveLinkSharedMemory: '%s' not mirrored (slot %d beyond capacity %d)"),
+		       *SubjectName.ToString(),
+		       Slot,
+		       Capacity);
+		return false;
+	}
+
+	// Names are checked before anything is written, so a rejected subject leaves the slot free
+	const FString SubjectNameString = SubjectName.ToString();
+	const FTCHARToUTF8 SubjectNameUtf8(*SubjectNameString);
+	bool bFits = SubjectNameUtf8.Length() < ULL_SHM_SUBJECT_NAME_BYTES && InPropertyNames.Num() <= MaxProperties;
+
+	TArray<FString> PropertyNameStrings;
+	PropertyNameStrings.Reserve(InPropertyNames.Num());
+	for (const FName& PropertyName : InPropertyNames)
+	{
+		PropertyNameStrings.Add(PropertyName.ToString());
+		bFits = bFits && FTCHARToUTF8(*PropertyNameStrings.Last()).Length() < ULL_SHM_PROPERTY_NAME_BYTES;
+	}
+
+	if (!bFits)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Warning,
+		       TEXT("LiveLinkSharedMemory: '%s' not mirrored (name longer than %d bytes or more than %d properties)"),
+		       *SubjectNameString,
+		       ULL_SHM_SUBJECT_NAME_BYTES - 1,
+		       MaxProperties);
+		ReleaseSlot(Slot);
+		return false;
+	}
+
+	BeginSlotWrite(Slot);
+
+	ULL_SharedMemorySlot& Info = Slots[Slot];
+	Info.staticSerial++;
+	Info.propertyCount = InPropertyNames.Num();
+	FMemory::Memzero(Info.name, sizeof(Info.name));
+	FMemory::Memcpy(Info.name, SubjectNameUtf8.Get(), SubjectNameUtf8.Length());
+
+	ANSICHAR* SlotPropertyNames = PropertyNames + (uint64)Slot * MaxProperties * ULL_SHM_PROPERTY_NAME_BYTES;
+	FMemory::Memzero(SlotPropertyNames, (SIZE_T)MaxProperties * ULL_SHM_PROPERTY_NAME_BYTES);
+	for (int32 i = 0; i < PropertyNameStrings.Num(); i++)
+	{
+		const FTCHARToUTF8 PropertyNameUtf8(*PropertyNameStrings[i]);
+		FMemory::Memcpy(SlotPropertyNames + i * ULL_SHM_PROPERTY_NAME_BYTES, PropertyNameUtf8.Get(), PropertyNameUtf8.Length());
+	}
+
+	// New subjects start from zero values; readers copy every property on a static change
+	FMemory::Memzero(Properties + (uint64)Slot * MaxProperties, (SIZE_T)MaxProperties * sizeof(float));
+	FMemory::Memset(PropertyDirty + (uint64)Slot * MaskWords, 0xFF, (SIZE_T)MaskWords * sizeof(uint64));
+
+	// No frame until the first WriteFrame
+	WorldTimes[Slot] = 0.0;
+
+	if ((uint32)Slot >= Header->slotHighWater)
+	{
+		Header->slotHighWater = (uint32)Slot + 1;
+	}
+
+	EndSlotWrite(Slot, FPlatformTime::Seconds());
+	return true;
+}
+
+void FLiveLinkSharedMemoryWriter::ReleaseSlot(int32 Slot)
+{
+	if (!Region || Slot < 0 || Slot >= Capacity || Slots[Slot].propertyCount == ULL_SHM_SLOT_FREE)
+	{
+		return;
+	}
+
+	BeginSlotWrite(Slot);
+	Slots[Slot].staticSerial++;
+	Slots[Slot].propertyCount = ULL_SHM_SLOT_FREE;
+	WorldTimes[Slot] = 0.0;
+	EndSlotWrite(Slot, FPlatformTime::Seconds());
+}
+
+bool FLiveLinkSharedMemoryWriter::WriteFrame(int32 Slot, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, double WorldTime)
+{
+	if (!Region || Slot < 0 || Slot >= Capacity || Slots[Slot].propertyCount != PropertyCount)
+	{
+		// Also rejects free slots (ULL_SHM_SLOT_FREE never equals a valid count)
+		return false;
+	}
+
+	BeginSlotWrite(Slot);
+
+	const FVector Location = Transform.GetLocation();
+	const FQuat Rotation = Transform.GetRotation();
+	const FVector Scale = Transform.GetScale3D();
+
+	double* Position = Positions + (uint64)Slot * 3;
+	Position[0] = Location.X;
+	Position[1] = Location.Y;
+	Position[2] = Location.Z;
+
+	double* Quaternion = Rotations + (uint64)Slot * 4;
+	Quaternion[0] = Rotation.X;
+	Quaternion[1] = Rotation.Y;
+	Quaternion[2] = Rotation.Z;
+	Quaternion[3] = Rotation.W;
+
+	double* Scale3D = Scales + (uint64)Slot * 3;
+	Scale3D[0] = Scale.X;
+	Scale3D[1] = Scale.Y;
+	Scale3D[2] = Scale.Z;
+
+	WriteProperties(Slot, PropertyValues, PropertyCount);
+
+	WorldTimes[Slot] = WorldTime;
+
+	EndSlotWrite(Slot, WorldTime);
+	return true;
+}
+
+// Bitwise comparison: lossless for NaN and signed zero
+static bool IsSameValue(float A, float B)
+{
+	uint32 BitsA;
+	uint32 BitsB;
+	FMemory::Memcpy(&BitsA, &A, sizeof(float));
+	FMemory::Memcpy(&BitsB, &B, sizeof(float));
+	return BitsA == BitsB;
+}
+
+// Note: Caller must be between BeginSlotWrite and EndSlotWrite
+void FLiveLinkSharedMemoryWriter::WriteProperties(int32 Slot, const float* PropertyValues, int32 PropertyCount)
+{
+	if (PropertyCount <= 0)
+	{
+		return;
+	}
+
+	// Unchanged values are not rewritten, so a slowly changing KPI subject dirties
+	// only the cache lines of the values that moved
+	float* SlotProperties = Properties + (uint64)Slot * MaxProperties;
+	uint64* SlotDirty = PropertyDirty + (uint64)Slot * MaskWords;
+	FMemory::Memzero(SlotDirty, (SIZE_T)MaskWords * sizeof(uint64));
+
+	int32 ChangedCount = 0;
+	for (int32 Index = 0; Index < PropertyCount; Index++)
+	{
+		if (!IsSameValue(SlotProperties[Index], PropertyValues[Index]))
+		{
+			SlotProperties[Index] = PropertyValues[Index];
+			SlotDirty[Index / 64] |= 1ull << (Index % 64);
+			ChangedCount++;
+		}
+	}
+
+	if (ChangedCount * 100 > PropertyCount * SparseMaxDirtyPercent)
+	{
+		FMemory::Memset(SlotDirty, 0xFF, (SIZE_T)MaskWords * sizeof(uint64));
+	}
+}
+
+void FLiveLinkSharedMemoryWriter::BeginSlotWrite(int32 Slot)
+{
+	// Odd sequence: readers discard anything they copy until it is even again
+	const uint64 Sequence = Sequences[Slot].load(std::memory_order_relaxed);
+	Sequences[Slot].store(Sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+void FLiveLinkSharedMemoryWriter::EndSlotWrite(int32 Slot, double WriteTime)
+{
+	const uint64 Sequence = Sequences[Slot].load(std::memory_order_relaxed);
+	Sequences[Slot].store(Sequence + 1, std::memory_order_release);
+
+	Header->lastWriteTime = WriteTime;
+	std::atomic_thread_fence(std::memory_order_release);
+	Header->frameCounter++;
+}
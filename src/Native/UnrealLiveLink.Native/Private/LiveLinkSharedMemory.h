@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformMemory.h"
+#include "Math/Transform.h"
+#include "UnrealLiveLink.SharedMemory.h"
+#include <atomic>
+
+//=============================================================================
+// LiveLink Shared Memory Writer
+//=============================================================================
+// Writer side of ULL_TRANSPORT_SHARED_MEMORY: transform subjects are written
+// into a named mapping (layout in UnrealLiveLink.SharedMemory.h) that the
+// SimioLiveLinkSharedMemory plugin reads inside the Unreal process, bypassing
+// ILiveLinkProvider, UdpMessaging serialization and the multicast loopback.
+//
+// Threading: single writer. Every method is called by FLiveLinkBridge with
+// its CriticalSection held; readers in other processes only ever read.
+//=============================================================================
+
+/// <summary>
+/// Owns the shared-memory mapping and writes subject slots with a per-slot seqlock
+/// </summary>
+class FLiveLinkSharedMemoryWriter
+{
+public:
+	FLiveLinkSharedMemoryWriter() = default;
+	~FLiveLinkSharedMemoryWriter();
+
+	/// <summary>
+	/// Create (or reuse) the mapping for a provider and write a fresh header
+	/// </summary>
+	/// <param name="ProviderName">Provider name; the mapping is ULL_SHM_NAME_PREFIX + ProviderName</param>
+	/// <param name="InCapacity">Subject slots (clamped to 1..ULL_SHM_MAX_CAPACITY)</param>
+	/// <param name="InMaxProperties">Property values per slot (clamped to 0..ULL_SHM_MAX_PROPERTIES)</param>
+	/// <returns>true if the mapping is ready</returns>
+	bool Open(const FString& ProviderName, int32 InCapacity, int32 InMaxProperties);
+
+	/// <summary>
+	/// Mark the writer closed (readers remove their subjects) and unmap. Safe to call multiple times.
+	/// </summary>
+	void Close();
+
+	bool IsOpen() const { return Region != nullptr; }
+	int32 GetCapacity() const { return Capacity; }
+	int32 GetMaxProperties() const { return MaxProperties; }
+	const FString& GetRegionName() const { return RegionName; }
+
+	/// <summary>
+	/// Publish a slot's subject and property names. The slot has no frame until WriteFrame.
+	/// </summary>
+	/// <returns>false if the slot is beyond capacity or a name/count does not fit (slot stays free)</returns>
+	bool RegisterSlot(int32 Slot, const FName& SubjectName, const TArray<FName>& PropertyNames);
+
+	/// <summary>
+	/// Mark a slot free (readers remove the subject)
+	/// </summary>
+	void ReleaseSlot(int32 Slot);
+
+	/// <summary>
+	/// Overwrite a registered slot's latest frame. Only properties that changed are
+	/// stored, and the slot's propertyDirty mask records which ones.
+	/// </summary>
+	/// <returns>false if the slot is not registered in shared memory or PropertyCount does not match</returns>
+	bool WriteFrame(int32 Slot, const FTransform& Transform, const float* PropertyValues, int32 PropertyCount, double WorldTime);
+
+	FLiveLinkSharedMemoryWriter(const FLiveLinkSharedMemoryWriter&) = delete;
+	FLiveLinkSharedMemoryWriter& operator=(const FLiveLinkSharedMemoryWriter&) = delete;
+
+private:
+	void BeginSlotWrite(int32 Slot);
+	void EndSlotWrite(int32 Slot, double WriteTime);
+	void WriteProperties(int32 Slot, const float* PropertyValues, int32 PropertyCount);
+
+	template<typename T>
+	T* At(uint64 Offset) const { return reinterpret_cast<T*>(Base + Offset); }
+
+	FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+	FString RegionName;
+	int32 Capacity = 0;
+	int32 MaxProperties = 0;
+	int32 MaskWords = 0;
+
+	// Views into the mapping
+	uint8* Base = nullptr;
+	ULL_SharedMemoryHeader* Header = nullptr;
+	std::atomic<uint64>* Sequences = nullptr;
+	ULL_SharedMemorySlot* Slots = nullptr;
+	double* Positions = nullptr;
+	double* Rotations = nullptr;
+	double* Scales = nullptr;
+	double* WorldTimes = nullptr;
+	float* Properties = nullptr;
+	ANSICHAR* PropertyNames = nullptr;
+	uint64* PropertyDirty = nullptr;
+};
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UnrealLiveLink.Types.h"
+#include <atomic>
+
+//=============================================================================
+// LiveLink Stats
+//=============================================================================
+// Always-on hot-path counters behind ULL_GetStats / ULL_ResetStats.
+//
+// Cost: relaxed atomic increments only. Timings use FPlatformTime::Cycles64
+// (converted to milliseconds when read). Lock wait is only timed when TryLock
+// fails, so an uncontended lock costs one extra increment.
+//
+// Update accounting (per subject, not per call):
+//   received = sent + dropped + deadband suppressed + coalesced (+ still pending)
+//=============================================================================
+
+/// <summary>
+/// Atomic counters and the UpdateSubjectFrameData latency histogram
+/// </summary>
+struct FLiveLinkStats
+{
+	std::atomic<uint64> TransformUpdatesReceived{0};
+	std::atomic<uint64> TransformUpdatesSent{0};
+	std::atomic<uint64> TransformUpdatesDropped{0};
+	std::atomic<uint64> DataUpdatesReceived{0};
+	std::atomic<uint64> DataUpdatesSent{0};
+	std::atomic<uint64> DataUpdatesDropped{0};
+	std::atomic<uint64> BatchCalls{0};
+
+	std::atomic<uint64> LockAcquisitions{0};
+	std::atomic<uint64> LockContentions{0};
+	std::atomic<uint64> LockWaitCycles{0};
+	std::atomic<uint64> LockWaitMaxCycles{0};
+
+	std::atomic<uint64> FrameDataCalls{0};
+	std::atomic<uint64> FrameDataCycles{0};
+	std::atomic<uint64> FrameDataMaxCycles{0};
+	std::atomic<uint64> FrameDataHistogram[ULL_STATS_HISTOGRAM_BUCKETS] = {};
+
+	/// <summary>
+	/// Relaxed increment (counters are independent; readers tolerate tearing between them)
+	/// </summary>
+	static void Add(std::atomic<uint64>& Counter, uint64 Amount = 1)
+	{
+		Counter.fetch_add(Amount, std::memory_order_relaxed);
+	}
+
+	/// <summary>
+	/// Record one ILiveLinkProvider::UpdateSubjectFrameData call (any thread)
+	/// </summary>
+	void RecordFrameData(uint64 Cycles)
+	{
+		FrameDataCalls.fetch_add(1, std::memory_order_relaxed);
+		FrameDataCycles.fetch_add(Cycles, std::memory_order_relaxed);
+		UpdateMax(FrameDataMaxCycles, Cycles);
+
+		// Bucket 0: < 1 µs, bucket i: [2^(i-1), 2^i) µs, last bucket open-ended
+		const uint64 Micros = (uint64)(FPlatformTime::ToSeconds64(Cycles) * 1000000.0);
+		const int32 Bucket = Micros == 0
+			? 0
+			: FMath::Min(1 + (int32)FMath::FloorLog2_64(Micros), ULL_STATS_HISTOGRAM_BUCKETS - 1);
+		FrameDataHistogram[Bucket].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/// <summary>
+	/// Record one contended lock acquisition
+	/// </summary>
+	void RecordLockWait(uint64 Cycles)
+	{
+		LockContentions.fetch_add(1, std::memory_order_relaxed);
+		LockWaitCycles.fetch_add(Cycles, std::memory_order_relaxed);
+		UpdateMax(LockWaitMaxCycles, Cycles);
+	}
+
+	/// <summary>
+	/// Copy the counters owned here into OutStats (other fields are left untouched)
+	/// </summary>
+	void Fill(ULL_Stats& OutStats) const
+	{
+		OutStats.transformUpdatesReceived = TransformUpdatesReceived.load(std::memory_order_relaxed);
+		OutStats.transformUpdatesSent = TransformUpdatesSent.load(std::memory_order_relaxed);
+		OutStats.transformUpdatesDropped = TransformUpdatesDropped.load(std::memory_order_relaxed);
+		OutStats.dataUpdatesReceived = DataUpdatesReceived.load(std::memory_order_relaxed);
+		OutStats.dataUpdatesSent = DataUpdatesSent.load(std::memory_order_relaxed);
+		OutStats.dataUpdatesDropped = DataUpdatesDropped.load(std::memory_order_relaxed);
+		OutStats.batchCalls = BatchCalls.load(std::memory_order_relaxed);
+
+		OutStats.lockAcquisitions = LockAcquisitions.load(std::memory_order_relaxed);
+		OutStats.lockContentions = LockContentions.load(std::memory_order_relaxed);
+		OutStats.lockWaitTotalMs = FPlatformTime::ToMilliseconds64(LockWaitCycles.load(std::memory_order_relaxed));
+		OutStats.lockWaitMaxMs = FPlatformTime::ToMilliseconds64(LockWaitMaxCycles.load(std::memory_order_relaxed));
+
+		OutStats.frameDataCalls = FrameDataCalls.load(std::memory_order_relaxed);
+		OutStats.frameDataTotalMs = FPlatformTime::ToMilliseconds64(FrameDataCycles.load(std::memory_order_relaxed));
+		OutStats.frameDataMaxMs = FPlatformTime::ToMilliseconds64(FrameDataMaxCycles.load(std::memory_order_relaxed));
+		for (int32 i = 0; i < ULL_STATS_HISTOGRAM_BUCKETS; i++)
+		{
+			OutStats.frameDataHistogram[i] = FrameDataHistogram[i].load(std::memory_order_relaxed);
+		}
+	}
+
+	/// <summary>
+	/// Zero every counter (concurrent increments may land on either side of the reset)
+	/// </summary>
+	void Reset()
+	{
+		for (std::atomic<uint64>* Counter : {
+			&TransformUpdatesReceived, &TransformUpdatesSent, &TransformUpdatesDropped,
+			&DataUpdatesReceived, &DataUpdatesSent, &DataUpdatesDropped, &BatchCalls,
+			&LockAcquisitions, &LockContentions, &LockWaitCycles, &LockWaitMaxCycles,
+			&FrameDataCalls, &FrameDataCycles, &FrameDataMaxCycles })
+		{
+			Counter->store(0, std::memory_order_relaxed);
+		}
+		for (std::atomic<uint64>& Bucket : FrameDataHistogram)
+		{
+			Bucket.store(0, std::memory_order_relaxed);
+		}
+	}
+
+private:
+	static void UpdateMax(std::atomic<uint64>& Max, uint64 Value)
+	{
+		uint64 Current = Max.load(std::memory_order_relaxed);
+		while (Value > Current && !Max.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+};
+
+/// <summary>
+/// FScopeLock replacement for hot paths: counts acquisitions and times contended waits
+/// </summary>
+class FLiveLinkTimedScopeLock
+{
+public:
+	FLiveLinkTimedScopeLock(FCriticalSection& InCriticalSection, FLiveLinkStats& Stats)
+		: CriticalSection(InCriticalSection)
+	{
+		Stats.LockAcquisitions.fetch_add(1, std::memory_order_relaxed);
+		if (!CriticalSection.TryLock())
+		{
+			const uint64 WaitStart = FPlatformTime::Cycles64();
+			CriticalSection.Lock();
+			Stats.RecordLockWait(FPlatformTime::Cycles64() - WaitStart);
+		}
+	}
+
+	~FLiveLinkTimedScopeLock()
+	{
+		CriticalSection.Unlock();
+	}
+
+	FLiveLinkTimedScopeLock(const FLiveLinkTimedScopeLock&) = delete;
+	FLiveLinkTimedScopeLock& operator=(const FLiveLinkTimedScopeLock&) = delete;
+
+private:
+	FCriticalSection& CriticalSection;
+};
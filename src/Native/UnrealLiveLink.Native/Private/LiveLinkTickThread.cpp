@@ -0,0 +1,131 @@
+#include "LiveLinkTickThread.h"
+#include "UnrealLiveLink.Native.h"
+#include "HAL/PlatformProcess.h"
+
+//=============================================================================
+// LiveLinkTickThread Implementation
+//=============================================================================
+
+FLiveLinkTickThread::FLiveLinkTickThread(const TCHAR* InThreadName, int32 InRateHz, TFunction<void(double)> InTickFunction)
+	: ThreadName(InThreadName)
+	, RateHz(FMath::Clamp(InRateHz, 1, 1000))
+	, TickFunction(MoveTemp(InTickFunction))
+{
+	IntervalSeconds = 1.0 / (double)RateHz;
+	StopEvent = FPlatformProcess::GetSynchEventFromPool(true);
+}
+
+FLiveLinkTickThread::~FLiveLinkTickThread()
+{
+	StopAndJoin();
+
+	if (StopEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(StopEvent);
+		StopEvent = nullptr;
+	}
+}
+
+bool FLiveLinkTickThread::Start()
+{
+	if (Thread)
+	{
+		return true;
+	}
+
+	bStopRequested.store(false);
+	StopEvent->Reset();
+	Thread = FRunnableThread::Create(this, ThreadName, 0, TPri_AboveNormal);
+
+	if (!Thread)
+	{
+		UE_LOG(LogUnrealLiveLinkNative, Error,
+		       TEXT("LiveLinkTickThread: ❌ Failed to create thread '%s'"),
+		       ThreadName);
+		return false;
+	}
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkTickThread: '%s' started at %d Hz"),
+	       ThreadName,
+	       RateHz);
+	return true;
+}
+
+void FLiveLinkTickThread::StopAndJoin()
+{
+	if (!Thread)
+	{
+		return;
+	}
+
+	Stop();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+
+	UE_LOG(LogUnrealLiveLinkNative, Log,
+	       TEXT("LiveLinkTickThread: '%s' stopped (%llu ticks, avg %.3f ms, max %.3f ms, %llu overruns)"),
+	       ThreadName,
+	       GetTickCount(),
+	       GetAverageTickSeconds() * 1000.0,
+	       GetMaxTickSeconds() * 1000.0,
+	       GetOverrunCount());
+}
+
+double FLiveLinkTickThread::GetAverageTickSeconds() const
+{
+	const uint64 Ticks = GetTickCount();
+	return Ticks > 0 ? TotalTickSeconds.load(std::memory_order_relaxed) / (double)Ticks : 0.0;
+}
+
+void FLiveLinkTickThread::Stop()
+{
+	bStopRequested.store(true);
+	if (StopEvent)
+	{
+		StopEvent->Trigger();
+	}
+}
+
+uint32 FLiveLinkTickThread::Run()
+{
+	double LastTickStart = FPlatformTime::Seconds();
+	double NextTickTime = LastTickStart + IntervalSeconds;
+
+	while (!bStopRequested.load(std::memory_order_acquire))
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now < NextTickTime)
+		{
+			// Sleep until the next tick; StopEvent wakes us early on shutdown
+			const uint32 WaitMs = (uint32)FMath::Max(1.0, (NextTickTime - Now) * 1000.0);
+			StopEvent->Wait(WaitMs);
+			continue;
+		}
+
+		TickFunction(Now - LastTickStart);
+		LastTickStart = Now;
+
+		// Statistics: single writer, so plain load/store is enough
+		const double AfterTick = FPlatformTime::Seconds();
+		const double TickSeconds = AfterTick - Now;
+		TickCount.fetch_add(1, std::memory_order_relaxed);
+		LastTickSeconds.store(TickSeconds, std::memory_order_relaxed);
+		TotalTickSeconds.store(TotalTickSeconds.load(std::memory_order_relaxed) + TickSeconds, std::memory_order_relaxed);
+		if (TickSeconds > MaxTickSeconds.load(std::memory_order_relaxed))
+		{
+			MaxTickSeconds.store(TickSeconds, std::memory_order_relaxed);
+		}
+
+		// Stay on the fixed grid; skip ticks we are too late for instead of bursting
+		NextTickTime += IntervalSeconds;
+		if (NextTickTime < AfterTick)
+		{
+			OverrunCount.fetch_add(1, std::memory_order_relaxed);
+			NextTickTime = AfterTick + IntervalSeconds;
+		}
+	}
+
+	return 0;
+}
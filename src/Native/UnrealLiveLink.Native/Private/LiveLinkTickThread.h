@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include <atomic>
+
+//=============================================================================
+// LiveLink Tick Thread
+//=============================================================================
+// Bridge-owned thread that calls a callback at a fixed rate. Used for the
+// coalescing publish pass (ULL_InitOptions.publishRateHz) and the Message Bus
+// pump (ULL_InitOptions.pumpRateHz).
+//
+// Scheduling: ticks are aligned to a fixed grid (StartTime + N * Interval).
+// If a tick overruns, missed ticks are skipped rather than run back-to-back
+// and counted as overruns.
+//=============================================================================
+
+/// <summary>
+/// Fixed-rate worker thread running a single callback
+/// </summary>
+class FLiveLinkTickThread : public FRunnable
+{
+public:
+	/// <summary>
+	/// Create the thread object (thread is not started until Start())
+	/// </summary>
+	/// <param name="InThreadName">Thread name shown in debuggers and profilers</param>
+	/// <param name="RateHz">Tick rate (clamped to 1..1000)</param>
+	/// <param name="InTickFunction">Called once per tick on the worker thread with seconds since the previous tick</param>
+	FLiveLinkTickThread(const TCHAR* InThreadName, int32 RateHz, TFunction<void(double)> InTickFunction);
+	virtual ~FLiveLinkTickThread();
+
+	/// <summary>
+	/// Start the worker thread
+	/// </summary>
+	/// <returns>true if the thread was created</returns>
+	bool Start();
+
+	/// <summary>
+	/// Stop the worker and join it. The callback is not called after this returns.
+	/// Safe to call multiple times. Must not be called while holding a lock the callback takes.
+	/// </summary>
+	void StopAndJoin();
+
+	int32 GetRateHz() const { return RateHz; }
+
+	//=============================================================================
+	// Tick Statistics (written by the worker, readable from any thread)
+	//=============================================================================
+
+	uint64 GetTickCount() const { return TickCount.load(std::memory_order_relaxed); }
+	uint64 GetOverrunCount() const { return OverrunCount.load(std::memory_order_relaxed); }
+	double GetLastTickSeconds() const { return LastTickSeconds.load(std::memory_order_relaxed); }
+	double GetMaxTickSeconds() const { return MaxTickSeconds.load(std::memory_order_relaxed); }
+	double GetAverageTickSeconds() const;
+
+	//=============================================================================
+	// FRunnable
+	//=============================================================================
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	const TCHAR* ThreadName;
+	int32 RateHz;
+	double IntervalSeconds;
+	TFunction<void(double)> TickFunction;
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* StopEvent = nullptr;
+	std::atomic<bool> bStopRequested{false};
+
+	std::atomic<uint64> TickCount{0};
+	std::atomic<uint64> OverrunCount{0};      // Ticks that took longer than the interval (later ticks skipped)
+	std::atomic<double> LastTickSeconds{0.0};
+	std::atomic<double> MaxTickSeconds{0.0};
+	std::atomic<double> TotalTickSeconds{0.0};
+};
@@ -1,13 +1,15 @@
 #include "UnrealLiveLink.API.h"
 #include "UnrealLiveLink.Native.h"
 #include "LiveLinkBridge.h"
+#include "CoordinateHelpers.h"
 #include "Math/Transform.h"
 #include "Misc/CString.h"
 
 //=============================================================================
 // C API Implementation with LiveLinkBridge
 //=============================================================================
-// This file implements all 12 C API functions using the LiveLinkBridge singleton.
+// This file implements the C API functions using the default LiveLinkBridge
+// session (ULL_Session* functions resolve theirs with FLiveLinkBridge::FindSession).
 // Functions perform parameter validation and delegate to FLiveLinkBridge.
 //
 // Implementation Status by Sub-Phase:
@@ -22,45 +24,10 @@
 // Helper Functions
 //=============================================================================
 
-/// <summary>
-/// Convert ULL_Transform to Unreal's FTransform
-/// </summary>
-static FTransform ConvertToFTransform(const ULL_Transform* transform)
-{
-    if (!transform)
-    {
-        return FTransform::Identity;
-    }
-    
-    // Position: centimeters (ULL_Transform uses cm, FVector uses cm)
-    FVector Location(
-        transform->position[0],
-        transform->position[1],
-        transform->position[2]
-    );
-    
-    // Rotation: quaternion (X, Y, Z, W)
-    FQuat Rotation(
-        transform->rotation[0],
-        transform->rotation[1],
-        transform->rotation[2],
-        transform->rotation[3]
-    );
-    
-    // Scale: uniform or non-uniform
-    FVector Scale(
-        transform->scale[0],
-        transform->scale[1],
-        transform->scale[2]
-    );
-    
-    return FTransform(Rotation, Location, Scale);
-}
-
 /// <summary>
 /// Convert array of C strings to TArray of FNames using cached names
 /// </summary>
-static TArray<FName> ConvertPropertyNames(const char** propertyNames, int propertyCount)
+static TArray<FName> ConvertPropertyNames(const char** propertyNames, int propertyCount, FLiveLinkBridge& Bridge = FLiveLinkBridge::Get())
 {
     TArray<FName> Result;
     Result.Reserve(propertyCount);
@@ -69,7 +36,7 @@ static TArray<FName> ConvertPropertyNames(const char** propertyNames, int proper
     {
         if (propertyNames[i])
         {
-            Result.Add(FLiveLinkBridge::Get().GetCachedName(propertyNames[i]));
+            Result.Add(Bridge.GetCachedName(propertyNames[i]));
         }
         else
         {
@@ -81,19 +48,17 @@ static TArray<FName> ConvertPropertyNames(const char** propertyNames, int proper
 }
 
 /// <summary>
-/// Convert array of floats to TArray
+/// Resolve a ULL_Session* session ID, logging unknown IDs
+/// The returned pointer keeps the session alive until the call returns
 /// </summary>
-static TArray<float> ConvertPropertyValues(const float* propertyValues, int propertyCount)
+static TSharedPtr<FLiveLinkBridge> FindSession(int sessionId, const TCHAR* FunctionName)
 {
-    TArray<float> Result;
-    Result.Reserve(propertyCount);
-    
-    for (int i = 0; i < propertyCount; i++)
+    TSharedPtr<FLiveLinkBridge> Session = FLiveLinkBridge::FindSession(sessionId);
+    if (!Session.IsValid())
     {
-        Result.Add(propertyValues[i]);
+        ULL_HOT_LOG(Error, TEXT("%s: unknown session %d"), FunctionName, sessionId);
     }
-    
-    return Result;
+    return Session;
 }
 
 //=============================================================================
@@ -129,6 +94,32 @@ extern "C"
         return bSuccess ? ULL_OK : ULL_ERROR;
     }
 
+    __declspec(dllexport) int ULL_InitializeEx(const char* providerName, const ULL_InitOptions* options)
+    {
+        // Parameter validation
+        if (!providerName || providerName[0] == '\0')
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_InitializeEx: providerName is NULL or empty"));
+            return ULL_ERROR;
+        }
+
+        if (options && options->structSize < (int)sizeof(int))
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, 
+                   TEXT("ULL_InitializeEx: options->structSize is invalid (%d)"), options->structSize);
+            return ULL_ERROR;
+        }
+
+        FString ProviderNameStr = UTF8_TO_TCHAR(providerName);
+        bool bSuccess = FLiveLinkBridge::Get().Initialize(ProviderNameStr, options);
+        
+        UE_LOG(LogUnrealLiveLinkNative, Log, TEXT("ULL_InitializeEx: %s (%s send mode)"), 
+               bSuccess ? TEXT("Success") : TEXT("Failed"),
+               FLiveLinkBridge::Get().IsAsyncSendMode() ? TEXT("async") : TEXT("sync"));
+        
+        return bSuccess ? ULL_OK : ULL_ERROR;
+    }
+
     __declspec(dllexport) void ULL_Shutdown()
     {
         UE_LOG(LogUnrealLiveLinkNative, Log, TEXT("ULL_Shutdown called"));
@@ -151,11 +142,16 @@ extern "C"
     {
         int status = FLiveLinkBridge::Get().GetConnectionStatus();
         
-        UE_LOG(LogUnrealLiveLinkNative, Log, TEXT("ULL_IsConnected: Status = %d"), status);
+        ULL_HOT_LOG(Log, TEXT("ULL_IsConnected: Status = %d"), status);
         
         return status;
     }
 
+    __declspec(dllexport) int ULL_GetInitState()
+    {
+        return FLiveLinkBridge::Get().GetInitState();
+    }
+
 //=============================================================================
 // Transform Subjects Implementation
 //=============================================================================
@@ -225,13 +221,13 @@ extern "C"
         // Parameter validation
         if (!subjectName)
         {
-            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_UpdateObject: subjectName is NULL"));
+            ULL_HOT_LOG(Error, TEXT("ULL_UpdateObject: subjectName is NULL"));
             return;
         }
 
         if (!transform)
         {
-            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_UpdateObject: transform is NULL"));
+            ULL_HOT_LOG(Error, TEXT("ULL_UpdateObject: transform is NULL"));
             return;
         }
 
@@ -251,33 +247,33 @@ extern "C"
         // Parameter validation
         if (!subjectName)
         {
-            UE_LOG(LogUnrealLiveLinkNative, Error, 
-                   TEXT("ULL_UpdateObjectWithProperties: subjectName is NULL"));
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectWithProperties: subjectName is NULL"));
             return;
         }
 
         if (!transform)
         {
-            UE_LOG(LogUnrealLiveLinkNative, Error, 
-                   TEXT("ULL_UpdateObjectWithProperties: transform is NULL"));
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectWithProperties: transform is NULL"));
             return;
         }
 
         if (propertyCount > 0 && !propertyValues)
         {
-            UE_LOG(LogUnrealLiveLinkNative, Error, 
-                   TEXT("ULL_UpdateObjectWithProperties: propertyValues is NULL but propertyCount is %d"),
-                   propertyCount);
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectWithProperties: propertyValues is NULL but propertyCount is %d"),
+                        propertyCount);
             return;
         }
 
         // Convert parameters and delegate to LiveLinkBridge
         FName SubjectFName = FLiveLinkBridge::Get().GetCachedName(subjectName);
         FTransform UnrealTransform = ConvertToFTransform(transform);
-        TArray<float> PropertiesArray = ConvertPropertyValues(propertyValues, propertyCount);
         
+        // Caller's buffer goes straight to the bridge (no intermediate TArray)
         FLiveLinkBridge::Get().UpdateTransformSubjectWithProperties(
-            SubjectFName, UnrealTransform, PropertiesArray);
+            SubjectFName, UnrealTransform, propertyValues, propertyCount);
     }
 
     __declspec(dllexport) void ULL_RemoveObject(const char* subjectName)
@@ -285,12 +281,11 @@ extern "C"
         // Parameter validation
         if (!subjectName)
         {
-            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_RemoveObject: subjectName is NULL"));
+            ULL_HOT_LOG(Error, TEXT("ULL_RemoveObject: subjectName is NULL"));
             return;
         }
 
-        FString SubjectNameStr = UTF8_TO_TCHAR(subjectName);
-        UE_LOG(LogUnrealLiveLinkNative, Log, TEXT("ULL_RemoveObject: '%s'"), *SubjectNameStr);
+        ULL_HOT_LOG(Log, TEXT("ULL_RemoveObject: '%s'"), UTF8_TO_TCHAR(subjectName));
 
         // Convert to FName and delegate to LiveLinkBridge
         FName SubjectFName = FLiveLinkBridge::Get().GetCachedName(subjectName);
@@ -298,103 +293,1082 @@ extern "C"
     }
 
 //=============================================================================
-// Data Subjects Implementation
+// Batch Updates Implementation
 //=============================================================================
 
-    __declspec(dllexport) void ULL_RegisterDataSubject(
-        const char* subjectName,
-        const char** propertyNames,
-        int propertyCount)
+    __declspec(dllexport) void ULL_UpdateObjectsBatch(
+        const char** subjectNames,
+        const ULL_Transform* transforms,
+        int count)
     {
         // Parameter validation
-        if (!subjectName)
+        if (count < 0)
         {
-            UE_LOG(LogUnrealLiveLinkNative, Error, 
-                   TEXT("ULL_RegisterDataSubject: subjectName is NULL"));
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatch: count is negative (%d)"), count);
             return;
         }
 
-        if (propertyCount > 0 && !propertyNames)
+        if (count == 0)
         {
-            UE_LOG(LogUnrealLiveLinkNative, Error, 
-                   TEXT("ULL_RegisterDataSubject: propertyNames is NULL but propertyCount is %d"),
-                   propertyCount);
             return;
         }
 
-        if (propertyCount < 0)
+        if (!subjectNames || !transforms)
         {
-            UE_LOG(LogUnrealLiveLinkNative, Error, 
-                   TEXT("ULL_RegisterDataSubject: propertyCount is negative (%d)"),
-                   propertyCount);
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatch: subjectNames or transforms is NULL (count %d)"), count);
             return;
         }
 
-        FString SubjectNameStr = UTF8_TO_TCHAR(subjectName);
-        UE_LOG(LogUnrealLiveLinkNative, Log, 
-               TEXT("ULL_RegisterDataSubject: '%s' with %d properties"),
-               *SubjectNameStr, propertyCount);
+        // Convert names (NULL entries become NAME_None and are skipped by the bridge)
+        TArray<FName> SubjectFNames = ConvertPropertyNames(subjectNames, count);
+        
+        FLiveLinkBridge::Get().UpdateTransformSubjectsBatch(SubjectFNames, transforms);
+    }
 
-        // Convert parameters and delegate to LiveLinkBridge
-        FName SubjectFName = FLiveLinkBridge::Get().GetCachedName(subjectName);
-        TArray<FName> PropNamesArray = ConvertPropertyNames(propertyNames, propertyCount);
+    __declspec(dllexport) void ULL_UpdateObjectsBatchWithProperties(
+        const char** subjectNames,
+        const ULL_Transform* transforms,
+        const float* propertyValues,
+        int propertyCount,
+        int count)
+    {
+        // Parameter validation
+        if (count < 0 || propertyCount < 0)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatchWithProperties: negative count (count %d, propertyCount %d)"),
+                        count, propertyCount);
+            return;
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (!subjectNames || !transforms)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatchWithProperties: subjectNames or transforms is NULL (count %d)"), count);
+            return;
+        }
+
+        if (propertyCount > 0 && !propertyValues)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatchWithProperties: propertyValues is NULL but propertyCount is %d"),
+                        propertyCount);
+            return;
+        }
+
+        TArray<FName> SubjectFNames = ConvertPropertyNames(subjectNames, count);
         
-        FLiveLinkBridge::Get().RegisterDataSubject(SubjectFName, PropNamesArray);
+        FLiveLinkBridge::Get().UpdateTransformSubjectsBatchWithProperties(
+            SubjectFNames, transforms, propertyValues, propertyCount);
     }
 
-    __declspec(dllexport) void ULL_UpdateDataSubject(
+//=============================================================================
+// Handle-Based Transform Subjects Implementation
+//=============================================================================
+
+    __declspec(dllexport) int ULL_RegisterObjectH(const char* subjectName)
+    {
+        // Parameter validation
+        if (!subjectName)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_RegisterObjectH: subjectName is NULL"));
+            return ULL_ERROR;
+        }
+
+        FName SubjectFName = FLiveLinkBridge::Get().GetCachedName(subjectName);
+        return FLiveLinkBridge::Get().RegisterTransformSubject(SubjectFName);
+    }
+
+    __declspec(dllexport) int ULL_RegisterObjectWithPropertiesH(
         const char* subjectName,
         const char** propertyNames,
-        const float* propertyValues,
         int propertyCount)
     {
         // Parameter validation
         if (!subjectName)
         {
             UE_LOG(LogUnrealLiveLinkNative, Error, 
-                   TEXT("ULL_UpdateDataSubject: subjectName is NULL"));
-            return;
+                   TEXT("ULL_RegisterObjectWithPropertiesH: subjectName is NULL"));
+            return ULL_ERROR;
         }
 
-        if (propertyCount > 0 && !propertyValues)
+        if (propertyCount < 0 || (propertyCount > 0 && !propertyNames))
         {
             UE_LOG(LogUnrealLiveLinkNative, Error, 
-                   TEXT("ULL_UpdateDataSubject: propertyValues is NULL but propertyCount is %d"),
+                   TEXT("ULL_RegisterObjectWithPropertiesH: invalid property array (count %d)"),
                    propertyCount);
+            return ULL_ERROR;
+        }
+
+        FName SubjectFName = FLiveLinkBridge::Get().GetCachedName(subjectName);
+        TArray<FName> PropertyFNames = ConvertPropertyNames(propertyNames, propertyCount);
+        
+        return FLiveLinkBridge::Get().RegisterTransformSubjectWithProperties(SubjectFName, PropertyFNames);
+    }
+
+    __declspec(dllexport) void ULL_UpdateObjectH(
+        int handle,
+        const ULL_Transform* transform)
+    {
+        if (!transform)
+        {
+            ULL_HOT_LOG(Error, TEXT("ULL_UpdateObjectH: transform is NULL"));
             return;
         }
 
-        if (propertyCount < 0)
+        FLiveLinkBridge::Get().UpdateTransformSubjectByHandle(handle, ConvertToFTransform(transform));
+    }
+
+    __declspec(dllexport) void ULL_UpdateObjectWithPropertiesH(
+        int handle,
+        const ULL_Transform* transform,
+        const float* propertyValues,
+        int propertyCount)
+    {
+        if (!transform)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectWithPropertiesH: transform is NULL"));
+            return;
+        }
+
+        if (propertyCount < 0 || (propertyCount > 0 && !propertyValues))
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectWithPropertiesH: invalid property array (count %d)"),
+                        propertyCount);
+            return;
+        }
+
+        FLiveLinkBridge::Get().UpdateTransformSubjectWithPropertiesByHandle(
+            handle, ConvertToFTransform(transform), propertyValues, propertyCount);
+    }
+
+    __declspec(dllexport) void ULL_UpdateObjectsBatchH(
+        const int* handles,
+        const ULL_Transform* transforms,
+        int count)
+    {
+        if (count <= 0)
+        {
+            if (count < 0)
+            {
+                ULL_HOT_LOG(Error,
+                            TEXT("ULL_UpdateObjectsBatchH: count is negative (%d)"), count);
+            }
+            return;
+        }
+
+        if (!handles || !transforms)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatchH: handles or transforms is NULL (count %d)"), count);
+            return;
+        }
+
+        FLiveLinkBridge::Get().UpdateTransformSubjectsBatchByHandle(handles, transforms, nullptr, 0, count);
+    }
+
+    __declspec(dllexport) void ULL_UpdateObjectsBatchWithPropertiesH(
+        const int* handles,
+        const ULL_Transform* transforms,
+        const float* propertyValues,
+        int propertyCount,
+        int count)
+    {
+        if (count < 0 || propertyCount < 0)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatchWithPropertiesH: negative count (count %d, propertyCount %d)"),
+                        count, propertyCount);
+            return;
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (!handles || !transforms || (propertyCount > 0 && !propertyValues))
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatchWithPropertiesH: NULL array (count %d, propertyCount %d)"),
+                        count, propertyCount);
+            return;
+        }
+
+        FLiveLinkBridge::Get().UpdateTransformSubjectsBatchByHandle(
+            handles, transforms, propertyValues, propertyCount, count);
+    }
+
+    __declspec(dllexport) void ULL_UpdateObjectAtTimeH(
+        int handle,
+        const ULL_Transform* transform,
+        const float* propertyValues,
+        int propertyCount,
+        double simTime)
+    {
+        if (!transform)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectAtTimeH: transform is NULL"));
+            return;
+        }
+
+        if (propertyCount < 0 || (propertyCount > 0 && !propertyValues))
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectAtTimeH: invalid property array (count %d)"),
+                        propertyCount);
+            return;
+        }
+
+        FLiveLinkBridge::Get().UpdateTransformSubjectWithPropertiesByHandle(
+            handle, ConvertToFTransform(transform), propertyValues, propertyCount, TOptional<double>(simTime));
+    }
+
+    __declspec(dllexport) void ULL_UpdateObjectsBatchAtTimeH(
+        const int* handles,
+        const ULL_Transform* transforms,
+        const float* propertyValues,
+        int propertyCount,
+        int count,
+        double simTime)
+    {
+        if (count < 0 || propertyCount < 0)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatchAtTimeH: negative count (count %d, propertyCount %d)"),
+                        count, propertyCount);
+            return;
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (!handles || !transforms || (propertyCount > 0 && !propertyValues))
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatchAtTimeH: NULL array (count %d, propertyCount %d)"),
+                        count, propertyCount);
+            return;
+        }
+
+        FLiveLinkBridge::Get().UpdateTransformSubjectsBatchByHandle(
+            handles, transforms, propertyValues, propertyCount, count, TOptional<double>(simTime));
+    }
+
+    __declspec(dllexport) void ULL_RemoveObjectH(int handle)
+    {
+        ULL_HOT_LOG(Log, TEXT("ULL_RemoveObjectH: %d"), handle);
+        FLiveLinkBridge::Get().RemoveTransformSubjectByHandle(handle);
+    }
+
+//=============================================================================
+// Property Schemas Implementation
+//=============================================================================
+
+    __declspec(dllexport) int ULL_RegisterPropertySchema(
+        const char** propertyNames,
+        int propertyCount)
+    {
+        if (propertyCount < 0 || (propertyCount > 0 && !propertyNames))
         {
             UE_LOG(LogUnrealLiveLinkNative, Error, 
-                   TEXT("ULL_UpdateDataSubject: propertyCount is negative (%d)"),
+                   TEXT("ULL_RegisterPropertySchema: invalid property array (count %d)"),
                    propertyCount);
-            return;
+            return ULL_ERROR;
         }
 
-        // Convert parameters and delegate to LiveLinkBridge
-        FName SubjectFName = FLiveLinkBridge::Get().GetCachedName(subjectName);
-        TArray<float> PropertiesArray = ConvertPropertyValues(propertyValues, propertyCount);
-        
-        FLiveLinkBridge::Get().UpdateDataSubject(SubjectFName, PropertiesArray);
+        return FLiveLinkBridge::Get().RegisterPropertySchema(ConvertPropertyNames(propertyNames, propertyCount));
     }
 
-    __declspec(dllexport) void ULL_RemoveDataSubject(const char* subjectName)
+    __declspec(dllexport) int ULL_RegisterObjectWithSchemaH(
+        const char* subjectName,
+        int schemaId)
     {
-        // Parameter validation
         if (!subjectName)
         {
             UE_LOG(LogUnrealLiveLinkNative, Error, 
-                   TEXT("ULL_RemoveDataSubject: subjectName is NULL"));
-            return;
+                   TEXT("ULL_RegisterObjectWithSchemaH: subjectName is NULL"));
+            return ULL_ERROR;
         }
 
-        FString SubjectNameStr = UTF8_TO_TCHAR(subjectName);
-        UE_LOG(LogUnrealLiveLinkNative, Log, TEXT("ULL_RemoveDataSubject: '%s'"), *SubjectNameStr);
+        FName SubjectFName = FLiveLinkBridge::Get().GetCachedName(subjectName);
+        return FLiveLinkBridge::Get().RegisterTransformSubjectWithSchema(SubjectFName, schemaId);
+    }
+
+    __declspec(dllexport) int ULL_RegisterObjectsBatchH(
+        const char** subjectNames,
+        const int* schemaIds,
+        int count,
+        int* outHandles)
+    {
+        if (count < 0 || (count > 0 && (!subjectNames || !outHandles)))
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, 
+                   TEXT("ULL_RegisterObjectsBatchH: invalid arrays (count %d)"),
+                   count);
+            return ULL_ERROR;
+        }
+
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        FLiveLinkBridge& Bridge = FLiveLinkBridge::Get();
+        TArray<FName> SubjectFNames;
+        SubjectFNames.Reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            // NULL names become NAME_None and are rejected per entry by the bridge
+            SubjectFNames.Add(subjectNames[i] ? Bridge.GetCachedName(subjectNames[i]) : FName());
+        }
+
+        return Bridge.RegisterTransformSubjectsBatch(SubjectFNames, schemaIds, outHandles);
+    }
+
+//=============================================================================
+// Update-Rate Tiers Implementation
+//=============================================================================
+
+    __declspec(dllexport) int ULL_SetObjectScheduleH(
+        int handle,
+        int priority,
+        int maxRateHz)
+    {
+        return FLiveLinkBridge::Get().SetTransformSubjectScheduleByHandle(handle, priority, maxRateHz);
+    }
+
+    __declspec(dllexport) int ULL_SetSubjectSchedule(
+        const char* subjectName,
+        int priority,
+        int maxRateHz)
+    {
+        if (!subjectName)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, 
+                   TEXT("ULL_SetSubjectSchedule: subjectName is NULL"));
+            return ULL_ERROR;
+        }
 
-        // Convert to FName and delegate to LiveLinkBridge
         FName SubjectFName = FLiveLinkBridge::Get().GetCachedName(subjectName);
-        FLiveLinkBridge::Get().RemoveDataSubject(SubjectFName);
+        return FLiveLinkBridge::Get().SetSubjectSchedule(SubjectFName, priority, maxRateHz);
+    }
+
+//=============================================================================
+// Simio Coordinate Batches Implementation
+//=============================================================================
+
+    /// <summary>
+    /// Shared argument check for the Simio value block exports
+    /// </summary>
+    static bool ValidateSimioValues(const TCHAR* FunctionName, const double* simioValues, int componentCount, int count)
+    {
+        if (count < 0 || (componentCount != ULL_SIMIO_POSE_COMPONENTS && componentCount != ULL_SIMIO_TRANSFORM_COMPONENTS))
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("%s: invalid block (count %d, componentCount %d)"),
+                        FunctionName, count, componentCount);
+            return false;
+        }
+
+        if (count > 0 && !simioValues)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("%s: simioValues is NULL (count %d)"),
+                        FunctionName, count);
+            return false;
+        }
+
+        return true;
+    }
+
+    __declspec(dllexport) int ULL_ConvertSimioTransforms(
+        const double* simioValues,
+        int componentCount,
+        int count,
+        ULL_Transform* outTransforms)
+    {
+        if (!ValidateSimioValues(TEXT("ULL_ConvertSimioTransforms"), simioValues, componentCount, count))
+        {
+            return ULL_ERROR;
+        }
+
+        if (count > 0 && !outTransforms)
+        {
+            ULL_HOT_LOG(Error, TEXT("ULL_ConvertSimioTransforms: outTransforms is NULL"));
+            return ULL_ERROR;
+        }
+
+        ConvertSimioTransforms(simioValues, componentCount, count, outTransforms);
+        return ULL_OK;
+    }
+
+    __declspec(dllexport) void ULL_UpdateObjectsBatchSimioH(
+        const int* handles,
+        const double* simioValues,
+        int componentCount,
+        const float* propertyValues,
+        int propertyCount,
+        int count)
+    {
+        if (!ValidateSimioValues(TEXT("ULL_UpdateObjectsBatchSimioH"), simioValues, componentCount, count))
+        {
+            return;
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (propertyCount < 0 || !handles || (propertyCount > 0 && !propertyValues))
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatchSimioH: invalid arrays (count %d, propertyCount %d)"),
+                        count, propertyCount);
+            return;
+        }
+
+        // Per-thread scratch: converted transforms go straight into the batch path
+        static thread_local TArray<ULL_Transform> Transforms;
+        Transforms.SetNumUninitialized(count, EAllowShrinking::No);
+        ConvertSimioTransforms(simioValues, componentCount, count, Transforms.GetData());
+
+        FLiveLinkBridge::Get().UpdateTransformSubjectsBatchByHandle(
+            handles, Transforms.GetData(), propertyValues, propertyCount, count);
+    }
+
+//=============================================================================
+// Compact Transforms Implementation
+//=============================================================================
+
+    __declspec(dllexport) void ULL_UpdateObjectsBatchCompactH(
+        const int* handles,
+        const ULL_CompactTransform* transforms,
+        const float* scales,
+        int scaleCount,
+        const float* propertyValues,
+        int propertyCount,
+        int count)
+    {
+        if (count < 0 || propertyCount < 0 || scaleCount < 0)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatchCompactH: negative count (count %d, scaleCount %d, propertyCount %d)"),
+                        count, scaleCount, propertyCount);
+            return;
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (!handles || !transforms || (scaleCount > 0 && !scales) || (propertyCount > 0 && !propertyValues))
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateObjectsBatchCompactH: NULL array (count %d, scaleCount %d, propertyCount %d)"),
+                        count, scaleCount, propertyCount);
+            return;
+        }
+
+        // Per-thread scratch: expanded transforms go straight into the batch path
+        static thread_local TArray<ULL_Transform> Transforms;
+        Transforms.SetNumUninitialized(count, EAllowShrinking::No);
+        if (!DecodeCompactTransforms(transforms, scales, scaleCount, count, Transforms.GetData()))
+        {
+            ULL_HOT_LOG(Warning,
+                        TEXT("ULL_UpdateObjectsBatchCompactH: more objects flagged ULL_COMPACT_HAS_SCALE than scaleCount %d (rest use unit scale)"),
+                        scaleCount);
+        }
+
+        FLiveLinkBridge::Get().UpdateTransformSubjectsBatchByHandle(
+            handles, Transforms.GetData(), propertyValues, propertyCount, count);
+    }
+
+//=============================================================================
+// Data Subjects Implementation
+//=============================================================================
+
+    __declspec(dllexport) void ULL_RegisterDataSubject(
+        const char* subjectName,
+        const char** propertyNames,
+        int propertyCount)
+    {
+        // Parameter validation
+        if (!subjectName)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, 
+                   TEXT("ULL_RegisterDataSubject: subjectName is NULL"));
+            return;
+        }
+
+        if (propertyCount > 0 && !propertyNames)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, 
+                   TEXT("ULL_RegisterDataSubject: propertyNames is NULL but propertyCount is %d"),
+                   propertyCount);
+            return;
+        }
+
+        if (propertyCount < 0)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, 
+                   TEXT("ULL_RegisterDataSubject: propertyCount is negative (%d)"),
+                   propertyCount);
+            return;
+        }
+
+        FString SubjectNameStr = UTF8_TO_TCHAR(subjectName);
+        UE_LOG(LogUnrealLiveLinkNative, Log, 
+               TEXT("ULL_RegisterDataSubject: '%s' with %d properties"),
+               *SubjectNameStr, propertyCount);
+
+        // Convert parameters and delegate to LiveLinkBridge
+        FName SubjectFName = FLiveLinkBridge::Get().GetCachedName(subjectName);
+        TArray<FName> PropNamesArray = ConvertPropertyNames(propertyNames, propertyCount);
+        
+        FLiveLinkBridge::Get().RegisterDataSubject(SubjectFName, PropNamesArray);
+    }
+
+    __declspec(dllexport) void ULL_UpdateDataSubject(
+        const char* subjectName,
+        const char** propertyNames,
+        const float* propertyValues,
+        int propertyCount)
+    {
+        // Parameter validation
+        if (!subjectName)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateDataSubject: subjectName is NULL"));
+            return;
+        }
+
+        if (propertyCount > 0 && !propertyValues)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateDataSubject: propertyValues is NULL but propertyCount is %d"),
+                        propertyCount);
+            return;
+        }
+
+        if (propertyCount < 0)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateDataSubject: propertyCount is negative (%d)"),
+                        propertyCount);
+            return;
+        }
+
+        // Convert parameters and delegate to LiveLinkBridge
+        FName SubjectFName = FLiveLinkBridge::Get().GetCachedName(subjectName);
+        
+        // Auto-register on first update when names are supplied (names are ignored afterwards)
+        if (propertyNames && !FLiveLinkBridge::Get().IsDataSubjectRegistered(SubjectFName))
+        {
+            TArray<FName> PropNamesArray = ConvertPropertyNames(propertyNames, propertyCount);
+            FLiveLinkBridge::Get().RegisterDataSubject(SubjectFName, PropNamesArray);
+        }
+        
+        FLiveLinkBridge::Get().UpdateDataSubject(SubjectFName, propertyValues, propertyCount);
+    }
+
+    __declspec(dllexport) void ULL_UpdateDataSubjectsBatch(
+        const char** subjectNames,
+        const float* propertyValues,
+        int propertyCount,
+        int count)
+    {
+        // Parameter validation
+        if (count < 0 || propertyCount < 0)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateDataSubjectsBatch: negative count (count %d, propertyCount %d)"),
+                        count, propertyCount);
+            return;
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (!subjectNames)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateDataSubjectsBatch: subjectNames is NULL (count %d)"), count);
+            return;
+        }
+
+        if (propertyCount > 0 && !propertyValues)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_UpdateDataSubjectsBatch: propertyValues is NULL but propertyCount is %d"),
+                        propertyCount);
+            return;
+        }
+
+        TArray<FName> SubjectFNames = ConvertPropertyNames(subjectNames, count);
+        
+        FLiveLinkBridge::Get().UpdateDataSubjectsBatch(SubjectFNames, propertyValues, propertyCount);
+    }
+
+    __declspec(dllexport) void ULL_RemoveDataSubject(const char* subjectName)
+    {
+        // Parameter validation
+        if (!subjectName)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_RemoveDataSubject: subjectName is NULL"));
+            return;
+        }
+
+        ULL_HOT_LOG(Log, TEXT("ULL_RemoveDataSubject: '%s'"), UTF8_TO_TCHAR(subjectName));
+
+        // Convert to FName and delegate to LiveLinkBridge
+        FName SubjectFName = FLiveLinkBridge::Get().GetCachedName(subjectName);
+        FLiveLinkBridge::Get().RemoveDataSubject(SubjectFName);
+    }
+
+//=============================================================================
+// Diagnostics Implementation
+//=============================================================================
+
+    __declspec(dllexport) int ULL_GetDeadbandCounters(
+        unsigned long long* outSentFrames,
+        unsigned long long* outSuppressedFrames,
+        unsigned long long* outKeepAliveFrames)
+    {
+        uint64 SentFrames = 0;
+        uint64 SuppressedFrames = 0;
+        uint64 KeepAliveFrames = 0;
+        int status = FLiveLinkBridge::Get().GetDeadbandCounters(SentFrames, SuppressedFrames, KeepAliveFrames);
+
+        // Outputs are optional
+        if (outSentFrames) { *outSentFrames = SentFrames; }
+        if (outSuppressedFrames) { *outSuppressedFrames = SuppressedFrames; }
+        if (outKeepAliveFrames) { *outKeepAliveFrames = KeepAliveFrames; }
+
+        return status;
+    }
+
+    __declspec(dllexport) int ULL_GetPumpStats(ULL_PumpStats* outStats)
+    {
+        // Parameter validation
+        if (!outStats)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_GetPumpStats: outStats is NULL"));
+            return ULL_ERROR;
+        }
+
+        return FLiveLinkBridge::Get().GetPumpStats(*outStats);
+    }
+
+    __declspec(dllexport) int ULL_GetStats(ULL_Stats* outStats)
+    {
+        // Parameter validation
+        if (!outStats)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_GetStats: outStats is NULL"));
+            return ULL_ERROR;
+        }
+
+        return FLiveLinkBridge::Get().GetStats(*outStats);
+    }
+
+    __declspec(dllexport) int ULL_ResetStats()
+    {
+        return FLiveLinkBridge::Get().ResetStats();
+    }
+
+    //=============================================================================
+    // Capture and Replay
+    //=============================================================================
+
+    __declspec(dllexport) int ULL_StartCapture(const char* filePath)
+    {
+        // Parameter validation
+        if (!filePath || filePath[0] == '\0')
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_StartCapture: filePath is NULL or empty"));
+            return ULL_ERROR;
+        }
+
+        return FLiveLinkBridge::Get().StartCapture(FString(UTF8_TO_TCHAR(filePath)));
+    }
+
+    __declspec(dllexport) int ULL_StopCapture()
+    {
+        return FLiveLinkBridge::Get().StopCapture();
+    }
+
+    __declspec(dllexport) int ULL_StartReplay(const char* filePath, double speed, int loop)
+    {
+        // Parameter validation
+        if (!filePath || filePath[0] == '\0')
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_StartReplay: filePath is NULL or empty"));
+            return ULL_ERROR;
+        }
+
+        return FLiveLinkBridge::Get().StartReplay(FString(UTF8_TO_TCHAR(filePath)), speed, loop != 0);
+    }
+
+    __declspec(dllexport) int ULL_SetReplaySpeed(double speed)
+    {
+        return FLiveLinkBridge::Get().SetReplaySpeed(speed);
+    }
+
+    __declspec(dllexport) int ULL_SeekReplay(double seconds)
+    {
+        return FLiveLinkBridge::Get().SeekReplay(seconds);
+    }
+
+    __declspec(dllexport) int ULL_StopReplay()
+    {
+        return FLiveLinkBridge::Get().StopReplay();
+    }
+
+    __declspec(dllexport) int ULL_GetReplayStatus(double* outPositionSeconds, double* outDurationSeconds)
+    {
+        double Position = 0.0;
+        double Duration = 0.0;
+        int status = FLiveLinkBridge::Get().GetReplayStatus(Position, Duration);
+
+        // Outputs are optional
+        if (outPositionSeconds) { *outPositionSeconds = Position; }
+        if (outDurationSeconds) { *outDurationSeconds = Duration; }
+
+        return status;
+    }
+
+    __declspec(dllexport) int ULL_GetReplayFrame(const char* subjectName, ULL_Transform* outTransform, float* outPropertyValues, int maxPropertyCount)
+    {
+        // Parameter validation
+        if (!subjectName || subjectName[0] == '\0' || !outTransform)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_GetReplayFrame: subjectName is NULL or empty, or outTransform is NULL"));
+            return ULL_ERROR;
+        }
+        if (maxPropertyCount < 0 || (maxPropertyCount > 0 && !outPropertyValues))
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_GetReplayFrame: Invalid property buffer (maxPropertyCount=%d)"), maxPropertyCount);
+            return ULL_ERROR;
+        }
+
+        FTransform Transform;
+        TArray<float> PropertyValues;
+        int status = FLiveLinkBridge::Get().GetReplayFrame(FName(UTF8_TO_TCHAR(subjectName)), Transform, PropertyValues);
+        if (status != ULL_OK)
+        {
+            return status;
+        }
+
+        ConvertFromFTransform(Transform, outTransform);
+        const int32 CopyCount = FMath::Min(PropertyValues.Num(), maxPropertyCount);
+        if (CopyCount > 0)
+        {
+            FMemory::Memcpy(outPropertyValues, PropertyValues.GetData(), CopyCount * sizeof(float));
+        }
+        return PropertyValues.Num();
+    }
+
+    //=============================================================================
+    // Sessions
+    //=============================================================================
+
+    __declspec(dllexport) int ULL_CreateSession(const char* providerName, const ULL_InitOptions* options)
+    {
+        // Parameter validation
+        if (!providerName || providerName[0] == '\0')
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_CreateSession: providerName is NULL or empty"));
+            return ULL_ERROR;
+        }
+
+        if (options && options->structSize < (int)sizeof(int))
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, 
+                   TEXT("ULL_CreateSession: options->structSize is invalid (%d)"), options->structSize);
+            return ULL_ERROR;
+        }
+
+        return FLiveLinkBridge::CreateSession(FString(UTF8_TO_TCHAR(providerName)), options);
+    }
+
+    __declspec(dllexport) int ULL_DestroySession(int sessionId)
+    {
+        return FLiveLinkBridge::DestroySession(sessionId);
+    }
+
+    __declspec(dllexport) int ULL_SessionRegisterObjectH(int sessionId, const char* subjectName)
+    {
+        // Parameter validation
+        if (!subjectName)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_SessionRegisterObjectH: subjectName is NULL"));
+            return ULL_ERROR;
+        }
+
+        TSharedPtr<FLiveLinkBridge> Session = FindSession(sessionId, TEXT("ULL_SessionRegisterObjectH"));
+        if (!Session.IsValid())
+        {
+            return ULL_ERROR;
+        }
+
+        return Session->RegisterTransformSubject(Session->GetCachedName(subjectName));
+    }
+
+    __declspec(dllexport) int ULL_SessionRegisterObjectWithPropertiesH(
+        int sessionId,
+        const char* subjectName,
+        const char** propertyNames,
+        int propertyCount)
+    {
+        // Parameter validation
+        if (!subjectName)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, 
+                   TEXT("ULL_SessionRegisterObjectWithPropertiesH: subjectName is NULL"));
+            return ULL_ERROR;
+        }
+
+        if (propertyCount < 0 || (propertyCount > 0 && !propertyNames))
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, 
+                   TEXT("ULL_SessionRegisterObjectWithPropertiesH: invalid property array (count %d)"),
+                   propertyCount);
+            return ULL_ERROR;
+        }
+
+        TSharedPtr<FLiveLinkBridge> Session = FindSession(sessionId, TEXT("ULL_SessionRegisterObjectWithPropertiesH"));
+        if (!Session.IsValid())
+        {
+            return ULL_ERROR;
+        }
+
+        return Session->RegisterTransformSubjectWithProperties(
+            Session->GetCachedName(subjectName), ConvertPropertyNames(propertyNames, propertyCount, *Session));
+    }
+
+    __declspec(dllexport) void ULL_SessionUpdateObjectsBatchWithPropertiesH(
+        int sessionId,
+        const int* handles,
+        const ULL_Transform* transforms,
+        const float* propertyValues,
+        int propertyCount,
+        int count)
+    {
+        if (count < 0 || propertyCount < 0)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_SessionUpdateObjectsBatchWithPropertiesH: negative count (count %d, propertyCount %d)"),
+                        count, propertyCount);
+            return;
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (!handles || !transforms || (propertyCount > 0 && !propertyValues))
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_SessionUpdateObjectsBatchWithPropertiesH: NULL array (count %d, propertyCount %d)"),
+                        count, propertyCount);
+            return;
+        }
+
+        TSharedPtr<FLiveLinkBridge> Session = FindSession(sessionId, TEXT("ULL_SessionUpdateObjectsBatchWithPropertiesH"));
+        if (Session.IsValid())
+        {
+            Session->UpdateTransformSubjectsBatchByHandle(handles, transforms, propertyValues, propertyCount, count);
+        }
+    }
+
+    __declspec(dllexport) void ULL_SessionRemoveObjectH(int sessionId, int handle)
+    {
+        ULL_HOT_LOG(Log, TEXT("ULL_SessionRemoveObjectH: session %d, handle %d"), sessionId, handle);
+
+        TSharedPtr<FLiveLinkBridge> Session = FindSession(sessionId, TEXT("ULL_SessionRemoveObjectH"));
+        if (Session.IsValid())
+        {
+            Session->RemoveTransformSubjectByHandle(handle);
+        }
+    }
+
+    __declspec(dllexport) void ULL_SessionUpdateDataSubject(
+        int sessionId,
+        const char* subjectName,
+        const char** propertyNames,
+        const float* propertyValues,
+        int propertyCount)
+    {
+        // Parameter validation
+        if (!subjectName)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_SessionUpdateDataSubject: subjectName is NULL"));
+            return;
+        }
+
+        if (propertyCount < 0 || (propertyCount > 0 && !propertyValues))
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_SessionUpdateDataSubject: invalid property array (count %d)"),
+                        propertyCount);
+            return;
+        }
+
+        TSharedPtr<FLiveLinkBridge> Session = FindSession(sessionId, TEXT("ULL_SessionUpdateDataSubject"));
+        if (!Session.IsValid())
+        {
+            return;
+        }
+
+        FName SubjectFName = Session->GetCachedName(subjectName);
+
+        // Auto-register on first update when names are supplied (names are ignored afterwards)
+        if (propertyNames && !Session->IsDataSubjectRegistered(SubjectFName))
+        {
+            Session->RegisterDataSubject(SubjectFName, ConvertPropertyNames(propertyNames, propertyCount, *Session));
+        }
+
+        Session->UpdateDataSubject(SubjectFName, propertyValues, propertyCount);
+    }
+
+    __declspec(dllexport) void ULL_SessionRemoveDataSubject(int sessionId, const char* subjectName)
+    {
+        // Parameter validation
+        if (!subjectName)
+        {
+            ULL_HOT_LOG(Error,
+                        TEXT("ULL_SessionRemoveDataSubject: subjectName is NULL"));
+            return;
+        }
+
+        TSharedPtr<FLiveLinkBridge> Session = FindSession(sessionId, TEXT("ULL_SessionRemoveDataSubject"));
+        if (Session.IsValid())
+        {
+            Session->RemoveDataSubject(Session->GetCachedName(subjectName));
+        }
+    }
+
+    __declspec(dllexport) int ULL_SessionGetStats(int sessionId, ULL_Stats* outStats)
+    {
+        // Parameter validation
+        if (!outStats)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_SessionGetStats: outStats is NULL"));
+            return ULL_ERROR;
+        }
+
+        TSharedPtr<FLiveLinkBridge> Session = FindSession(sessionId, TEXT("ULL_SessionGetStats"));
+        if (!Session.IsValid())
+        {
+            FMemory::Memzero(outStats, sizeof(ULL_Stats));
+            return ULL_ERROR;
+        }
+
+        return Session->GetStats(*outStats);
+    }
+
+    __declspec(dllexport) int ULL_SessionGetInitState(int sessionId)
+    {
+        TSharedPtr<FLiveLinkBridge> Session = FindSession(sessionId, TEXT("ULL_SessionGetInitState"));
+        if (!Session.IsValid())
+        {
+            return ULL_ERROR;
+        }
+
+        return Session->GetInitState();
+    }
+
+//=============================================================================
+// Interest Regions Implementation
+//=============================================================================
+
+    __declspec(dllexport) int ULL_SetInterestRegions(
+        const ULL_InterestRegion* regions,
+        int count,
+        int outsideRateHz)
+    {
+        return FLiveLinkBridge::Get().SetInterestRegions(regions, count, outsideRateHz);
+    }
+
+    __declspec(dllexport) int ULL_SessionSetInterestRegions(
+        int sessionId,
+        const ULL_InterestRegion* regions,
+        int count,
+        int outsideRateHz)
+    {
+        TSharedPtr<FLiveLinkBridge> Session = FindSession(sessionId, TEXT("ULL_SessionSetInterestRegions"));
+        if (!Session.IsValid())
+        {
+            return ULL_ERROR;
+        }
+
+        return Session->SetInterestRegions(regions, count, outsideRateHz);
+    }
+
+    __declspec(dllexport) int ULL_GetInterestCounters(
+        unsigned long long* outHeldFrames,
+        unsigned long long* outOutsideFrames,
+        int* outGridCells)
+    {
+        uint64 HeldFrames = 0;
+        uint64 OutsideFrames = 0;
+        int32 GridCells = 0;
+        int status = FLiveLinkBridge::Get().GetInterestCounters(HeldFrames, OutsideFrames, GridCells);
+
+        // Outputs are optional
+        if (outHeldFrames) { *outHeldFrames = HeldFrames; }
+        if (outOutsideFrames) { *outOutsideFrames = OutsideFrames; }
+        if (outGridCells) { *outGridCells = GridCells; }
+
+        return status;
+    }
+
+    //=============================================================================
+    // Latency Probe
+    //=============================================================================
+
+    __declspec(dllexport) int ULL_StartLatencyProbe(int rateHz, int echoPort, const char* csvPath)
+    {
+        // NULL or empty path: no CSV
+        const FString CsvPath = csvPath ? FString(UTF8_TO_TCHAR(csvPath)) : FString();
+        return FLiveLinkBridge::Get().StartLatencyProbe(rateHz, echoPort, CsvPath);
+    }
+
+    __declspec(dllexport) int ULL_StopLatencyProbe()
+    {
+        return FLiveLinkBridge::Get().StopLatencyProbe();
+    }
+
+    __declspec(dllexport) int ULL_GetLatencyStats(ULL_LatencyStats* outStats)
+    {
+        // Parameter validation
+        if (!outStats)
+        {
+            UE_LOG(LogUnrealLiveLinkNative, Error, TEXT("ULL_GetLatencyStats: outStats is NULL"));
+            return ULL_ERROR;
+        }
+
+        return FLiveLinkBridge::Get().GetLatencyStats(*outStats);
     }
 
 } // extern "C"
@@ -1,11 +1,12 @@
 #pragma once
 
 #include "UnrealLiveLink.Types.h"
+#include "UnrealLiveLink.Capture.h"
 
 //=============================================================================
 // Unreal LiveLink C API
 //=============================================================================
-// This header defines the 12-function C API for LiveLink integration.
+// This header defines the C API for LiveLink integration.
 // All functions use extern "C" linkage and __declspec(dllexport) for P/Invoke.
 //
 // IMPORTANT: Function signatures must match UnrealLiveLinkNative.cs exactly.
@@ -22,7 +23,7 @@ extern "C" {
 #endif
 
 //=============================================================================
-// Lifecycle Management (4 functions)
+// Lifecycle Management (6 functions)
 //=============================================================================
 
 /// <summary>
@@ -36,6 +37,31 @@ extern "C" {
 /// </remarks>
 __declspec(dllexport) int ULL_Initialize(const char* providerName);
 
+/// <summary>
+/// Initialize LiveLink system with provider name and options.
+/// </summary>
+/// <param name="providerName">Name displayed in Unreal's LiveLink window</param>
+/// <param name="options">Options (structSize must be set); NULL behaves like ULL_Initialize</param>
+/// <returns>ULL_OK on success, ULL_ERROR on failure</returns>
+/// <remarks>
+/// ULL_SEND_MODE_ASYNC makes update calls enqueue into a bounded ring buffer that a
+/// dedicated sender thread drains into LiveLink, so the caller never waits on
+/// Message Bus serialization or UDP send. With ULL_QUEUE_POLICY_DROP_OLDEST a full
+/// queue discards the oldest frame; with ULL_QUEUE_POLICY_BLOCK the caller waits.
+/// publishRateHz > 0 enables coalescing: each update only overwrites the subject's
+/// latest-value slot and a publish thread sends the dirty subjects at that rate, so
+/// repeated updates within one publish interval cost a single LiveLink frame.
+/// deadbandEnabled skips frames that match the subject's last sent frame within
+/// the position/rotation/property thresholds, resending every keepAliveIntervalMs.
+/// pumpRateHz sets the Message Bus pump thread rate (ULL_PUMP_DISABLED turns it off).
+/// simTimeScale and sceneFrameRate control how ULL_Update*AtTimeH map simulation time.
+/// initMode ULL_INIT_MODE_ASYNC returns before the engine runtime is up (first call in
+/// the process only): registrations and updates are buffered as each subject's latest
+/// value and go out once it is (see ULL_GetInitState).
+/// Options apply only to the call that actually initializes; later calls are no-ops.
+/// </remarks>
+__declspec(dllexport) int ULL_InitializeEx(const char* providerName, const ULL_InitOptions* options);
+
 /// <summary>
 /// Shutdown LiveLink system.
 /// Flushes all messages and releases resources.
@@ -65,6 +91,17 @@ __declspec(dllexport) int ULL_GetVersion();
 /// </remarks>
 __declspec(dllexport) int ULL_IsConnected();
 
+/// <summary>
+/// Get the initialization state (see ULL_INIT_MODE_ASYNC).
+/// </summary>
+/// <returns>ULL_INIT_STATE_STAGING, ULL_INIT_STATE_READY, ULL_INIT_STATE_FAILED, or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// STAGING while the engine runtime is brought up in the background; updates sent meanwhile
+/// are published when it turns READY. FAILED sessions drop updates until ULL_Shutdown.
+/// Synchronous initialization goes straight to READY.
+/// </remarks>
+__declspec(dllexport) int ULL_GetInitState();
+
 //=============================================================================
 // Transform Subjects (5 functions) - 3D Objects
 //=============================================================================
@@ -141,7 +178,340 @@ __declspec(dllexport) void ULL_UpdateObjectWithProperties(
 __declspec(dllexport) void ULL_RemoveObject(const char* subjectName);
 
 //=============================================================================
-// Data Subjects (3 functions) - Metrics/KPIs without 3D representation
+// Batch Updates (2 functions) - Many transform subjects per call
+//=============================================================================
+
+/// <summary>
+/// Update transforms for many objects in a single call.
+/// Registers objects automatically if not already registered.
+/// </summary>
+/// <param name="subjectNames">Array of object identifiers (count entries)</param>
+/// <param name="transforms">Contiguous array of transforms (count entries, same order as subjectNames)</param>
+/// <param name="count">Number of objects in the batch</param>
+/// <remarks>
+/// Takes the bridge lock once and pushes every frame to LiveLink in a single pass.
+/// Intended for per-tick flushing of all dirty objects (e.g., 1,000+ entities).
+/// NULL names are skipped; the remaining entries are still submitted.
+/// </remarks>
+__declspec(dllexport) void ULL_UpdateObjectsBatch(
+    const char** subjectNames,
+    const ULL_Transform* transforms,
+    int count);
+
+/// <summary>
+/// Update transforms and property values for many objects in a single call.
+/// </summary>
+/// <param name="subjectNames">Array of object identifiers (count entries)</param>
+/// <param name="transforms">Contiguous array of transforms (count entries)</param>
+/// <param name="propertyValues">Contiguous property values, propertyCount per object (count * propertyCount entries)</param>
+/// <param name="propertyCount">Number of property values per object (must match each object's registration count)</param>
+/// <param name="count">Number of objects in the batch</param>
+/// <remarks>
+/// All objects in one batch share the same property count - group objects by
+/// property layout and submit one batch per group.
+/// Objects whose registration count differs are skipped (logged, throttled).
+/// Unlike ULL_UpdateObjectsBatch, objects are only registered automatically when
+/// propertyCount is 0: the property names are not known here, so register objects
+/// with properties first (ULL_RegisterObjectWithProperties). Their frames are sent
+/// unregistered otherwise, as with ULL_UpdateObjectWithProperties, and Unreal ignores them.
+/// </remarks>
+__declspec(dllexport) void ULL_UpdateObjectsBatchWithProperties(
+    const char** subjectNames,
+    const ULL_Transform* transforms,
+    const float* propertyValues,
+    int propertyCount,
+    int count);
+
+//=============================================================================
+// Handle-Based Transform Subjects (9 functions) - Hot path without string lookups
+//=============================================================================
+
+/// <summary>
+/// Register a transform subject and return an integer handle for updates.
+/// </summary>
+/// <param name="subjectName">Unique identifier for this object</param>
+/// <returns>Subject handle (>= 0) on success, negative ULL_* error code on failure</returns>
+/// <remarks>
+/// Registering an existing name returns its current handle.
+/// Handle-based updates skip the UTF-8 → FName conversion and name lookup.
+/// </remarks>
+__declspec(dllexport) int ULL_RegisterObjectH(const char* subjectName);
+
+/// <summary>
+/// Register a transform subject with custom properties and return a handle.
+/// </summary>
+/// <param name="subjectName">Unique identifier for this object</param>
+/// <param name="propertyNames">Array of property name strings</param>
+/// <param name="propertyCount">Number of properties in array</param>
+/// <returns>Subject handle (>= 0) on success, negative ULL_* error code on failure</returns>
+__declspec(dllexport) int ULL_RegisterObjectWithPropertiesH(
+    const char* subjectName,
+    const char** propertyNames,
+    int propertyCount);
+
+/// <summary>
+/// Update transform for a registered subject handle.
+/// </summary>
+/// <param name="handle">Handle returned by ULL_RegisterObjectH</param>
+/// <param name="transform">Transform data (position, rotation, scale)</param>
+/// <remarks>
+/// Unlike ULL_UpdateObject, does not auto-register. Invalid or stale handles are ignored.
+/// </remarks>
+__declspec(dllexport) void ULL_UpdateObjectH(
+    int handle,
+    const ULL_Transform* transform);
+
+/// <summary>
+/// Update transform and property values for a registered subject handle.
+/// </summary>
+/// <param name="handle">Handle returned by ULL_RegisterObjectWithPropertiesH</param>
+/// <param name="transform">Transform data</param>
+/// <param name="propertyValues">Array of property values (must match registration order)</param>
+/// <param name="propertyCount">Number of values (must match registration count)</param>
+__declspec(dllexport) void ULL_UpdateObjectWithPropertiesH(
+    int handle,
+    const ULL_Transform* transform,
+    const float* propertyValues,
+    int propertyCount);
+
+/// <summary>
+/// Update transforms for many subject handles in a single call.
+/// </summary>
+/// <param name="handles">Array of subject handles (count entries)</param>
+/// <param name="transforms">Contiguous array of transforms (count entries)</param>
+/// <param name="count">Number of subjects in the batch</param>
+/// <remarks>
+/// Entries with invalid handles, or handles registered with properties, are skipped.
+/// </remarks>
+__declspec(dllexport) void ULL_UpdateObjectsBatchH(
+    const int* handles,
+    const ULL_Transform* transforms,
+    int count);
+
+/// <summary>
+/// Update transforms and property values for many subject handles in a single call.
+/// </summary>
+/// <param name="handles">Array of subject handles (count entries)</param>
+/// <param name="transforms">Contiguous array of transforms (count entries)</param>
+/// <param name="propertyValues">Contiguous property values, propertyCount per subject</param>
+/// <param name="propertyCount">Number of property values per subject</param>
+/// <param name="count">Number of subjects in the batch</param>
+__declspec(dllexport) void ULL_UpdateObjectsBatchWithPropertiesH(
+    const int* handles,
+    const ULL_Transform* transforms,
+    const float* propertyValues,
+    int propertyCount,
+    int count);
+
+/// <summary>
+/// Update transform and property values for a subject handle, timestamped with simulation time.
+/// </summary>
+/// <param name="handle">Handle returned by ULL_RegisterObjectH or ULL_RegisterObjectWithPropertiesH</param>
+/// <param name="transform">Transform data</param>
+/// <param name="propertyValues">Array of property values (can be NULL when propertyCount is 0)</param>
+/// <param name="propertyCount">Number of values (must match registration count)</param>
+/// <param name="simTime">Simulation time of this state in seconds</param>
+/// <remarks>
+/// The frame's WorldTime advances by (simTime delta * simTimeScale) from an anchor taken at
+/// the first timed frame (re-anchored if simTime goes backwards), and its scene time is
+/// simTime * simTimeScale at sceneFrameRate. With buffered evaluation in Unreal this lets
+/// subjects be sent at a low rate and interpolated, instead of being sent every frame.
+/// </remarks>
+__declspec(dllexport) void ULL_UpdateObjectAtTimeH(
+    int handle,
+    const ULL_Transform* transform,
+    const float* propertyValues,
+    int propertyCount,
+    double simTime);
+
+/// <summary>
+/// Update transforms and property values for many subject handles at one simulation time.
+/// </summary>
+/// <param name="handles">Array of subject handles (count entries)</param>
+/// <param name="transforms">Contiguous array of transforms (count entries)</param>
+/// <param name="propertyValues">Contiguous property values, propertyCount per subject (can be NULL when propertyCount is 0)</param>
+/// <param name="propertyCount">Number of property values per subject</param>
+/// <param name="count">Number of subjects in the batch</param>
+/// <param name="simTime">Simulation time of this state in seconds (same mapping as ULL_UpdateObjectAtTimeH)</param>
+__declspec(dllexport) void ULL_UpdateObjectsBatchAtTimeH(
+    const int* handles,
+    const ULL_Transform* transforms,
+    const float* propertyValues,
+    int propertyCount,
+    int count,
+    double simTime);
+
+/// <summary>
+/// Remove a transform subject by handle. The handle becomes invalid.
+/// </summary>
+/// <param name="handle">Handle to remove</param>
+/// <remarks>
+/// Safe to call with invalid or already-removed handles (no error).
+/// </remarks>
+__declspec(dllexport) void ULL_RemoveObjectH(int handle);
+
+//=============================================================================
+// Property Schemas (3 functions) - Shared property layouts
+//=============================================================================
+
+/// <summary>
+/// Intern a property name list and return its schema ID.
+/// </summary>
+/// <param name="propertyNames">Array of property name strings</param>
+/// <param name="propertyCount">Number of properties in array (0 = transform only)</param>
+/// <returns>Schema ID (>= 0) on success, negative ULL_* error code on failure</returns>
+/// <remarks>
+/// Identical lists (same names, same order) return the same ID. IDs stay valid until
+/// ULL_Shutdown. ULL_RegisterObjectWithPropertiesH and ULL_RegisterDataSubject intern
+/// their names into the same registry.
+/// </remarks>
+__declspec(dllexport) int ULL_RegisterPropertySchema(
+    const char** propertyNames,
+    int propertyCount);
+
+/// <summary>
+/// Register a transform subject with a schema from ULL_RegisterPropertySchema and return a handle.
+/// </summary>
+/// <param name="subjectName">Unique identifier for this object</param>
+/// <param name="schemaId">Schema ID</param>
+/// <returns>Subject handle (>= 0) on success, negative ULL_* error code on failure</returns>
+/// <remarks>
+/// Same as ULL_RegisterObjectWithPropertiesH without converting or comparing property names.
+/// </remarks>
+__declspec(dllexport) int ULL_RegisterObjectWithSchemaH(
+    const char* subjectName,
+    int schemaId);
+
+/// <summary>
+/// Register many transform subjects in one call and return their handles.
+/// </summary>
+/// <param name="subjectNames">Array of subject names</param>
+/// <param name="schemaIds">Schema ID per subject (NULL = no properties for all)</param>
+/// <param name="count">Number of subjects</param>
+/// <param name="outHandles">Receives a handle (>= 0) or negative ULL_* error code per subject</param>
+/// <returns>Number of subjects registered, or negative ULL_* error code</returns>
+/// <remarks>
+/// Intended for the startup warm-up with the model's known entity list. Takes the bridge
+/// lock and checks the LiveLink source once for the whole batch. With async send mode the
+/// static data is queued to the sender thread instead of being sent on the calling thread.
+/// Already registered names return their existing handle.
+/// </remarks>
+__declspec(dllexport) int ULL_RegisterObjectsBatchH(
+    const char** subjectNames,
+    const int* schemaIds,
+    int count,
+    int* outHandles);
+
+//=============================================================================
+// Update-Rate Tiers (2 functions) - Per-subject priority and rate
+//=============================================================================
+
+/// <summary>
+/// Set the priority and maximum publish rate of a registered transform subject.
+/// </summary>
+/// <param name="handle">Subject handle</param>
+/// <param name="priority">ULL_PRIORITY_HIGH, ULL_PRIORITY_NORMAL (default) or ULL_PRIORITY_LOW</param>
+/// <param name="maxRateHz">Maximum frames per second for this subject (ULL_RATE_UNLIMITED = every publish pass)</param>
+/// <returns>ULL_OK, ULL_ERROR (stale handle, invalid priority or rate) or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// Applies in coalescing mode only (publishRateHz > 0); immediate mode sends every update.
+/// Updates between two published frames of a subject are coalesced into its latest value. When
+/// the publish budget (publishFrameBudget / publishByteBudget) is spent, lower priorities are
+/// held back first. Call right after registration; the tier resets when the subject is removed.
+/// </remarks>
+__declspec(dllexport) int ULL_SetObjectScheduleH(
+    int handle,
+    int priority,
+    int maxRateHz);
+
+/// <summary>
+/// Set the priority and maximum publish rate of a registered transform or data subject by name.
+/// </summary>
+/// <param name="subjectName">Registered transform or data subject</param>
+/// <param name="priority">ULL_PRIORITY_*</param>
+/// <param name="maxRateHz">Maximum frames per second (ULL_RATE_UNLIMITED = every publish pass)</param>
+/// <returns>ULL_OK, ULL_ERROR (unknown subject, invalid priority or rate) or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// Same as ULL_SetObjectScheduleH. Data subjects (KPIs, counters) are the typical low-rate tier.
+/// </remarks>
+__declspec(dllexport) int ULL_SetSubjectSchedule(
+    const char* subjectName,
+    int priority,
+    int maxRateHz);
+
+//=============================================================================
+// Simio Coordinate Batches (2 functions) - Conversion done natively
+//=============================================================================
+
+/// <summary>
+/// Convert raw Simio values to Unreal transforms (same conventions as CoordinateConverter.cs).
+/// </summary>
+/// <param name="simioValues">Column block of componentCount * count doubles (see "Simio Value Blocks")</param>
+/// <param name="componentCount">ULL_SIMIO_POSE_COMPONENTS or ULL_SIMIO_TRANSFORM_COMPONENTS</param>
+/// <param name="count">Number of objects</param>
+/// <param name="outTransforms">Receives count transforms</param>
+/// <returns>ULL_OK on success, ULL_ERROR on invalid arguments</returns>
+/// <remarks>
+/// Does not require ULL_Initialize. Non-finite positions become the origin, non-finite
+/// rotations the identity and non-finite or non-positive scales unit scale.
+/// </remarks>
+__declspec(dllexport) int ULL_ConvertSimioTransforms(
+    const double* simioValues,
+    int componentCount,
+    int count,
+    ULL_Transform* outTransforms);
+
+/// <summary>
+/// Convert raw Simio values and update many subject handles in a single call.
+/// </summary>
+/// <param name="handles">Array of subject handles (count entries)</param>
+/// <param name="simioValues">Column block of componentCount * count doubles (see "Simio Value Blocks")</param>
+/// <param name="componentCount">ULL_SIMIO_POSE_COMPONENTS or ULL_SIMIO_TRANSFORM_COMPONENTS</param>
+/// <param name="propertyValues">Contiguous property values, propertyCount per subject (can be NULL when propertyCount is 0)</param>
+/// <param name="propertyCount">Number of property values per subject</param>
+/// <param name="count">Number of subjects in the batch</param>
+/// <remarks>
+/// Equivalent to ULL_ConvertSimioTransforms followed by ULL_UpdateObjectsBatchWithPropertiesH,
+/// without the managed per-object conversion and without marshaling ULL_Transform arrays.
+/// </remarks>
+__declspec(dllexport) void ULL_UpdateObjectsBatchSimioH(
+    const int* handles,
+    const double* simioValues,
+    int componentCount,
+    const float* propertyValues,
+    int propertyCount,
+    int count);
+
+//=============================================================================
+// Compact Transforms (1 function) - Reduced P/Invoke bytes per object
+//=============================================================================
+
+/// <summary>
+/// Update transforms and property values for many subject handles from compact transforms.
+/// </summary>
+/// <param name="handles">Array of subject handles (count entries)</param>
+/// <param name="transforms">Array of compact transforms (count entries, see "Compact Transform Structure")</param>
+/// <param name="scales">Scale triples of the transforms flagged ULL_COMPACT_HAS_SCALE, in batch order (can be NULL when scaleCount is 0)</param>
+/// <param name="scaleCount">Number of scale triples in scales</param>
+/// <param name="propertyValues">Contiguous property values, propertyCount per subject (can be NULL when propertyCount is 0)</param>
+/// <param name="propertyCount">Number of property values per subject</param>
+/// <param name="count">Number of subjects in the batch</param>
+/// <remarks>
+/// 20 bytes per object instead of 80. Positions are float32 centimeters and rotations
+/// smallest-three quantized (worst case 48-bit: 0.004 degrees, 32-bit: 0.25 degrees). Frames are
+/// expanded natively and sent exactly like ULL_UpdateObjectsBatchWithPropertiesH.
+/// </remarks>
+__declspec(dllexport) void ULL_UpdateObjectsBatchCompactH(
+    const int* handles,
+    const ULL_CompactTransform* transforms,
+    const float* scales,
+    int scaleCount,
+    const float* propertyValues,
+    int propertyCount,
+    int count);
+
+//=============================================================================
+// Data Subjects (4 functions) - Metrics/KPIs without 3D representation
 //=============================================================================
 
 /// <summary>
@@ -151,7 +521,8 @@ __declspec(dllexport) void ULL_RemoveObject(const char* subjectName);
 /// <param name="propertyNames">Array of property name strings</param>
 /// <param name="propertyCount">Number of properties in the array</param>
 /// <remarks>
-/// Register with LiveLink as ULiveLinkBasicRole
+/// Registered with LiveLink as ULiveLinkBasicRole (property names only, no transform).
+/// Registering again with different property names replaces the layout.
 /// </remarks>
 __declspec(dllexport) void ULL_RegisterDataSubject(
     const char* subjectName,
@@ -166,7 +537,9 @@ __declspec(dllexport) void ULL_RegisterDataSubject(
 /// <param name="propertyValues">Array of property values (float)</param>
 /// <param name="propertyCount">Number of values in the array</param>
 /// <remarks>
-/// Submit data frame to LiveLink
+/// Sends a ULiveLinkBasicRole frame (property values only). If the subject is not
+/// registered and propertyNames is provided, it is registered first.
+/// Follows the same coalescing (publishRateHz) and deadband rules as transform subjects.
 /// </remarks>
 __declspec(dllexport) void ULL_UpdateDataSubject(
     const char* subjectName,
@@ -174,15 +547,358 @@ __declspec(dllexport) void ULL_UpdateDataSubject(
     const float* propertyValues,
     int propertyCount);
 
+/// <summary>
+/// Update property values for many data subjects in a single call.
+/// </summary>
+/// <param name="subjectNames">Array of subject identifiers (count entries)</param>
+/// <param name="propertyValues">Contiguous property values, propertyCount per subject (count * propertyCount entries)</param>
+/// <param name="propertyCount">Number of property values per subject (must match each subject's registration count)</param>
+/// <param name="count">Number of subjects in the batch</param>
+/// <remarks>
+/// Register subjects with ULL_RegisterDataSubject first so Unreal knows the property names.
+/// Subjects whose registration count differs are skipped (logged, throttled).
+/// </remarks>
+__declspec(dllexport) void ULL_UpdateDataSubjectsBatch(
+    const char** subjectNames,
+    const float* propertyValues,
+    int propertyCount,
+    int count);
+
 /// <summary>
 /// Remove a data subject from LiveLink.
 /// </summary>
 /// <param name="subjectName">Subject identifier to remove</param>
 /// <remarks>
-/// Mark data subject as removed in LiveLink
+/// Safe to call for subjects that were never registered
 /// </remarks>
 __declspec(dllexport) void ULL_RemoveDataSubject(const char* subjectName);
 
+//=============================================================================
+// Diagnostics (4 functions)
+//=============================================================================
+
+/// <summary>
+/// Read the change-detection (deadband) counters since initialization.
+/// </summary>
+/// <param name="outSentFrames">Frames that passed the filter (includes keep-alive resends); may be NULL</param>
+/// <param name="outSuppressedFrames">Frames skipped as unchanged; may be NULL</param>
+/// <param name="outKeepAliveFrames">Unchanged frames resent because keepAliveIntervalMs elapsed; may be NULL</param>
+/// <returns>ULL_OK, or ULL_NOT_INITIALIZED (outputs set to 0)</returns>
+/// <remarks>
+/// Counters stay at 0 unless ULL_InitOptions.deadbandEnabled was set.
+/// </remarks>
+__declspec(dllexport) int ULL_GetDeadbandCounters(
+    unsigned long long* outSentFrames,
+    unsigned long long* outSuppressedFrames,
+    unsigned long long* outKeepAliveFrames);
+
+/// <summary>
+/// Read Message Bus pump thread statistics.
+/// </summary>
+/// <param name="outStats">Receives the statistics (zeroed when the pump is not running)</param>
+/// <returns>ULL_OK, ULL_ERROR if outStats is NULL, or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// The pump thread starts in ULL_Initialize and ticks FTSTicker at pumpRateHz so discovery
+/// replies, heartbeats and UdpMessaging work are processed on a steady cadence.
+/// A rising overrunCount or maxTickMs near 1000/rateHz means the pump is falling behind.
+/// </remarks>
+__declspec(dllexport) int ULL_GetPumpStats(ULL_PumpStats* outStats);
+
+/// <summary>
+/// Read hot-path statistics: update counters, name cache, lock wait and
+/// UpdateSubjectFrameData latency histogram.
+/// </summary>
+/// <param name="outStats">Receives the statistics (zeroed when not initialized)</param>
+/// <returns>ULL_OK, ULL_ERROR if outStats is NULL, or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// Counters are atomics updated on every call and are always on; reading them
+/// takes the bridge lock once for subject counts.
+/// </remarks>
+__declspec(dllexport) int ULL_GetStats(ULL_Stats* outStats);
+
+/// <summary>
+/// Zero the ULL_GetStats counters (also the ULL_GetDeadbandCounters and ULL_GetInterestCounters counters).
+/// </summary>
+/// <returns>ULL_OK or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// Subject counts are live values and are not affected.
+/// </remarks>
+__declspec(dllexport) int ULL_ResetStats();
+
+//=============================================================================
+// Capture and Replay (8 functions) - Record frame streams for offline review
+//=============================================================================
+
+/// <summary>
+/// Start recording every static-data, frame and removal sent to LiveLink to a capture file.
+/// </summary>
+/// <param name="filePath">Capture file path (overwritten)</param>
+/// <returns>ULL_OK, ULL_ERROR (NULL path, file not created, or shared-memory transport), or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// Format: UnrealLiveLink.Capture.h. Subjects registered before the call are written first.
+/// In async send mode the sender thread records what it sends; in sync mode each
+/// send is recorded inline at the cost of a copy into the current chunk buffer.
+/// Calling again replaces the running capture. ULL_Shutdown closes it.
+/// </remarks>
+__declspec(dllexport) int ULL_StartCapture(const char* filePath);
+
+/// <summary>
+/// Finalize and close the capture file.
+/// </summary>
+/// <returns>ULL_OK (also when no capture is running) or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// In async send mode, frames still queued when the capture stops are not recorded.
+/// </remarks>
+__declspec(dllexport) int ULL_StopCapture();
+
+/// <summary>
+/// Stream a capture file to LiveLink on a replay thread.
+/// </summary>
+/// <param name="filePath">Capture file written by ULL_StartCapture</param>
+/// <param name="speed">Playback speed multiplier (1.0 = real time, ULL_REPLAY_PAUSED = start paused, max ULL_REPLAY_MAX_SPEED)</param>
+/// <param name="loop">Non-zero to restart at the end of the capture</param>
+/// <returns>ULL_OK, ULL_ERROR (NULL path or unreadable file), ULL_NOT_CONNECTED, or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// Frames are restamped with the current time. Replayed subjects use their captured
+/// names, so avoid replaying while a simulation streams the same subjects.
+/// Starting a replay stops the previous one.
+/// </remarks>
+__declspec(dllexport) int ULL_StartReplay(const char* filePath, double speed, int loop);
+
+/// <summary>
+/// Change replay speed (ULL_REPLAY_PAUSED to pause, negative values are treated as paused).
+/// </summary>
+/// <returns>ULL_OK, ULL_ERROR if no replay is running, or ULL_NOT_INITIALIZED</returns>
+__declspec(dllexport) int ULL_SetReplaySpeed(double speed);
+
+/// <summary>
+/// Jump to a capture time and publish every subject's state at that time (scrubbing).
+/// </summary>
+/// <param name="seconds">Seconds from the start of the capture (clamped to the capture)</param>
+/// <returns>ULL_OK, ULL_ERROR if no replay is running, or ULL_NOT_INITIALIZED</returns>
+__declspec(dllexport) int ULL_SeekReplay(double seconds);
+
+/// <summary>
+/// Stop the replay and remove the replayed subjects from LiveLink.
+/// </summary>
+/// <returns>ULL_OK (also when no replay is running) or ULL_NOT_INITIALIZED</returns>
+__declspec(dllexport) int ULL_StopReplay();
+
+/// <summary>
+/// Read the replay position.
+/// </summary>
+/// <param name="outPositionSeconds">Current capture time; may be NULL</param>
+/// <param name="outDurationSeconds">Capture length; may be NULL</param>
+/// <returns>ULL_OK, ULL_ERROR if no replay is running, or ULL_NOT_INITIALIZED (outputs set to 0)</returns>
+/// <remarks>
+/// Without looping, the position stops at the duration when the capture has been played.
+/// </remarks>
+__declspec(dllexport) int ULL_GetReplayStatus(double* outPositionSeconds, double* outDurationSeconds);
+
+/// <summary>
+/// Read back the last frame the replay sent for a subject.
+/// </summary>
+/// <param name="subjectName">Captured subject name</param>
+/// <param name="outTransform">Receives the transform (identity for data subjects)</param>
+/// <param name="outPropertyValues">Receives up to maxPropertyCount property values; may be NULL when maxPropertyCount is 0</param>
+/// <param name="maxPropertyCount">Capacity of outPropertyValues</param>
+/// <returns>
+/// The subject's property count (values beyond maxPropertyCount are not copied), ULL_ERROR
+/// (invalid arguments, no replay running, or no frame of the subject live), or ULL_NOT_INITIALIZED
+/// </returns>
+/// <remarks>
+/// Shows what a seek rebuilt (key positions and sparse property sections decoded) without
+/// an Unreal instance. The frame is kept until the subject is removed from the replay.
+/// </remarks>
+__declspec(dllexport) int ULL_GetReplayFrame(const char* subjectName, ULL_Transform* outTransform, float* outPropertyValues, int maxPropertyCount);
+
+//=============================================================================
+// Sessions (10 functions) - Independent providers in one process
+//=============================================================================
+
+/// <summary>
+/// Create an independent LiveLink session with its own provider.
+/// </summary>
+/// <param name="providerName">Name displayed in Unreal's LiveLink window (unique among live sessions)</param>
+/// <param name="options">Options (structSize must be set); NULL = synchronous defaults</param>
+/// <returns>Session ID (> ULL_DEFAULT_SESSION) on success, ULL_ERROR on failure</returns>
+/// <remarks>
+/// Each session has its own subject tables, property schemas, lock, sender and publish
+/// threads, so parallel experiment replications do not serialize on one lock and can
+/// stream to separate Unreal viewers. The Message Bus pump thread is shared by all
+/// sessions (the first one to start it sets its rate). Sessions are independent of
+/// ULL_Initialize/ULL_Shutdown and stay alive until ULL_DestroySession. Fails when the
+/// provider name is in use or ULL_MAX_SESSIONS sessions are open.
+/// </remarks>
+__declspec(dllexport) int ULL_CreateSession(const char* providerName, const ULL_InitOptions* options);
+
+/// <summary>
+/// Shut down a session and remove its subjects from LiveLink. Its handles become invalid.
+/// </summary>
+/// <param name="sessionId">Session returned by ULL_CreateSession</param>
+/// <returns>ULL_OK, or ULL_ERROR for unknown IDs (ULL_DEFAULT_SESSION is shut down with ULL_Shutdown)</returns>
+/// <remarks>
+/// Calls already running on the session on other threads finish first; later calls with the ID are ignored.
+/// </remarks>
+__declspec(dllexport) int ULL_DestroySession(int sessionId);
+
+/// <summary>
+/// Register a transform subject in a session and return a handle (see ULL_RegisterObjectH).
+/// </summary>
+/// <param name="sessionId">Session ID (ULL_DEFAULT_SESSION = ULL_Initialize bridge)</param>
+/// <param name="subjectName">Unique identifier within the session</param>
+/// <returns>Subject handle (>= 0) on success, negative ULL_* error code on failure (ULL_ERROR for unknown sessions)</returns>
+__declspec(dllexport) int ULL_SessionRegisterObjectH(int sessionId, const char* subjectName);
+
+/// <summary>
+/// Register a transform subject with custom properties in a session (see ULL_RegisterObjectWithPropertiesH).
+/// </summary>
+/// <returns>Subject handle (>= 0) on success, negative ULL_* error code on failure</returns>
+__declspec(dllexport) int ULL_SessionRegisterObjectWithPropertiesH(
+    int sessionId,
+    const char* subjectName,
+    const char** propertyNames,
+    int propertyCount);
+
+/// <summary>
+/// Update transforms and property values for many handles of a session (see ULL_UpdateObjectsBatchWithPropertiesH).
+/// </summary>
+/// <remarks>
+/// Unknown sessions are ignored. The session lookup is one shared-lock read per call.
+/// </remarks>
+__declspec(dllexport) void ULL_SessionUpdateObjectsBatchWithPropertiesH(
+    int sessionId,
+    const int* handles,
+    const ULL_Transform* transforms,
+    const float* propertyValues,
+    int propertyCount,
+    int count);
+
+/// <summary>
+/// Remove a transform subject of a session by handle (see ULL_RemoveObjectH).
+/// </summary>
+__declspec(dllexport) void ULL_SessionRemoveObjectH(int sessionId, int handle);
+
+/// <summary>
+/// Update property values for a data subject of a session (see ULL_UpdateDataSubject).
+/// </summary>
+/// <remarks>
+/// Registers the subject first when propertyNames is provided and it is not registered.
+/// </remarks>
+__declspec(dllexport) void ULL_SessionUpdateDataSubject(
+    int sessionId,
+    const char* subjectName,
+    const char** propertyNames,
+    const float* propertyValues,
+    int propertyCount);
+
+/// <summary>
+/// Remove a data subject of a session (see ULL_RemoveDataSubject).
+/// </summary>
+__declspec(dllexport) void ULL_SessionRemoveDataSubject(int sessionId, const char* subjectName);
+
+/// <summary>
+/// Read a session's hot-path statistics (see ULL_GetStats).
+/// </summary>
+/// <returns>ULL_OK, ULL_ERROR if outStats is NULL or the session is unknown, or ULL_NOT_INITIALIZED</returns>
+__declspec(dllexport) int ULL_SessionGetStats(int sessionId, ULL_Stats* outStats);
+
+/// <summary>
+/// Get a session's initialization state (see ULL_GetInitState).
+/// </summary>
+/// <returns>ULL_INIT_STATE_* value, ULL_ERROR if the session is unknown, or ULL_NOT_INITIALIZED</returns>
+__declspec(dllexport) int ULL_SessionGetInitState(int sessionId);
+
+//=============================================================================
+// Interest Regions (3 functions) - Stream what the viewers look at
+//=============================================================================
+
+/// <summary>
+/// Declare the regions of interest of the ULL_Initialize bridge (viewer frusta, cameras, areas).
+/// </summary>
+/// <param name="regions">Axis-aligned boxes in Unreal coordinates (count entries; may be NULL when count is 0)</param>
+/// <param name="count">Number of regions (0 = no regions, every subject streams; max ULL_MAX_INTEREST_REGIONS)</param>
+/// <param name="outsideRateHz">Frames per second for subjects outside every region (ULL_INTEREST_SUPPRESS = none)</param>
+/// <returns>ULL_OK, ULL_ERROR (invalid regions or rate), or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// Transform subjects are placed in a uniform grid as their updates arrive; the grid
+/// resolves most inside/outside tests per cell. A subject outside every region keeps
+/// only its latest frame, which is sent as soon as a region covers it (on its next
+/// update, or by this call when moving a region over it) and otherwise at outsideRateHz.
+/// Call again whenever a viewer moves; the call costs one pass over the occupied cells.
+/// Not applied to data subjects or the shared-memory transport.
+/// </remarks>
+__declspec(dllexport) int ULL_SetInterestRegions(
+    const ULL_InterestRegion* regions,
+    int count,
+    int outsideRateHz);
+
+/// <summary>
+/// Declare the regions of interest of a session (see ULL_SetInterestRegions).
+/// </summary>
+/// <returns>ULL_OK, ULL_ERROR (unknown session, invalid regions or rate), or ULL_NOT_INITIALIZED</returns>
+__declspec(dllexport) int ULL_SessionSetInterestRegions(
+    int sessionId,
+    const ULL_InterestRegion* regions,
+    int count,
+    int outsideRateHz);
+
+/// <summary>
+/// Read the interest-region counters of the ULL_Initialize bridge since initialization.
+/// </summary>
+/// <param name="outHeldFrames">Updates of subjects outside every region that were not sent; may be NULL</param>
+/// <param name="outOutsideFrames">Frames sent for subjects outside every region at outsideRateHz; may be NULL</param>
+/// <param name="outGridCells">Occupied grid cells (live value); may be NULL</param>
+/// <returns>ULL_OK, or ULL_NOT_INITIALIZED (outputs set to 0)</returns>
+/// <remarks>
+/// Counters stay at 0 until ULL_SetInterestRegions declares a region. ULL_ResetStats zeroes them.
+/// </remarks>
+__declspec(dllexport) int ULL_GetInterestCounters(
+    unsigned long long* outHeldFrames,
+    unsigned long long* outOutsideFrames,
+    int* outGridCells);
+
+//=============================================================================
+// Latency Probe (3 functions) - Where the lag comes from
+//=============================================================================
+
+/// <summary>
+/// Send a reserved probe subject through the update path and measure each stage it passes.
+/// </summary>
+/// <param name="rateHz">Probes per second (1 to ULL_LATENCY_MAX_RATE_HZ)</param>
+/// <param name="echoPort">UDP port the Unreal-side echo reports to (0 = in-process stages only,
+/// default ULL_LATENCY_ECHO_DEFAULT_PORT)</param>
+/// <param name="csvPath">CSV file, one row of ULL_GetLatencyStats values per
+/// ULL_LATENCY_CSV_INTERVAL_SECONDS (overwritten); may be NULL</param>
+/// <returns>ULL_OK, ULL_ERROR (invalid rate or port, port in use, file not created, subject pools
+/// or shared-memory transport), or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// The probe is the transform subject ULL_LATENCY_PROBE_SUBJECT (wire format:
+/// UnrealLiveLink.LatencyProbe.h). A bridge thread submits it like ULL_UpdateObjectH,
+/// so it waits on the same lock, pending slots and send queue as the model's subjects,
+/// and its frames are counted in ULL_GetStats. The echo in the SimioLiveLinkSharedMemory
+/// plugin reports when Unreal evaluates it. Calling again replaces the running probe.
+/// ULL_Shutdown stops it.
+/// </remarks>
+__declspec(dllexport) int ULL_StartLatencyProbe(int rateHz, int echoPort, const char* csvPath);
+
+/// <summary>
+/// Stop the probe, write the last CSV row and remove the probe subject.
+/// </summary>
+/// <returns>ULL_OK (also when no probe is running) or ULL_NOT_INITIALIZED</returns>
+__declspec(dllexport) int ULL_StopLatencyProbe();
+
+/// <summary>
+/// Read per-stage latency percentiles of the running (or last) probe.
+/// </summary>
+/// <param name="outStats">Receives the statistics (zeroed when no probe has run)</param>
+/// <returns>ULL_OK, ULL_ERROR if outStats is NULL, or ULL_NOT_INITIALIZED</returns>
+/// <remarks>
+/// Values stay readable after ULL_StopLatencyProbe until the probe is started again.
+/// ULL_ResetStats does not clear them.
+/// </remarks>
+__declspec(dllexport) int ULL_GetLatencyStats(ULL_LatencyStats* outStats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -203,7 +919,7 @@ __declspec(dllexport) void ULL_RemoveDataSubject(const char* subjectName);
 //   - No dynamic allocation or ownership transfer
 //
 // Thread Safety:
-//   - FCriticalSection in LiveLinkBridge
+//   - FCriticalSection in LiveLinkBridge (one per session)
 //
 // Error Handling:
 //   - Parameter validation (null checks, bounds)
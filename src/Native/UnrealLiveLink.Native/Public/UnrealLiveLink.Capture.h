@@ -0,0 +1,139 @@
+#pragma once
+
+#include <stddef.h>  // For offsetof macro
+
+// Pure C layout - no C++ types in this header
+// Written by the capture recorder (ULL_StartCapture) and read by the replayer (ULL_StartReplay)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Capture File Format
+// =============================================================================
+// A capture holds every static-data, frame and removal the bridge handed to
+// ILiveLinkProvider, in send order:
+//
+//   [ULL_CaptureFileHeader]                         64 bytes
+//   chunk 0                                         chunkBytes
+//   chunk 1                                         chunkBytes
+//   ...
+//
+// Each chunk is [ULL_CaptureChunkHeader] followed by records (usedBytes of
+// them, the rest of the chunk is zero padding). Records never span chunks.
+// Every record starts with ULL_CaptureRecordHeader; size is the whole record
+// (header included, multiple of 4 bytes).
+//
+//   SUBJECT    ULL_CaptureSubjectRecord, then the UTF-8 subject name and
+//              propertyCount UTF-8 property names, each NUL-terminated
+//   REMOVE     header only
+//   FRAME      ULL_CaptureFrameRecord, then double[3] key position when flagged
+//              ULL_CAPTURE_FLAG_KEY, then float[3] scale when flagged
+//              ULL_CAPTURE_FLAG_SCALE, then the property section
+//   DATA       ULL_CaptureDataRecord, then the property section
+//
+// A property section runs to the end of the record and is either full (float
+// values, one per property) or, when flagged ULL_CAPTURE_FLAG_SPARSE, a changed
+// mask of unsigned int[(n + 31) / 32] (bit i = property i) followed by the
+// float values of the set bits in property order; n is the property count of
+// the subject's last full section and unset properties keep their values.
+//
+// Subject IDs are assigned on a subject's first SUBJECT record. A subject that
+// is registered again after removal (or whose schema changes) gets another
+// SUBJECT record with the same ID; the latest record before a frame applies.
+//
+// Positions are delta-encoded per chunk: a subject's first frame in a chunk is
+// a key frame (ULL_CAPTURE_FLAG_KEY) carrying the absolute position as doubles;
+// later frames in the same chunk carry the float offset from that key. Every
+// chunk can therefore be decoded on its own once the subject table is known,
+// which is what seeking uses. Property sections follow the same rule: a
+// subject's first section in a chunk is full, later ones may be sparse.
+// =============================================================================
+
+#define ULL_CAPTURE_MAGIC               0x434C4C55u   // "ULLC" (little-endian)
+#define ULL_CAPTURE_CHUNK_MAGIC         0x4B4C4C55u   // "ULLK"
+#define ULL_CAPTURE_VERSION             2             // 2: sparse property sections (version 1 files still load)
+
+#define ULL_CAPTURE_CHUNK_BYTES         (1 << 20)     // Chunk size including its header
+
+#define ULL_CAPTURE_RECORD_SUBJECT      1
+#define ULL_CAPTURE_RECORD_REMOVE       2
+#define ULL_CAPTURE_RECORD_FRAME        3
+#define ULL_CAPTURE_RECORD_DATA         4
+
+#define ULL_CAPTURE_FLAG_KEY            0x01          // FRAME: position is absolute (keyPosition valid)
+#define ULL_CAPTURE_FLAG_SCALE          0x02          // FRAME: a float[3] scale follows (otherwise unit scale)
+#define ULL_CAPTURE_FLAG_SPARSE         0x04          // FRAME/DATA: the property section holds changed values only
+
+#define ULL_CAPTURE_ROLE_TRANSFORM      0             // ULiveLinkTransformRole
+#define ULL_CAPTURE_ROLE_BASIC          1             // ULiveLinkBasicRole (data subjects)
+
+#define ULL_CAPTURE_MAX_RECORD_BYTES    65532         // Largest record (size is a 16-bit field)
+
+#define ULL_REPLAY_PAUSED               0.0           // ULL_SetReplaySpeed: hold the current position
+#define ULL_REPLAY_MAX_SPEED            1000.0        // Fastest playback multiplier
+
+#pragma pack(push, 8)
+
+typedef struct ULL_CaptureFileHeader {
+    unsigned int magic;               // ULL_CAPTURE_MAGIC
+    unsigned int version;             // ULL_CAPTURE_VERSION
+    unsigned int headerSize;          // sizeof(ULL_CaptureFileHeader)
+    unsigned int chunkBytes;          // ULL_CAPTURE_CHUNK_BYTES
+    unsigned long long chunkCount;    // Written when the capture is stopped (0 = capture was not closed)
+    unsigned long long recordCount;
+    unsigned long long frameCount;    // FRAME + DATA records
+    double startWorldTime;            // WorldTime that record times are relative to
+    double durationSeconds;           // Time of the last record
+    unsigned int subjectCount;        // SUBJECT records
+    unsigned int reserved;
+} ULL_CaptureFileHeader;
+
+typedef struct ULL_CaptureChunkHeader {
+    unsigned int magic;               // ULL_CAPTURE_CHUNK_MAGIC
+    unsigned int chunkIndex;
+    unsigned int usedBytes;           // Record bytes after this header
+    unsigned int recordCount;
+    double baseTime;                  // Seconds from startWorldTime; record times are offsets from it
+    double endTime;                   // Time of the chunk's last record
+} ULL_CaptureChunkHeader;
+
+typedef struct ULL_CaptureRecordHeader {
+    unsigned char type;               // ULL_CAPTURE_RECORD_*
+    unsigned char flags;              // ULL_CAPTURE_FLAG_*
+    unsigned short size;              // Whole record in bytes (multiple of 4)
+    unsigned int subjectId;
+} ULL_CaptureRecordHeader;
+
+typedef struct ULL_CaptureSubjectRecord {
+    ULL_CaptureRecordHeader header;
+    unsigned int timeOffsetUs;        // Microseconds after the chunk's baseTime
+    unsigned short role;              // ULL_CAPTURE_ROLE_*
+    unsigned short propertyCount;
+} ULL_CaptureSubjectRecord;
+
+typedef struct ULL_CaptureFrameRecord {
+    ULL_CaptureRecordHeader header;
+    unsigned int timeOffsetUs;        // Microseconds after the chunk's baseTime
+    float position[3];                // Offset from the chunk's key position (cm); 0 in a key frame
+    float rotation[4];                // Quaternion X, Y, Z, W
+} ULL_CaptureFrameRecord;
+
+typedef struct ULL_CaptureDataRecord {
+    ULL_CaptureRecordHeader header;
+    unsigned int timeOffsetUs;        // Microseconds after the chunk's baseTime
+} ULL_CaptureDataRecord;
+
+#pragma pack(pop)
+
+static_assert(sizeof(ULL_CaptureFileHeader) == 64, "ULL_CaptureFileHeader size must be 64 bytes (file format)");
+static_assert(sizeof(ULL_CaptureChunkHeader) == 32, "ULL_CaptureChunkHeader size must be 32 bytes (file format)");
+static_assert(sizeof(ULL_CaptureRecordHeader) == 8, "ULL_CaptureRecordHeader size must be 8 bytes (file format)");
+static_assert(sizeof(ULL_CaptureSubjectRecord) == 16, "ULL_CaptureSubjectRecord size must be 16 bytes (file format)");
+static_assert(sizeof(ULL_CaptureFrameRecord) == 40, "ULL_CaptureFrameRecord size must be 40 bytes (file format)");
+static_assert(sizeof(ULL_CaptureDataRecord) == 12, "ULL_CaptureDataRecord size must be 12 bytes (file format)");
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,17 +1,59 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include <atomic>
 
 DECLARE_LOG_CATEGORY_EXTERN(LogUnrealLiveLinkNative, Log, All);
 
+// Build flavor
+// The Production target (UnrealLiveLinkNativeProduction.Target.cs) defines ULL_PRODUCTION_BUILD=1
+#ifndef ULL_PRODUCTION_BUILD
+    #define ULL_PRODUCTION_BUILD 0
+#endif
+
+#if ULL_PRODUCTION_BUILD
+    #define ULL_BUILD_FLAVOR TEXT("Production")
+#else
+    #define ULL_BUILD_FLAVOR TEXT("Development")
+#endif
+
 // Verbose logging control
 // Set to 0 to disable verbose logs in production builds
 #ifndef ULL_ENABLE_VERBOSE_LOGGING
-    #define ULL_ENABLE_VERBOSE_LOGGING 1
+    #define ULL_ENABLE_VERBOSE_LOGGING !ULL_PRODUCTION_BUILD
 #endif
 
 #if ULL_ENABLE_VERBOSE_LOGGING
     #define ULL_VERBOSE_LOG(Format, ...) UE_LOG(LogUnrealLiveLinkNative, Verbose, Format, ##__VA_ARGS__)
 #else
     #define ULL_VERBOSE_LOG(Format, ...)
-#endif
\ No newline at end of file
+#endif
+
+// Hot-path logging control
+// Logs on per-frame paths (updates, IsConnected, remove, handle lookups). When disabled the
+// statement is removed entirely - no throttle counter, no branch, no FString conversion of
+// the arguments. Lifecycle and registration logs are unaffected.
+#ifndef ULL_ENABLE_HOT_PATH_LOGGING
+    #define ULL_ENABLE_HOT_PATH_LOGGING !ULL_PRODUCTION_BUILD
+#endif
+
+#if ULL_ENABLE_HOT_PATH_LOGGING
+    #define ULL_HOT_LOG(Verbosity, Format, ...) UE_LOG(LogUnrealLiveLinkNative, Verbosity, Format, ##__VA_ARGS__)
+
+    // Logs the 1st, 61st, 121st... call. Counter names this call's count, which the format
+    // arguments may reference (e.g. to print it). The function-local static behind it is
+    // atomic: hot paths run on several producer threads and the publish thread at once.
+    #define ULL_HOT_LOG_THROTTLED(Counter, Verbosity, Format, ...) \
+        do \
+        { \
+            static std::atomic<int32> Counter##Calls{0}; \
+            const int32 Counter = Counter##Calls.fetch_add(1, std::memory_order_relaxed) + 1; \
+            if (Counter % 60 == 1) \
+            { \
+                UE_LOG(LogUnrealLiveLinkNative, Verbosity, Format, ##__VA_ARGS__); \
+            } \
+        } while (0)
+#else
+    #define ULL_HOT_LOG(Verbosity, Format, ...) do { } while (0)
+    #define ULL_HOT_LOG_THROTTLED(Counter, Verbosity, Format, ...) do { } while (0)
+#endif
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <stddef.h>  // For offsetof macro
+
+// Pure C layout - no C++ types in this header
+// Shared by the writer (LiveLinkBridge, ULL_TRANSPORT_SHARED_MEMORY) and the reader
+// (Unreal plugin SimioLiveLinkSharedMemory, which keeps a mirrored copy of this file)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Shared-Memory Transport
+// =============================================================================
+// One named mapping per provider: ULL_SHM_NAME_PREFIX + provider name.
+//
+// The mapping is a latest-value table indexed by subject handle slot
+// (handle & 0xFFFFF), laid out as struct-of-arrays so a reader scanning many
+// subjects touches contiguous memory:
+//
+//   [ULL_SharedMemoryHeader]                        192 bytes
+//   sequence      uint64  [capacity]                seqlock per slot
+//   slots         ULL_SharedMemorySlot [capacity]   name, property count, static serial
+//   positions     double  [capacity * 3]            X, Y, Z (cm)
+//   rotations     double  [capacity * 4]            quaternion X, Y, Z, W
+//   scales        double  [capacity * 3]
+//   worldTimes    double  [capacity]                FPlatformTime::Seconds() of the frame (0 = no frame yet)
+//   properties    float   [capacity * maxProperties]
+//   propertyNames char    [capacity * maxProperties * ULL_SHM_PROPERTY_NAME_BYTES]
+//   propertyDirty uint64  [capacity * ULL_SHM_PROPERTY_MASK_WORDS(maxProperties)]
+//
+// Every array starts on a 64-byte boundary; the header holds the byte offsets.
+//
+// Seqlock protocol (single writer per mapping):
+//   writer: sequence[slot]++ (odd), write the slot's entries, sequence[slot]++ (even),
+//           then frameCounter++
+//   reader: s1 = sequence[slot] (skip if odd), copy, s2 = sequence[slot];
+//           the copy is valid only if s1 == s2
+// A slot whose sequence did not change since the last read has nothing new.
+// staticSerial changes when the slot is registered, re-registered or released;
+// readers re-read the name and property names (and resend static data) then.
+//
+// Changed properties: every write covers the whole slot and advances its
+// sequence by exactly 2. propertyDirty holds the properties the slot's last
+// write changed (bit i = property i, compared bitwise); the writer only stores
+// those values. A reader whose last valid copy of the slot was at sequence s and
+// that now reads s + 2 with the same staticSerial only needs the set bits. Any
+// other gap, a static change, or a mask with every word ~0 (the writer's
+// fallback when most values changed) means copying every property.
+// =============================================================================
+
+#define ULL_SHM_MAGIC                   0x534C4C55u   // "ULLS" (little-endian)
+#define ULL_SHM_VERSION                 2     // 2: propertyDirty masks
+
+#define ULL_SHM_NAME_PREFIX             "Local\\UnrealLiveLink_"
+
+#define ULL_SHM_SUBJECT_NAME_BYTES      64    // UTF-8 including terminator (longer names are not mirrored)
+#define ULL_SHM_PROPERTY_NAME_BYTES     32    // UTF-8 including terminator (longer names are not mirrored)
+
+#define ULL_SHM_DEFAULT_CAPACITY        16384 // Subject slots
+#define ULL_SHM_MAX_CAPACITY            (1 << 20)
+#define ULL_SHM_DEFAULT_MAX_PROPERTIES  16
+#define ULL_SHM_MAX_PROPERTIES          256
+
+#define ULL_SHM_PROPERTY_MASK_WORDS(maxProperties)  (((maxProperties) + 63) / 64)   // uint64 mask words per slot
+
+#define ULL_SHM_SLOT_FREE               -1    // ULL_SharedMemorySlot.propertyCount of an unused slot
+
+#define ULL_SHM_WRITER_CLOSED           0     // Writer shut down (readers remove their subjects)
+#define ULL_SHM_WRITER_ACTIVE           1
+
+#pragma pack(push, 8)
+
+typedef struct ULL_SharedMemoryHeader {
+    unsigned int magic;               // ULL_SHM_MAGIC
+    unsigned int version;             // ULL_SHM_VERSION
+    unsigned int headerSize;          // sizeof(ULL_SharedMemoryHeader)
+    unsigned int capacity;            // Subject slots
+    unsigned int maxProperties;       // Property values per slot
+    unsigned int slotHighWater;       // Readers only need to scan slots [0, slotHighWater)
+    int writerProcessId;
+    int writerState;                  // ULL_SHM_WRITER_*
+
+    unsigned long long sessionId;     // New value for every ULL_Initialize (readers drop cached subjects)
+    unsigned long long frameCounter;  // Incremented after every write (unchanged = nothing new)
+    double lastWriteTime;             // FPlatformTime::Seconds() of the last write
+    unsigned long long totalSize;     // Mapping size in bytes
+
+    // Byte offsets from the start of the mapping
+    unsigned long long sequenceOffset;
+    unsigned long long slotOffset;
+    unsigned long long positionOffset;
+    unsigned long long rotationOffset;
+    unsigned long long scaleOffset;
+    unsigned long long worldTimeOffset;
+    unsigned long long propertyOffset;
+    unsigned long long propertyNameOffset;
+    unsigned long long propertyDirtyOffset;
+
+    unsigned long long reserved[7];   // Zero; keeps the header a whole number of cache lines
+} ULL_SharedMemoryHeader;
+
+typedef struct ULL_SharedMemorySlot {
+    unsigned int staticSerial;        // Changes on register / re-register / release
+    int propertyCount;                // ULL_SHM_SLOT_FREE when unused
+    char name[ULL_SHM_SUBJECT_NAME_BYTES];  // UTF-8 subject name, null-terminated
+} ULL_SharedMemorySlot;
+
+#pragma pack(pop)
+
+static_assert(sizeof(ULL_SharedMemoryHeader) == 192, "ULL_SharedMemoryHeader size must be 192 bytes (reader layout)");
+static_assert(offsetof(ULL_SharedMemoryHeader, sessionId) == 32, "sessionId offset must be 32");
+static_assert(offsetof(ULL_SharedMemoryHeader, sequenceOffset) == 64, "sequenceOffset offset must be 64");
+static_assert(offsetof(ULL_SharedMemoryHeader, propertyDirtyOffset) == 128, "propertyDirtyOffset offset must be 128");
+static_assert(sizeof(ULL_SharedMemorySlot) == 72, "ULL_SharedMemorySlot size must be 72 bytes (reader layout)");
+
+#ifdef __cplusplus
+}
+#endif
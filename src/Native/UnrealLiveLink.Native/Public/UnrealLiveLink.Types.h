@@ -21,6 +21,26 @@ extern "C" {
 #define ULL_NOT_CONNECTED      -2    // Not connected to Unreal Engine
 #define ULL_NOT_INITIALIZED    -3    // LiveLink not initialized
 
+// =============================================================================
+// Subject Handles
+// =============================================================================
+// Returned by ULL_Register*H functions. Valid handles are >= 0; a negative
+// value is one of the error codes above. Handles stay valid until the subject
+// is removed or ULL_Shutdown is called.
+
+#define ULL_INVALID_HANDLE     -1    // Same value as ULL_ERROR
+
+// =============================================================================
+// Sessions
+// =============================================================================
+// ULL_CreateSession returns IDs > ULL_DEFAULT_SESSION. Each session has its own
+// provider, subject tables, lock and worker threads; handles and schema IDs are
+// only valid in the session that returned them. ULL_DEFAULT_SESSION passed to a
+// ULL_Session* function addresses the bridge ULL_Initialize set up.
+
+#define ULL_DEFAULT_SESSION     0    // The ULL_Initialize bridge
+#define ULL_MAX_SESSIONS       64    // Sessions alive at once (ULL_DEFAULT_SESSION not counted)
+
 // =============================================================================
 // API Version
 // =============================================================================
@@ -50,6 +70,325 @@ typedef struct ULL_Transform {
 
 #pragma pack(pop)
 
+// =============================================================================
+// Compact Transform Structure
+// =============================================================================
+// Optional 20-byte submission format for the ULL_UpdateObjectsBatchCompact*
+// calls (a quarter of ULL_Transform's P/Invoke bytes).
+//
+// Memory Layout:
+//   - Position: 3 floats x 4 bytes     = 12 bytes (centimeters)
+//   - Rotation: 3 unsigned shorts      =  6 bytes (smallest-three quaternion)
+//   - Flags:    1 unsigned short       =  2 bytes
+//   - Total:                             20 bytes
+//
+// Rotation (smallest-three): the largest-magnitude quaternion component is
+// dropped (its index in flags & ULL_COMPACT_LARGEST_MASK, sign made positive)
+// and the other three, each in [-1/sqrt(2), 1/sqrt(2)], are quantized in
+// X, Y, Z, W order skipping the dropped one:
+//   - 48-bit (default): rotation[k] = 16-bit value
+//   - 32-bit (ULL_COMPACT_ROTATION_32): rotation[0] | rotation[1] << 16 holds
+//     three 10-bit values (bits 0-9, 10-19, 20-29); rotation[2] is unused
+// Quantized q maps back to ((q / max) * 2 - 1) / sqrt(2), max = 65535 or 1023.
+//
+// Scale: unit unless ULL_COMPACT_HAS_SCALE is set; the scales of flagged
+// objects are passed separately, 3 floats each, in batch order (objects
+// without the flag take no space in that array).
+
+#define ULL_COMPACT_LARGEST_MASK    0x0003    // flags: index (0-3 = X, Y, Z, W) of the dropped component
+#define ULL_COMPACT_HAS_SCALE       0x0004    // flags: take the next scale triple from the scales array
+#define ULL_COMPACT_ROTATION_32     0x0008    // flags: rotation uses the 32-bit (3 x 10 bits) encoding
+
+#pragma pack(push, 4)
+
+typedef struct ULL_CompactTransform {
+    float position[3];              // X, Y, Z in centimeters (Unreal coordinate system)
+    unsigned short rotation[3];     // Smallest-three quaternion (see above)
+    unsigned short flags;           // ULL_COMPACT_*
+} ULL_CompactTransform;
+
+#pragma pack(pop)
+
+// =============================================================================
+// Simio Value Blocks
+// =============================================================================
+// Input of ULL_ConvertSimioTransforms / ULL_UpdateObjectsBatchSimioH: raw Simio
+// values for N objects as contiguous columns of N doubles (struct-of-arrays),
+// in this order:
+//
+//   [x][y][z]                     meters
+//   [rotX][rotY][rotZ]            degrees (heading, pitch, roll as passed to
+//                                 CoordinateConverter.SimioToUnrealTransform)
+//   [scaleX][scaleY][scaleZ]      only with ULL_SIMIO_TRANSFORM_COMPONENTS
+//
+// Column c of object i is values[c * count + i].
+
+#define ULL_SIMIO_POSE_COMPONENTS       6    // Position + rotation (unit scale)
+#define ULL_SIMIO_TRANSFORM_COMPONENTS  9    // Position + rotation + scale
+
+// =============================================================================
+// Initialization Options
+// =============================================================================
+// Passed to ULL_InitializeEx. structSize must be set to sizeof(ULL_InitOptions)
+// by the caller so fields can be appended in later versions without breaking
+// older callers (fields beyond structSize take their defaults).
+//
+// Memory Layout (version 9):
+//   - structSize, sendMode, queueDepth, queuePolicy: 4 × int32 = 16 bytes (version 1)
+//   - publishRateHz: int32 = 4 bytes (version 2, total 20 bytes)
+//   - deadbandEnabled, positionDeadband, rotationDeadbandDegrees, propertyDeadband,
+//     keepAliveIntervalMs: 2 × int32 + 3 × float = 20 bytes (version 3, total 40 bytes)
+//   - pumpRateHz: int32 = 4 bytes (version 4, total 44 bytes)
+//   - transport, sharedMemoryCapacity, sharedMemoryMaxProperties: 3 × int32 = 12 bytes
+//     (version 5, total 56 bytes)
+//   - simTimeScale, sceneFrameRate: float + int32 = 8 bytes (version 6, total 64 bytes)
+//   - subjectPoolSize: int32 = 4 bytes (version 7, total 68 bytes)
+//   - publishFrameBudget, publishByteBudget: 2 × int32 = 8 bytes (version 8, total 76 bytes)
+//   - initMode: int32 = 4 bytes (version 9, total 80 bytes)
+
+#define ULL_SEND_MODE_SYNC              0    // Update calls push to LiveLink inline (default)
+#define ULL_SEND_MODE_ASYNC             1    // Update calls enqueue; a worker thread pushes to LiveLink
+
+#define ULL_QUEUE_POLICY_DROP_OLDEST    0    // Full queue: discard the oldest frame (default; waits while a register/remove is oldest)
+#define ULL_QUEUE_POLICY_BLOCK          1    // Full queue: caller waits until the worker frees space
+
+#define ULL_DEFAULT_QUEUE_DEPTH      4096    // Frame records (rounded up to a power of two)
+
+#define ULL_PUBLISH_IMMEDIATE           0    // publishRateHz: send every update as it arrives (default)
+#define ULL_MAX_PUBLISH_RATE_HZ      1000    // publishRateHz upper bound
+
+#define ULL_DEFAULT_KEEPALIVE_MS     1000    // keepAliveIntervalMs when the deadband is enabled with 0
+
+#define ULL_DEFAULT_PUMP_RATE_HZ       60    // pumpRateHz 0 (and callers without the field)
+#define ULL_PUMP_DISABLED              -1    // pumpRateHz: no pump thread (one-shot ticker tick only)
+
+#define ULL_TRANSPORT_MESSAGE_BUS       0    // Transform frames go through ILiveLinkProvider / UdpMessaging (default)
+#define ULL_TRANSPORT_SHARED_MEMORY     1    // Transform frames go to a same-host mapped table (UnrealLiveLink.SharedMemory.h)
+
+#define ULL_DEFAULT_SCENE_FRAME_RATE   60    // sceneFrameRate 0 (and callers without the field)
+
+// Pool mode (subjectPoolSize > 0): transform subjects are pre-registered in pools of
+// subjectPoolSize per property schema, named ULL_POOL_SUBJECT_PREFIX + "<pool>_<index>".
+// Entities are bound to free pooled subjects on register and released ones are hidden
+// (zero scale, ULL_POOL_VISIBLE_PROPERTY = 0) instead of removed, so static data is sent
+// once per pooled subject. ULL_POOL_VISIBLE_PROPERTY is appended after the schema's
+// own properties and is 1 on every frame of a bound subject.
+#define ULL_POOL_DISABLED               0    // subjectPoolSize: register and remove subjects individually (default)
+#define ULL_MAX_POOL_SIZE           65536    // subjectPoolSize upper bound (pools grow by this many subjects)
+#define ULL_POOL_SUBJECT_PREFIX    "Pool"
+#define ULL_POOL_VISIBLE_PROPERTY  "Visible"
+
+// Update-rate tiers (coalescing mode, publishRateHz > 0): each subject has a priority and an
+// optional maximum rate (ULL_SetObjectScheduleH / ULL_SetSubjectSchedule). Each publish pass
+// sends the dirty subjects that are due, highest priority first and least recently published
+// first within a priority, until the publish budget is spent. Subjects over budget keep their
+// latest value for a later pass, so low-priority subjects degrade first.
+// publishByteBudget counts estimated Message Bus payload bytes (ULL_PUBLISH_FRAME_OVERHEAD_BYTES
+// + 80 per transform + 4 per property value).
+#define ULL_PRIORITY_HIGH               0
+#define ULL_PRIORITY_NORMAL             1    // Default for every subject
+#define ULL_PRIORITY_LOW                2
+#define ULL_RATE_UNLIMITED              0    // maxRateHz: publish on every pass the subject is dirty
+#define ULL_BUDGET_UNLIMITED            0    // publishFrameBudget / publishByteBudget: no limit (default)
+#define ULL_PUBLISH_FRAME_OVERHEAD_BYTES 128 // Per-frame estimate (subject name, timestamps, envelope)
+
+// Staged initialization (initMode = ULL_INIT_MODE_ASYNC): ULL_InitializeEx returns at once and
+// the engine runtime (GEngineLoop.PreInit, UObjects, UdpMessaging, plugins) comes up on the
+// engine thread, which stays alive as the game thread for the life of the process;
+// ULL_GetInitState reports progress. Until it is ready, registrations are tracked and each
+// subject's latest update is kept; the subjects are registered and their latest frames
+// published when the provider is created. The runtime stays up, so later runs initialize
+// without staging (a failed bring-up is retried on the same thread). ULL_Shutdown during
+// staging waits for the bring-up to finish. Pool mode and the shared-memory transport need
+// the runtime at registration and initialize synchronously.
+#define ULL_INIT_MODE_SYNC              0    // ULL_InitializeEx returns once the runtime and provider are up (default)
+#define ULL_INIT_MODE_ASYNC             1    // ULL_InitializeEx returns at once, the runtime is staged on the engine thread
+
+#define ULL_INIT_STATE_STAGING          1    // ULL_GetInitState: runtime coming up, updates are buffered
+#define ULL_INIT_STATE_READY            2    // Runtime up, provider created (or retried on registration)
+#define ULL_INIT_STATE_FAILED           3    // Runtime bring-up failed; updates are dropped until ULL_Shutdown
+
+#pragma pack(push, 4)
+
+typedef struct ULL_InitOptions {
+    int structSize;      // sizeof(ULL_InitOptions)
+    int sendMode;        // ULL_SEND_MODE_*
+    int queueDepth;      // Async queue capacity in frame records (0 = ULL_DEFAULT_QUEUE_DEPTH)
+    int queuePolicy;     // ULL_QUEUE_POLICY_*
+    int publishRateHz;   // > 0: keep only the latest frame per subject and publish dirty subjects at this rate
+    
+    // Change detection (deadband): skip frames that differ from the last sent frame by less than
+    // the thresholds. 0 thresholds suppress exact repeats only.
+    int deadbandEnabled;            // 0 = disabled (default), 1 = enabled
+    float positionDeadband;         // Centimeters
+    float rotationDeadbandDegrees;  // Quaternion angular distance in degrees
+    float propertyDeadband;         // Absolute difference per property value
+    int keepAliveIntervalMs;        // Resend unchanged subjects after this long (0 = ULL_DEFAULT_KEEPALIVE_MS)
+    
+    int pumpRateHz;      // Message Bus pump thread rate (0 = ULL_DEFAULT_PUMP_RATE_HZ, ULL_PUMP_DISABLED = off)
+    
+    // Same-host transport for transform subjects. Data subjects always use the Message Bus.
+    int transport;                  // ULL_TRANSPORT_*
+    int sharedMemoryCapacity;       // Subject slots (0 = ULL_SHM_DEFAULT_CAPACITY)
+    int sharedMemoryMaxProperties;  // Property values per subject (0 = ULL_SHM_DEFAULT_MAX_PROPERTIES)
+    
+    // Simulation-time frames (ULL_Update*AtTimeH): world time advances by simTime * simTimeScale
+    float simTimeScale;             // Playback seconds per simulation second (0 = 1.0)
+    int sceneFrameRate;             // FQualifiedFrameTime rate of the frame's scene time (0 = ULL_DEFAULT_SCENE_FRAME_RATE)
+    
+    int subjectPoolSize;            // Pooled subjects per property schema (ULL_POOL_DISABLED = pool mode off)
+    
+    // Publish budget shared by all subjects (coalescing mode only, see rate tiers above)
+    int publishFrameBudget;         // Frames per second (ULL_BUDGET_UNLIMITED = no limit)
+    int publishByteBudget;          // Estimated bytes per second (ULL_BUDGET_UNLIMITED = no limit)
+    
+    int initMode;                   // ULL_INIT_MODE_*
+} ULL_InitOptions;
+
+#pragma pack(pop)
+
+// =============================================================================
+// Pump Statistics
+// =============================================================================
+// Filled by ULL_GetPumpStats. Tick durations cover one FTSTicker::Tick call on
+// the pump thread; overrunCount counts ticks that took longer than the pump
+// interval (the following ticks are skipped rather than run back-to-back).
+//
+// Memory Layout:
+//   - tickCount, overrunCount: 2 × uint64 = 16 bytes
+//   - lastTickMs, maxTickMs, averageTickMs: 3 × double = 24 bytes
+//   - rateHz, running: 2 × int32 = 8 bytes
+//   - Total: 48 bytes
+
+typedef struct ULL_PumpStats {
+    unsigned long long tickCount;
+    unsigned long long overrunCount;
+    double lastTickMs;
+    double maxTickMs;
+    double averageTickMs;
+    int rateHz;          // Configured rate (0 when the pump is not running)
+    int running;         // 1 if the pump thread is running
+} ULL_PumpStats;
+
+// =============================================================================
+// Hot-Path Statistics
+// =============================================================================
+// Filled by ULL_GetStats, zeroed by ULL_ResetStats. Update counters are per
+// subject (a batch of N subjects counts N updates):
+//   received = sent + dropped + deadbandSuppressed + coalescedUpdates (+ pending)
+//              (+ interest-held, see ULL_GetInterestCounters)
+// "dropped" covers rejected updates (not initialized, no LiveLink source,
+// property count mismatch, stale handle); queueDropped counts frames evicted
+// from the async queue after they were sent to it.
+//
+// frameDataHistogram buckets ILiveLinkProvider::UpdateSubjectFrameData call
+// durations: bucket 0 is < 1 µs, bucket i is [2^(i-1), 2^i) µs and the last
+// bucket is everything from 2^(ULL_STATS_HISTOGRAM_BUCKETS-2) µs up.
+//
+// Memory Layout (natural alignment, no padding):
+//   - 19 × 8-byte counters/timings = 152 bytes
+//   - frameDataHistogram: 16 × uint64 = 128 bytes
+//   - 4 × int32 = 16 bytes
+//   - Total: 296 bytes
+
+#define ULL_STATS_HISTOGRAM_BUCKETS 16
+
+typedef struct ULL_Stats {
+    unsigned long long transformUpdatesReceived;
+    unsigned long long transformUpdatesSent;
+    unsigned long long transformUpdatesDropped;
+    unsigned long long dataUpdatesReceived;
+    unsigned long long dataUpdatesSent;
+    unsigned long long dataUpdatesDropped;
+    unsigned long long batchCalls;
+    
+    unsigned long long coalescedUpdates;     // Overwritten in the latest-value slot before publish
+    unsigned long long deadbandSuppressed;   // Unchanged frames not sent
+    unsigned long long queueDropped;         // Evicted by the async drop-oldest policy
+    
+    unsigned long long nameCacheHits;
+    unsigned long long nameCacheMisses;
+    
+    unsigned long long lockAcquisitions;     // Bridge lock taken by update calls
+    unsigned long long lockContentions;      // ...of which had to wait
+    double lockWaitTotalMs;
+    double lockWaitMaxMs;
+    
+    unsigned long long frameDataCalls;       // UpdateSubjectFrameData calls (any thread)
+    double frameDataTotalMs;
+    double frameDataMaxMs;
+    unsigned long long frameDataHistogram[ULL_STATS_HISTOGRAM_BUCKETS];
+    
+    int registeredTransformSubjects;
+    int registeredDataSubjects;
+    int nameCacheEntries;
+    int reserved;                            // Always 0 (keeps the size a multiple of 8)
+} ULL_Stats;
+
+// =============================================================================
+// Latency Probe Statistics
+// =============================================================================
+// Filled by ULL_GetLatencyStats while ULL_StartLatencyProbe runs. Each probe is
+// stamped with FPlatformTime::Seconds() at four points, giving one sample per
+// stage it completes:
+//   ENQUEUE  ULL_* entry -> bridge enqueue (lock wait, validation)
+//   SEND     bridge enqueue -> ILiveLinkProvider::UpdateSubjectFrameData
+//            (coalescing wait, async queue; 0 in synchronous mode)
+//   RECEIPT  provider send -> Unreal subject evaluation (UdpMessaging, Unreal tick)
+//   TOTAL    ULL_* entry -> Unreal subject evaluation
+// RECEIPT and TOTAL need the Unreal-side echo (UnrealLiveLink.LatencyProbe.h).
+// samples counts every sample since the probe started; the percentiles and the
+// maximum cover the latest ULL_LATENCY_WINDOW samples of the stage.
+//
+// Memory Layout (natural alignment, no padding):
+//   - ULL_LatencyStage: uint64 + 4 × double = 40 bytes
+//   - ULL_LatencyStats: 2 × uint64 + 4 stages = 176 bytes
+
+#define ULL_LATENCY_STAGE_ENQUEUE       0
+#define ULL_LATENCY_STAGE_SEND          1
+#define ULL_LATENCY_STAGE_RECEIPT       2
+#define ULL_LATENCY_STAGE_TOTAL         3
+#define ULL_LATENCY_STAGES              4
+
+#define ULL_LATENCY_WINDOW              1024  // Samples per stage behind the percentiles
+#define ULL_LATENCY_MAX_RATE_HZ         100   // Probes per second
+#define ULL_LATENCY_CSV_INTERVAL_SECONDS 1    // One CSV row per interval
+
+typedef struct ULL_LatencyStage {
+    unsigned long long samples;
+    double p50Ms;
+    double p90Ms;
+    double p99Ms;
+    double maxMs;
+} ULL_LatencyStage;
+
+typedef struct ULL_LatencyStats {
+    unsigned long long probesSent;           // Probes submitted through the update path
+    unsigned long long probesEchoed;         // ...of which the Unreal side reported evaluating
+    ULL_LatencyStage stages[ULL_LATENCY_STAGES];
+} ULL_LatencyStats;
+
+// =============================================================================
+// Interest Regions
+// =============================================================================
+// Set by ULL_SetInterestRegions / ULL_SessionSetInterestRegions. Axis-aligned
+// boxes in Unreal coordinates (centimeters, same space as ULL_Transform.position).
+// Transform subjects whose latest position is outside every region are sent at
+// outsideRateHz instead of on every update (ULL_INTEREST_SUPPRESS = held until
+// they enter a region). Data subjects and the shared-memory transport are not
+// filtered.
+//
+// Memory Layout:
+//   - min, max: 2 × 3 doubles = 48 bytes
+
+#define ULL_MAX_INTEREST_REGIONS       16    // Regions per session
+#define ULL_INTEREST_SUPPRESS           0    // outsideRateHz: send nothing for subjects outside every region
+
+typedef struct ULL_InterestRegion {
+    double min[3];       // Lower corner X, Y, Z (cm)
+    double max[3];       // Upper corner X, Y, Z (cm), >= min on every axis
+} ULL_InterestRegion;
+
 // =============================================================================
 // Compile-Time Validation
 // =============================================================================
@@ -63,6 +402,17 @@ static_assert(offsetof(ULL_Transform, position) == 0, "position offset must be 0
 static_assert(offsetof(ULL_Transform, rotation) == 24, "rotation offset must be 24");
 static_assert(offsetof(ULL_Transform, scale) == 56, "scale offset must be 56");
 
+static_assert(sizeof(ULL_CompactTransform) == 20, "ULL_CompactTransform size must be 20 bytes to match C# marshaling");
+static_assert(offsetof(ULL_CompactTransform, rotation) == 12, "compact rotation offset must be 12");
+static_assert(offsetof(ULL_CompactTransform, flags) == 18, "compact flags offset must be 18");
+
+static_assert(sizeof(ULL_InitOptions) == 80, "ULL_InitOptions size must be 80 bytes to match C# marshaling");
+static_assert(sizeof(ULL_PumpStats) == 48, "ULL_PumpStats size must be 48 bytes to match C# marshaling");
+static_assert(sizeof(ULL_Stats) == 296, "ULL_Stats size must be 296 bytes to match C# marshaling");
+static_assert(sizeof(ULL_LatencyStage) == 40, "ULL_LatencyStage size must be 40 bytes to match C# marshaling");
+static_assert(sizeof(ULL_LatencyStats) == 176, "ULL_LatencyStats size must be 176 bytes to match C# marshaling");
+static_assert(sizeof(ULL_InterestRegion) == 48, "ULL_InterestRegion size must be 48 bytes to match C# marshaling");
+
 #ifdef __cplusplus
 }
 #endif
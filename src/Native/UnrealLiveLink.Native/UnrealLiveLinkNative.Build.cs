@@ -20,6 +20,8 @@ public class UnrealLiveLinkNative : ModuleRules
             "LiveLinkInterface",            // LiveLink type definitions
             "LiveLinkMessageBusFramework",  // Message Bus framework
             "UdpMessaging",                 // Network transport
+            "Sockets",                      // Latency probe echo socket
+            "Networking",                   // FUdpSocketBuilder
         });
         
         // Add include paths for Program main includes
@@ -28,7 +30,8 @@ public class UnrealLiveLinkNative : ModuleRules
         // Export symbols for DLL
         PublicDefinitions.Add("ULL_API=__declspec(dllexport)");
         
-        // Optimize for shipping
-        OptimizeCode = CodeOptimization.InShippingBuildsOnly;
+        // Optimize for shipping; the Production target is fully optimized in every configuration
+        bool bProductionFlavor = Target.Name == "UnrealLiveLinkNativeProduction";
+        OptimizeCode = bProductionFlavor ? CodeOptimization.Always : CodeOptimization.InShippingBuildsOnly;
     }
 }
\ No newline at end of file
@@ -0,0 +1,21 @@
+using UnrealBuildTool;
+using System.Collections.Generic;
+
+// Production flavor of UnrealLiveLinkNative: same module, built as UnrealLiveLinkNativeProduction.dll
+// - ULL_PRODUCTION_BUILD=1 compiles out all per-frame logging (see UnrealLiveLink.Native.h)
+// - Module code is fully optimized in every configuration (UnrealLiveLinkNative.Build.cs)
+// Lifecycle and error logging stays on so field issues can still be diagnosed.
+[SupportedPlatforms(UnrealPlatformClass.Desktop)]
+public class UnrealLiveLinkNativeProductionTarget : UnrealLiveLinkNativeTarget
+{
+    public UnrealLiveLinkNativeProductionTarget(TargetInfo Target) : base(Target)
+    {
+        GlobalDefinitions.Add("ULL_PRODUCTION_BUILD=1");
+        
+        // No trace instrumentation in production
+        GlobalDefinitions.Remove("UE_TRACE_ENABLED=1");
+        GlobalDefinitions.Add("UE_TRACE_ENABLED=0");
+        
+        bUseChecksInShipping = false;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,382 @@
+#include "LiveLinkSharedMemorySource.h"
+#include "UnrealLiveLink.SharedMemory.h"
+#include "ILiveLinkClient.h"
+#include "LiveLinkTypes.h"
+#include "Roles/LiveLinkTransformRole.h"
+#include "Roles/LiveLinkTransformTypes.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimioLiveLinkSharedMemory, Log, All);
+
+#define LOCTEXT_NAMESPACE "LiveLinkSharedMemorySource"
+
+// Poll often enough that the table adds well under a frame of latency
+static constexpr float PollIntervalSeconds = 0.001f;
+
+// Mapping retry interval while Simio is not running
+static constexpr double ReopenIntervalSeconds = 0.5;
+
+//=============================================================================
+// LiveLinkSharedMemorySource Implementation
+//=============================================================================
+
+FLiveLinkSharedMemorySource::FLiveLinkSharedMemorySource(const FString& InProviderName)
+	: ProviderName(InProviderName)
+	, RegionName(FString(ANSI_TO_TCHAR(ULL_SHM_NAME_PREFIX)) + InProviderName)
+{
+}
+
+FLiveLinkSharedMemorySource::~FLiveLinkSharedMemorySource()
+{
+	RequestSourceShutdown();
+}
+
+void FLiveLinkSharedMemorySource::ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid)
+{
+	Client = InClient;
+	SourceGuid = InSourceGuid;
+
+	Thread = FRunnableThread::Create(this, TEXT("SimioLiveLinkSharedMemory"), 0, TPri_AboveNormal);
+
+	UE_LOG(LogSimioLiveLinkSharedMemory, Log,
+	       TEXT("Source: Watching '%s'"),
+	       *RegionName);
+}
+
+bool FLiveLinkSharedMemorySource::IsSourceStillValid() const
+{
+	// Stays valid while Simio is stopped so the next run reconnects by itself
+	return Thread != nullptr;
+}
+
+bool FLiveLinkSharedMemorySource::RequestSourceShutdown()
+{
+	if (Thread)
+	{
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+	return true;
+}
+
+FText FLiveLinkSharedMemorySource::GetSourceType() const
+{
+	return LOCTEXT("SourceType", "Simio Shared Memory");
+}
+
+FText FLiveLinkSharedMemorySource::GetSourceMachineName() const
+{
+	return FText::FromString(ProviderName);
+}
+
+FText FLiveLinkSharedMemorySource::GetSourceStatus() const
+{
+	if (!bConnected.load(std::memory_order_relaxed))
+	{
+		return LOCTEXT("Waiting", "Waiting for Simio");
+	}
+
+	return FText::Format(LOCTEXT("Connected", "{0} subjects, {1} ms"),
+	                     FText::AsNumber(SubjectCount.load(std::memory_order_relaxed)),
+	                     FText::AsNumber(LatencyMicroseconds.load(std::memory_order_relaxed) / 1000.0));
+}
+
+uint32 FLiveLinkSharedMemorySource::Run()
+{
+	while (!bStopping.load(std::memory_order_relaxed))
+	{
+		Poll();
+		FPlatformProcess::Sleep(PollIntervalSeconds);
+	}
+
+	RemoveAllSubjects();
+	CloseMapping();
+	return 0;
+}
+
+void FLiveLinkSharedMemorySource::Stop()
+{
+	bStopping.store(true, std::memory_order_relaxed);
+}
+
+bool FLiveLinkSharedMemorySource::TryOpen()
+{
+	// Map the header alone first: the full size is only known once it is readable
+	FPlatformMemory::FSharedMemoryRegion* HeaderRegion = FPlatformMemory::MapNamedSharedMemoryRegion(
+		RegionName, false, FPlatformMemory::ESharedMemoryAccess::Read, sizeof(ULL_SharedMemoryHeader));
+	if (!HeaderRegion)
+	{
+		return false;
+	}
+
+	ULL_SharedMemoryHeader Snapshot;
+	FMemory::Memcpy(&Snapshot, HeaderRegion->GetAddress(), sizeof(Snapshot));
+	FPlatformMemory::UnmapNamedSharedMemoryRegion(HeaderRegion);
+
+	if (Snapshot.magic != ULL_SHM_MAGIC || Snapshot.writerState != ULL_SHM_WRITER_ACTIVE)
+	{
+		return false;
+	}
+
+	if (Snapshot.version != ULL_SHM_VERSION || Snapshot.headerSize != sizeof(ULL_SharedMemoryHeader))
+	{
+		UE_LOG(LogSimioLiveLinkSharedMemory, Warning,
+		       TEXT("Source: '%s' has layout version %u, this plugin reads version %d"),
+		       *RegionName,
+		       Snapshot.version,
+		       ULL_SHM_VERSION);
+		return false;
+	}
+
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(
+		RegionName, false, FPlatformMemory::ESharedMemoryAccess::Read, (SIZE_T)Snapshot.totalSize);
+	if (!Region)
+	{
+		return false;
+	}
+
+	Base = static_cast<const uint8*>(Region->GetAddress());
+	Header = reinterpret_cast<const ULL_SharedMemoryHeader*>(Base);
+	SessionId = Snapshot.sessionId;
+	LastFrameCounter = 0;
+
+	SlotStates.Reset();
+	SlotStates.SetNum((int32)Snapshot.capacity);
+	PropertyNameScratch.Reserve((int32)Snapshot.maxProperties);
+	PropertyValueScratch.Reserve((int32)Snapshot.maxProperties);
+	DirtyIndexScratch.Reserve((int32)Snapshot.maxProperties);
+
+	bConnected.store(true, std::memory_order_relaxed);
+
+	UE_LOG(LogSimioLiveLinkSharedMemory, Log,
+	       TEXT("Source: Connected to '%s' (writer process %d, %u slots)"),
+	       *RegionName,
+	       Snapshot.writerProcessId,
+	       Snapshot.capacity);
+	return true;
+}
+
+void FLiveLinkSharedMemorySource::CloseMapping()
+{
+	if (Region)
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+		Region = nullptr;
+	}
+
+	Base = nullptr;
+	Header = nullptr;
+	SlotStates.Reset();
+	bConnected.store(false, std::memory_order_relaxed);
+}
+
+void FLiveLinkSharedMemorySource::Poll()
+{
+	if (!Region)
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now < NextOpenAttemptTime)
+		{
+			return;
+		}
+
+		NextOpenAttemptTime = Now + ReopenIntervalSeconds;
+		if (!TryOpen())
+		{
+			return;
+		}
+	}
+
+	// Writer shut down or a new ULL_Initialize reused the mapping: drop everything and reattach
+	if (Header->magic != ULL_SHM_MAGIC || Header->writerState != ULL_SHM_WRITER_ACTIVE || Header->sessionId != SessionId)
+	{
+		UE_LOG(LogSimioLiveLinkSharedMemory, Log,
+		       TEXT("Source: '%s' writer closed or restarted, removing %d subjects"),
+		       *RegionName,
+		       SubjectCount.load(std::memory_order_relaxed));
+
+		RemoveAllSubjects();
+		CloseMapping();
+		NextOpenAttemptTime = 0.0;
+		return;
+	}
+
+	// Nothing was written since the last poll
+	const uint64 FrameCounter = Header->frameCounter;
+	if (FrameCounter == LastFrameCounter)
+	{
+		return;
+	}
+	LastFrameCounter = FrameCounter;
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	const int32 SlotCount = FMath::Min((int32)Header->slotHighWater, SlotStates.Num());
+	for (int32 Slot = 0; Slot < SlotCount; Slot++)
+	{
+		ReadSlot(Slot);
+	}
+
+	LatencyMicroseconds.store((int32)((FPlatformTime::Seconds() - Header->lastWriteTime) * 1000000.0), std::memory_order_relaxed);
+}
+
+void FLiveLinkSharedMemorySource::ReadSlot(int32 Slot)
+{
+	const std::atomic<uint64>* Sequences = At<std::atomic<uint64>>(Header->sequenceOffset);
+	FSlotState& State = SlotStates[Slot];
+
+	const uint64 SequenceBefore = Sequences[Slot].load(std::memory_order_acquire);
+	if (SequenceBefore == State.LastSequence || (SequenceBefore & 1) != 0)
+	{
+		// Unchanged, or mid-write (picked up on the next poll)
+		return;
+	}
+
+	// Copy everything out before acting on any of it
+	const ULL_SharedMemorySlot& Info = At<ULL_SharedMemorySlot>(Header->slotOffset)[Slot];
+	const uint32 StaticSerial = Info.staticSerial;
+	const int32 PropertyCount = FMath::Min(Info.propertyCount, (int32)Header->maxProperties);
+	const bool bStaticChanged = StaticSerial != State.StaticSerial;
+
+	ANSICHAR Name[ULL_SHM_SUBJECT_NAME_BYTES];
+	FMemory::Memcpy(Name, Info.name, sizeof(Name));
+	Name[ULL_SHM_SUBJECT_NAME_BYTES - 1] = '\0';
+
+	TArray<FString> PropertyNameStrings;
+	if (bStaticChanged && PropertyCount > 0)
+	{
+		const ANSICHAR* SlotPropertyNames = At<ANSICHAR>(Header->propertyNameOffset) + (uint64)Slot * Header->maxProperties * ULL_SHM_PROPERTY_NAME_BYTES;
+		for (int32 i = 0; i < PropertyCount; i++)
+		{
+			ANSICHAR PropertyName[ULL_SHM_PROPERTY_NAME_BYTES];
+			FMemory::Memcpy(PropertyName, SlotPropertyNames + i * ULL_SHM_PROPERTY_NAME_BYTES, sizeof(PropertyName));
+			PropertyName[ULL_SHM_PROPERTY_NAME_BYTES - 1] = '\0';
+			PropertyNameStrings.Add(UTF8_TO_TCHAR(PropertyName));
+		}
+	}
+
+	const double* Position = At<double>(Header->positionOffset) + (uint64)Slot * 3;
+	const double* Rotation = At<double>(Header->rotationOffset) + (uint64)Slot * 4;
+	const double* Scale = At<double>(Header->scaleOffset) + (uint64)Slot * 3;
+	const FVector Location(Position[0], Position[1], Position[2]);
+	const FQuat Quaternion(Rotation[0], Rotation[1], Rotation[2], Rotation[3]);
+	const FVector Scale3D(Scale[0], Scale[1], Scale[2]);
+	const double WorldTime = At<double>(Header->worldTimeOffset)[Slot];
+
+	// Each write advances the sequence by 2: exactly one write past our last copy
+	// means the dirty mask covers everything that changed since then
+	const float* SlotProperties = At<float>(Header->propertyOffset) + (uint64)Slot * Header->maxProperties;
+	const uint32 MaskWords = ULL_SHM_PROPERTY_MASK_WORDS(Header->maxProperties);
+	const uint64* SlotDirty = At<uint64>(Header->propertyDirtyOffset) + (uint64)Slot * MaskWords;
+	bool bSparse = !bStaticChanged && SequenceBefore == State.LastSequence + 2 && State.PropertyValues.Num() == PropertyCount;
+	if (bSparse)
+	{
+		bool bAllDirty = true;
+		for (uint32 Word = 0; Word < MaskWords; Word++)
+		{
+			bAllDirty = bAllDirty && SlotDirty[Word] == ~0ull;
+		}
+		bSparse = !bAllDirty;
+	}
+
+	DirtyIndexScratch.Reset();
+	PropertyValueScratch.Reset();
+	if (bSparse)
+	{
+		for (int32 Index = 0; Index < PropertyCount; Index++)
+		{
+			if (SlotDirty[Index / 64] & (1ull << (Index % 64)))
+			{
+				DirtyIndexScratch.Add(Index);
+				PropertyValueScratch.Add(SlotProperties[Index]);
+			}
+		}
+	}
+	else if (PropertyCount > 0)
+	{
+		PropertyValueScratch.SetNumUninitialized(PropertyCount, EAllowShrinking::No);
+		FMemory::Memcpy(PropertyValueScratch.GetData(), SlotProperties, PropertyCount * sizeof(float));
+	}
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (Sequences[Slot].load(std::memory_order_relaxed) != SequenceBefore)
+	{
+		// Torn read: the writer touched the slot while we copied, retry on the next poll
+		return;
+	}
+	State.LastSequence = SequenceBefore;
+
+	if (bSparse)
+	{
+		for (int32 i = 0; i < DirtyIndexScratch.Num(); i++)
+		{
+			State.PropertyValues[DirtyIndexScratch[i]] = PropertyValueScratch[i];
+		}
+	}
+	else
+	{
+		State.PropertyValues = PropertyValueScratch;
+	}
+
+	if (bStaticChanged)
+	{
+		State.StaticSerial = StaticSerial;
+
+		if (!State.SubjectName.IsNone())
+		{
+			Client->RemoveSubject_AnyThread(FLiveLinkSubjectKey(SourceGuid, State.SubjectName));
+			State.SubjectName = NAME_None;
+			SubjectCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		if (PropertyCount == ULL_SHM_SLOT_FREE)
+		{
+			return;
+		}
+
+		State.SubjectName = FName(UTF8_TO_TCHAR(Name));
+		State.PropertyCount = PropertyCount;
+
+		PropertyNameScratch.Reset();
+		for (const FString& PropertyName : PropertyNameStrings)
+		{
+			PropertyNameScratch.Add(FName(*PropertyName));
+		}
+
+		FLiveLinkStaticDataStruct StaticData(FLiveLinkTransformStaticData::StaticStruct());
+		StaticData.Cast<FLiveLinkTransformStaticData>()->PropertyNames = PropertyNameScratch;
+		Client->PushSubjectStaticData_AnyThread(FLiveLinkSubjectKey(SourceGuid, State.SubjectName), ULiveLinkTransformRole::StaticClass(), MoveTemp(StaticData));
+		SubjectCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Registered but no frame written yet
+	if (State.SubjectName.IsNone() || WorldTime <= 0.0)
+	{
+		return;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkTransformFrameData::StaticStruct());
+	FLiveLinkTransformFrameData* TransformFrameData = FrameData.Cast<FLiveLinkTransformFrameData>();
+	TransformFrameData->Transform = FTransform(Quaternion, Location, Scale3D);
+	TransformFrameData->WorldTime = FLiveLinkWorldTime(WorldTime);
+	TransformFrameData->PropertyValues = State.PropertyValues;
+	Client->PushSubjectFrameData_AnyThread(FLiveLinkSubjectKey(SourceGuid, State.SubjectName), MoveTemp(FrameData));
+}
+
+void FLiveLinkSharedMemorySource::RemoveAllSubjects()
+{
+	for (FSlotState& State : SlotStates)
+	{
+		if (!State.SubjectName.IsNone())
+		{
+			Client->RemoveSubject_AnyThread(FLiveLinkSubjectKey(SourceGuid, State.SubjectName));
+			State.SubjectName = NAME_None;
+		}
+	}
+	SubjectCount.store(0, std::memory_order_relaxed);
+}
+
+#undef LOCTEXT_NAMESPACE
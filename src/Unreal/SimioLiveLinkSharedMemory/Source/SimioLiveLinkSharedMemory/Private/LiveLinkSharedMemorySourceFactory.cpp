@@ -0,0 +1,26 @@
+#include "LiveLinkSharedMemorySourceFactory.h"
+#include "LiveLinkSharedMemorySource.h"
+
+#define LOCTEXT_NAMESPACE "LiveLinkSharedMemorySourceFactory"
+
+// Matches LiveLinkConfiguration.SourceName's default on the Simio side
+static const TCHAR* DefaultProviderName = TEXT("SimioSimulation");
+
+FText ULiveLinkSharedMemorySourceFactory::GetSourceDisplayName() const
+{
+	return LOCTEXT("SourceDisplayName", "Simio Shared Memory");
+}
+
+FText ULiveLinkSharedMemorySourceFactory::GetSourceTooltip() const
+{
+	return LOCTEXT("SourceTooltip", "Reads Simio objects from shared memory when Simio runs on this machine with 'Use Shared Memory Transport' enabled");
+}
+
+TSharedPtr<ILiveLinkSource> ULiveLinkSharedMemorySourceFactory::CreateSource(const FString& ConnectionString) const
+{
+	// Presets store the provider name as the connection string; the menu entry passes an empty one
+	const FString ProviderName = ConnectionString.IsEmpty() ? FString(DefaultProviderName) : ConnectionString;
+	return MakeShared<FLiveLinkSharedMemorySource>(ProviderName);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,159 @@
+#include "SimioLatencyProbeEcho.h"
+#include "UnrealLiveLink.LatencyProbe.h"
+#include "ILiveLinkClient.h"
+#include "LiveLinkTypes.h"
+#include "Roles/LiveLinkTransformRole.h"
+#include "Roles/LiveLinkTransformTypes.h"
+#include "Features/IModularFeatures.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Common/UdpSocketBuilder.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimioLatencyProbeEcho, Log, All);
+
+static TAutoConsoleVariable<int32> CVarLatencyProbeEchoPort(
+	TEXT("Simio.LatencyProbe.EchoPort"),
+	0,
+	TEXT("UDP port of the Simio connector's latency probe (ULL_StartLatencyProbe echoPort, default 6670). 0 = echo off."));
+
+static TAutoConsoleVariable<FString> CVarLatencyProbeEchoHost(
+	TEXT("Simio.LatencyProbe.EchoHost"),
+	TEXT("127.0.0.1"),
+	TEXT("Address of the machine running Simio, for latency probe echoes."));
+
+// Interpolated evaluations fall between two sequence numbers; only whole ones are echoed
+static constexpr double SequenceTolerance = 0.001;
+
+//=============================================================================
+// SimioLatencyProbeEcho Implementation
+//=============================================================================
+
+FSimioLatencyProbeEcho::FSimioLatencyProbeEcho()
+	: ProbeSubjectName(ULL_LATENCY_PROBE_SUBJECT)
+{
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FSimioLatencyProbeEcho::Tick));
+}
+
+FSimioLatencyProbeEcho::~FSimioLatencyProbeEcho()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	CloseSocket();
+}
+
+bool FSimioLatencyProbeEcho::Tick(float DeltaTime)
+{
+	if (!UpdateSocket())
+	{
+		return true;
+	}
+
+	IModularFeatures& ModularFeatures = IModularFeatures::Get();
+	if (!ModularFeatures.IsModularFeatureAvailable(ILiveLinkClient::ModularFeatureName))
+	{
+		return true;
+	}
+
+	ILiveLinkClient& Client = ModularFeatures.GetModularFeature<ILiveLinkClient>(ILiveLinkClient::ModularFeatureName);
+	FLiveLinkSubjectFrameData Frame;
+	if (!Client.EvaluateFrame_AnyThread(FLiveLinkSubjectName(ProbeSubjectName), ULiveLinkTransformRole::StaticClass(), Frame))
+	{
+		return true;
+	}
+
+	const double ReceiptSeconds = FPlatformTime::Seconds();
+	const FLiveLinkTransformFrameData* FrameData = Frame.FrameData.Cast<FLiveLinkTransformFrameData>();
+	if (!FrameData)
+	{
+		return true;
+	}
+
+	const double Encoded = FrameData->Transform.GetTranslation().X;
+	const double Rounded = FMath::RoundToDouble(Encoded);
+	if (Rounded < 1.0 || FMath::Abs(Encoded - Rounded) > SequenceTolerance)
+	{
+		return true;
+	}
+
+	// A restarted probe counts from 1 again, so any change is a new probe
+	const uint64 Sequence = (uint64)Rounded;
+	if (Sequence == LastSequence)
+	{
+		return true;
+	}
+	LastSequence = Sequence;
+
+	ULL_LatencyEcho Echo;
+	Echo.magic = ULL_LATENCY_ECHO_MAGIC;
+	Echo.version = ULL_LATENCY_ECHO_VERSION;
+	Echo.sequence = Sequence;
+	Echo.receiptSeconds = ReceiptSeconds;
+
+	int32 BytesSent = 0;
+	Socket->SendTo(reinterpret_cast<const uint8*>(&Echo), sizeof(Echo), BytesSent, *EchoAddress);
+	return true;
+}
+
+bool FSimioLatencyProbeEcho::UpdateSocket()
+{
+	const int32 Port = CVarLatencyProbeEchoPort.GetValueOnGameThread();
+	const FString Host = CVarLatencyProbeEchoHost.GetValueOnGameThread();
+	if (Port == EchoPort && Host == EchoHost)
+	{
+		// Unchanged: a failed address is not retried (or logged) every tick
+		return Socket != nullptr;
+	}
+
+	CloseSocket();
+	EchoPort = Port;
+	EchoHost = Host;
+	LastSequence = 0;
+
+	if (Port <= 0 || Port > 65535)
+	{
+		UE_LOG(LogSimioLatencyProbeEcho, Log, TEXT("Echo: Off"));
+		return false;
+	}
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	EchoAddress = SocketSubsystem->CreateInternetAddr();
+	bool bValidHost = false;
+	EchoAddress->SetIp(*Host, bValidHost);
+	EchoAddress->SetPort(Port);
+	if (!bValidHost)
+	{
+		UE_LOG(LogSimioLatencyProbeEcho, Error, TEXT("Echo: ❌ Invalid host '%s'"), *Host);
+		EchoAddress.Reset();
+		return false;
+	}
+
+	Socket = FUdpSocketBuilder(TEXT("SimioLatencyProbeEcho"))
+		.AsNonBlocking()
+		.Build();
+	if (!Socket)
+	{
+		UE_LOG(LogSimioLatencyProbeEcho, Error, TEXT("Echo: ❌ Failed to create socket"));
+		EchoAddress.Reset();
+		return false;
+	}
+
+	UE_LOG(LogSimioLatencyProbeEcho, Log,
+	       TEXT("Echo: ✅ Echoing '%s' to %s:%d"),
+	       *ProbeSubjectName.ToString(),
+	       *Host,
+	       Port);
+	return true;
+}
+
+void FSimioLatencyProbeEcho::CloseSocket()
+{
+	if (Socket)
+	{
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		Socket = nullptr;
+	}
+	EchoAddress.Reset();
+}
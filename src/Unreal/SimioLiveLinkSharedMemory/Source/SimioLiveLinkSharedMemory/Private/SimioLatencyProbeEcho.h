@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class FSocket;
+class FInternetAddr;
+
+//=============================================================================
+// Simio Latency Probe Echo
+//=============================================================================
+// Unreal side of UnrealLiveLinkNative's ULL_StartLatencyProbe (wire format in
+// UnrealLiveLink.LatencyProbe.h). Every engine tick it evaluates the probe
+// subject through ILiveLinkClient, the way an animated actor would, and sends
+// one ULL_LatencyEcho datagram per new sequence number back to the probe.
+//
+// - Off until Simio.LatencyProbe.EchoPort is set (the port passed to
+//   ULL_StartLatencyProbe, default 6670); Simio.LatencyProbe.EchoHost is the
+//   Simio machine (default 127.0.0.1)
+// - Receipt times include the wait for the next engine tick, which is part of
+//   the lag a viewer sees
+//=============================================================================
+
+/// <summary>
+/// Core ticker that echoes probe subject evaluations to the Simio connector
+/// </summary>
+class FSimioLatencyProbeEcho
+{
+public:
+	FSimioLatencyProbeEcho();
+	~FSimioLatencyProbeEcho();
+
+private:
+	bool Tick(float DeltaTime);
+
+	/// <summary>
+	/// (Re)create the socket when the console variables change
+	/// </summary>
+	/// <returns>false while the echo is off or the host is invalid</returns>
+	bool UpdateSocket();
+
+	void CloseSocket();
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	FSocket* Socket = nullptr;
+	TSharedPtr<FInternetAddr> EchoAddress;
+	int32 EchoPort = 0;
+	FString EchoHost;
+
+	FName ProbeSubjectName;
+	uint64 LastSequence = 0;
+};
@@ -0,0 +1,23 @@
+#include "Modules/ModuleManager.h"
+#include "SimioLatencyProbeEcho.h"
+
+// ULiveLinkSharedMemorySourceFactory is found by the LiveLink panel through reflection;
+// the module only owns the latency probe echo (off until Simio.LatencyProbe.EchoPort is set)
+class FSimioLiveLinkSharedMemoryModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override
+	{
+		LatencyProbeEcho = MakeUnique<FSimioLatencyProbeEcho>();
+	}
+
+	virtual void ShutdownModule() override
+	{
+		LatencyProbeEcho.Reset();
+	}
+
+private:
+	TUniquePtr<FSimioLatencyProbeEcho> LatencyProbeEcho;
+};
+
+IMPLEMENT_MODULE(FSimioLiveLinkSharedMemoryModule, SimioLiveLinkSharedMemory)
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stddef.h>  // For offsetof macro
+
+// Pure C layout - no C++ types in this header
+// Shared by the probe (LiveLinkBridge, ULL_StartLatencyProbe) and the echo
+// (Unreal plugin SimioLiveLinkSharedMemory, which keeps a mirrored copy of this file)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// Latency Probe Wire Format
+// =============================================================================
+// The probe is a transform subject without properties, ULL_LATENCY_PROBE_SUBJECT,
+// sent through the same path as the model's subjects. Its translation X holds the
+// probe sequence number (1, 2, 3, ...; Y and Z are 0, rotation and scale identity).
+//
+// The Unreal-side echo evaluates the subject every engine tick. When it sees a
+// new sequence number it sends one ULL_LatencyEcho datagram (UDP, little-endian)
+// to the probe's echo port. receiptSeconds is FPlatformTime::Seconds() at the
+// evaluation, the same clock the bridge stamps with, so the receipt stage is exact
+// when Unreal runs on the Simio machine; across machines it includes the offset
+// between their clocks.
+// =============================================================================
+
+#define ULL_LATENCY_PROBE_SUBJECT       "SimioLatencyProbe"
+
+#define ULL_LATENCY_ECHO_MAGIC          0x454C4C55u   // "ULLE" (little-endian)
+#define ULL_LATENCY_ECHO_VERSION        1
+#define ULL_LATENCY_ECHO_DEFAULT_PORT   6670
+
+#pragma pack(push, 8)
+
+typedef struct ULL_LatencyEcho {
+    unsigned int magic;               // ULL_LATENCY_ECHO_MAGIC
+    unsigned int version;             // ULL_LATENCY_ECHO_VERSION
+    unsigned long long sequence;      // Probe sequence number evaluated
+    double receiptSeconds;            // FPlatformTime::Seconds() on the Unreal side at evaluation
+} ULL_LatencyEcho;
+
+#pragma pack(pop)
+
+static_assert(sizeof(ULL_LatencyEcho) == 24, "ULL_LatencyEcho size must be 24 bytes (echo layout)");
+static_assert(offsetof(ULL_LatencyEcho, sequence) == 8, "sequence offset must be 8");
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ILiveLinkSource.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+
+class ILiveLinkClient;
+class FRunnableThread;
+struct ULL_SharedMemoryHeader;
+
+//=============================================================================
+// LiveLink Shared Memory Source
+//=============================================================================
+// Reader side of UnrealLiveLinkNative's ULL_TRANSPORT_SHARED_MEMORY: polls the
+// provider's mapping (layout in UnrealLiveLink.SharedMemory.h) on its own
+// thread and pushes changed slots to LiveLink as transform subjects.
+//
+// - Only slots whose seqlock sequence changed since the last poll are copied
+// - When no write was missed, only the properties in the slot's propertyDirty
+//   mask are copied; the rest keep the values this source already holds
+// - staticSerial changes (register / re-register / release) resend static data
+//   or remove the subject
+// - A new writer session or a closed writer removes every subject; the source
+//   keeps retrying the mapping until Simio initializes again
+//=============================================================================
+
+/// <summary>
+/// LiveLink source fed from the Simio connector's shared-memory table
+/// </summary>
+class SIMIOLIVELINKSHAREDMEMORY_API FLiveLinkSharedMemorySource : public ILiveLinkSource, public FRunnable
+{
+public:
+	/// <param name="InProviderName">Provider name passed to ULL_Initialize (mapping is ULL_SHM_NAME_PREFIX + name)</param>
+	explicit FLiveLinkSharedMemorySource(const FString& InProviderName);
+	virtual ~FLiveLinkSharedMemorySource() override;
+
+	// ILiveLinkSource
+	virtual void ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid) override;
+	virtual bool IsSourceStillValid() const override;
+	virtual bool RequestSourceShutdown() override;
+	virtual FText GetSourceType() const override;
+	virtual FText GetSourceMachineName() const override;
+	virtual FText GetSourceStatus() const override;
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	/// <summary>
+	/// What this source last pushed for one slot
+	/// </summary>
+	struct FSlotState
+	{
+		uint64 LastSequence = 0;      // 0 = never read (a written slot is always >= 2)
+		uint32 StaticSerial = 0;
+		int32 PropertyCount = 0;
+		FName SubjectName;            // NAME_None = no subject pushed for this slot
+		TArray<float> PropertyValues; // Slot's property values as of LastSequence
+	};
+
+	bool TryOpen();
+	void CloseMapping();
+	void Poll();
+	void ReadSlot(int32 Slot);
+	void RemoveAllSubjects();
+
+	template<typename T>
+	const T* At(uint64 Offset) const { return reinterpret_cast<const T*>(Base + Offset); }
+
+	FString ProviderName;
+	FString RegionName;
+
+	ILiveLinkClient* Client = nullptr;
+	FGuid SourceGuid;
+
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bStopping{false};
+
+	// Mapping (reader thread only)
+	FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+	const uint8* Base = nullptr;
+	const ULL_SharedMemoryHeader* Header = nullptr;
+	uint64 SessionId = 0;
+	uint64 LastFrameCounter = 0;
+	double NextOpenAttemptTime = 0.0;
+	TArray<FSlotState> SlotStates;
+	TArray<FName> PropertyNameScratch;
+	TArray<float> PropertyValueScratch;
+	TArray<int32> DirtyIndexScratch;
+
+	// Status shown in the LiveLink panel (written by the reader thread)
+	std::atomic<bool> bConnected{false};
+	std::atomic<int32> SubjectCount{0};
+	std::atomic<int32> LatencyMicroseconds{0};
+};
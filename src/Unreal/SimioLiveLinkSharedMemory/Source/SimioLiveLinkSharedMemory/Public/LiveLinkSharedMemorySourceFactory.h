@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LiveLinkSourceFactory.h"
+#include "LiveLinkSharedMemorySourceFactory.generated.h"
+
+/// <summary>
+/// Adds "Simio Shared Memory" to the LiveLink panel's Add Source menu.
+/// The connection string is the Simio provider name (Source Name property), default "SimioSimulation".
+/// </summary>
+UCLASS()
+class SIMIOLIVELINKSHAREDMEMORY_API ULiveLinkSharedMemorySourceFactory : public ULiveLinkSourceFactory
+{
+	GENERATED_BODY()
+
+public:
+	virtual FText GetSourceDisplayName() const override;
+	virtual FText GetSourceTooltip() const override;
+	virtual EMenuType GetMenuType() const override { return EMenuType::MenuEntry; }
+	virtual TSharedPtr<ILiveLinkSource> CreateSource(const FString& ConnectionString) const override;
+};
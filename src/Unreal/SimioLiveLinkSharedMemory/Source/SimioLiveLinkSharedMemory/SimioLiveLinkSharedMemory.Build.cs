@@ -0,0 +1,22 @@
+using UnrealBuildTool;
+
+public class SimioLiveLinkSharedMemory : ModuleRules
+{
+    public SimioLiveLinkSharedMemory(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+        
+        PublicDependencyModuleNames.AddRange(new string[] 
+        {
+            "Core",
+            "CoreUObject",
+            "LiveLinkInterface",            // ILiveLinkSource, ULiveLinkSourceFactory, transform role
+        });
+        
+        PrivateDependencyModuleNames.AddRange(new string[] 
+        {
+            "Sockets",                      // Latency probe echo (UDP)
+            "Networking",                   // FUdpSocketBuilder
+        });
+    }
+}
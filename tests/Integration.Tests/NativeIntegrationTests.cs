@@ -2,6 +2,7 @@ using Microsoft.VisualStudio.TestTools.UnitTesting;
 using SimioUnrealEngineLiveLinkConnector.UnrealIntegration;
 using System;
 using System.IO;
+using System.Linq;
 using System.Runtime.InteropServices;
 
 namespace SimioUnrealEngineLiveLinkConnector.Integration.Tests
@@ -86,6 +87,33 @@ namespace SimioUnrealEngineLiveLinkConnector.Integration.Tests
             // Individual test cleanup if needed
         }
 
+        /// <summary>
+        /// Update handles from several threads at once. Producer p owns every handle whose index
+        /// modulo producerCount is p, so neighbouring slots (and their ingest shard) are shared;
+        /// pass u writes position (u, index, 0), so the latest value has X = updateCount - 1.
+        /// </summary>
+        private static void RunConcurrentProducers(int[] handles, int producerCount, int updateCount)
+        {
+            using (var startLine = new System.Threading.Barrier(producerCount))
+            {
+                var producers = Enumerable.Range(0, producerCount).Select(producer => new System.Threading.Thread(() =>
+                {
+                    startLine.SignalAndWait();
+                    for (int update = 0; update < updateCount; update++)
+                    {
+                        for (int index = producer; index < handles.Length; index += producerCount)
+                        {
+                            var transform = ULL_Transform.Create(update, index, 0.0, 0.0, 0.0, 0.0, 1.0);
+                            UnrealLiveLinkNative.ULL_UpdateObjectH(handles[index], ref transform);
+                        }
+                    }
+                })).ToArray();
+
+                foreach (var producer in producers) { producer.Start(); }
+                foreach (var producer in producers) { producer.Join(); }
+            }
+        }
+
         #endregion
 
         #region 1. DLL Loading & Availability Tests
@@ -243,6 +271,212 @@ namespace SimioUnrealEngineLiveLinkConnector.Integration.Tests
             _isInitialized = false;
         }
 
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Lifecycle")]
+        [TestCategory("AsyncSend")]
+        public void InitializeEx_AsyncSendMode_ShouldAcceptUpdatesAndFlushOnShutdown()
+        {
+            // Arrange - Start from a clean state so the options are applied
+            UnrealLiveLinkNative.ULL_Shutdown();
+            var options = ULL_InitOptions.Create(LiveLinkSendMode.Asynchronous, 64, LiveLinkQueuePolicy.DropOldest);
+            var transform = ULL_Transform.Create(100.0, 200.0, 300.0, 0.0, 0.0, 0.0, 1.0);
+
+            // Act - Submit more frames than the queue holds to exercise drop-oldest
+            int initResult = UnrealLiveLinkNative.ULL_InitializeEx(_testProviderName ?? "TestProvider", ref options);
+            _isInitialized = (initResult == UnrealLiveLinkNative.ULL_OK);
+            UnrealLiveLinkNative.ULL_RegisterObject("AsyncSendObject");
+            for (int i = 0; i < 256; i++)
+            {
+                UnrealLiveLinkNative.ULL_UpdateObject("AsyncSendObject", ref transform);
+            }
+            UnrealLiveLinkNative.ULL_RemoveObject("AsyncSendObject");
+
+            // Assert - Initialization succeeded and shutdown drains the worker without crashing
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, initResult, "InitializeEx should succeed with async options");
+            UnrealLiveLinkNative.ULL_Shutdown();
+            _isInitialized = false;
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Lifecycle")]
+        [TestCategory("AsyncInit")]
+        public void InitializeEx_AsyncInitMode_ShouldBufferUpdatesUntilReady()
+        {
+            // Arrange - Start from a clean state so the options are applied
+            UnrealLiveLinkNative.ULL_Shutdown();
+            var options = ULL_InitOptions.Create(LiveLinkSendMode.Synchronous, 0, LiveLinkQueuePolicy.DropOldest);
+            options.initMode = UnrealLiveLinkNative.ULL_INIT_MODE_ASYNC;
+
+            // Act - Register and update right away; these are held until the runtime is up
+            int initResult = UnrealLiveLinkNative.ULL_InitializeEx(_testProviderName ?? "TestProvider", ref options);
+            _isInitialized = (initResult == UnrealLiveLinkNative.ULL_OK);
+            int handle = UnrealLiveLinkNative.ULL_RegisterObjectH("StagedObject");
+            for (int i = 0; i < 10; i++)
+            {
+                var transform = ULL_Transform.Create(i, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
+                UnrealLiveLinkNative.ULL_UpdateObjectH(handle, ref transform);
+            }
+            UnrealLiveLinkNative.ULL_UpdateDataSubject("StagedKpis", new[] { "Throughput" }, new[] { 1.0f }, 1);
+
+            // Staging only lasts while the engine runtime starts (already up if an earlier test started it)
+            int state = UnrealLiveLinkNative.ULL_GetInitState();
+            var deadline = DateTime.UtcNow.AddSeconds(30);
+            while (state == UnrealLiveLinkNative.ULL_INIT_STATE_STAGING && DateTime.UtcNow < deadline)
+            {
+                System.Threading.Thread.Sleep(50);
+                state = UnrealLiveLinkNative.ULL_GetInitState();
+            }
+
+            // Assert
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, initResult, "InitializeEx should return at once in async init mode");
+            Assert.IsTrue(handle >= 0, "Registration should return a valid handle while staging");
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_INIT_STATE_READY, state, "Staged initialization should complete");
+            UnrealLiveLinkNative.ULL_Shutdown();
+            _isInitialized = false;
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_NOT_INITIALIZED, UnrealLiveLinkNative.ULL_GetInitState());
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Lifecycle")]
+        [TestCategory("Coalescing")]
+        public void InitializeEx_WithPublishRate_ShouldCoalesceUpdatesAndFlushOnShutdown()
+        {
+            // Arrange - Start from a clean state so the options are applied
+            UnrealLiveLinkNative.ULL_Shutdown();
+            var options = ULL_InitOptions.Create(LiveLinkSendMode.Synchronous, 0, LiveLinkQueuePolicy.DropOldest, 60);
+
+            // Act - Many updates per subject inside one publish interval
+            int initResult = UnrealLiveLinkNative.ULL_InitializeEx(_testProviderName ?? "TestProvider", ref options);
+            _isInitialized = (initResult == UnrealLiveLinkNative.ULL_OK);
+            int handle = UnrealLiveLinkNative.ULL_RegisterObjectH("CoalescedObject");
+            for (int i = 0; i < 100; i++)
+            {
+                var transform = ULL_Transform.Create(i, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
+                UnrealLiveLinkNative.ULL_UpdateObjectH(handle, ref transform);
+                UnrealLiveLinkNative.ULL_UpdateObject("CoalescedByName", ref transform);
+            }
+            System.Threading.Thread.Sleep(50); // Let the publish thread run a few passes
+
+            // Assert - Shutdown stops the publish thread and sends the final state without crashing
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, initResult, "InitializeEx should succeed with a publish rate");
+            Assert.IsTrue(handle >= 0, "Registration should return a valid handle in coalescing mode");
+            UnrealLiveLinkNative.ULL_Shutdown();
+            _isInitialized = false;
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Lifecycle")]
+        [TestCategory("Deadband")]
+        public void InitializeEx_WithDeadband_ShouldSuppressUnchangedFrames()
+        {
+            // Arrange - Start from a clean state so the options are applied
+            UnrealLiveLinkNative.ULL_Shutdown();
+            var options = ULL_InitOptions.Create(LiveLinkSendMode.Synchronous, 0, LiveLinkQueuePolicy.DropOldest);
+            options.deadbandEnabled = 1;
+            options.positionDeadband = 0.5f;
+            options.keepAliveIntervalMs = 60000;
+            var transform = ULL_Transform.Create(100.0, 200.0, 300.0, 0.0, 0.0, 0.0, 1.0);
+
+            // Act - Parked object: the same transform every step
+            int initResult = UnrealLiveLinkNative.ULL_InitializeEx(_testProviderName ?? "TestProvider", ref options);
+            _isInitialized = (initResult == UnrealLiveLinkNative.ULL_OK);
+            int handle = UnrealLiveLinkNative.ULL_RegisterObjectH("ParkedObject");
+            for (int i = 0; i < 50; i++)
+            {
+                UnrealLiveLinkNative.ULL_UpdateObjectH(handle, ref transform);
+            }
+            int countersResult = UnrealLiveLinkNative.ULL_GetDeadbandCounters(
+                out ulong sent, out ulong suppressed, out ulong keepAlive);
+
+            // Assert - Only the first frame is sent
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, initResult, "InitializeEx should succeed with deadband options");
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, countersResult, "GetDeadbandCounters should succeed when initialized");
+            Assert.AreEqual(1UL, sent, "Only the first frame of an unchanged subject should be sent");
+            Assert.AreEqual(49UL, suppressed, "Repeated identical frames should be suppressed");
+            Assert.AreEqual(0UL, keepAlive, "Keep-alive should not fire within the interval");
+
+            UnrealLiveLinkNative.ULL_Shutdown();
+            _isInitialized = false;
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Lifecycle")]
+        [TestCategory("Pump")]
+        public void Initialize_ShouldStartMessageBusPump()
+        {
+            // Arrange - Start from a clean state (default options start the pump)
+            UnrealLiveLinkNative.ULL_Shutdown();
+
+            // Act
+            int initResult = UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = (initResult == UnrealLiveLinkNative.ULL_OK);
+            System.Threading.Thread.Sleep(200); // ~12 ticks at the default 60 Hz
+            int statsResult = UnrealLiveLinkNative.ULL_GetPumpStats(out ULL_PumpStats stats);
+
+            // Assert
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, statsResult, "GetPumpStats should succeed when initialized");
+            Assert.AreEqual(1, stats.running, "Pump thread should run after Initialize");
+            Assert.AreEqual(60, stats.rateHz, "Pump should use the default rate");
+            Assert.IsTrue(stats.tickCount > 0, "Pump should have ticked");
+
+            UnrealLiveLinkNative.ULL_Shutdown();
+            _isInitialized = false;
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_NOT_INITIALIZED, UnrealLiveLinkNative.ULL_GetPumpStats(out _),
+                "GetPumpStats should report not initialized after Shutdown");
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Diagnostics")]
+        public void GetStats_AfterUpdates_ShouldCountReceivedUpdates()
+        {
+            // Arrange
+            UnrealLiveLinkNative.ULL_Shutdown();
+            int initResult = UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = (initResult == UnrealLiveLinkNative.ULL_OK);
+            var transform = ULL_Transform.Create(10.0, 20.0, 30.0, 0.0, 0.0, 0.0, 1.0);
+
+            // Act
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_ResetStats());
+            for (int i = 0; i < 10; i++)
+            {
+                UnrealLiveLinkNative.ULL_UpdateObject("StatsTestSubject", ref transform);
+            }
+            int statsResult = UnrealLiveLinkNative.ULL_GetStats(out ULL_Stats stats);
+
+            // Assert
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, statsResult, "GetStats should succeed when initialized");
+            Assert.AreEqual(10UL, stats.transformUpdatesReceived, "Every update call should be counted");
+            Assert.AreEqual(ULL_Stats.HistogramBuckets, stats.frameDataHistogram.Length);
+
+            UnrealLiveLinkNative.ULL_Shutdown();
+            _isInitialized = false;
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_NOT_INITIALIZED, UnrealLiveLinkNative.ULL_GetStats(out _),
+                "GetStats should report not initialized after Shutdown");
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Lifecycle")]
+        [TestCategory("ErrorHandling")]
+        public void InitializeEx_WithNullProviderName_ShouldReturnError()
+        {
+            // Arrange
+            var options = ULL_InitOptions.Create(LiveLinkSendMode.Asynchronous, 64, LiveLinkQueuePolicy.Block);
+
+            // Act
+            int result = UnrealLiveLinkNative.ULL_InitializeEx(null!, ref options);
+
+            // Assert
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR, result,
+                "InitializeEx should return ULL_ERROR (-1) for null provider name");
+        }
+
         #endregion
 
         #region 3. Transform Subject Operation Tests
@@ -347,6 +581,992 @@ namespace SimioUnrealEngineLiveLinkConnector.Integration.Tests
             UnrealLiveLinkNative.ULL_RemoveObject("TestObject_005");
         }
 
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("TransformSubjects")]
+        [TestCategory("Batch")]
+        public void UpdateObjectsBatch_WithValidTransforms_ShouldNotThrow()
+        {
+            // Arrange - Initialize first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            
+            string[] subjectNames = new string[] { "BatchObject_001", "BatchObject_002", "BatchObject_003" };
+            ULL_Transform[] transforms = new ULL_Transform[subjectNames.Length];
+            for (int i = 0; i < transforms.Length; i++)
+            {
+                transforms[i] = new ULL_Transform
+                {
+                    position = new double[] { i * 100.0, 0.0, 0.0 },
+                    rotation = new double[] { 0.0, 0.0, 0.0, 1.0 },
+                    scale = new double[] { 1.0, 1.0, 1.0 }
+                };
+            }
+            
+            // Act & Assert - Should not throw (auto-registers all subjects)
+            UnrealLiveLinkNative.ULL_UpdateObjectsBatch(subjectNames, transforms, subjectNames.Length);
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("TransformSubjects")]
+        [TestCategory("Batch")]
+        public void UpdateObjectsBatchWithProperties_WithValidData_ShouldNotThrow()
+        {
+            // Arrange - Initialize and register first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            
+            string[] propertyNames = new string[] { "Speed", "Load" };
+            string[] subjectNames = new string[] { "BatchObject_004", "BatchObject_005" };
+            foreach (var name in subjectNames)
+            {
+                UnrealLiveLinkNative.ULL_RegisterObjectWithProperties(name, propertyNames, propertyNames.Length);
+            }
+            
+            ULL_Transform[] transforms = new ULL_Transform[subjectNames.Length];
+            for (int i = 0; i < transforms.Length; i++)
+            {
+                transforms[i] = new ULL_Transform
+                {
+                    position = new double[] { 0.0, i * 100.0, 0.0 },
+                    rotation = new double[] { 0.0, 0.0, 0.707, 0.707 },
+                    scale = new double[] { 1.0, 1.0, 1.0 }
+                };
+            }
+            
+            // Two values per object, contiguous in subject order
+            float[] propertyValues = new float[] { 25.5f, 100.0f, 12.0f, 50.0f };
+            
+            // Act & Assert - Should not throw
+            UnrealLiveLinkNative.ULL_UpdateObjectsBatchWithProperties(
+                subjectNames, transforms, propertyValues, propertyNames.Length, subjectNames.Length);
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("TransformSubjects")]
+        [TestCategory("Batch")]
+        public void UpdateObjectsBatchWithProperties_UnregisteredObjects_AutoRegisterOnlyWithoutProperties()
+        {
+            // Arrange - Initialize first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            ULL_Transform[] transforms = { ULL_Transform.Identity(), ULL_Transform.Identity() };
+            UnrealLiveLinkNative.ULL_GetStats(out ULL_Stats before);
+
+            // Act - Property names are unknown to the batch, so only property-less objects register
+            UnrealLiveLinkNative.ULL_UpdateObjectsBatchWithProperties(
+                new[] { "BatchAutoObject_001", "BatchAutoObject_002" }, transforms, new float[0], 0, 2);
+            UnrealLiveLinkNative.ULL_GetStats(out ULL_Stats afterPlain);
+            UnrealLiveLinkNative.ULL_UpdateObjectsBatchWithProperties(
+                new[] { "BatchAutoObject_003", "BatchAutoObject_004" }, transforms, new[] { 1.0f, 2.0f }, 1, 2);
+            UnrealLiveLinkNative.ULL_GetStats(out ULL_Stats afterProperties);
+
+            // Assert
+            Assert.AreEqual(before.registeredTransformSubjects + 2, afterPlain.registeredTransformSubjects,
+                "A batch without properties should auto-register like ULL_UpdateObjectsBatch");
+            Assert.AreEqual(afterPlain.registeredTransformSubjects, afterProperties.registeredTransformSubjects,
+                "A batch with properties should not register objects it cannot name properties for");
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("TransformSubjects")]
+        [TestCategory("Handles")]
+        public void RegisterObjectH_UpdateAndRemove_ShouldUseStableHandle()
+        {
+            // Arrange - Initialize first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            
+            // Act - Register twice, same name
+            int handle = UnrealLiveLinkNative.ULL_RegisterObjectH("HandleObject_001");
+            int sameHandle = UnrealLiveLinkNative.ULL_RegisterObjectH("HandleObject_001");
+            
+            // Assert - Valid and stable
+            Assert.IsTrue(handle >= 0, $"Handle should be non-negative, got {handle}");
+            Assert.AreEqual(handle, sameHandle, "Registering the same name should return the same handle");
+            
+            ULL_Transform transform = ULL_Transform.Identity();
+            UnrealLiveLinkNative.ULL_UpdateObjectH(handle, ref transform);
+            UnrealLiveLinkNative.ULL_UpdateObjectsBatchH(new[] { handle }, new[] { transform }, 1);
+            
+            // Remove, then stale handle calls must be ignored safely
+            UnrealLiveLinkNative.ULL_RemoveObjectH(handle);
+            UnrealLiveLinkNative.ULL_UpdateObjectH(handle, ref transform);
+            UnrealLiveLinkNative.ULL_RemoveObjectH(handle);
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("TransformSubjects")]
+        [TestCategory("Handles")]
+        public void BlittableOverloads_ShouldAcceptTransformData()
+        {
+            // Arrange - Initialize first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            int handle = UnrealLiveLinkNative.ULL_RegisterObjectH("BlittableObject_001");
+            Assert.IsTrue(handle >= 0, $"Handle should be non-negative, got {handle}");
+
+            var transforms = new ULL_TransformData[4];
+            CoordinateConverter.SimioToUnrealTransform(ref transforms[0], 1.0, 2.0, 3.0, 0.0, 90.0, 0.0);
+            byte[] name = UnrealLiveLinkNative.GetUtf8Name("BlittableObject_001");
+
+            // Act & Assert - Should not throw (count smaller than the reused buffer)
+            UnrealLiveLinkNative.ULL_UpdateObjectH(handle, ref transforms[0]);
+            UnrealLiveLinkNative.ULL_UpdateObjectAtTimeH(handle, ref transforms[0], null, 0, 1.0);
+            UnrealLiveLinkNative.ULL_UpdateObjectsBatchH(new[] { handle }, transforms, 1);
+            UnrealLiveLinkNative.ULL_UpdateObject(name, ref transforms[0]);
+
+            Assert.AreEqual(0, name[name.Length - 1], "UTF-8 name must be null-terminated");
+            UnrealLiveLinkNative.ULL_RemoveObjectH(handle);
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("TransformSubjects")]
+        [TestCategory("Handles")]
+        public void RegisterPropertySchema_SameNames_ShouldShareSchemaId()
+        {
+            // Arrange - Initialize first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            string[] propertyNames = { "Speed", "Load", "Battery" };
+            
+            // Act
+            int schemaId = UnrealLiveLinkNative.ULL_RegisterPropertySchema(propertyNames, propertyNames.Length);
+            int sameSchemaId = UnrealLiveLinkNative.ULL_RegisterPropertySchema(new[] { "Speed", "Load", "Battery" }, 3);
+            int otherSchemaId = UnrealLiveLinkNative.ULL_RegisterPropertySchema(new[] { "Load", "Speed" }, 2);
+            int handleA = UnrealLiveLinkNative.ULL_RegisterObjectWithSchemaH("SchemaObject_A", schemaId);
+            int handleB = UnrealLiveLinkNative.ULL_RegisterObjectWithSchemaH("SchemaObject_B", schemaId);
+            
+            // Assert
+            Assert.IsTrue(schemaId >= 0, $"Schema ID should be non-negative, got {schemaId}");
+            Assert.AreEqual(schemaId, sameSchemaId, "Identical property lists should return the same schema ID");
+            Assert.AreNotEqual(schemaId, otherSchemaId, "Different property lists should get different schema IDs");
+            Assert.IsTrue(handleA >= 0 && handleB >= 0 && handleA != handleB, "Each object should get its own handle");
+            Assert.IsTrue(UnrealLiveLinkNative.ULL_RegisterObjectWithSchemaH("SchemaObject_C", 12345) < 0,
+                "Unknown schema IDs should be rejected");
+            
+            ULL_Transform transform = ULL_Transform.Identity();
+            UnrealLiveLinkNative.ULL_UpdateObjectWithPropertiesH(handleA, ref transform, new float[] { 1.0f, 2.0f, 3.0f }, 3);
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("TransformSubjects")]
+        [TestCategory("Handles")]
+        public void RegisterObjectsBatch_ValidNames_ShouldReturnHandlePerObject()
+        {
+            // Arrange - Initialize first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            string[] names = { "BatchObject_A", "BatchObject_B", "BatchObject_C" };
+            int schemaId = UnrealLiveLinkNative.ULL_RegisterPropertySchema(new[] { "Speed" }, 1);
+            var handles = new int[names.Length];
+            var badHandles = new int[2];
+            
+            // Act
+            int registered = UnrealLiveLinkNative.ULL_RegisterObjectsBatchH(
+                names, new[] { schemaId, schemaId, schemaId }, names.Length, handles);
+            int partial = UnrealLiveLinkNative.ULL_RegisterObjectsBatchH(
+                new[] { "BatchObject_D", "BatchObject_E" }, new[] { schemaId, 12345 }, 2, badHandles);
+            
+            // Assert
+            Assert.AreEqual(names.Length, registered, "All objects should be registered");
+            Assert.IsTrue(handles.All(h => h >= 0), "Every object should get a handle");
+            Assert.AreEqual(names.Length, handles.Distinct().Count(), "Handles should be unique");
+            Assert.AreEqual(1, partial, "Only the entry with a known schema should be registered");
+            Assert.IsTrue(badHandles[0] >= 0 && badHandles[1] < 0, "Unknown schema IDs should be rejected per entry");
+            
+            ULL_Transform transform = ULL_Transform.Identity();
+            UnrealLiveLinkNative.ULL_UpdateObjectWithPropertiesH(handles[0], ref transform, new float[] { 1.0f }, 1);
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("TransformSubjects")]
+        [TestCategory("Handles")]
+        public void SetObjectSchedule_ValidTier_ShouldSucceedAndRejectInvalidValues()
+        {
+            // Arrange - Initialize first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            int handle = UnrealLiveLinkNative.ULL_RegisterObjectH("ScheduledObject");
+            
+            // Act & Assert
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK,
+                UnrealLiveLinkNative.ULL_SetObjectScheduleH(handle, (int)LiveLinkPriority.Low, 5));
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK,
+                UnrealLiveLinkNative.ULL_SetSubjectSchedule("ScheduledObject", (int)LiveLinkPriority.High, UnrealLiveLinkNative.ULL_RATE_UNLIMITED));
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR,
+                UnrealLiveLinkNative.ULL_SetObjectScheduleH(handle, 7, 5), "Unknown priorities should be rejected");
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR,
+                UnrealLiveLinkNative.ULL_SetObjectScheduleH(handle, (int)LiveLinkPriority.Normal, -1), "Negative rates should be rejected");
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR,
+                UnrealLiveLinkNative.ULL_SetSubjectSchedule("NotRegistered", (int)LiveLinkPriority.Low, 2), "Unknown subjects should be rejected");
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Capture")]
+        public void CaptureAndReplay_ShouldRoundTripThroughCaptureFile()
+        {
+            // Arrange - Initialize first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            string capturePath = Path.Combine(Path.GetTempPath(), $"ull_capture_{Guid.NewGuid():N}.ullc");
+            
+            try
+            {
+                // Act - Record a few frames
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_StartCapture(capturePath));
+                ULL_Transform transform = ULL_Transform.Identity();
+                UnrealLiveLinkNative.ULL_UpdateObject("CapturedObject", ref transform);
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_StopCapture());
+                Assert.IsTrue(File.Exists(capturePath), "Capture file should be created");
+                
+                // Act - Play it back paused so the position is deterministic
+                int replayResult = UnrealLiveLinkNative.ULL_StartReplay(capturePath, UnrealLiveLinkNative.ULL_REPLAY_PAUSED, 0);
+                
+                // Assert
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, replayResult, "A finished capture should be replayable");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK,
+                    UnrealLiveLinkNative.ULL_GetReplayStatus(out double position, out double duration));
+                Assert.AreEqual(0.0, position, "A paused replay should stay at the start");
+                Assert.IsTrue(duration >= 0.0, $"Duration should be non-negative, got {duration}");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_SeekReplay(duration));
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_SetReplaySpeed(2.0));
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_StopReplay());
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR,
+                    UnrealLiveLinkNative.ULL_GetReplayStatus(out _, out _), "Status should fail once the replay is stopped");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR,
+                    UnrealLiveLinkNative.ULL_StartReplay(Path.Combine(Path.GetTempPath(), "ull_missing_capture.ullc"), 1.0, 0),
+                    "Missing files should be rejected");
+            }
+            finally
+            {
+                UnrealLiveLinkNative.ULL_StopReplay();
+                if (File.Exists(capturePath))
+                {
+                    File.Delete(capturePath);
+                }
+            }
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Capture")]
+        public void CaptureAndReplay_SeekMidChunk_ShouldRebuildSparseProperties()
+        {
+            // Arrange - Initialize first. Speed changes every frame, Status and Shift only now and
+            // then and Capacity never, so most frames are recorded with sparse property sections
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            const string subjectName = "CapturedKpiObject";
+            const int frameCount = 40;
+            string[] propertyNames = { "Speed", "Status", "Capacity", "Shift" };
+            Func<int, float[]> valuesAt = frame => new[] { frame * 1.5f, frame / 10, 50.0f, frame < 25 ? 1.0f : 2.0f };
+            string capturePath = Path.Combine(Path.GetTempPath(), $"ull_capture_{Guid.NewGuid():N}.ullc");
+
+            // Seeks are applied by the replay thread; the position moves to the target once it has sent the state
+            Func<double, bool> seekAndWait = target =>
+            {
+                UnrealLiveLinkNative.ULL_SeekReplay(target);
+                for (int attempt = 0; attempt < 200; attempt++)
+                {
+                    UnrealLiveLinkNative.ULL_GetReplayStatus(out double position, out _);
+                    if (Math.Abs(position - target) < 1e-9)
+                    {
+                        return true;
+                    }
+                    System.Threading.Thread.Sleep(10);
+                }
+                return false;
+            };
+
+            try
+            {
+                // Act - Record frames whose position encodes the frame number
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_StartCapture(capturePath));
+                UnrealLiveLinkNative.ULL_RegisterObjectWithProperties(subjectName, propertyNames, propertyNames.Length);
+                for (int frame = 0; frame < frameCount; frame++)
+                {
+                    ULL_Transform transform = ULL_Transform.Create(frame * 10.0, -250.0, 75.0, 0.0, 0.0, 0.0, 1.0);
+                    UnrealLiveLinkNative.ULL_UpdateObjectWithProperties(subjectName, ref transform, valuesAt(frame), propertyNames.Length);
+                    System.Threading.Thread.Sleep(5);
+                }
+                System.Threading.Thread.Sleep(50);
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_StopCapture());
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_StartReplay(capturePath, UnrealLiveLinkNative.ULL_REPLAY_PAUSED, 0));
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_GetReplayStatus(out _, out double duration));
+
+                var midValues = new float[propertyNames.Length];
+                Assert.IsTrue(seekAndWait(duration / 2), "The replay should reach the mid-capture seek target");
+                int midCount = UnrealLiveLinkNative.ULL_GetReplayFrame(subjectName, out ULL_Transform midTransform, midValues, midValues.Length);
+
+                var endValues = new float[propertyNames.Length];
+                Assert.IsTrue(seekAndWait(duration), "The replay should reach the end of the capture");
+                int endCount = UnrealLiveLinkNative.ULL_GetReplayFrame(subjectName, out ULL_Transform endTransform, endValues, endValues.Length);
+
+                // Assert - every frame sits in chunk 0 after its key frame, so the rebuilt values
+                // come from the key position and the last full section plus the sparse ones after it
+                Assert.AreEqual(propertyNames.Length, midCount, "The mid-capture frame should carry every property");
+                int midFrame = (int)Math.Round(midTransform.position[0] / 10.0);
+                Assert.IsTrue(midFrame > 0 && midFrame < frameCount, $"The seek should land after the key frame, got frame {midFrame}");
+                Assert.AreEqual(-250.0, midTransform.position[1], 1e-3, "Key-relative positions should be rebuilt");
+                Assert.AreEqual(75.0, midTransform.position[2], 1e-3, "Key-relative positions should be rebuilt");
+                CollectionAssert.AreEqual(valuesAt(midFrame), midValues, $"Properties at frame {midFrame} should be rebuilt from the sparse sections");
+
+                Assert.AreEqual(propertyNames.Length, endCount);
+                int endFrame = (int)Math.Round(endTransform.position[0] / 10.0);
+                Assert.IsTrue(endFrame >= midFrame && endFrame < frameCount, $"Seeking to the end should not go back, got frame {endFrame}");
+                CollectionAssert.AreEqual(valuesAt(endFrame), endValues, $"Properties at frame {endFrame} should be rebuilt from the sparse sections");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR,
+                    UnrealLiveLinkNative.ULL_GetReplayFrame("NotCaptured", out _, null, 0), "Subjects outside the capture have no frame");
+            }
+            finally
+            {
+                UnrealLiveLinkNative.ULL_StopReplay();
+                if (File.Exists(capturePath))
+                {
+                    File.Delete(capturePath);
+                }
+            }
+
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR,
+                UnrealLiveLinkNative.ULL_GetReplayFrame(subjectName, out _, null, 0), "Stopped replays have no frames");
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Capture")]
+        public void StartReplay_VersionOneCapture_ShouldStillLoad()
+        {
+            // Arrange - Initialize first. A version 1 file: one chunk holding a SUBJECT record and a
+            // key FRAME record with a full property section (version 1 never writes sparse sections)
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            string capturePath = Path.Combine(Path.GetTempPath(), $"ull_capture_v1_{Guid.NewGuid():N}.ullc");
+
+            Func<uint, byte[]> buildCapture = version =>
+            {
+                const int chunkBytes = 4096;
+                using (var stream = new MemoryStream())
+                using (var writer = new BinaryWriter(stream))
+                {
+                    // ULL_CaptureFileHeader (64 bytes)
+                    writer.Write(0x434C4C55u);              // ULL_CAPTURE_MAGIC
+                    writer.Write(version);
+                    writer.Write(64u);
+                    writer.Write((uint)chunkBytes);
+                    writer.Write(1UL);                      // chunkCount
+                    writer.Write(2UL);                      // recordCount
+                    writer.Write(1UL);                      // frameCount
+                    writer.Write(0.0);                      // startWorldTime
+                    writer.Write(0.5);                      // durationSeconds
+                    writer.Write(1u);                       // subjectCount
+                    writer.Write(0u);
+
+                    // ULL_CaptureChunkHeader (32 bytes)
+                    writer.Write(0x4B4C4C55u);              // ULL_CAPTURE_CHUNK_MAGIC
+                    writer.Write(0u);                       // chunkIndex
+                    writer.Write(36u + 72u);                // usedBytes
+                    writer.Write(2u);                       // recordCount
+                    writer.Write(0.0);                      // baseTime
+                    writer.Write(0.25);                     // endTime
+
+                    // SUBJECT: header, timeOffsetUs, role, propertyCount, then "V1Object\0Speed\0Load\0"
+                    writer.Write((byte)1);
+                    writer.Write((byte)0);
+                    writer.Write((ushort)36);
+                    writer.Write(0u);                       // subjectId
+                    writer.Write(0u);
+                    writer.Write((ushort)0);                // ULL_CAPTURE_ROLE_TRANSFORM
+                    writer.Write((ushort)2);
+                    writer.Write(System.Text.Encoding.ASCII.GetBytes("V1Object\0Speed\0Load\0"));
+
+                    // FRAME: header (ULL_CAPTURE_FLAG_KEY), timeOffsetUs, offset, rotation, key position, properties
+                    writer.Write((byte)3);
+                    writer.Write((byte)0x01);
+                    writer.Write((ushort)72);
+                    writer.Write(0u);
+                    writer.Write(250000u);
+                    foreach (float value in new[] { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f }) { writer.Write(value); }
+                    foreach (double value in new[] { 100.0, 200.0, 300.0 }) { writer.Write(value); }
+                    writer.Write(7.5f);
+                    writer.Write(42.0f);
+
+                    writer.Flush();
+                    writer.Write(new byte[64 + chunkBytes - stream.Length]);
+                    writer.Flush();
+                    return stream.ToArray();
+                }
+            };
+
+            try
+            {
+                // Act
+                File.WriteAllBytes(capturePath, buildCapture(1));
+                int replayResult = UnrealLiveLinkNative.ULL_StartReplay(capturePath, UnrealLiveLinkNative.ULL_REPLAY_PAUSED, 0);
+                UnrealLiveLinkNative.ULL_SeekReplay(0.5);
+                double position = 0.0;
+                for (int attempt = 0; attempt < 200 && position < 0.5; attempt++)
+                {
+                    System.Threading.Thread.Sleep(10);
+                    UnrealLiveLinkNative.ULL_GetReplayStatus(out position, out _);
+                }
+                var values = new float[2];
+                int count = UnrealLiveLinkNative.ULL_GetReplayFrame("V1Object", out ULL_Transform transform, values, values.Length);
+                UnrealLiveLinkNative.ULL_StopReplay();
+
+                File.WriteAllBytes(capturePath, buildCapture(3));
+                int futureResult = UnrealLiveLinkNative.ULL_StartReplay(capturePath, UnrealLiveLinkNative.ULL_REPLAY_PAUSED, 0);
+
+                // Assert
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, replayResult, "Version 1 captures should still load");
+                Assert.AreEqual(0.5, position, 1e-9, "The seek should reach the end of the capture");
+                Assert.AreEqual(2, count, "The version 1 frame should be replayed with its properties");
+                Assert.AreEqual(100.0, transform.position[0], 1e-9);
+                Assert.AreEqual(200.0, transform.position[1], 1e-9);
+                Assert.AreEqual(300.0, transform.position[2], 1e-9);
+                CollectionAssert.AreEqual(new[] { 7.5f, 42.0f }, values);
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR, futureResult, "Versions newer than ULL_CAPTURE_VERSION should be rejected");
+            }
+            finally
+            {
+                UnrealLiveLinkNative.ULL_StopReplay();
+                if (File.Exists(capturePath))
+                {
+                    File.Delete(capturePath);
+                }
+            }
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Coalescing")]
+        [TestCategory("Concurrency")]
+        public void UpdateObjectH_ConcurrentProducers_ShouldKeepLatestValuePerSubject()
+        {
+            // Arrange - Start from a clean state: a publish rate turns on sharded ingestion
+            UnrealLiveLinkNative.ULL_Shutdown();
+            var options = ULL_InitOptions.Create(LiveLinkSendMode.Synchronous, 0, LiveLinkQueuePolicy.DropOldest, 30);
+            int initResult = UnrealLiveLinkNative.ULL_InitializeEx(_testProviderName ?? "TestProvider", ref options);
+            _isInitialized = (initResult == UnrealLiveLinkNative.ULL_OK);
+            const int producerCount = 4;
+            const int subjectCount = 256;   // Four 64-slot shards
+            const int updateCount = 200;
+            int[] handles = Enumerable.Range(0, subjectCount)
+                .Select(index => UnrealLiveLinkNative.ULL_RegisterObjectH($"ShardedObject_{index}"))
+                .ToArray();
+            string capturePath = Path.Combine(Path.GetTempPath(), $"ull_sharded_{Guid.NewGuid():N}.ullc");
+            var latestX = new double[subjectCount];
+            var frameResults = new int[subjectCount];
+
+            try
+            {
+                // Act - The capture records what the publish passes sent after draining the shards
+                UnrealLiveLinkNative.ULL_ResetStats();
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_StartCapture(capturePath));
+                RunConcurrentProducers(handles, producerCount, updateCount);
+                System.Threading.Thread.Sleep(300); // Several publish passes after the last update
+                int statsResult = UnrealLiveLinkNative.ULL_GetStats(out ULL_Stats stats);
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_StopCapture());
+
+                // Each subject's last sent frame: replay the capture paused and seek to its end
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_StartReplay(capturePath, UnrealLiveLinkNative.ULL_REPLAY_PAUSED, 0));
+                UnrealLiveLinkNative.ULL_GetReplayStatus(out _, out double duration);
+                UnrealLiveLinkNative.ULL_SeekReplay(duration);
+                double position = -1.0;
+                for (int attempt = 0; attempt < 200 && Math.Abs(position - duration) > 1e-9; attempt++)
+                {
+                    System.Threading.Thread.Sleep(10);
+                    UnrealLiveLinkNative.ULL_GetReplayStatus(out position, out _);
+                }
+                for (int index = 0; index < subjectCount; index++)
+                {
+                    frameResults[index] = UnrealLiveLinkNative.ULL_GetReplayFrame($"ShardedObject_{index}", out ULL_Transform transform, null, 0);
+                    latestX[index] = frameResults[index] >= 0 ? transform.position[0] : double.NaN;
+                }
+
+                // Assert - No update is lost across shards and each subject ends on its producer's last value
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, initResult, "InitializeEx should succeed with a publish rate");
+                Assert.IsTrue(handles.All(handle => handle >= 0), "Every subject should register");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, statsResult);
+                Assert.AreEqual((ulong)(subjectCount * updateCount), stats.transformUpdatesReceived,
+                    "Every update from every producer should be counted once");
+                Assert.AreEqual(stats.transformUpdatesReceived,
+                    stats.transformUpdatesSent + stats.transformUpdatesDropped + stats.deadbandSuppressed + stats.coalescedUpdates,
+                    $"Each update should be sent, dropped, suppressed or coalesced, got {stats.transformUpdatesSent} sent, " +
+                    $"{stats.transformUpdatesDropped} dropped, {stats.deadbandSuppressed} suppressed, {stats.coalescedUpdates} coalesced");
+                Assert.IsTrue(stats.transformUpdatesSent >= subjectCount, "Every subject should be published at least once");
+                Assert.AreEqual(duration, position, 1e-9, "The seek should reach the end of the capture");
+                for (int index = 0; index < subjectCount; index++)
+                {
+                    Assert.AreEqual(0, frameResults[index], $"ShardedObject_{index} should have been sent");
+                    Assert.AreEqual(updateCount - 1, latestX[index], $"ShardedObject_{index} should end on its last update");
+                }
+            }
+            finally
+            {
+                UnrealLiveLinkNative.ULL_StopReplay();
+                UnrealLiveLinkNative.ULL_Shutdown();
+                _isInitialized = false;
+                if (File.Exists(capturePath))
+                {
+                    File.Delete(capturePath);
+                }
+            }
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Coalescing")]
+        [TestCategory("Concurrency")]
+        [TestCategory("SharedMemory")]
+        public void UpdateObjectH_ConcurrentProducersWithSharedMemory_ShouldTakeLockedPath()
+        {
+            // Arrange - Start from a clean state. A publish rate would turn on sharded ingestion,
+            // but the shared-memory table is written directly, so updates keep the locked path
+            UnrealLiveLinkNative.ULL_Shutdown();
+            var options = ULL_InitOptions.Create(LiveLinkSendMode.Synchronous, 0, LiveLinkQueuePolicy.DropOldest, 30);
+            options.transport = UnrealLiveLinkNative.ULL_TRANSPORT_SHARED_MEMORY;
+            string providerName = _testProviderName ?? "TestProvider";
+            int initResult = UnrealLiveLinkNative.ULL_InitializeEx(providerName, ref options);
+            _isInitialized = (initResult == UnrealLiveLinkNative.ULL_OK);
+            const int producerCount = 4;
+            const int subjectCount = 256;
+            const int updateCount = 200;
+            int[] handles = Enumerable.Range(0, subjectCount)
+                .Select(index => UnrealLiveLinkNative.ULL_RegisterObjectH($"SharedMemoryObject_{index}"))
+                .ToArray();
+            var latestX = new double[subjectCount];
+
+            try
+            {
+                // Act
+                UnrealLiveLinkNative.ULL_ResetStats();
+                RunConcurrentProducers(handles, producerCount, updateCount);
+                int statsResult = UnrealLiveLinkNative.ULL_GetStats(out ULL_Stats stats);
+
+                // Read each slot's X position from the mapping (UnrealLiveLink.SharedMemory.h). The
+                // producers have finished, so no seqlock retry is needed
+                using (var mapping = System.IO.MemoryMappedFiles.MemoryMappedFile.OpenExisting(@"Local\UnrealLiveLink_" + providerName))
+                using (var view = mapping.CreateViewAccessor(0, 0, System.IO.MemoryMappedFiles.MemoryMappedFileAccess.Read))
+                {
+                    long positionOffset = (long)view.ReadUInt64(80);   // ULL_SharedMemoryHeader.positionOffset
+                    for (int index = 0; index < subjectCount; index++)
+                    {
+                        int slot = handles[index] & 0xFFFFF;
+                        latestX[index] = view.ReadDouble(positionOffset + slot * 3L * sizeof(double));
+                    }
+                }
+
+                // Assert - Nothing is coalesced in shards: every update went through the locked path into the table
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, initResult, "InitializeEx should succeed with the shared-memory transport");
+                Assert.IsTrue(handles.All(handle => handle >= 0), "Every subject should register");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, statsResult);
+                Assert.AreEqual((ulong)(subjectCount * updateCount), stats.transformUpdatesReceived,
+                    "Every update from every producer should be counted once");
+                Assert.AreEqual(stats.transformUpdatesReceived, stats.transformUpdatesSent,
+                    $"Every update should be written to the table, got {stats.transformUpdatesSent} sent, " +
+                    $"{stats.transformUpdatesDropped} dropped, {stats.coalescedUpdates} coalesced");
+                Assert.AreEqual(0UL, stats.coalescedUpdates, "Shared-memory updates should not be ingested through the shards");
+                for (int index = 0; index < subjectCount; index++)
+                {
+                    Assert.AreEqual(updateCount - 1, latestX[index], $"SharedMemoryObject_{index} should end on its last update");
+                }
+            }
+            finally
+            {
+                UnrealLiveLinkNative.ULL_Shutdown();
+                _isInitialized = false;
+            }
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("SharedMemory")]
+        [TestCategory("TransformSubjects")]
+        public void UpdateObjectWithPropertiesH_SharedMemory_ShouldMaskChangedProperties()
+        {
+            // Arrange
+            UnrealLiveLinkNative.ULL_Shutdown();
+            var options = ULL_InitOptions.Create(LiveLinkSendMode.Synchronous, 0, LiveLinkQueuePolicy.DropOldest, 30);
+            options.transport = UnrealLiveLinkNative.ULL_TRANSPORT_SHARED_MEMORY;
+            string providerName = _testProviderName ?? "TestProvider";
+            int initResult = UnrealLiveLinkNative.ULL_InitializeEx(providerName, ref options);
+            _isInitialized = (initResult == UnrealLiveLinkNative.ULL_OK);
+            int handle = UnrealLiveLinkNative.ULL_RegisterObjectWithPropertiesH(
+                "SharedMemoryKpiObject", new[] { "Throughput", "Utilization", "Queue", "Wip" }, 4);
+            ULL_Transform transform = ULL_Transform.Identity();
+
+            try
+            {
+                using (var mapping = System.IO.MemoryMappedFiles.MemoryMappedFile.OpenExisting(@"Local\UnrealLiveLink_" + providerName))
+                using (var view = mapping.CreateViewAccessor(0, 0, System.IO.MemoryMappedFiles.MemoryMappedFileAccess.Read))
+                {
+                    // ULL_SharedMemoryHeader (UnrealLiveLink.SharedMemory.h): maxProperties at 16,
+                    // propertyOffset at 112, propertyDirtyOffset at 128
+                    int slot = handle & 0xFFFFF;
+                    long maxProperties = view.ReadUInt32(16);
+                    long maskWords = (maxProperties + 63) / 64;
+                    long propertyOffset = (long)view.ReadUInt64(112) + slot * maxProperties * sizeof(float);
+                    long dirtyOffset = (long)view.ReadUInt64(128) + slot * maskWords * sizeof(ulong);
+
+                    // Act
+                    UnrealLiveLinkNative.ULL_UpdateObjectWithPropertiesH(handle, ref transform, new float[] { 1.0f, 2.0f, 3.0f, 4.0f }, 4);
+                    ulong fullMask = view.ReadUInt64(dirtyOffset);
+                    UnrealLiveLinkNative.ULL_UpdateObjectWithPropertiesH(handle, ref transform, new float[] { 1.0f, 2.0f, 7.0f, 4.0f }, 4);
+                    ulong sparseMask = view.ReadUInt64(dirtyOffset);
+                    float changedValue = view.ReadSingle(propertyOffset + 2 * sizeof(float));
+                    UnrealLiveLinkNative.ULL_UpdateObjectWithPropertiesH(handle, ref transform, new float[] { 1.0f, 2.0f, 7.0f, 4.0f }, 4);
+                    ulong unchangedMask = view.ReadUInt64(dirtyOffset);
+
+                    // Assert
+                    Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, initResult, "InitializeEx should succeed with the shared-memory transport");
+                    Assert.IsTrue(handle >= 0, "The subject should register");
+                    Assert.AreEqual(ulong.MaxValue, fullMask, "A write that changes most values should mark every property dirty");
+                    Assert.AreEqual(1UL << 2, sparseMask, "Only the changed property should be marked dirty");
+                    Assert.AreEqual(7.0f, changedValue, "The changed value should be stored in the slot");
+                    Assert.AreEqual(0UL, unchangedMask, "A write with no changed values should leave the mask empty");
+                }
+            }
+            finally
+            {
+                UnrealLiveLinkNative.ULL_Shutdown();
+                _isInitialized = false;
+            }
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Sessions")]
+        public void CreateSession_TwoProviders_ShouldKeepIndependentSubjects()
+        {
+            // Arrange
+            var options = ULL_InitOptions.FromConfiguration(new LiveLinkConfiguration());
+            int sessionA = UnrealLiveLinkNative.ULL_CreateSession("TestSession_A", ref options);
+            int sessionB = UnrealLiveLinkNative.ULL_CreateSession("TestSession_B", ref options);
+
+            try
+            {
+                // Act
+                int duplicate = UnrealLiveLinkNative.ULL_CreateSession("TestSession_A", ref options);
+                int handleA = UnrealLiveLinkNative.ULL_SessionRegisterObjectH(sessionA, "SessionObject");
+                int handleB = UnrealLiveLinkNative.ULL_SessionRegisterObjectWithPropertiesH(
+                    sessionB, "SessionObject", new[] { "Speed" }, 1);
+                UnrealLiveLinkNative.ULL_SessionUpdateObjectsBatchWithPropertiesH(
+                    sessionA, new[] { handleA }, new[] { ULL_Transform.Identity() }, null, 0, 1);
+                UnrealLiveLinkNative.ULL_SessionUpdateDataSubject(sessionB, "SessionKpis", new[] { "Throughput" }, new[] { 4.0f }, 1);
+                int statsResult = UnrealLiveLinkNative.ULL_SessionGetStats(sessionB, out ULL_Stats statsB);
+
+                // Assert
+                Assert.IsTrue(sessionA > UnrealLiveLinkNative.ULL_DEFAULT_SESSION, $"Session ID should be positive, got {sessionA}");
+                Assert.IsTrue(sessionB > UnrealLiveLinkNative.ULL_DEFAULT_SESSION && sessionB != sessionA, "Each session should get its own ID");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR, duplicate, "Provider names should be unique among live sessions");
+                Assert.IsTrue(handleA >= 0 && handleB >= 0, "The same subject name should register in both sessions");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, statsResult);
+                Assert.AreEqual(1, statsB.registeredTransformSubjects, "Session B should only see its own transform subject");
+                Assert.AreEqual(1, statsB.registeredDataSubjects, "Session B should see its data subject");
+            }
+            finally
+            {
+                UnrealLiveLinkNative.ULL_DestroySession(sessionA);
+                UnrealLiveLinkNative.ULL_DestroySession(sessionB);
+            }
+
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR, UnrealLiveLinkNative.ULL_DestroySession(sessionA),
+                "Destroying a session twice should fail");
+            Assert.IsTrue(UnrealLiveLinkNative.ULL_SessionRegisterObjectH(sessionA, "LateObject") < 0,
+                "Destroyed sessions should reject registrations");
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("Sessions")]
+        public void Initialize_ProviderNameOfLiveSession_ShouldFail()
+        {
+            // Arrange - the session takes the name before the default provider is initialized
+            UnrealLiveLinkNative.ULL_Shutdown();
+            _isInitialized = false;
+            var options = ULL_InitOptions.FromConfiguration(new LiveLinkConfiguration());
+            int session = UnrealLiveLinkNative.ULL_CreateSession("TestSession_Taken", ref options);
+            int initResult;
+
+            try
+            {
+                // Act
+                initResult = UnrealLiveLinkNative.ULL_Initialize("TestSession_Taken");
+                _isInitialized = (initResult == UnrealLiveLinkNative.ULL_OK);
+                int connected = UnrealLiveLinkNative.ULL_IsConnected();
+
+                // Assert
+                Assert.IsTrue(session > UnrealLiveLinkNative.ULL_DEFAULT_SESSION, $"Session ID should be positive, got {session}");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR, initResult, "The default provider should not take a live session's name");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_NOT_INITIALIZED, connected, "A rejected Initialize should leave the default session uninitialized");
+            }
+            finally
+            {
+                UnrealLiveLinkNative.ULL_DestroySession(session);
+                if (_isInitialized)
+                {
+                    UnrealLiveLinkNative.ULL_Shutdown();
+                    _isInitialized = false;
+                }
+            }
+
+            // The name is free again once the session is destroyed
+            initResult = UnrealLiveLinkNative.ULL_Initialize("TestSession_Taken");
+            _isInitialized = (initResult == UnrealLiveLinkNative.ULL_OK);
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, initResult, "Destroying the session should release its provider name");
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR, UnrealLiveLinkNative.ULL_CreateSession("TestSession_Taken", ref options),
+                "Sessions should not take the default provider's name either");
+
+            UnrealLiveLinkNative.ULL_Shutdown();
+            _isInitialized = false;
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("InterestRegions")]
+        public void SetInterestRegions_ShouldValidateRegionsAndRate()
+        {
+            // Arrange - Initialize first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            var regions = new[]
+            {
+                ULL_InterestRegion.AroundPoint(0.0, 0.0, 0.0, 5000.0),
+                ULL_InterestRegion.FromCorners(20000.0, 0.0, 0.0, 10000.0, 8000.0, 500.0)
+            };
+            var inverted = new[] { new ULL_InterestRegion { minX = 100.0, maxX = -100.0 } };
+
+            // Act
+            int setResult = UnrealLiveLinkNative.ULL_SetInterestRegions(regions, regions.Length, 2);
+            ULL_Transform transform = ULL_Transform.Create(90000.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
+            UnrealLiveLinkNative.ULL_UpdateObject("InterestObject", ref transform);
+            int countersResult = UnrealLiveLinkNative.ULL_GetInterestCounters(out ulong held, out ulong outside, out int cells);
+
+            // Assert
+            Assert.AreEqual(48, Marshal.SizeOf<ULL_InterestRegion>(), "ULL_InterestRegion should match the native 48-byte layout");
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, setResult);
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, countersResult);
+            Assert.IsTrue(cells >= 0 && held + outside <= 1, $"One update should be held or sent at most once, got {held} held, {outside} outside");
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR, UnrealLiveLinkNative.ULL_SetInterestRegions(inverted, 1, 0),
+                "Regions with min above max should be rejected");
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR, UnrealLiveLinkNative.ULL_SetInterestRegions(regions, regions.Length, -1),
+                "Negative outside rates should be rejected");
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR,
+                UnrealLiveLinkNative.ULL_SetInterestRegions(null, UnrealLiveLinkNative.ULL_MAX_INTEREST_REGIONS + 1, 0),
+                "More than ULL_MAX_INTEREST_REGIONS regions should be rejected");
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK,
+                UnrealLiveLinkNative.ULL_SetInterestRegions(null, 0, UnrealLiveLinkNative.ULL_INTEREST_SUPPRESS),
+                "Clearing the regions should succeed");
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR, UnrealLiveLinkNative.ULL_SessionSetInterestRegions(-5, null, 0, 0),
+                "Unknown sessions should be rejected");
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("InterestRegions")]
+        public void SetInterestRegions_MoveIntoExistingCell_ShouldUseNewCoverage()
+        {
+            // Arrange - Initialize first. "Held" sits in a 50 m grid cell outside the first region,
+            // so that cell exists (with a held frame) when the regions change
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            int held = UnrealLiveLinkNative.ULL_RegisterObjectH("InterestHeldObject");
+            int mover = UnrealLiveLinkNative.ULL_RegisterObjectH("InterestMovingObject");
+            var aroundOrigin = new[] { ULL_InterestRegion.AroundPoint(0.0, 0.0, 0.0, 5000.0) };
+            var aroundHeld = new[] { ULL_InterestRegion.AroundPoint(92500.0, 2500.0, 2500.0, 10000.0) };
+
+            try
+            {
+                UnrealLiveLinkNative.ULL_SetInterestRegions(aroundOrigin, 1, UnrealLiveLinkNative.ULL_INTEREST_SUPPRESS);
+                ULL_Transform heldTransform = ULL_Transform.Create(92500.0, 2500.0, 2500.0, 0.0, 0.0, 0.0, 1.0);
+                ULL_Transform moverTransform = ULL_Transform.Create(1000.0, 1000.0, 1000.0, 0.0, 0.0, 0.0, 1.0);
+                UnrealLiveLinkNative.ULL_UpdateObjectH(held, ref heldTransform);
+                UnrealLiveLinkNative.ULL_UpdateObjectH(mover, ref moverTransform);
+
+                // Act - the new region covers the held subject's cell, then the mover enters that cell
+                UnrealLiveLinkNative.ULL_SetInterestRegions(aroundHeld, 1, UnrealLiveLinkNative.ULL_INTEREST_SUPPRESS);
+                UnrealLiveLinkNative.ULL_GetInterestCounters(out ulong heldBefore, out _, out _);
+                UnrealLiveLinkNative.ULL_GetStats(out ULL_Stats statsBefore);
+                moverTransform = ULL_Transform.Create(93000.0, 3000.0, 3000.0, 0.0, 0.0, 0.0, 1.0);
+                UnrealLiveLinkNative.ULL_UpdateObjectH(mover, ref moverTransform);
+                UnrealLiveLinkNative.ULL_GetInterestCounters(out ulong heldAfter, out _, out int cells);
+                UnrealLiveLinkNative.ULL_GetStats(out ULL_Stats statsAfter);
+
+                // Assert
+                Assert.IsTrue(held >= 0 && mover >= 0, "Both subjects should register");
+                Assert.IsTrue(heldBefore >= 1, $"The subject outside the first region should have been held, got {heldBefore}");
+                Assert.AreEqual(heldBefore, heldAfter, "A subject entering a cell the new regions cover should not be held");
+                Assert.AreEqual(statsBefore.transformUpdatesSent + 1, statsAfter.transformUpdatesSent,
+                    "The update inside the new region should be sent at once");
+                Assert.AreEqual(1, cells, "Both subjects should share the held subject's cell");
+            }
+            finally
+            {
+                UnrealLiveLinkNative.ULL_SetInterestRegions(null, 0, UnrealLiveLinkNative.ULL_INTEREST_SUPPRESS);
+                UnrealLiveLinkNative.ULL_RemoveObjectH(held);
+                UnrealLiveLinkNative.ULL_RemoveObjectH(mover);
+            }
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("LatencyProbe")]
+        public void LatencyProbe_ShouldStampStagesAndWriteCsv()
+        {
+            // Arrange - Initialize first. RunIntegrationTests.ps1 -LatencyCsv keeps the CSV
+            // (and listens for the Unreal-side echo) so latency can be compared across releases
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            string? keptCsvPath = Environment.GetEnvironmentVariable("ULL_LATENCY_CSV");
+            bool keepCsv = !string.IsNullOrWhiteSpace(keptCsvPath);
+            string csvPath = keepCsv ? keptCsvPath! : Path.Combine(Path.GetTempPath(), $"ull_latency_{Guid.NewGuid():N}.csv");
+            int echoPort = keepCsv ? UnrealLiveLinkNative.ULL_LATENCY_ECHO_DEFAULT_PORT : 0;
+
+            try
+            {
+                // Act
+                int startResult = UnrealLiveLinkNative.ULL_StartLatencyProbe(50, echoPort, csvPath);
+                System.Threading.Thread.Sleep(keepCsv ? 5000 : 300);
+                int statsResult = UnrealLiveLinkNative.ULL_GetLatencyStats(out ULL_LatencyStats stats);
+                int stopResult = UnrealLiveLinkNative.ULL_StopLatencyProbe();
+                Console.WriteLine($"Latency probe: {stats}");
+
+                // Assert - the mock probes nothing, so only the bounds hold for both layers
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, startResult);
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, statsResult);
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, stopResult);
+                Assert.AreEqual(ULL_LatencyStats.StageCount, stats.stages.Length);
+                Assert.IsTrue(stats.probesEchoed <= stats.probesSent, $"Echoes should not exceed probes, got {stats}");
+                Assert.IsTrue(stats.Enqueue.samples <= stats.probesSent, $"Each probe is enqueued at most once, got {stats}");
+                Assert.IsTrue(stats.Enqueue.p50Ms <= stats.Enqueue.p99Ms && stats.Enqueue.p99Ms <= stats.Enqueue.maxMs,
+                    $"Percentiles should be ordered, got {stats.Enqueue}");
+                Assert.IsTrue(File.Exists(csvPath), "CSV file should be created");
+                StringAssert.StartsWith(File.ReadLines(csvPath).First(), "seconds,probesSent,probesEchoed,enqueueSamples");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, UnrealLiveLinkNative.ULL_StopLatencyProbe(),
+                    "Stopping twice should succeed");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR, UnrealLiveLinkNative.ULL_StartLatencyProbe(0, 0, null),
+                    "A rate of 0 should be rejected");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR,
+                    UnrealLiveLinkNative.ULL_StartLatencyProbe(UnrealLiveLinkNative.ULL_LATENCY_MAX_RATE_HZ + 1, 0, null),
+                    "Rates above ULL_LATENCY_MAX_RATE_HZ should be rejected");
+                Assert.AreEqual(UnrealLiveLinkNative.ULL_ERROR, UnrealLiveLinkNative.ULL_StartLatencyProbe(10, 70000, null),
+                    "Ports above 65535 should be rejected");
+            }
+            finally
+            {
+                UnrealLiveLinkNative.ULL_StopLatencyProbe();
+                if (!keepCsv && File.Exists(csvPath))
+                {
+                    File.Delete(csvPath);
+                }
+            }
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("TransformSubjects")]
+        [TestCategory("Handles")]
+        [TestCategory("ErrorHandling")]
+        public void RegisterObjectH_WithNullName_ShouldReturnInvalidHandle()
+        {
+            // Arrange - Initialize first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            
+            // Act
+            int handle = UnrealLiveLinkNative.ULL_RegisterObjectH(null!);
+            
+            // Assert
+            Assert.IsTrue(handle < 0, $"NULL name should return a negative handle, got {handle}");
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("TransformSubjects")]
+        [TestCategory("Coordinates")]
+        public void ConvertSimioTransforms_ShouldMatchCoordinateConverter()
+        {
+            // Arrange - random poses plus edge cases, as a 9-column Simio value block
+            const int count = 257;
+            var random = new Random(1234);
+            var values = new double[count * UnrealLiveLinkNative.ULL_SIMIO_TRANSFORM_COMPONENTS];
+            for (int i = 0; i < values.Length; i++)
+            {
+                values[i] = (random.NextDouble() - 0.5) * 1440.0;
+            }
+            for (int i = 0; i < count; i++)
+            {
+                for (int c = 6; c < 9; c++)
+                {
+                    values[c * count + i] = Math.Abs(values[c * count + i]) / 100.0;
+                }
+            }
+            values[3 * count + 0] = 90.0;       // Quadrant boundaries
+            values[4 * count + 0] = 180.0;
+            values[5 * count + 0] = -270.0;
+            values[0 * count + 1] = double.NaN; // Invalid position
+            values[4 * count + 2] = double.PositiveInfinity; // Invalid rotation
+            values[7 * count + 3] = -1.0;       // Invalid scale
+
+            // Act
+            var transforms = new ULL_Transform[count];
+            int result = UnrealLiveLinkNative.ULL_ConvertSimioTransforms(
+                values, UnrealLiveLinkNative.ULL_SIMIO_TRANSFORM_COMPONENTS, count, transforms);
+
+            // Assert
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_OK, result);
+            for (int i = 0; i < count; i++)
+            {
+                var expected = CoordinateConverter.SimioToUnrealTransform(
+                    values[i], values[count + i], values[2 * count + i],
+                    values[3 * count + i], values[4 * count + i], values[5 * count + i],
+                    values[6 * count + i], values[7 * count + i], values[8 * count + i]);
+
+                for (int k = 0; k < 3; k++)
+                {
+                    Assert.AreEqual(expected.position[k], transforms[i].position[k], 1e-9, $"position[{k}] of object {i}");
+                    Assert.AreEqual(expected.scale[k], transforms[i].scale[k], 1e-12, $"scale[{k}] of object {i}");
+                }
+                for (int k = 0; k < 4; k++)
+                {
+                    Assert.AreEqual(expected.rotation[k], transforms[i].rotation[k], 1e-12, $"rotation[{k}] of object {i}");
+                }
+            }
+        }
+
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("TransformSubjects")]
+        [TestCategory("Handles")]
+        public void UpdateObjectsBatchSimioH_WithPoseBlock_ShouldNotThrow()
+        {
+            // Arrange
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            int[] handles =
+            {
+                UnrealLiveLinkNative.ULL_RegisterObjectH("SimioBatchA"),
+                UnrealLiveLinkNative.ULL_RegisterObjectH("SimioBatchB")
+            };
+            double[] pose = { 1.0, 2.0, 0.5, 0.0, 3.0, 0.0, 90.0, 45.0, 0.0, 0.0, 10.0, -10.0 };
+
+            // Act & Assert - should not throw
+            UnrealLiveLinkNative.ULL_UpdateObjectsBatchSimioH(
+                handles, pose, UnrealLiveLinkNative.ULL_SIMIO_POSE_COMPONENTS, null, 0, handles.Length);
+
+            UnrealLiveLinkNative.ULL_RemoveObjectH(handles[0]);
+            UnrealLiveLinkNative.ULL_RemoveObjectH(handles[1]);
+        }
+
         #endregion
 
         #region 4. Data Subject Operation Tests
@@ -384,6 +1604,29 @@ namespace SimioUnrealEngineLiveLinkConnector.Integration.Tests
             UnrealLiveLinkNative.ULL_UpdateDataSubject("DataSubject_002", propertyNames, propertyValues, propertyValues.Length);
         }
 
+        [TestMethod]
+        [TestCategory("Integration")]
+        [TestCategory("DataSubjects")]
+        public void UpdateDataSubjectsBatch_WithValidData_ShouldNotThrow()
+        {
+            // Arrange - Initialize and register first
+            UnrealLiveLinkNative.ULL_Initialize(_testProviderName ?? "TestProvider");
+            _isInitialized = true;
+            
+            string[] subjectNames = new string[] { "DataSubject_Batch_A", "DataSubject_Batch_B" };
+            string[] propertyNames = new string[] { "Throughput", "WIP" };
+            foreach (string subjectName in subjectNames)
+            {
+                UnrealLiveLinkNative.ULL_RegisterDataSubject(subjectName, propertyNames, propertyNames.Length);
+            }
+            
+            float[] propertyValues = new float[] { 10.0f, 2.0f, 12.5f, 3.0f };
+            
+            // Act & Assert - Should not throw
+            UnrealLiveLinkNative.ULL_UpdateDataSubjectsBatch(
+                subjectNames, propertyValues, propertyNames.Length, subjectNames.Length);
+        }
+
         [TestMethod]
         [TestCategory("Integration")]
         [TestCategory("DataSubjects")]
@@ -98,6 +98,56 @@ namespace SimioUnrealEngineLiveLinkConnector.Unit.Tests
             Assert.IsTrue(result.Contains("3.50"), "ToString should include position Z");
             Assert.IsTrue(result.Contains("1.000"), "ToString should include quaternion W");
         }
+
+        [TestMethod]
+        public void ULL_TransformData_StructSize_ShouldMatchNative()
+        {
+            // Same 10-double layout as ULL_Transform; blittable, so no marshaling copy
+            Assert.AreEqual(Marshal.SizeOf<ULL_Transform>(), Marshal.SizeOf<ULL_TransformData>());
+        }
+
+        [TestMethod]
+        public void ULL_CompactTransform_StructSize_ShouldMatchNative()
+        {
+            // 3 floats + 3 rotation ushorts + flags = 20 bytes
+            Assert.AreEqual(20, Marshal.SizeOf<ULL_CompactTransform>());
+        }
+
+        [TestMethod]
+        public void ULL_CompactTransform_RoundTrip_ShouldPreserveRotation()
+        {
+            double[] q = CoordinateConverter.EulerToQuaternion(30.0, -75.0, 160.0);
+            var source = ULL_Transform.Create(10.5, -20.25, 300.0, q[0], q[1], q[2], q[3], 2.0, 1.0, 1.0);
+
+            foreach (bool rotation32 in new[] { false, true })
+            {
+                var compact = ULL_CompactTransform.FromTransform(source, rotation32);
+                Assert.IsTrue(compact.HasScale, "Non-unit scale should set HasScale");
+
+                var decoded = compact.ToTransform(2.0, 1.0, 1.0);
+                Assert.AreEqual(10.5, decoded.position[0], 1e-4);
+                Assert.AreEqual(-20.25, decoded.position[1], 1e-4);
+                Assert.AreEqual(300.0, decoded.position[2], 1e-4);
+                Assert.AreEqual(2.0, decoded.scale[0], 1e-12);
+
+                // |dot| near 1 means the same rotation (q and -q are equivalent)
+                double dot = 0.0;
+                for (int i = 0; i < 4; i++)
+                {
+                    dot += q[i] * decoded.rotation[i];
+                }
+                Assert.AreEqual(1.0, Math.Abs(dot), rotation32 ? 1e-5 : 1e-8,
+                    $"Rotation not preserved (rotation32={rotation32})");
+            }
+        }
+
+        [TestMethod]
+        public void ULL_CompactTransform_UnitScale_ShouldNotSetHasScale()
+        {
+            var compact = ULL_CompactTransform.FromTransform(ULL_Transform.Identity());
+            Assert.IsFalse(compact.HasScale);
+            Assert.AreEqual(3, compact.flags & UnrealLiveLinkNative.ULL_COMPACT_LARGEST_MASK, "W should be the dropped component");
+        }
     }
 
     [TestClass]
@@ -238,6 +288,30 @@ namespace SimioUnrealEngineLiveLinkConnector.Unit.Tests
             Assert.AreEqual(2.0, transform.scale[2], TOLERANCE, "Z scale (remapped)");
         }
 
+        [TestMethod]
+        public void SimioToUnrealTransform_RefOverload_ShouldMatchArrayOverload()
+        {
+            var expected = CoordinateConverter.SimioToUnrealTransform(1.5, -2.0, 3.25, 30.0, 45.0, -60.0, 2.0, 3.0, 4.0);
+
+            var buffer = new ULL_TransformData[2];
+            CoordinateConverter.SimioToUnrealTransform(ref buffer[1], 1.5, -2.0, 3.25, 30.0, 45.0, -60.0, 2.0, 3.0, 4.0);
+            var actual = buffer[1].ToTransform();
+
+            for (int i = 0; i < 3; i++)
+            {
+                Assert.AreEqual(expected.position[i], actual.position[i], TOLERANCE, $"position[{i}]");
+                Assert.AreEqual(expected.scale[i], actual.scale[i], TOLERANCE, $"scale[{i}]");
+            }
+            for (int i = 0; i < 4; i++)
+            {
+                Assert.AreEqual(expected.rotation[i], actual.rotation[i], TOLERANCE, $"rotation[{i}]");
+            }
+
+            // Invalid input falls back to the same defaults, overwriting previous contents
+            CoordinateConverter.SimioToUnrealTransform(ref buffer[1], double.NaN, 0.0, 0.0, double.NaN, 0.0, 0.0, -1.0, 1.0, 1.0);
+            Assert.AreEqual(ULL_TransformData.Identity, buffer[1]);
+        }
+
         [TestMethod]
         public void IsQuaternionNormalized_ValidQuaternion_ShouldReturnTrue()
         {
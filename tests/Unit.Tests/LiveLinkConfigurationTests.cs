@@ -83,5 +83,225 @@ namespace SimioUnrealEngineLiveLinkConnector.Unit.Tests
             Assert.IsNotNull(errors);
             Assert.AreEqual(0, errors.Length);
         }
+    
+
+        [TestMethod]
+        public void LiveLinkConfiguration_Constructor_ShouldDefaultToSynchronousSend()
+        {
+            var config = new LiveLinkConfiguration();
+            Assert.AreEqual(LiveLinkSendMode.Synchronous, config.SendMode);
+            Assert.AreEqual(LiveLinkConfiguration.DefaultQueueDepth, config.QueueDepth);
+            Assert.AreEqual(LiveLinkQueuePolicy.DropOldest, config.QueuePolicy);
+        }
+
+        [TestMethod]
+        public void LiveLinkConfiguration_Validate_AsyncWithQueueDepthOutOfRange_ShouldReturnError()
+        {
+            var config = new LiveLinkConfiguration {
+                SourceName = "TestSource",
+                SendMode = LiveLinkSendMode.Asynchronous,
+                QueueDepth = 1
+            };
+            var errors = config.Validate();
+            Assert.AreEqual(1, errors.Length);
+            Assert.IsTrue(errors[0].Contains("Queue Depth"));
+        }
+
+        [TestMethod]
+        public void ULL_InitOptions_Create_ShouldMatchNativeLayout()
+        {
+            var options = ULL_InitOptions.Create(LiveLinkSendMode.Asynchronous, 1024, LiveLinkQueuePolicy.Block, 60);
+            // Native ULL_InitOptions is 80 bytes (static_assert in UnrealLiveLink.Types.h)
+            Assert.AreEqual(80, options.structSize);
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_TRANSPORT_MESSAGE_BUS, options.transport);
+            Assert.AreEqual(0, options.deadbandEnabled);
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_SEND_MODE_ASYNC, options.sendMode);
+            Assert.AreEqual(1024, options.queueDepth);
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_QUEUE_POLICY_BLOCK, options.queuePolicy);
+            Assert.AreEqual(60, options.publishRateHz);
+        }
+
+        [TestMethod]
+        public void LiveLinkConfiguration_PublishRate_ShouldRequireInitOptions()
+        {
+            var config = new LiveLinkConfiguration { SourceName = "TestSource" };
+            Assert.IsFalse(config.RequiresInitOptions);
+
+            config.PublishRateHz = 60;
+            Assert.IsTrue(config.RequiresInitOptions);
+            Assert.AreEqual(0, config.Validate().Length);
+
+            config.PublishRateHz = -1;
+            Assert.IsTrue(config.Validate()[0].Contains("Publish Rate"));
+        }
+
+        [TestMethod]
+        public void LiveLinkConfiguration_Deadband_ShouldValidateAndMapToInitOptions()
+        {
+            var config = new LiveLinkConfiguration {
+                SourceName = "TestSource",
+                EnableDeadband = true,
+                PositionDeadband = 0.5,
+                RotationDeadbandDegrees = 1.0,
+                KeepAliveIntervalMs = 250
+            };
+            Assert.IsTrue(config.RequiresInitOptions);
+            Assert.AreEqual(0, config.Validate().Length);
+
+            var options = ULL_InitOptions.FromConfiguration(config);
+            Assert.AreEqual(1, options.deadbandEnabled);
+            Assert.AreEqual(0.5f, options.positionDeadband);
+            Assert.AreEqual(1.0f, options.rotationDeadbandDegrees);
+            Assert.AreEqual(250, options.keepAliveIntervalMs);
+
+            config.PositionDeadband = -1.0;
+            Assert.IsTrue(config.Validate()[0].Contains("Deadband"));
+        }
+
+        [TestMethod]
+        public void LiveLinkConfiguration_PumpRate_ZeroShouldDisableNativePump()
+        {
+            var config = new LiveLinkConfiguration { SourceName = "TestSource" };
+            Assert.AreEqual(LiveLinkConfiguration.DefaultMessageBusPumpRateHz, config.MessageBusPumpRateHz);
+            Assert.IsFalse(config.RequiresInitOptions);
+
+            config.MessageBusPumpRateHz = 0;
+            Assert.IsTrue(config.RequiresInitOptions);
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_PUMP_DISABLED, ULL_InitOptions.FromConfiguration(config).pumpRateHz);
+        }
+
+        [TestMethod]
+        public void LiveLinkConfiguration_SharedMemory_ShouldValidateAndMapToInitOptions()
+        {
+            var config = new LiveLinkConfiguration {
+                SourceName = "TestSource",
+                Transport = LiveLinkTransport.SharedMemory,
+                SharedMemoryCapacity = 2048,
+                SharedMemoryMaxProperties = 4
+            };
+            Assert.IsTrue(config.RequiresInitOptions);
+            Assert.AreEqual(0, config.Validate().Length);
+
+            var options = ULL_InitOptions.FromConfiguration(config);
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_TRANSPORT_SHARED_MEMORY, options.transport);
+            Assert.AreEqual(2048, options.sharedMemoryCapacity);
+            Assert.AreEqual(4, options.sharedMemoryMaxProperties);
+
+            config.SharedMemoryCapacity = 0;
+            Assert.IsTrue(config.Validate()[0].Contains("Shared Memory Capacity"));
+        }
+
+        [TestMethod]
+        public void LiveLinkConfiguration_SimulationTime_ShouldValidateAndMapToInitOptions()
+        {
+            var config = new LiveLinkConfiguration {
+                SourceName = "TestSource",
+                UseSimulationTime = true,
+                SimulationTimeScale = 0.1,
+                SceneFrameRate = 30
+            };
+            Assert.IsTrue(config.RequiresInitOptions);
+            Assert.AreEqual(0, config.Validate().Length);
+
+            var options = ULL_InitOptions.FromConfiguration(config);
+            Assert.AreEqual(0.1f, options.simTimeScale, 1e-6f);
+            Assert.AreEqual(30, options.sceneFrameRate);
+
+            config.SimulationTimeScale = 0;
+            Assert.IsTrue(config.Validate()[0].Contains("Simulation Time Scale"));
+            Assert.AreEqual(1.0, config.CreateValidated().SimulationTimeScale);
+        }
+
+        [TestMethod]
+        public void LiveLinkConfiguration_SubjectPool_ShouldValidateAndMapToInitOptions()
+        {
+            var config = new LiveLinkConfiguration {
+                SourceName = "TestSource",
+                SubjectPoolSize = 256
+            };
+            Assert.IsTrue(config.RequiresInitOptions);
+            Assert.AreEqual(0, config.Validate().Length);
+            Assert.AreEqual(256, ULL_InitOptions.FromConfiguration(config).subjectPoolSize);
+
+            config.SubjectPoolSize = -1;
+            Assert.IsTrue(config.Validate()[0].Contains("Subject Pool Size"));
+            Assert.AreEqual(0, config.CreateValidated().SubjectPoolSize);
+        }
+
+        [TestMethod]
+        public void LiveLinkConfiguration_PublishBudget_ShouldRequirePublishRate()
+        {
+            var config = new LiveLinkConfiguration {
+                SourceName = "TestSource",
+                PublishFrameBudget = 2000
+            };
+            Assert.IsTrue(config.RequiresInitOptions);
+            Assert.IsTrue(config.Validate()[0].Contains("Publish Rate"));
+
+            config.PublishRateHz = 60;
+            config.PublishByteBudget = 500000;
+            Assert.AreEqual(0, config.Validate().Length);
+            var options = ULL_InitOptions.FromConfiguration(config);
+            Assert.AreEqual(2000, options.publishFrameBudget);
+            Assert.AreEqual(500000, options.publishByteBudget);
+
+            config.PublishByteBudget = -1;
+            Assert.IsTrue(config.Validate()[0].Contains("budgets"));
+            Assert.AreEqual(0, config.CreateValidated().PublishByteBudget);
+        }
+
+        [TestMethod]
+        public void LiveLinkConfiguration_AsyncInitialization_ShouldSetInitMode()
+        {
+            var config = new LiveLinkConfiguration { SourceName = "TestSource" };
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_INIT_MODE_SYNC, ULL_InitOptions.FromConfiguration(config).initMode);
+
+            config.AsyncInitialization = true;
+            Assert.IsTrue(config.RequiresInitOptions);
+            Assert.AreEqual(0, config.Validate().Length);
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_INIT_MODE_ASYNC, ULL_InitOptions.FromConfiguration(config).initMode);
+            Assert.IsTrue(config.CreateValidated().AsyncInitialization);
+            StringAssert.Contains(config.ToString(), "AsyncInit:True");
+        }
+
+        [TestMethod]
+        public void LiveLinkConfiguration_DeferredUpdates_ShouldValidateFlushRate()
+        {
+            var config = new LiveLinkConfiguration {
+                SourceName = "TestSource",
+                DeferredUpdates = true,
+                DeferredFlushRateHz = 30
+            };
+            Assert.IsFalse(config.RequiresInitOptions, "Deferred mode is managed only");
+            Assert.AreEqual(0, config.Validate().Length);
+            StringAssert.Contains(config.ToString(), "Deferred:30Hz");
+
+            config.DeferredFlushRateHz = -1;
+            Assert.IsTrue(config.Validate()[0].Contains("Deferred Flush Rate"));
+            Assert.AreEqual(0, config.CreateValidated().DeferredFlushRateHz);
+            Assert.IsTrue(config.CreateValidated().DeferredUpdates);
+        }
+
+        [TestMethod]
+        public void ULL_PumpStats_ShouldMatchNativeLayout()
+        {
+            // Native ULL_PumpStats is 48 bytes (static_assert in UnrealLiveLink.Types.h)
+            Assert.AreEqual(48, System.Runtime.InteropServices.Marshal.SizeOf(typeof(ULL_PumpStats)));
+        }
+
+        [TestMethod]
+        public void ULL_Stats_ShouldMatchNativeLayout()
+        {
+            // Native ULL_Stats is 296 bytes (static_assert in UnrealLiveLink.Types.h)
+            Assert.AreEqual(296, System.Runtime.InteropServices.Marshal.SizeOf(typeof(ULL_Stats)));
+        }
+
+        [TestMethod]
+        public void ULL_LatencyStats_ShouldMatchNativeLayout()
+        {
+            // Native ULL_LatencyStage is 40 bytes and ULL_LatencyStats 176 (static_asserts in UnrealLiveLink.Types.h)
+            Assert.AreEqual(40, System.Runtime.InteropServices.Marshal.SizeOf(typeof(ULL_LatencyStage)));
+            Assert.AreEqual(176, System.Runtime.InteropServices.Marshal.SizeOf(typeof(ULL_LatencyStats)));
+        }
     }
 }
@@ -36,6 +36,51 @@ namespace SimioUnrealEngineLiveLinkConnector.Unit.Tests
                 manager.GetOrCreateObject("TestObject"));
         }
 
+        [TestMethod]
+        public void LiveLinkManager_UpdateObjectsBatch_WithoutInitialization_ShouldThrow()
+        {
+            var manager = LiveLinkManager.Instance;
+            var transforms = new[] { ULL_Transform.Identity() };
+            
+            Assert.ThrowsException<InvalidOperationException>(() => 
+                manager.UpdateObjectsBatch(new[] { "TestObject" }, transforms));
+        }
+
+        [TestMethod]
+        public void LiveLinkManager_UpdateObjectsBatch_InvalidArrays_ShouldThrow()
+        {
+            var manager = LiveLinkManager.Instance;
+            var transforms = new[] { ULL_Transform.Identity() };
+            
+            // Argument validation happens before the initialization check
+            Assert.ThrowsException<ArgumentNullException>(() => 
+                manager.UpdateObjectsBatch(null, transforms));
+            Assert.ThrowsException<ArgumentException>(() => 
+                manager.UpdateObjectsBatch(new[] { "A", "B" }, transforms));
+            Assert.ThrowsException<ArgumentException>(() => 
+                manager.UpdateObjectsBatch(new[] { "" }, transforms));
+            Assert.ThrowsException<ArgumentException>(() => 
+                manager.UpdateObjectsBatchWithProperties(
+                    new[] { "A" }, transforms, new[] { "Speed", "Load" }, new float[] { 1.0f }));
+        }
+
+        [TestMethod]
+        public void LiveLinkManager_UpdateDataSubjectsBatch_InvalidArrays_ShouldThrow()
+        {
+            var manager = LiveLinkManager.Instance;
+            var propertyNames = new[] { "Throughput", "WIP" };
+            
+            // Argument validation happens before the initialization check
+            Assert.ThrowsException<ArgumentNullException>(() => 
+                manager.UpdateDataSubjectsBatch(null, propertyNames, new float[2]));
+            Assert.ThrowsException<ArgumentException>(() => 
+                manager.UpdateDataSubjectsBatch(new[] { "KPIs" }, propertyNames, new float[3]));
+            Assert.ThrowsException<ArgumentException>(() => 
+                manager.UpdateDataSubjectsBatch(new[] { "" }, propertyNames, new float[2]));
+            Assert.ThrowsException<InvalidOperationException>(() => 
+                manager.UpdateDataSubjectsBatch(new[] { "KPIs" }, propertyNames, new float[2]));
+        }
+
         [TestMethod]
         public void LiveLinkObjectUpdater_Constructor_ValidName_ShouldSucceed()
         {
@@ -43,6 +88,7 @@ namespace SimioUnrealEngineLiveLinkConnector.Unit.Tests
             
             Assert.AreEqual("TestObject", updater.ObjectName);
             Assert.IsFalse(updater.IsRegistered);
+            Assert.AreEqual(UnrealLiveLinkNative.ULL_INVALID_HANDLE, updater.Handle);
             Assert.IsFalse(updater.HasProperties);
             Assert.IsNull(updater.PropertyNames);
         }